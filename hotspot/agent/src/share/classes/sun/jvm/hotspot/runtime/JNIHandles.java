@@ -32,6 +32,7 @@ public class JNIHandles {
   private static AddressField      globalHandlesField;
   private static AddressField      weakGlobalHandlesField;
   private static OopField          deletedHandleField;
+  private static int               stripeCount;
 
   static {
     VM.registerVMInitializedObserver(new Observer() {
@@ -44,25 +45,32 @@ public class JNIHandles {
   private static synchronized void initialize(TypeDataBase db) {
     Type type = db.lookupType("JNIHandles");
 
-    globalHandlesField = type.getAddressField("_global_handles");
-    weakGlobalHandlesField = type.getAddressField("_weak_global_handles");
+    globalHandlesField = type.getAddressField("_global_handles[0]");
+    weakGlobalHandlesField = type.getAddressField("_weak_global_handles[0]");
     deletedHandleField = type.getOopField("_deleted_handle");
-
+    stripeCount = db.lookupIntConstant("JNIHandles::_stripe_count").intValue();
   }
 
   public JNIHandles() {
   }
 
-  public JNIHandleBlock globalHandles() {
-    Address handleAddr  = globalHandlesField.getValue();
+  // Number of independent global handle block chains
+  public int stripeCount() {
+    return stripeCount;
+  }
+
+  public JNIHandleBlock globalHandles(int stripe) {
+    Address handleAddr = globalHandlesField.getStaticFieldAddress().
+      getAddressAt(stripe * VM.getVM().getAddressSize());
     if (handleAddr == null) {
       return null;
     }
     return new JNIHandleBlock(handleAddr);
   }
 
-  public JNIHandleBlock weakGlobalHandles() {
-    Address handleAddr  = weakGlobalHandlesField.getValue();
+  public JNIHandleBlock weakGlobalHandles(int stripe) {
+    Address handleAddr = weakGlobalHandlesField.getStaticFieldAddress().
+      getAddressAt(stripe * VM.getVM().getAddressSize());
     if (handleAddr == null) {
       return null;
     }
@@ -145,7 +145,12 @@ public abstract class AbstractHeapGraphWriter implements HeapGraphWriter {
 
     protected void writeGlobalJNIHandles() throws IOException {
         JNIHandles handles = VM.getVM().getJNIHandles();
-        JNIHandleBlock blk = handles.globalHandles();
+        for (int i = 0; i < handles.stripeCount(); i++) {
+            writeGlobalJNIHandles(handles.globalHandles(i));
+        }
+    }
+
+    private void writeGlobalJNIHandles(JNIHandleBlock blk) throws IOException {
         if (blk != null) {
             try {
                 blk.oopsDo(new AddressVisitor() {
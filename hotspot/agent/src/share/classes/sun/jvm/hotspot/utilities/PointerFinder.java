@@ -108,34 +108,39 @@ public class PointerFinder {
 
     // Check JNIHandles; both local and global
     JNIHandles handles = VM.getVM().getJNIHandles();
-    JNIHandleBlock handleBlock = handles.globalHandles();
-    if (handleBlock != null) {
-      handleBlock = handleBlock.blockContainingHandle(a);
+    JNIHandleBlock handleBlock = null;
+    for (int i = 0; i < handles.stripeCount() && handleBlock == null; i++) {
+      handleBlock = handles.globalHandles(i);
+      if (handleBlock != null) {
+        handleBlock = handleBlock.blockContainingHandle(a);
+      }
     }
     if (handleBlock != null) {
       loc.inStrongGlobalJNIHandleBlock = true;
       loc.handleBlock = handleBlock;
       return loc;
     } else {
-      handleBlock = handles.weakGlobalHandles();
-      if (handleBlock != null) {
-        handleBlock = handleBlock.blockContainingHandle(a);
+      for (int i = 0; i < handles.stripeCount() && handleBlock == null; i++) {
+        handleBlock = handles.weakGlobalHandles(i);
         if (handleBlock != null) {
-          loc.inWeakGlobalJNIHandleBlock = true;
-          loc.handleBlock = handleBlock;
-          return loc;
-        } else {
-          // Look in thread-local handles
-          for (JavaThread t = VM.getVM().getThreads().first(); t != null; t = t.next()) {
-            handleBlock = t.activeHandles();
+          handleBlock = handleBlock.blockContainingHandle(a);
+        }
+      }
+      if (handleBlock != null) {
+        loc.inWeakGlobalJNIHandleBlock = true;
+        loc.handleBlock = handleBlock;
+        return loc;
+      } else {
+        // Look in thread-local handles
+        for (JavaThread t = VM.getVM().getThreads().first(); t != null; t = t.next()) {
+          handleBlock = t.activeHandles();
+          if (handleBlock != null) {
+            handleBlock = handleBlock.blockContainingHandle(a);
             if (handleBlock != null) {
-              handleBlock = handleBlock.blockContainingHandle(a);
-              if (handleBlock != null) {
-                loc.inLocalJNIHandleBlock = true;
-                loc.handleBlock = handleBlock;
-                loc.handleThread = t;
-                return loc;
-              }
+              loc.inLocalJNIHandleBlock = true;
+              loc.handleBlock = handleBlock;
+              loc.handleThread = t;
+              return loc;
             }
           }
         }
@@ -105,12 +105,14 @@ public class ReversePtrsAnalysis {
                        new RootVisitor("JNI handle root" + threadDesc));
     }
 
-    // Do global JNI handles
+    // Do global JNI handles, one block chain per stripe
     JNIHandles handles = VM.getVM().getJNIHandles();
-    doJNIHandleBlock(handles.globalHandles(),
-                     new RootVisitor("Global JNI handle root"));
-    doJNIHandleBlock(handles.weakGlobalHandles(),
-                     new RootVisitor("Weak global JNI handle root"));
+    for (int i = 0; i < handles.stripeCount(); i++) {
+      doJNIHandleBlock(handles.globalHandles(i),
+                       new RootVisitor("Global JNI handle root"));
+      doJNIHandleBlock(handles.weakGlobalHandles(i),
+                       new RootVisitor("Weak global JNI handle root"));
+    }
 
     // Do Java-level static fields
     SystemDictionary sysDict = VM.getVM().getSystemDictionary();
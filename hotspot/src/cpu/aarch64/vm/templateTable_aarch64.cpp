@@ -555,10 +555,18 @@ void TemplateTable::iload()
     __ cmpw(r1, Bytecodes::_iload);
     __ br(Assembler::EQ, done);
 
-    // if _fast_iload rewrite to _fast_iload2
+    // if _fast_iload, the pair is complete; rewrite to _fast_iiadd if
+    // the pair feeds an iadd, otherwise to _fast_iload2
+    Label not_iload_pair;
     __ cmpw(r1, Bytecodes::_fast_iload);
-    __ movw(bc, Bytecodes::_fast_iload2);
+    __ br(Assembler::NE, not_iload_pair);
+    __ load_unsigned_byte(r1, at_bcp(2 * Bytecodes::length_for(Bytecodes::_iload)));
+    __ cmpw(r1, Bytecodes::_iadd);
+    __ movw(bc, Bytecodes::_fast_iiadd);
     __ br(Assembler::EQ, rewrite);
+    __ movw(bc, Bytecodes::_fast_iload2);
+    __ b(rewrite);
+    __ bind(not_iload_pair);
 
     // if _caload rewrite to _fast_icaload
     __ cmpw(r1, Bytecodes::_caload);
@@ -592,6 +600,16 @@ void TemplateTable::fast_iload2()
   __ ldr(r0, iaddress(r1));
 }
 
+void TemplateTable::fast_iiadd()
+{
+  transition(vtos, itos);
+  locals_index(r1);
+  __ ldr(r0, iaddress(r1));
+  locals_index(r1, 3);
+  __ ldr(r1, iaddress(r1));
+  __ addw(r0, r0, r1);
+}
+
 void TemplateTable::fast_iload()
 {
   transition(vtos, itos);
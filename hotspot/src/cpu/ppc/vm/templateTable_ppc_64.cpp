@@ -463,9 +463,19 @@ void TemplateTable::iload() {
     __ cmpwi(CCR0, Rnext_byte, (unsigned int)(unsigned char)Bytecodes::_iload);
     __ beq(CCR0, Ldone);
 
+    // if _fast_iload, the pair is complete; rewrite to _fast_iiadd if
+    // the pair feeds an iadd, otherwise to _fast_iload2
+    Label Lnot_iload_pair;
     __ cmpwi(CCR1, Rnext_byte, (unsigned int)(unsigned char)Bytecodes::_fast_iload);
-    __ li(Rrewrite_to, (unsigned int)(unsigned char)Bytecodes::_fast_iload2);
+    __ bne(CCR1, Lnot_iload_pair);
+
+    __ lbz(Rnext_byte, 2 * Bytecodes::length_for(Bytecodes::_iload), R14_bcp);
+    __ cmpwi(CCR1, Rnext_byte, (unsigned int)(unsigned char)Bytecodes::_iadd);
+    __ li(Rrewrite_to, (unsigned int)(unsigned char)Bytecodes::_fast_iiadd);
     __ beq(CCR1, Lrewrite);
+    __ li(Rrewrite_to, (unsigned int)(unsigned char)Bytecodes::_fast_iload2);
+    __ b(Lrewrite);
+    __ bind(Lnot_iload_pair);
 
     __ cmpwi(CCR0, Rnext_byte, (unsigned int)(unsigned char)Bytecodes::_caload);
     __ li(Rrewrite_to, (unsigned int)(unsigned char)Bytecodes::_fast_icaload);
@@ -493,6 +503,18 @@ void TemplateTable::fast_iload2() {
   __ push_i(R3_ARG1);
 }
 
+// Load 2 integers in a row and add them without dispatching.
+void TemplateTable::fast_iiadd() {
+  transition(vtos, itos);
+
+  __ lbz(R3_ARG1, 1, R14_bcp);
+  __ lbz(R17_tos, Bytecodes::length_for(Bytecodes::_iload) + 1, R14_bcp);
+
+  __ load_local_int(R3_ARG1, R11_scratch1, R3_ARG1);
+  __ load_local_int(R17_tos, R12_scratch2, R17_tos);
+  __ add(R17_tos, R3_ARG1, R17_tos);
+}
+
 void TemplateTable::fast_iload() {
   transition(vtos, itos);
   // Get the local value into tos
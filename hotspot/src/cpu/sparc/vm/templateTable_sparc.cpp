@@ -459,9 +459,20 @@ void TemplateTable::iload() {
     // an iload pair.
     __ cmp_and_br_short(G3_scratch, (int)Bytecodes::_iload, Assembler::equal, Assembler::pn, done);
 
+    // if _fast_iload, the pair is complete; rewrite to _fast_iiadd if
+    // the pair feeds an iadd, otherwise to _fast_iload2
+    Label not_iload_pair;
     __ cmp(G3_scratch, (int)Bytecodes::_fast_iload);
+    __ br(Assembler::notEqual, false, Assembler::pt, not_iload_pair);
+    __ delayed()->nop();
+
+    __ ldub(at_bcp(2 * Bytecodes::length_for(Bytecodes::_iload)), G3_scratch);
+    __ cmp(G3_scratch, (int)Bytecodes::_iadd);
     __ br(Assembler::equal, false, Assembler::pn, rewrite);
+    __ delayed()->set(Bytecodes::_fast_iiadd, G4_scratch);
+    __ ba(rewrite);
     __ delayed()->set(Bytecodes::_fast_iload2, G4_scratch);
+    __ bind(not_iload_pair);
 
     __ cmp(G3_scratch, (int)Bytecodes::_caload);
     __ br(Assembler::equal, false, Assembler::pn, rewrite);
@@ -489,6 +500,15 @@ void TemplateTable::fast_iload2() {
   __ access_local_int( G3_scratch, Otos_i );
 }
 
+void TemplateTable::fast_iiadd() {
+  transition(vtos, itos);
+  locals_index(G3_scratch);
+  __ access_local_int( G3_scratch, Otos_i );
+  locals_index(G3_scratch, 3);  // get next bytecode's local index.
+  __ access_local_int( G3_scratch, G4_scratch );
+  __ add(G4_scratch, Otos_i, Otos_i);
+}
+
 void TemplateTable::fast_iload() {
   transition(vtos, itos);
   locals_index(G3_scratch);
@@ -1275,7 +1275,7 @@ void LIRGenerator::do_CheckCast(CheckCast* x) {
   if (x->is_incompatible_class_change_check()) {
     assert(patching_info == NULL, "can't patch this");
     stub = new SimpleExceptionStub(Runtime1::throw_incompatible_class_change_error_id, LIR_OprFact::illegalOpr, info_for_exception);
-  } else if (x->is_invokespecial_receiver_check()) {
+  } else if (x->is_invokespecial_receiver_check() || x->is_profiled_receiver_check()) {
     assert(patching_info == NULL, "can't patch this");
     stub = new DeoptimizeStub(info_for_exception);
   } else {
@@ -1026,6 +1026,22 @@ void InterpreterMacroAssembler::update_mdp_for_ret(Register return_bci) {
 }
 
 
+// Decrement the thread-local sample countdown and branch to skip_sample
+// unless this event is due for a profile sample; the sampled path rearms
+// the countdown. The countdown lives in the JavaThread, so the hot-loop
+// write traffic stays on a thread-private cacheline instead of the
+// shared MethodData. No-op unless SampleProfileUpdates is enabled.
+void InterpreterMacroAssembler::profile_sample_check(Label& skip_sample) {
+  if (!SampleProfileUpdates) {
+    return;
+  }
+  Address countdown(r15_thread, JavaThread::profile_sample_countdown_offset());
+  decrementl(countdown);
+  jcc(Assembler::greater, skip_sample);
+  movl(countdown, (int32_t)ProfileSampleInterval);
+}
+
+
 void InterpreterMacroAssembler::profile_taken_branch(Register mdp,
                                                      Register bumped_count) {
   if (ProfileInterpreter) {
@@ -1040,11 +1056,16 @@ void InterpreterMacroAssembler::profile_taken_branch(Register mdp,
     //increment_mdp_data_at(mdp, in_bytes(JumpData::taken_offset()));
     Address data(mdp, in_bytes(JumpData::taken_offset()));
     movptr(bumped_count, data);
+    // When sampling, leave the current count in bumped_count for the
+    // caller but only write the bumped value back every Nth event.
+    Label skip_sample;
+    profile_sample_check(skip_sample);
     assert(DataLayout::counter_increment == 1,
             "flow-free idiom only works with 1");
     addptr(bumped_count, DataLayout::counter_increment);
     sbbptr(bumped_count, 0);
     movptr(data, bumped_count); // Store back out
+    bind(skip_sample);
 
     // The method data pointer needs to be updated to reflect the new target.
     update_mdp_by_offset(mdp, in_bytes(JumpData::displacement_offset()));
@@ -1060,8 +1081,12 @@ void InterpreterMacroAssembler::profile_not_taken_branch(Register mdp) {
     // If no method data exists, go to profile_continue.
     test_method_data_pointer(mdp, profile_continue);
 
-    // We are taking a branch.  Increment the not taken count.
+    // We are taking a branch.  Increment the not taken count,
+    // unless this event is not due for a profile sample.
+    Label skip_sample;
+    profile_sample_check(skip_sample);
     increment_mdp_data_at(mdp, in_bytes(BranchData::not_taken_offset()));
+    bind(skip_sample);
 
     // The method data pointer needs to be updated to correspond to
     // the next bytecode
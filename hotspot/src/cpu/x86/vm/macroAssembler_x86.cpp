@@ -6924,12 +6924,14 @@ void MacroAssembler::string_compare(Register str1, Register str2,
 // Compare char[] arrays aligned to 4 bytes or substrings.
 void MacroAssembler::char_arrays_equals(bool is_array_equ, Register ary1, Register ary2,
                                         Register limit, Register result, Register chr,
-                                        XMMRegister vec1, XMMRegister vec2) {
+                                        XMMRegister vec1, XMMRegister vec2,
+                                        BasicType elem) {
+  assert(elem == T_BYTE || elem == T_CHAR || elem == T_INT, "unsupported element type");
   ShortBranchVerifier sbv(this);
   Label TRUE_LABEL, FALSE_LABEL, DONE, COMPARE_VECTORS, COMPARE_CHAR;
 
   int length_offset  = arrayOopDesc::length_offset_in_bytes();
-  int base_offset    = arrayOopDesc::base_offset_in_bytes(T_CHAR);
+  int base_offset    = arrayOopDesc::base_offset_in_bytes(elem);
 
   // Check the input args
   cmpptr(ary1, ary2);
@@ -6958,7 +6960,30 @@ void MacroAssembler::char_arrays_equals(bool is_array_equ, Register ary1, Regist
     lea(ary2, Address(ary2, base_offset));
   }
 
-  shll(limit, 1);      // byte count != 0
+  if (elem == T_CHAR) {
+    shll(limit, 1);    // byte count != 0
+  } else if (elem == T_INT) {
+    shll(limit, 2);    // byte count != 0
+  }
+
+  if (elem == T_BYTE) {
+    // The code below assumes an even byte count (the smallest tail it
+    // handles is 2 bytes). Peel a trailing odd byte here so everything
+    // after this, including its carefully sized short branches, stays
+    // unchanged.
+    Label EVEN_COUNT;
+    testl(limit, 1);
+    jccb(Assembler::zero, EVEN_COUNT);
+    decrementl(limit);
+    load_unsigned_byte(chr, Address(ary1, limit, Address::times_1));
+    load_unsigned_byte(result, Address(ary2, limit, Address::times_1));
+    cmpl(chr, result);
+    jcc(Assembler::notEqual, FALSE_LABEL);
+    testl(limit, limit);
+    jcc(Assembler::zero, TRUE_LABEL);
+    bind(EVEN_COUNT);
+  }
+
   movl(result, limit); // copy
 
   if (UseAVX >= 2) {
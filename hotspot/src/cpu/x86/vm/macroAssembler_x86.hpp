@@ -1211,10 +1211,12 @@ public:
                       Register cnt1, Register cnt2, Register result,
                       XMMRegister vec1);
 
-  // Compare char[] arrays.
+  // Compare primitive arrays; elem selects the element width (byte, char
+  // or int -- equality only cares about the total number of bytes).
   void char_arrays_equals(bool is_array_equ, Register ary1, Register ary2,
                           Register limit, Register result, Register chr,
-                          XMMRegister vec1, XMMRegister vec2);
+                          XMMRegister vec1, XMMRegister vec2,
+                          BasicType elem = T_CHAR);
 
   // Fill primitive arrays
   void generate_fill(BasicType t, bool aligned,
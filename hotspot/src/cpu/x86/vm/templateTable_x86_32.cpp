@@ -526,9 +526,18 @@ void TemplateTable::iload() {
     __ cmpl(rbx, Bytecodes::_iload);
     __ jcc(Assembler::equal, done);
 
+    // if _fast_iload, the pair is complete; rewrite to _fast_iiadd if
+    // the pair feeds an iadd, otherwise to _fast_iload2
+    Label not_iload_pair;
     __ cmpl(rbx, Bytecodes::_fast_iload);
-    __ movl(rcx, Bytecodes::_fast_iload2);
+    __ jccb(Assembler::notEqual, not_iload_pair);
+    __ load_unsigned_byte(rbx, at_bcp(2 * Bytecodes::length_for(Bytecodes::_iload)));
+    __ cmpl(rbx, Bytecodes::_iadd);
+    __ movl(rcx, Bytecodes::_fast_iiadd);
     __ jccb(Assembler::equal, rewrite);
+    __ movl(rcx, Bytecodes::_fast_iload2);
+    __ jmpb(rewrite);
+    __ bind(not_iload_pair);
 
     // if _caload, rewrite to fast_icaload
     __ cmpl(rbx, Bytecodes::_caload);
@@ -560,6 +569,14 @@ void TemplateTable::fast_iload2() {
   __ movl(rax, iaddress(rbx));
 }
 
+void TemplateTable::fast_iiadd() {
+  transition(vtos, itos);
+  locals_index(rbx);
+  __ movl(rax, iaddress(rbx));
+  locals_index(rbx, 3);
+  __ addl(rax, iaddress(rbx));
+}
+
 void TemplateTable::fast_iload() {
   transition(vtos, itos);
   locals_index(rbx);
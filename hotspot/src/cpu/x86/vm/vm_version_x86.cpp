@@ -495,8 +495,8 @@ void VM_Version::get_processor_features() {
     _cpuFeatures &= ~CPU_HT;
   }
 
-  char buf[256];
-  jio_snprintf(buf, sizeof(buf), "(%u cores per cpu, %u threads per core) family %d model %d stepping %d%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s",
+  char buf[512];
+  jio_snprintf(buf, sizeof(buf), "(%u cores per cpu, %u threads per core) family %d model %d stepping %d%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s",
                cores_per_cpu(), threads_per_core(),
                cpu_family(), _model, _stepping,
                (supports_cmov() ? ", cmov" : ""),
@@ -526,7 +526,12 @@ void VM_Version::get_processor_features() {
                (supports_tscinv() ? ", tscinv": ""),
                (supports_bmi1() ? ", bmi1" : ""),
                (supports_bmi2() ? ", bmi2" : ""),
-               (supports_adx() ? ", adx" : ""));
+               (supports_adx() ? ", adx" : ""),
+               (supports_avx512f()  ? ", avx512f"  : ""),
+               (supports_avx512dq() ? ", avx512dq" : ""),
+               (supports_avx512cd() ? ", avx512cd" : ""),
+               (supports_avx512bw() ? ", avx512bw" : ""),
+               (supports_avx512vl() ? ", avx512vl" : ""));
   _features_str = strdup(buf);
 
   // UseSSE is set to the smaller of what hardware supports and what
@@ -543,7 +548,14 @@ void VM_Version::get_processor_features() {
   if (!supports_sse ()) // Drop to 0 if no SSE  support
     UseSSE = 0;
 
-  if (UseAVX > 2) UseAVX=2;
+  if (UseAVX > 2) {
+    if (!FLAG_IS_DEFAULT(UseAVX)) {
+      // AVX-512 hardware is detected and reported, but this backend has no
+      // EVEX encoder, so code generation is capped at 256-bit vectors.
+      warning("UseAVX=%d is not supported by this VM, using UseAVX=2", (int) UseAVX);
+    }
+    UseAVX = 2;
+  }
   if (UseAVX < 0) UseAVX=0;
   if (!supports_avx2()) // Drop to 1 if no AVX2 support
     UseAVX = MIN2((intx)1,UseAVX);
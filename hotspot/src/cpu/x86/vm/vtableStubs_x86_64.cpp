@@ -163,14 +163,27 @@ VtableStub* VtableStubs::create_itable_stub(int itable_index) {
   Label L_no_such_interface;
 
   const Register icholder_reg = rax;
-  __ movptr(resolved_klass_reg, Address(icholder_reg, CompiledICHolder::holder_klass_offset()));
-  __ movptr(holder_klass_reg,   Address(icholder_reg, CompiledICHolder::holder_metadata_offset()));
 
   // get receiver klass (also an implicit null-check)
   assert(VtableStub::receiver_location() == j_rarg0->as_VMReg(), "receiver expected in j_rarg0");
   address npe_addr = __ pc();
   __ load_klass(recv_klass_reg, j_rarg0);
 
+  if (MegamorphicReceiverPrediction) {
+    // Compare the receiver klass against the one recorded in the
+    // CompiledICHolder at the megamorphic transition and dispatch
+    // directly on a hit, skipping both itable scans.
+    Label L_mispredict;
+    __ cmpptr(recv_klass_reg, Address(icholder_reg, CompiledICHolder::cached_receiver_klass_offset()));
+    __ jcc(Assembler::notEqual, L_mispredict);
+    __ movptr(rbx, Address(icholder_reg, CompiledICHolder::cached_method_offset()));
+    __ jmp(Address(rbx, Method::from_compiled_offset()));
+    __ bind(L_mispredict);
+  }
+
+  __ movptr(resolved_klass_reg, Address(icholder_reg, CompiledICHolder::holder_klass_offset()));
+  __ movptr(holder_klass_reg,   Address(icholder_reg, CompiledICHolder::holder_metadata_offset()));
+
   // Receiver subtype check against REFC.
   // Destroys recv_klass_reg value.
   __ lookup_interface_method(// inputs: rec. class, interface
@@ -242,6 +255,7 @@ int VtableStub::pd_code_size_limit(bool is_vtable_stub) {
   } else {
     // Itable stub size
     return (DebugVtables ? 512 : 140) + (CountCompiledCalls ? 13 : 0) +
+           (MegamorphicReceiverPrediction ? 32 : 0) +
            (UseCompressedClassPointers ? 2 * MacroAssembler::instr_size_for_decode_klass_not_null() : 0);
   }
   // In order to tune these parameters, run the JVM with VM options
@@ -2238,6 +2238,10 @@ void os::numa_make_global(char *addr, size_t bytes) {
 void os::numa_make_local(char *addr, size_t bytes, int lgrp_hint) {
 }
 
+bool os::numa_bind_thread_to_node(int node) {
+  return false;
+}
+
 bool os::numa_topology_changed() {
   return false;
 }
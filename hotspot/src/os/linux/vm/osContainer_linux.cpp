@@ -137,6 +137,9 @@ CgroupMemorySubsystem* memory = NULL;
 CgroupSubsystem* cpuset = NULL;
 CgroupSubsystem* cpu = NULL;
 CgroupSubsystem* cpuacct = NULL;
+/* cgroup v2 unified hierarchy: all controllers are reached through
+ * a single cgroup2 mount point. Non-NULL iff the v2 readers are used. */
+CgroupSubsystem* unified = NULL;
 
 typedef char * cptr;
 
@@ -331,6 +334,16 @@ void OSContainer::init() {
     char *token;
 
     // mountinfo format is documented at https://www.kernel.org/doc/Documentation/filesystems/proc.txt
+
+    // Check for a cgroup v2 (unified hierarchy) mount point first; the
+    // v1 pattern below would otherwise match the "cgroup2" fstype too.
+    if (sscanf(p, "%*d %*d %*d:%*d %s %s %*[^-]- cgroup2 %*s %*s", tmproot, tmpmount) == 2) {
+      if (unified == NULL) {
+        unified = new CgroupSubsystem(tmproot, tmpmount);
+      }
+      continue;
+    }
+
     if (sscanf(p, "%*d %*d %*d:%*d %s %s %*[^-]- cgroup %*s %s", tmproot, tmpmount, tmpcgroups) != 3) {
       continue;
     }
@@ -348,29 +361,49 @@ void OSContainer::init() {
   }
   fclose(mntinfo);
 
-  if (memory == NULL) {
-    if (PrintContainerInfo) {
-      tty->print_cr("Required cgroup memory subsystem not found");
+  if (unified != NULL) {
+    if (memory != NULL && cpuset != NULL && cpu != NULL && cpuacct != NULL) {
+      // Hybrid hierarchy with all required controllers bound to v1:
+      // the cgroup2 mount point carries no controllers, so use the v1
+      // readers below.
+      unified = NULL;
+    } else if (memory != NULL || cpuset != NULL || cpu != NULL || cpuacct != NULL) {
+      // Some controllers bound to v1, the rest presumably to the unified
+      // hierarchy; no single set of readers covers that.
+      if (PrintContainerInfo) {
+        tty->print_cr("Mixed cgroup v1/v2 hierarchy is not supported");
+      }
+      return;
     }
-    return;
+    // Otherwise a pure unified hierarchy (cgroup v2); all controllers are
+    // read through the single cgroup2 mount point.
   }
-  if (cpuset == NULL) {
-    if (PrintContainerInfo) {
-      tty->print_cr("Required cgroup cpuset subsystem not found");
+
+  if (unified == NULL) {
+    if (memory == NULL) {
+      if (PrintContainerInfo) {
+        tty->print_cr("Required cgroup memory subsystem not found");
+      }
+      return;
     }
-    return;
-  }
-  if (cpu == NULL) {
-    if (PrintContainerInfo) {
-      tty->print_cr("Required cgroup cpu subsystem not found");
+    if (cpuset == NULL) {
+      if (PrintContainerInfo) {
+        tty->print_cr("Required cgroup cpuset subsystem not found");
+      }
+      return;
     }
-    return;
-  }
-  if (cpuacct == NULL) {
-    if (PrintContainerInfo) {
-      tty->print_cr("Required cgroup cpuacct subsystem not found");
+    if (cpu == NULL) {
+      if (PrintContainerInfo) {
+        tty->print_cr("Required cgroup cpu subsystem not found");
+      }
+      return;
+    }
+    if (cpuacct == NULL) {
+      if (PrintContainerInfo) {
+        tty->print_cr("Required cgroup cpuacct subsystem not found");
+      }
+      return;
     }
-    return;
   }
 
   /*
@@ -420,6 +453,15 @@ void OSContainer::init() {
       continue;
     }
 
+    if (unified != NULL) {
+      /* cgroup v2: the process membership is the single "0::<path>" line,
+       * recognizable by its empty controller list. */
+      if (strlen(controllers) == 0) {
+        unified->set_subsystem_path(base);
+      }
+      continue;
+    }
+
     while ((token = strsep(&controllers, ",")) != NULL) {
       if (strcmp(token, "memory") == 0) {
         memory->set_subsystem_path(base);
@@ -454,12 +496,45 @@ void OSContainer::init() {
 
 const char * OSContainer::container_type() {
   if (is_containerized()) {
-    return "cgroupv1";
+    return unified != NULL ? "cgroupv2" : "cgroupv1";
   } else {
     return NULL;
   }
 }
 
+/* v2_read_limit
+ *
+ * Read a cgroup v2 limit file, which holds either a number or the
+ * literal "max", and translate the latter to the "unlimited" convention
+ * of the v1 readers.
+ *
+ * return:
+ *    limit in file units or
+ *    -1 for unlimited
+ *    OSCONTAINER_ERROR for not supported
+ */
+static jlong v2_read_limit(const char* filename, const char* logstring) {
+  char buf[1024];
+  int err = subsystem_file_line_contents(unified, filename, NULL, "%1023s", buf);
+  if (err != 0) {
+    return (jlong) OSCONTAINER_ERROR;
+  }
+  jlong limit;
+  if (strcmp(buf, "max") == 0) {
+    limit = (jlong) -1;
+  } else {
+    julong value;
+    if (sscanf(buf, JULONG_FORMAT, &value) != 1) {
+      return (jlong) OSCONTAINER_ERROR;
+    }
+    limit = (jlong) value;
+  }
+  if (PrintContainerInfo) {
+    tty->print_cr(logstring, limit);
+  }
+  return limit;
+}
+
 /* uses_mem_hierarchy
  *
  * Return whether or not hierarchical cgroup accounting is being
@@ -486,6 +561,10 @@ jlong OSContainer::uses_mem_hierarchy() {
  *    OSCONTAINER_ERROR for not supported
  */
 jlong OSContainer::memory_limit_in_bytes() {
+  if (unified != NULL) {
+    return v2_read_limit("/memory.max", "Memory Limit is: " JLONG_FORMAT);
+  }
+
   GET_CONTAINER_INFO(julong, memory, "/memory.limit_in_bytes",
                      "Memory Limit is: " JULONG_FORMAT, JULONG_FORMAT, memlimit);
 
@@ -514,6 +593,19 @@ jlong OSContainer::memory_limit_in_bytes() {
 }
 
 jlong OSContainer::memory_and_swap_limit_in_bytes() {
+  if (unified != NULL) {
+    // Unlike the v1 memsw limit, memory.swap.max counts swap only.
+    jlong swap_limit = v2_read_limit("/memory.swap.max", "Swap Limit is: " JLONG_FORMAT);
+    if (swap_limit < 0) {
+      return swap_limit;
+    }
+    jlong mem_limit = memory_limit_in_bytes();
+    if (mem_limit < 0) {
+      return mem_limit;
+    }
+    return mem_limit + swap_limit;
+  }
+
   GET_CONTAINER_INFO(julong, memory, "/memory.memsw.limit_in_bytes",
                      "Memory and Swap Limit is: " JULONG_FORMAT, JULONG_FORMAT, memswlimit);
   if (memswlimit >= _unlimited_memory) {
@@ -540,6 +632,10 @@ jlong OSContainer::memory_and_swap_limit_in_bytes() {
 }
 
 jlong OSContainer::memory_soft_limit_in_bytes() {
+  if (unified != NULL) {
+    return v2_read_limit("/memory.low", "Memory Soft Limit is: " JLONG_FORMAT);
+  }
+
   GET_CONTAINER_INFO(julong, memory, "/memory.soft_limit_in_bytes",
                      "Memory Soft Limit is: " JULONG_FORMAT, JULONG_FORMAT, memsoftlimit);
   if (memsoftlimit >= _unlimited_memory) {
@@ -562,6 +658,12 @@ jlong OSContainer::memory_soft_limit_in_bytes() {
  *    OSCONTAINER_ERROR for not supported
  */
 jlong OSContainer::memory_usage_in_bytes() {
+  if (unified != NULL) {
+    GET_CONTAINER_INFO(jlong, unified, "/memory.current",
+                       "Memory Usage is: " JLONG_FORMAT, JLONG_FORMAT, memcurrent);
+    return memcurrent;
+  }
+
   GET_CONTAINER_INFO(jlong, memory, "/memory.usage_in_bytes",
                      "Memory Usage is: " JLONG_FORMAT, JLONG_FORMAT, memusage);
   return memusage;
@@ -576,6 +678,14 @@ jlong OSContainer::memory_usage_in_bytes() {
  *    OSCONTAINER_ERROR for not supported
  */
 jlong OSContainer::memory_max_usage_in_bytes() {
+  if (unified != NULL) {
+    // The unified hierarchy has no peak usage counter.
+    if (PrintContainerInfo) {
+      tty->print_cr("Maximum Memory Usage is not supported on cgroup v2");
+    }
+    return (jlong) OSCONTAINER_ERROR;
+  }
+
   GET_CONTAINER_INFO(jlong, memory, "/memory.max_usage_in_bytes",
                      "Maximum Memory Usage is: " JLONG_FORMAT, JLONG_FORMAT, memmaxusage);
   return memmaxusage;
@@ -622,10 +732,14 @@ int OSContainer::active_processor_count() {
   int cpu_count, limit_count;
   int result;
 
+  // On the unified hierarchy the cpu controller has no mount of its own;
+  // hang the cache off the cgroup2 mount point instead.
+  CgroupSubsystem* cache_subsystem = unified != NULL ? unified : cpu;
+
   // We use a cache with a timeout to avoid performing expensive
   // computations in the event this function is called frequently.
   // [See 8227006].
-  if (!cpu->cache_has_expired()) {
+  if (!cache_subsystem->cache_has_expired()) {
     if (PrintContainerInfo) {
       tty->print_cr("OSContainer::active_processor_count (cached): %d", OSContainer::_active_processor_count);
     }
@@ -674,18 +788,30 @@ int OSContainer::active_processor_count() {
 
   // Update the value and reset the cache timeout
   OSContainer::_active_processor_count = result;
-  cpu->set_cache_expiry_time(OSCONTAINER_CACHE_TIMEOUT);
+  cache_subsystem->set_cache_expiry_time(OSCONTAINER_CACHE_TIMEOUT);
 
   return result;
 }
 
 char * OSContainer::cpu_cpuset_cpus() {
+  if (unified != NULL) {
+    GET_CONTAINER_INFO_CPTR(cptr, unified, "/cpuset.cpus.effective",
+                       "cpuset.cpus.effective is: %s", "%1023s", v2cpus, 1024);
+    return os::strdup(v2cpus);
+  }
+
   GET_CONTAINER_INFO_CPTR(cptr, cpuset, "/cpuset.cpus",
                      "cpuset.cpus is: %s", "%1023s", cpus, 1024);
   return os::strdup(cpus);
 }
 
 char * OSContainer::cpu_cpuset_memory_nodes() {
+  if (unified != NULL) {
+    GET_CONTAINER_INFO_CPTR(cptr, unified, "/cpuset.mems.effective",
+                       "cpuset.mems.effective is: %s", "%1023s", v2mems, 1024);
+    return os::strdup(v2mems);
+  }
+
   GET_CONTAINER_INFO_CPTR(cptr, cpuset, "/cpuset.mems",
                      "cpuset.mems is: %s", "%1023s", mems, 1024);
   return os::strdup(mems);
@@ -702,12 +828,37 @@ char * OSContainer::cpu_cpuset_memory_nodes() {
  *    OSCONTAINER_ERROR for not supported
  */
 int OSContainer::cpu_quota() {
+  if (unified != NULL) {
+    // cpu.max holds "<quota> <period>", where quota may be "max".
+    char quota_str[1024];
+    int err = subsystem_file_line_contents(unified, "/cpu.max", NULL, "%1023s", quota_str);
+    if (err != 0) {
+      return OSCONTAINER_ERROR;
+    }
+    int v2quota;
+    if (strcmp(quota_str, "max") == 0) {
+      v2quota = -1;
+    } else if (sscanf(quota_str, "%d", &v2quota) != 1) {
+      return OSCONTAINER_ERROR;
+    }
+    if (PrintContainerInfo) {
+      tty->print_cr("CPU Quota is: %d", v2quota);
+    }
+    return v2quota;
+  }
+
   GET_CONTAINER_INFO(int, cpu, "/cpu.cfs_quota_us",
                      "CPU Quota is: %d", "%d", quota);
   return quota;
 }
 
 int OSContainer::cpu_period() {
+  if (unified != NULL) {
+    GET_CONTAINER_INFO(int, unified, "/cpu.max",
+                       "CPU Period is: %d", "%*s %d", v2period);
+    return v2period;
+  }
+
   GET_CONTAINER_INFO(int, cpu, "/cpu.cfs_period_us",
                      "CPU Period is: %d", "%d", period);
   return period;
@@ -724,6 +875,24 @@ int OSContainer::cpu_period() {
  *    OSCONTAINER_ERROR for not supported
  */
 int OSContainer::cpu_shares() {
+  if (unified != NULL) {
+    GET_CONTAINER_INFO(int, unified, "/cpu.weight",
+                       "Raw value for CPU weight is: %d", "%d", weight);
+    // The default weight of 100 means no shares have been set up
+    if (weight == 100) {
+      return -1;
+    }
+    // Map the cgroup v2 weight range [1, 10000] back onto the OCI shares
+    // range [2, 262144] the ergonomics downstream works with. This is the
+    // inverse of the translation container runtimes apply to --cpu-shares:
+    //   weight = 1 + ((shares - 2) * 9999) / 262142
+    int v2shares = 2 + ((weight - 1) * 262142) / 9999;
+    if (PrintContainerInfo) {
+      tty->print_cr("CPU Shares is: %d", v2shares);
+    }
+    return v2shares;
+  }
+
   GET_CONTAINER_INFO(int, cpu, "/cpu.shares",
                      "CPU Shares is: %d", "%d", shares);
   // Convert 1024 to no shares setup
@@ -43,6 +43,7 @@
 #include "prims/jvm_misc.hpp"
 #include "runtime/arguments.hpp"
 #include "runtime/extendedPC.hpp"
+#include "runtime/fastTime.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/interfaceSupport.hpp"
 #include "runtime/init.hpp"
@@ -1458,6 +1459,11 @@ void os::Linux::fast_thread_clock_init() {
 }
 
 jlong os::javaTimeNanos() {
+  if (FastTime::enabled()) {
+    // invariant TSC, recalibrated against CLOCK_MONOTONIC by the
+    // WatcherThread; see -XX:+UseFastJavaTimeNanos
+    return FastTime::now();
+  }
   if (Linux::supports_monotonic_clock()) {
     struct timespec tp;
     int status = Linux::clock_gettime(CLOCK_MONOTONIC, &tp);
@@ -2907,6 +2913,29 @@ int os::numa_get_group_id() {
   return 0;
 }
 
+bool os::numa_bind_thread_to_node(int node) {
+  // Translate the node to its processors, and restrict the calling thread
+  // to them with sched_setaffinity. The affinity is plain scheduler state,
+  // so it composes with cpusets and stays visible to sched_getaffinity.
+  unsigned long cpu_map[8];
+  if (Linux::numa_node_to_cpus(node, cpu_map, sizeof(cpu_map)) == -1) {
+    return false;
+  }
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  bool found = false;
+  for (size_t i = 0; i < sizeof(cpu_map) * BitsPerByte; i++) {
+    if ((cpu_map[i / BitsPerCLong] & (1UL << (i % BitsPerCLong))) != 0) {
+      CPU_SET((int)i, &cpus);
+      found = true;
+    }
+  }
+  if (!found) {
+    return false;
+  }
+  return sched_setaffinity(0, sizeof(cpu_set_t), &cpus) == 0;
+}
+
 int os::Linux::get_existing_num_nodes() {
   size_t node;
   size_t highest_node_number = Linux::numa_max_node();
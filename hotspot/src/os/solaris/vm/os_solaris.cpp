@@ -2706,6 +2706,10 @@ void os::numa_make_local(char *addr, size_t bytes, int lgrp_hint) {
   }
 }
 
+bool os::numa_bind_thread_to_node(int node) {
+  return false;
+}
+
 // Tell the OS that this range would be accessed from different LWPs.
 void os::numa_make_global(char *addr, size_t bytes) {
   assert((intptr_t)addr % os::vm_page_size() == 0, "Address should be page-aligned.");
@@ -140,4 +140,43 @@ inline void* Atomic::cmpxchg_ptr(void* exchange_value, volatile void* dest, void
 
 inline jlong Atomic::load(volatile jlong* src) { return *src; }
 
+// Explicitly-ordered operations. The weak compare-and-exchange maps directly
+// onto a single ldxr/stxr (or ldaxr/stlxr) pair without the retry loop the
+// strong __sync form needs, and the weaker orderings drop the trailing dmb.
+#define ATOMIC_HAVE_ORDERED_OPS 1
+
+inline bool Atomic::cmpxchg_weak(jint exchange_value, volatile jint* dest, jint compare_value) {
+  return __atomic_compare_exchange_n(dest, &compare_value, exchange_value, /* weak */ true,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
+
+inline bool Atomic::cmpxchg_weak_acq_rel(jint exchange_value, volatile jint* dest, jint compare_value) {
+  return __atomic_compare_exchange_n(dest, &compare_value, exchange_value, /* weak */ true,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+inline bool Atomic::cmpxchg_weak_acq_rel(jbyte exchange_value, volatile jbyte* dest, jbyte compare_value) {
+  return __atomic_compare_exchange_n(dest, &compare_value, exchange_value, /* weak */ true,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+inline bool Atomic::cmpxchg_weak_relaxed(jint exchange_value, volatile jint* dest, jint compare_value) {
+  return __atomic_compare_exchange_n(dest, &compare_value, exchange_value, /* weak */ true,
+                                     __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+inline bool Atomic::cmpxchg_ptr_weak(intptr_t exchange_value, volatile intptr_t* dest, intptr_t compare_value) {
+  return __atomic_compare_exchange_n(dest, &compare_value, exchange_value, /* weak */ true,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
+
+inline bool Atomic::cmpxchg_ptr_weak_acq_rel(intptr_t exchange_value, volatile intptr_t* dest, intptr_t compare_value) {
+  return __atomic_compare_exchange_n(dest, &compare_value, exchange_value, /* weak */ true,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+inline jint Atomic::add_relaxed(jint add_value, volatile jint* dest) {
+  return __atomic_add_fetch(dest, add_value, __ATOMIC_RELAXED);
+}
+
 #endif // OS_CPU_LINUX_AARCH64_VM_ATOMIC_LINUX_AARCH64_INLINE_HPP
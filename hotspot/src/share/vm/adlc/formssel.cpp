@@ -608,7 +608,9 @@ bool InstructForm::needs_anti_dependence_check(FormDict &globals) const {
       ( strcmp(_matrule->_rChild->_opType,"StrComp"    )==0 ||
         strcmp(_matrule->_rChild->_opType,"StrEquals"  )==0 ||
         strcmp(_matrule->_rChild->_opType,"StrIndexOf" )==0 ||
-        strcmp(_matrule->_rChild->_opType,"AryEq"      )==0 ))
+        strcmp(_matrule->_rChild->_opType,"AryEq"      )==0 ||
+        strcmp(_matrule->_rChild->_opType,"AryEqB"     )==0 ||
+        strcmp(_matrule->_rChild->_opType,"AryEqI"     )==0 ))
     return true;
 
   // Check if instruction has a USE of a memory operand class, but no defs
@@ -871,6 +873,8 @@ uint InstructForm::oper_input_base(FormDict &globals) {
 
   if( _matrule->_rChild &&
       ( strcmp(_matrule->_rChild->_opType,"AryEq"     )==0 ||
+        strcmp(_matrule->_rChild->_opType,"AryEqB"    )==0 ||
+        strcmp(_matrule->_rChild->_opType,"AryEqI"    )==0 ||
         strcmp(_matrule->_rChild->_opType,"StrComp"   )==0 ||
         strcmp(_matrule->_rChild->_opType,"StrEquals" )==0 ||
         strcmp(_matrule->_rChild->_opType,"StrIndexOf")==0 ||
@@ -575,6 +575,11 @@ void Canonicalizer::do_NewTypeArray   (NewTypeArray*    x) {}
 void Canonicalizer::do_NewObjectArray (NewObjectArray*  x) {}
 void Canonicalizer::do_NewMultiArray  (NewMultiArray*   x) {}
 void Canonicalizer::do_CheckCast      (CheckCast*       x) {
+  if (x->is_profiled_receiver_check()) {
+    // The guard tests the receiver class for identity; it must not be
+    // weakened to a subtype check or eliminated based on declared types.
+    return;
+  }
   if (x->klass()->is_loaded()) {
     Value obj = x->obj();
     ciType* klass = obj->exact_type();
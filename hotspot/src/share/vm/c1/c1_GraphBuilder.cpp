@@ -28,6 +28,7 @@
 #include "c1/c1_Compilation.hpp"
 #include "c1/c1_GraphBuilder.hpp"
 #include "c1/c1_InstructionPrinter.hpp"
+#include "ci/ciCallProfile.hpp"
 #include "ci/ciCallSite.hpp"
 #include "ci/ciField.hpp"
 #include "ci/ciKlass.hpp"
@@ -2007,6 +2008,40 @@ void GraphBuilder::invoke(Bytecodes::Code code) {
         }
       }
     }
+
+    if (C1TypeProfileInlining && !PatchALot &&
+        cha_monomorphic_target == NULL && exact_target == NULL &&
+        receiver != NULL && target->is_loaded() &&
+        (code == Bytecodes::_invokevirtual || code == Bytecodes::_invokeinterface)) {
+      // CHA could not devirtualize the call. If the receiver type profile
+      // collected by the interpreter is monomorphic, guard the call with
+      // an exact receiver class check that deoptimizes on a mismatch and
+      // bind directly to the profiled target so it becomes inlineable.
+      ciCallProfile profile = method()->call_profile_at_bci(bci());
+      if (profile.morphism() == 1 && profile.has_receiver(0)) {
+        ciKlass* profiled_klass = profile.receiver(0);
+        if (profiled_klass->is_instance_klass() && profiled_klass->is_loaded() &&
+            !profiled_klass->is_interface() &&
+            ((ciInstanceKlass*) profiled_klass)->is_initialized()) {
+          ciMethod* profiled_target = target->resolve_invoke(calling_klass, profiled_klass);
+          if (profiled_target != NULL && profiled_target->is_loaded() &&
+              !profiled_target->is_abstract()) {
+            // insert a check that the receiver really is of the profiled
+            // class; a new receiver type deoptimizes and reprofiles
+            CheckCast* c = new CheckCast(profiled_klass, receiver, copy_state_before());
+            c->set_profiled_receiver_check();
+            c->set_direct_compare(true);
+            // pass the result of the guard so that the compiler has
+            // exact type info in the inlinee
+            better_receiver = append_split(c);
+
+            exact_target = profiled_target;
+            target = profiled_target;
+            code = Bytecodes::_invokespecial;
+          }
+        }
+      }
+    }
   }
 
   if (cha_monomorphic_target != NULL) {
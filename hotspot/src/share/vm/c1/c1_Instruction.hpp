@@ -382,6 +382,7 @@ class Instruction: public CompilationResourceObj {
     NeedsPatchingFlag,
     ThrowIncompatibleClassChangeErrorFlag,
     InvokeSpecialReceiverCheckFlag,
+    ProfiledReceiverCheckFlag,
     ProfileMDOFlag,
     IsLinkedInBlockFlag,
     NeedsRangeCheckFlag,
@@ -1463,9 +1464,18 @@ LEAF(CheckCast, TypeCheck)
   bool is_invokespecial_receiver_check() const {
     return check_flag(InvokeSpecialReceiverCheckFlag);
   }
+  // An exact receiver class check inserted in front of a call that was
+  // devirtualized from the receiver type profile. Deoptimizes on mismatch
+  // instead of throwing.
+  void set_profiled_receiver_check() {
+    set_flag(ProfiledReceiverCheckFlag, true);
+  }
+  bool is_profiled_receiver_check() const {
+    return check_flag(ProfiledReceiverCheckFlag);
+  }
 
   virtual bool needs_exception_state() const {
-    return !is_invokespecial_receiver_check();
+    return !is_invokespecial_receiver_check() && !is_profiled_receiver_check();
   }
 
   ciType* declared_type() const;
@@ -59,9 +59,6 @@
 #include "utilities/copy.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
-#if INCLUDE_ALL_GCS
-#include "gc_implementation/shenandoah/shenandoahBarrierSet.inline.hpp"
-#endif
 
 // Implementation of StubAssembler
 
@@ -1311,11 +1308,7 @@ template <class T> int obj_arraycopy_work(oopDesc* src, T* src_addr,
   assert(bs->has_write_ref_array_opt(), "Barrier set must have ref array opt");
   assert(bs->has_write_ref_array_pre_opt(), "For pre-barrier as well.");
 
-#if INCLUDE_ALL_GCS
-  if (UseShenandoahGC) {
-    ShenandoahBarrierSet::barrier_set()->arraycopy_barrier(src_addr, dst_addr, length);
-  }
-#endif
+  bs->arraycopy_pre(src_addr, dst_addr, length);
 
   if (src == dst) {
     // same object, no check
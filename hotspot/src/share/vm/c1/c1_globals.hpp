@@ -314,6 +314,10 @@
   develop(bool, ComputeExactFPURegisterUsage, true,                         \
           "Compute additional live set for fpu registers to simplify fpu stack merge (Intel only)") \
                                                                             \
+  product(bool, C1TypeProfileInlining, false,                               \
+          "Use receiver type profiles to devirtualize and inline "          \
+          "monomorphic virtual calls in C1")                                \
+                                                                            \
   product(bool, C1ProfileCalls, true,                                       \
           "Profile calls when generating code for updating MDOs")           \
                                                                             \
@@ -3273,6 +3273,24 @@ instanceKlassHandle ClassFileParser::parse_super_class(int super_class_index,
 }
 
 
+// Returns the first free offset after the last declared instance field in
+// the given class and its supers. The superclass field size is rounded up
+// to whole heap words, so this can be less than where the subclass fields
+// start, leaving an alignment gap at the boundary.
+static int nonstatic_fields_actual_end(InstanceKlass* k) {
+  int end = instanceOopDesc::base_offset_in_bytes();
+  for (InstanceKlass* ik = k; ik != NULL; ik = ik->superklass()) {
+    for (AllFieldStream fs(ik); !fs.done(); fs.next()) {
+      if (fs.access_flags().is_static()) continue;
+      BasicType type = FieldType::basic_type(fs.signature());
+      int size = (type == T_OBJECT || type == T_ARRAY) ? heapOopSize
+                                                       : type2aelembytes(type);
+      end = MAX2(end, (int)fs.offset() + size);
+    }
+  }
+  return end;
+}
+
 // Values needed for oopmap and InstanceKlass creation
 class FieldLayoutInfo : public StackObj {
  public:
@@ -3460,6 +3478,82 @@ void ClassFileParser::layout_fields(Handle class_loader,
     ShouldNotReachHere();
   }
 
+  int super_gap_word_space_offset  = 0;
+  int super_gap_short_space_offset = 0;
+  int super_gap_byte_space_offset  = 0;
+  int super_gap_word_space_count   = 0;
+  int super_gap_short_space_count  = 0;
+  int super_gap_byte_space_count   = 0;
+
+  // Try to squeeze some of the fields into the alignment gap at the
+  // superclass boundary: the superclass field size is rounded up to whole
+  // heap words, so up to (heapOopSize - 1) bytes right before
+  // nonstatic_fields_start may be unoccupied. Only gaps strictly smaller
+  // than a heap word are filled: a larger residue is deliberate padding
+  // around @Contended fields, which must stay clear. Oop fields are never
+  // placed here, so superclass oop maps are not disturbed.
+  if (CompactInheritedGaps && compact_fields &&
+      !is_contended_class && super_has_nonstatic_fields) {
+    int offset = nonstatic_fields_actual_end(_super_klass());
+    int length = nonstatic_fields_start - offset;
+    if (length > 0 && length < heapOopSize) {
+      // Byte field first when the gap starts at an odd offset. The gap ends
+      // at a heap word boundary, so an odd start means an odd length, and
+      // the tail below never needs a second byte run.
+      super_gap_byte_space_offset = offset;
+      while (((offset & (BytesPerShort - 1)) != 0) && length >= 1 && nonstatic_byte_count > 0) {
+        nonstatic_byte_count       -= 1;
+        super_gap_byte_space_count += 1;
+        length -= 1;
+        offset += 1;
+      }
+      // Short field to reach word alignment.
+      super_gap_short_space_offset = offset;
+      while (((offset & (BytesPerInt - 1)) != 0) && length >= BytesPerShort && nonstatic_short_count > 0) {
+        nonstatic_short_count       -= 1;
+        super_gap_short_space_count += 1;
+        length -= BytesPerShort;
+        offset += BytesPerShort;
+      }
+      // Word fields in the aligned middle.
+      if ((offset & (BytesPerInt - 1)) == 0) {
+        super_gap_word_space_offset = offset;
+        while (length >= BytesPerInt && nonstatic_word_count > 0) {
+          nonstatic_word_count       -= 1;
+          super_gap_word_space_count += 1;
+          length -= BytesPerInt;
+          offset += BytesPerInt;
+        }
+      }
+      // Trailing short fields. Appending keeps the short run contiguous
+      // only while no word fields sit in between.
+      if (super_gap_short_space_count == 0 || super_gap_word_space_count == 0) {
+        if (super_gap_short_space_count == 0) {
+          super_gap_short_space_offset = offset;
+        }
+        while (((offset & (BytesPerShort - 1)) == 0) && length >= BytesPerShort && nonstatic_short_count > 0) {
+          nonstatic_short_count       -= 1;
+          super_gap_short_space_count += 1;
+          length -= BytesPerShort;
+          offset += BytesPerShort;
+        }
+      }
+      // Trailing byte fields, same contiguity consideration. An odd gap
+      // start consumed the head byte already and left an even remainder,
+      // so head and tail byte runs never both occur.
+      if (super_gap_byte_space_count == 0) {
+        super_gap_byte_space_offset = offset;
+        while (length >= 1 && nonstatic_byte_count > 0) {
+          nonstatic_byte_count       -= 1;
+          super_gap_byte_space_count += 1;
+          length -= 1;
+          offset += 1;
+        }
+      }
+      assert(offset <= nonstatic_fields_start, "must not spill into own fields");
+    }
+  }
+
   int nonstatic_oop_space_count    = 0;
   int nonstatic_word_space_count   = 0;
   int nonstatic_short_space_count  = 0;
@@ -3594,7 +3688,11 @@ void ClassFileParser::layout_fields(Handle class_loader,
         }
         break;
       case NONSTATIC_BYTE:
-        if( nonstatic_byte_space_count > 0 ) {
+        if( super_gap_byte_space_count > 0 ) {
+          real_offset = super_gap_byte_space_offset;
+          super_gap_byte_space_offset += 1;
+          super_gap_byte_space_count  -= 1;
+        } else if( nonstatic_byte_space_count > 0 ) {
           real_offset = nonstatic_byte_space_offset;
           nonstatic_byte_space_offset += 1;
           nonstatic_byte_space_count  -= 1;
@@ -3604,7 +3702,11 @@ void ClassFileParser::layout_fields(Handle class_loader,
         }
         break;
       case NONSTATIC_SHORT:
-        if( nonstatic_short_space_count > 0 ) {
+        if( super_gap_short_space_count > 0 ) {
+          real_offset = super_gap_short_space_offset;
+          super_gap_short_space_offset += BytesPerShort;
+          super_gap_short_space_count  -= 1;
+        } else if( nonstatic_short_space_count > 0 ) {
           real_offset = nonstatic_short_space_offset;
           nonstatic_short_space_offset += BytesPerShort;
           nonstatic_short_space_count  -= 1;
@@ -3614,7 +3716,11 @@ void ClassFileParser::layout_fields(Handle class_loader,
         }
         break;
       case NONSTATIC_WORD:
-        if( nonstatic_word_space_count > 0 ) {
+        if( super_gap_word_space_count > 0 ) {
+          real_offset = super_gap_word_space_offset;
+          super_gap_word_space_offset += BytesPerInt;
+          super_gap_word_space_count  -= 1;
+        } else if( nonstatic_word_space_count > 0 ) {
           real_offset = nonstatic_word_space_offset;
           nonstatic_word_space_offset += BytesPerInt;
           nonstatic_word_space_count  -= 1;
@@ -3767,6 +3873,26 @@ void ClassFileParser::layout_fields(Handle class_loader,
          (instanceOopDesc::base_offset_in_bytes() + nonstatic_field_size*heapOopSize),
           wordSize) / wordSize), "consistent layout helper value");
 
+#ifdef ASSERT
+  // Verify the layout: every nonstatic field of this class must lie within
+  // the instance, and fields packed below nonstatic_fields_start must stay
+  // inside the superclass alignment gap.
+  for (AllFieldStream fs(_fields, _cp); !fs.done(); fs.next()) {
+    if (fs.access_flags().is_static()) continue;
+    BasicType ftype = FieldType::basic_type(fs.signature());
+    int fsize = (ftype == T_OBJECT || ftype == T_ARRAY) ? heapOopSize
+                                                        : type2aelembytes(ftype);
+    int foffset = (int)fs.offset();
+    assert(foffset >= instanceOopDesc::base_offset_in_bytes(), "field under the header");
+    assert(foffset + fsize <= instance_size * wordSize, "field past the instance end");
+    if (foffset < nonstatic_fields_start) {
+      assert(foffset >= nonstatic_fields_actual_end(_super_klass()) &&
+             foffset + fsize <= nonstatic_fields_start,
+             "packed field outside the superclass alignment gap");
+    }
+  }
+#endif
+
   // Invariant: nonstatic_field end/start should only change if there are
   // nonstatic fields in the class, or if the class is contended. We compare
   // against the non-aligned value, so that end alignment will not fail the
@@ -57,6 +57,7 @@
 #include "memory/metadataFactory.hpp"
 #include "memory/metaspaceShared.hpp"
 #include "memory/oopFactory.hpp"
+#include "prims/jniLookupCache.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/safepoint.hpp"
@@ -134,11 +135,13 @@ void ClassLoaderData::ChunkedHandleList::oops_do(OopClosure* f) {
 }
 
 bool ClassLoaderData::claim() {
-  if (_claimed == 1) {
+  jint round = ClassLoaderDataGraph::claim_round();
+  int  prev  = _claimed;
+  if (prev == round) {
     return false;
   }
 
-  return (int) Atomic::cmpxchg(1, &_claimed, 0) == 0;
+  return (int) Atomic::cmpxchg(round, &_claimed, prev) == prev;
 }
 
 void ClassLoaderData::oops_do(OopClosure* f, KlassClosure* klass_closure, bool must_claim) {
@@ -293,9 +296,19 @@ void ClassLoaderData::Dependencies::locked_add(objArrayHandle last_handle,
 }
 
 void ClassLoaderDataGraph::clear_claimed_marks() {
-  for (ClassLoaderData* cld = _head; cld != NULL; cld = cld->next()) {
-    cld->clear_claimed();
+  // Opening a new claiming round unclaims every CLD at once: the old stamps
+  // no longer match. This keeps the frequent pre-scan clearing O(1) instead
+  // of walking a graph with potentially thousands of loaders.
+  jint next = _claim_round + 1;
+  if (next == 0) {
+    // The round counter wrapped. Reset the stale stamps the slow way, so
+    // that no long-lived CLD can alias a restarted round.
+    for (ClassLoaderData* cld = _head; cld != NULL; cld = cld->next()) {
+      cld->clear_claimed();
+    }
+    next = 1;
   }
+  _claim_round = next;
 }
 
 void ClassLoaderData::add_class(Klass* k) {
@@ -566,6 +579,9 @@ ClassLoaderData* ClassLoaderDataGraph::_saved_unloading = NULL;
 ClassLoaderData* ClassLoaderDataGraph::_saved_head = NULL;
 
 bool ClassLoaderDataGraph::_should_purge = false;
+// Start at 1: freshly constructed CLDs carry stamp 0, which must read as
+// not claimed in the first round already.
+volatile jint ClassLoaderDataGraph::_claim_round = 1;
 
 // Add a new class loader data node to the list.  Assign the newly created
 // ClassLoaderData into the java/lang/ClassLoader object as a hidden field
@@ -787,6 +803,11 @@ bool ClassLoaderDataGraph::do_unloading(BoolObjectClosure* is_alive_closure, boo
     ClassLoaderDataGraph::clean_metaspaces();
   }
 
+  if (seen_dead_loader) {
+    // Memoized JNI lookups may reference the dead loaders' metadata.
+    JNILookupCache::clear();
+  }
+
   return seen_dead_loader;
 }
 
@@ -811,16 +832,36 @@ void ClassLoaderDataGraph::clean_metaspaces() {
 }
 
 void ClassLoaderDataGraph::purge() {
+  purge_list(detach_unloading_list());
+}
+
+ClassLoaderData* ClassLoaderDataGraph::detach_unloading_list() {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint!");
   ClassLoaderData* list = _unloading;
   _unloading = NULL;
+  return list;
+}
+
+void ClassLoaderDataGraph::purge_list(ClassLoaderData* list) {
+  // The list had been detached from the graph at a safepoint, nobody else
+  // can reach these ClassLoaderDatas. Freeing the metaspaces synchronizes
+  // on the expand lock, see Metaspace::purge().
   ClassLoaderData* next = list;
   while (next != NULL) {
     ClassLoaderData* purge_me = next;
     next = purge_me->next();
     delete purge_me;
   }
-  Metaspace::purge();
+  if (SafepointSynchronize::is_at_safepoint()) {
+    Metaspace::purge();
+  } else {
+    // Deleting the dead loaders returned their chunks to the free lists
+    // above, but unlinking the now-empty virtual space nodes must wait for
+    // a safepoint: Metaspace::contains walks the node lists without locking
+    // and relies on nodes only being removed at a safepoint. Leave that to
+    // the next safepoint cleanup, see SafepointSynchronize::do_cleanup_tasks.
+    ClassLoaderDataGraph::set_should_purge(true);
+  }
 }
 
 void ClassLoaderDataGraph::free_deallocate_lists() {
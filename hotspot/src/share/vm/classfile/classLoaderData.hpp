@@ -69,13 +69,21 @@ class ClassLoaderDataGraph : public AllStatic {
   static ClassLoaderData* _saved_head;
   static ClassLoaderData* _saved_unloading;
   static bool _should_purge;
+  // Current claiming round; CLDs stamped with it count as claimed. See
+  // clear_claimed_marks().
+  static volatile jint _claim_round;
 
   static ClassLoaderData* add(Handle class_loader, bool anonymous, TRAPS);
   static void clean_metaspaces();
  public:
   static ClassLoaderData* find_or_create(Handle class_loader, TRAPS);
   static void purge();
+  // Detach the unloading list at a safepoint, for deferred (possibly
+  // concurrent) purging with purge_list().
+  static ClassLoaderData* detach_unloading_list();
+  static void purge_list(ClassLoaderData* list);
   static void clear_claimed_marks();
+  static jint claim_round() { return _claim_round; }
   // oops do
   static void oops_do(OopClosure* f, KlassClosure* klass_closure, bool must_claim);
   static void keep_alive_oops_do(OopClosure* blk, KlassClosure* klass_closure, bool must_claim);
@@ -183,8 +191,10 @@ class ClassLoaderData : public CHeapObj<mtClass> {
   bool _unloading;         // true if this class loader goes away
   bool _keep_alive;        // if this CLD is kept alive without a keep_alive_object().
   bool _is_anonymous;      // if this CLD is for an anonymous class
-  volatile int _claimed;   // true if claimed, for example during GC traces.
-                           // To avoid applying oop closure more than once.
+  volatile int _claimed;   // Round stamp of the last claim, for example during
+                           // GC traces, to avoid applying oop closure more than
+                           // once. Claimed means stamped with the current
+                           // ClassLoaderDataGraph::claim_round().
                            // Has to be an int because we cas it.
   Klass* _klasses;         // The classes defined by the class loader.
 
@@ -236,7 +246,7 @@ class ClassLoaderData : public CHeapObj<mtClass> {
 
   // GC interface.
   void clear_claimed()          { _claimed = 0; }
-  bool claimed() const          { return _claimed == 1; }
+  bool claimed() const          { return _claimed == ClassLoaderDataGraph::claim_round(); }
   bool claim();
 
   bool is_alive(BoolObjectClosure* is_alive_closure) const;
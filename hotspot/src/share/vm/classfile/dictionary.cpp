@@ -305,6 +305,14 @@ void Dictionary::oops_do(OopClosure* f) {
   _pd_cache_table->oops_do(f);
 }
 
+int Dictionary::pd_cache_table_size() {
+  return _pd_cache_table->table_size();
+}
+
+void Dictionary::pd_cache_buckets_oops_do(OopClosure* f, int start_idx, int end_idx) {
+  _pd_cache_table->buckets_oops_do(f, start_idx, end_idx);
+}
+
 void Dictionary::methods_do(void f(Method*)) {
   for (int index = 0; index < table_size(); index++) {
     for (DictionaryEntry* probe = bucket(index);
@@ -500,7 +508,14 @@ void ProtectionDomainCacheTable::unlink(BoolObjectClosure* is_alive) {
 }
 
 void ProtectionDomainCacheTable::oops_do(OopClosure* f) {
-  for (int index = 0; index < table_size(); index++) {
+  buckets_oops_do(f, 0, table_size());
+}
+
+void ProtectionDomainCacheTable::buckets_oops_do(OopClosure* f, int start_idx, int end_idx) {
+  assert(0 <= start_idx && start_idx <= end_idx && end_idx <= table_size(),
+         err_msg("bad bucket range: [" INT32_FORMAT ", " INT32_FORMAT ") of " INT32_FORMAT,
+                 start_idx, end_idx, table_size()));
+  for (int index = start_idx; index < end_idx; index++) {
     for (ProtectionDomainCacheEntry* probe = bucket(index);
                                      probe != NULL;
                                      probe = probe->next()) {
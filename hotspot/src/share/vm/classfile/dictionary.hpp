@@ -94,6 +94,12 @@ public:
   void always_strong_oops_do(OopClosure* blk);
   void roots_oops_do(OopClosure* strong, OopClosure* weak);
 
+  // Striped scan of the protection domain cache, which holds all of the
+  // heap oops behind oops_do. Used by Shenandoah to spread the scan over
+  // several GC workers claiming disjoint bucket ranges.
+  int pd_cache_table_size();
+  void pd_cache_buckets_oops_do(OopClosure* f, int start_idx, int end_idx);
+
   void always_strong_classes_do(KlassClosure* closure);
 
   void classes_do(void f(Klass*));
@@ -219,6 +225,7 @@ public:
 
   // GC support
   void oops_do(OopClosure* f);
+  void buckets_oops_do(OopClosure* f, int start_idx, int end_idx);
   void always_strong_oops_do(OopClosure* f);
   void roots_oops_do(OopClosure* strong, OopClosure* weak);
 
@@ -47,6 +47,7 @@
 #include "runtime/interfaceSupport.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/orderAccess.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/vframe.hpp"
@@ -2557,6 +2558,26 @@ oop java_lang_boxing_object::create(BasicType type, jvalue* value, TRAPS) {
 }
 
 
+oop java_lang_boxing_object::canonical_boolean(jboolean value, TRAPS) {
+  instanceKlassHandle h(THREAD, SystemDictionary::Boolean_klass());
+  if (!h->is_initialized())  h->initialize(CHECK_0);
+  // Lazy initialization can race: arbitrary Java threads get here through
+  // reflection. _true_offset is the guard and is published last, with
+  // release/acquire ordering, so that a thread that observes it non-zero
+  // also observes _false_offset. Losing the race only recomputes the same
+  // values.
+  int true_offset = OrderAccess::load_acquire((volatile jint*)&_true_offset);
+  if (true_offset == 0) {
+    compute_offset(_false_offset, h(), vmSymbols::FALSE_name(), vmSymbols::boolean_object_signature());
+    compute_offset(true_offset,   h(), vmSymbols::TRUE_name(),  vmSymbols::boolean_object_signature());
+    OrderAccess::release_store((volatile jint*)&_true_offset, true_offset);
+  }
+  // The statics live in the mirror. They are only NULL while Boolean itself
+  // is still running <clinit>; callers fall back to allocating then.
+  return h->java_mirror()->obj_field(value ? true_offset : _false_offset);
+}
+
+
 BasicType java_lang_boxing_object::basic_type(oop box) {
   if (box == NULL)  return T_ILLEGAL;
   BasicType type = SystemDictionary::box_klass_type(box->klass());
@@ -3252,6 +3273,8 @@ int java_lang_reflect_Parameter::index_offset;
 int java_lang_reflect_Parameter::executable_offset;
 int java_lang_boxing_object::value_offset;
 int java_lang_boxing_object::long_value_offset;
+int java_lang_boxing_object::_true_offset = 0;
+int java_lang_boxing_object::_false_offset = 0;
 int java_lang_ref_Reference::referent_offset;
 int java_lang_ref_Reference::queue_offset;
 int java_lang_ref_Reference::next_offset;
@@ -845,11 +845,18 @@ class java_lang_boxing_object: AllStatic {
   };
   static int value_offset;
   static int long_value_offset;
+  // Static field offsets of Boolean.TRUE/FALSE in the Boolean mirror,
+  // resolved lazily on first use. Zero until then.
+  static int _true_offset;
+  static int _false_offset;
 
   static oop initialize_and_allocate(BasicType type, TRAPS);
  public:
   // Allocation. Returns a boxed value, or NULL for invalid type.
   static oop create(BasicType type, jvalue* value, TRAPS);
+  // Returns the canonical Boolean.TRUE/FALSE instance, as Boolean.valueOf()
+  // would. Returns NULL if java.lang.Boolean has not finished initializing.
+  static oop canonical_boolean(jboolean value, TRAPS);
   // Accessors. Returns the basic type being boxed, or T_ILLEGAL for invalid oop.
   static BasicType get_value(oop box, jvalue* value);
   static BasicType set_value(oop box, jvalue* value);
@@ -28,111 +28,94 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
-#include "utilities/hashtable.inline.hpp"
+
+// create resolution error table
+ResolutionErrorTable::ResolutionErrorTable(int table_size)
+    : _table(table_size) {
+}
 
 // add new entry to the table
-void ResolutionErrorTable::add_entry(int index, unsigned int hash,
-                                     constantPoolHandle pool, int cp_index,
-                                     Symbol* error, Symbol* message)
+void ResolutionErrorTable::add_entry(unsigned int hash, constantPoolHandle pool,
+                                     int cp_index, Symbol* error, Symbol* message)
 {
   assert_locked_or_safepoint(SystemDictionary_lock);
-  assert(!pool.is_null() && error != NULL, "adding NULL obj");
+  assert(!pool.is_null() && error != NULL && message != NULL, "adding NULL obj");
 
-  ResolutionErrorEntry* entry = new_entry(hash, pool(), cp_index, error, message);
-  add_entry(index, entry);
+  Key key;
+  key._pool = pool();
+  key._cp_index = cp_index;
+  if (_table.find(hash, key) != NULL) {
+    // racing resolvers can both fail; the first recorded error wins
+    return;
+  }
+  Value value;
+  value._error = error;
+  value._message = message;
+  error->increment_refcount();
+  message->increment_refcount();
+  _table.add(hash, key, value);
 }
 
 // find entry in the table
-ResolutionErrorEntry* ResolutionErrorTable::find_entry(int index, unsigned int hash,
-                                                       constantPoolHandle pool, int cp_index)
+bool ResolutionErrorTable::find_entry(unsigned int hash, constantPoolHandle pool,
+                                      int cp_index, Symbol** error, Symbol** message)
 {
   assert_locked_or_safepoint(SystemDictionary_lock);
 
-  for (ResolutionErrorEntry *error_probe = bucket(index);
-                         error_probe != NULL;
-                         error_probe = error_probe->next()) {
-  if (error_probe->hash() == hash && error_probe->pool() == pool()) {
-      return error_probe;;
-    }
+  Key key;
+  key._pool = pool();
+  key._cp_index = cp_index;
+  Value* value = _table.find(hash, key);
+  if (value == NULL) {
+    return false;
   }
-  return NULL;
-}
-
-void ResolutionErrorEntry::set_error(Symbol* e) {
-  assert(e != NULL, "must set a value");
-  _error = e;
-  _error->increment_refcount();
-}
-
-void ResolutionErrorEntry::set_message(Symbol* c) {
-  assert(c != NULL, "must set a value");
-  _message = c;
-  _message->increment_refcount();
-}
-
-// create new error entry
-ResolutionErrorEntry* ResolutionErrorTable::new_entry(int hash, ConstantPool* pool,
-                                                      int cp_index, Symbol* error,
-                                                      Symbol* message)
-{
-  ResolutionErrorEntry* entry = (ResolutionErrorEntry*)Hashtable<ConstantPool*, mtClass>::new_entry(hash, pool);
-  entry->set_cp_index(cp_index);
-  entry->set_error(error);
-  entry->set_message(message);
-
-  return entry;
-}
-
-void ResolutionErrorTable::free_entry(ResolutionErrorEntry *entry) {
-  // decrement error refcount
-  assert(entry->error() != NULL, "error should be set");
-  entry->error()->decrement_refcount();
-  entry->message()->decrement_refcount();
-  Hashtable<ConstantPool*, mtClass>::free_entry(entry);
-}
-
-
-// create resolution error table
-ResolutionErrorTable::ResolutionErrorTable(int table_size)
-    : Hashtable<ConstantPool*, mtClass>(table_size, sizeof(ResolutionErrorEntry)) {
+  *error = value->_error;
+  *message = value->_message;
+  return true;
 }
 
 // RedefineClasses support - remove matching entry of a
 // constant pool that is going away
 void ResolutionErrorTable::delete_entry(ConstantPool* c) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
-  for (int i = 0; i < table_size(); i++) {
-    for (ResolutionErrorEntry** p = bucket_addr(i); *p != NULL; ) {
-      ResolutionErrorEntry* entry = *p;
-      assert(entry->pool() != NULL, "resolution error table is corrupt");
-      if (entry->pool() == c) {
-        *p = entry->next();
-        free_entry(entry);
-      } else {
-        p = entry->next_addr();
+
+  class DeleteForPool : public ErrorTable::UnlinkClosure {
+   private:
+    ConstantPool* _pool;
+   public:
+    DeleteForPool(ConstantPool* pool) : _pool(pool) {}
+    bool do_entry(const Key& key, Value& value) {
+      assert(key._pool != NULL, "resolution error table is corrupt");
+      if (key._pool != _pool) {
+        return false;
       }
+      value._error->decrement_refcount();
+      value._message->decrement_refcount();
+      return true;
     }
-  }
+  } cl(c);
+  _table.unlink(&cl);
 }
 
-
 // Remove unloaded entries from the table
 void ResolutionErrorTable::purge_resolution_errors() {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
-  for (int i = 0; i < table_size(); i++) {
-    for (ResolutionErrorEntry** p = bucket_addr(i); *p != NULL; ) {
-      ResolutionErrorEntry* entry = *p;
-      assert(entry->pool() != (ConstantPool*)NULL, "resolution error table is corrupt");
-      ConstantPool* pool = entry->pool();
+
+  class PurgeUnloaded : public ErrorTable::UnlinkClosure {
+   public:
+    bool do_entry(const Key& key, Value& value) {
+      ConstantPool* pool = key._pool;
+      assert(pool != (ConstantPool*)NULL, "resolution error table is corrupt");
       assert(pool->pool_holder() != NULL, "Constant pool without a class?");
       ClassLoaderData* loader_data =
               pool->pool_holder()->class_loader_data();
       if (!loader_data->is_unloading()) {
-        p = entry->next_addr();
-      } else {
-        *p = entry->next();
-        free_entry(entry);
+        return false;
       }
+      value._error->decrement_refcount();
+      value._message->decrement_refcount();
+      return true;
     }
-  }
+  } cl;
+  _table.unlink(&cl);
 }
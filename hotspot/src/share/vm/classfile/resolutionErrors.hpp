@@ -26,48 +26,53 @@
 #define SHARE_VM_CLASSFILE_RESOLUTIONERRORS_HPP
 
 #include "oops/constantPool.hpp"
-#include "utilities/hashtable.hpp"
-
-class ResolutionErrorEntry;
+#include "utilities/openHashtable.hpp"
 
 // ResolutionError objects are used to record errors encountered during
 // constant pool resolution (JVMS 5.4.3).
+//
+// The table is an open-addressing table with inline entries; the entries
+// may move on insertion and removal, which is fine because they are only
+// examined under the SystemDictionary_lock (or at a safepoint) and no
+// entry pointer is retained across operations.
 
-class ResolutionErrorTable : public Hashtable<ConstantPool*, mtClass> {
-
-public:
-  ResolutionErrorTable(int table_size);
-
-  ResolutionErrorEntry* new_entry(int hash, ConstantPool* pool, int cp_index,
-                                  Symbol* error, Symbol* message);
-  void free_entry(ResolutionErrorEntry *entry);
-
-  ResolutionErrorEntry* bucket(int i) {
-    return (ResolutionErrorEntry*)Hashtable<ConstantPool*, mtClass>::bucket(i);
-  }
-
-  ResolutionErrorEntry** bucket_addr(int i) {
-    return (ResolutionErrorEntry**)Hashtable<ConstantPool*, mtClass>::bucket_addr(i);
-  }
+class ResolutionErrorTable : public CHeapObj<mtClass> {
+ private:
+  struct Key {
+    ConstantPool* _pool;
+    int           _cp_index;
 
-  void add_entry(int index, ResolutionErrorEntry* new_entry) {
-    Hashtable<ConstantPool*, mtClass>::add_entry(index,
-      (HashtableEntry<ConstantPool*, mtClass>*)new_entry);
-  }
+    bool operator==(const Key& other) const {
+      return _pool == other._pool && _cp_index == other._cp_index;
+    }
+  };
 
-  void add_entry(int index, unsigned int hash,
-                 constantPoolHandle pool, int which, Symbol* error, Symbol* message);
+  struct Value {
+    Symbol* _error;
+    Symbol* _message;
+  };
 
+  typedef OpenHashtable<Key, Value, mtClass> ErrorTable;
 
-  // find error given the constant pool and constant pool index
-  ResolutionErrorEntry* find_entry(int index, unsigned int hash,
-                                   constantPoolHandle pool, int cp_index);
+  ErrorTable _table;
 
+public:
+  ResolutionErrorTable(int table_size);
 
   unsigned int compute_hash(constantPoolHandle pool, int cp_index) {
     return (unsigned int) pool->identity_hash() + cp_index;
   }
 
+  // add error for the constant pool and constant pool index; keeps the
+  // already recorded error if one exists
+  void add_entry(unsigned int hash, constantPoolHandle pool, int cp_index,
+                 Symbol* error, Symbol* message);
+
+  // find error given the constant pool and constant pool index; returns
+  // whether an error was recorded
+  bool find_entry(unsigned int hash, constantPoolHandle pool, int cp_index,
+                  Symbol** error, Symbol** message);
+
   // purges unloaded entries from the table
   void purge_resolution_errors();
 
@@ -75,32 +80,4 @@ public:
   void delete_entry(ConstantPool* c);
 };
 
-
-class ResolutionErrorEntry : public HashtableEntry<ConstantPool*, mtClass> {
- private:
-  int               _cp_index;
-  Symbol*           _error;
-  Symbol*           _message;
-
- public:
-  ConstantPool*      pool() const               { return literal(); }
-
-  int                cp_index() const           { return _cp_index; }
-  void               set_cp_index(int cp_index) { _cp_index = cp_index; }
-
-  Symbol*            error() const              { return _error; }
-  void               set_error(Symbol* e);
-
-  Symbol*            message() const            { return _message; }
-  void               set_message(Symbol* c);
-
-  ResolutionErrorEntry* next() const {
-    return (ResolutionErrorEntry*)HashtableEntry<ConstantPool*, mtClass>::next();
-  }
-
-  ResolutionErrorEntry** next_addr() {
-    return (ResolutionErrorEntry**)HashtableEntry<ConstantPool*, mtClass>::next_addr();
-  }
-};
-
 #endif // SHARE_VM_CLASSFILE_RESOLUTIONERRORS_HPP
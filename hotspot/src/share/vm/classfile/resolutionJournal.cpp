@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2018, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#include "classfile/resolutionJournal.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/constantPool.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+
+class ResolutionJournal::JournalEntry : public CHeapObj<mtClass> {
+public:
+  char*         _name;
+  int           _cp_length;
+  int           _method_count;
+  int           _count;
+  u2*           _indices;
+  volatile bool _replayed;
+  JournalEntry* _next;
+};
+
+static const int BUCKET_COUNT   = 2048;
+static const int MAX_LINE_NAME  = 4096;
+static const char* DEFAULT_FILE = "hs_resolution.journal";
+
+ResolutionJournal::JournalEntry** ResolutionJournal::_buckets = NULL;
+
+static unsigned int name_hash(const char* s) {
+  unsigned int h = 0;
+  while (*s != '\0') {
+    h = 31 * h + (unsigned char) *s++;
+  }
+  return h;
+}
+
+const char* ResolutionJournal::journal_file_name() {
+  return (ResolutionJournalFile != NULL) ? ResolutionJournalFile : DEFAULT_FILE;
+}
+
+void ResolutionJournal::initialize() {
+  if (!UseResolutionJournal) {
+    return;
+  }
+
+  FILE* file = fopen(journal_file_name(), "rt");
+  if (file == NULL) {
+    // Nothing to replay; the journal is written on exit for the next run.
+    return;
+  }
+
+  _buckets = NEW_C_HEAP_ARRAY(JournalEntry*, BUCKET_COUNT, mtClass);
+  for (int i = 0; i < BUCKET_COUNT; i++) {
+    _buckets[i] = NULL;
+  }
+
+  char* name = NEW_C_HEAP_ARRAY(char, MAX_LINE_NAME, mtClass);
+  for (;;) {
+    int cp_length, method_count, count;
+    if (fscanf(file, "%4095s %d %d %d", name, &cp_length, &method_count, &count) != 4) {
+      break;
+    }
+    if (count < 0 || count > max_jushort) {
+      // Malformed journal; drop the rest rather than trusting it.
+      break;
+    }
+    JournalEntry* entry = new JournalEntry();
+    entry->_name         = os::strdup(name, mtClass);
+    entry->_cp_length    = cp_length;
+    entry->_method_count = method_count;
+    entry->_count        = count;
+    entry->_indices      = (count > 0) ? NEW_C_HEAP_ARRAY(u2, count, mtClass) : NULL;
+    entry->_replayed     = false;
+
+    bool ok = true;
+    for (int c = 0; c < count; c++) {
+      int idx;
+      if (fscanf(file, "%d", &idx) != 1 || idx < 0 || idx > max_jushort) {
+        ok = false;
+        break;
+      }
+      entry->_indices[c] = (u2) idx;
+    }
+    if (!ok) {
+      break;
+    }
+
+    unsigned int bucket = name_hash(entry->_name) % BUCKET_COUNT;
+    entry->_next = _buckets[bucket];
+    _buckets[bucket] = entry;
+  }
+  FREE_C_HEAP_ARRAY(char, name, mtClass);
+  fclose(file);
+}
+
+ResolutionJournal::JournalEntry* ResolutionJournal::find(const char* name) {
+  unsigned int bucket = name_hash(name) % BUCKET_COUNT;
+  for (JournalEntry* entry = _buckets[bucket]; entry != NULL; entry = entry->_next) {
+    if (strcmp(entry->_name, name) == 0) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+void ResolutionJournal::bulk_resolve(instanceKlassHandle k, TRAPS) {
+  if (_buckets == NULL) {
+    return;
+  }
+
+  JournalEntry* entry;
+  {
+    ResourceMark rm(THREAD);
+    entry = find(k->name()->as_C_string());
+  }
+  if (entry == NULL || entry->_replayed) {
+    return;
+  }
+  // Benign race: concurrent linkers may both replay, resolution is idempotent.
+  entry->_replayed = true;
+
+  constantPoolHandle pool(THREAD, k->constants());
+  if (pool->length() != entry->_cp_length ||
+      k->methods()->length() != entry->_method_count) {
+    // The class changed since the journal was written.
+    return;
+  }
+
+  for (int c = 0; c < entry->_count; c++) {
+    int index = entry->_indices[c];
+    if (index < 1 || index >= pool->length()) {
+      continue;
+    }
+    if (pool->tag_at(index).is_unresolved_klass()) {
+      pool->klass_at(index, THREAD);
+      if (HAS_PENDING_EXCEPTION) {
+        // Failed resolutions are rediscovered and reported at the original
+        // use site; replay must stay invisible.
+        CLEAR_PENDING_EXCEPTION;
+      }
+    }
+  }
+}
+
+static FILE* _dump_file = NULL;
+
+void ResolutionJournal::dump_klass(Klass* k) {
+  if (!k->oop_is_instance()) {
+    return;
+  }
+  InstanceKlass* ik = InstanceKlass::cast(k);
+  if (ik->is_anonymous() || !ik->is_linked()) {
+    // VM-anonymous classes have no stable name, and unlinked classes have
+    // resolved nothing worth replaying.
+    return;
+  }
+
+  ConstantPool* pool = ik->constants();
+  int count = 0;
+  for (int i = 1; i < pool->length(); i++) {
+    if (pool->tag_at(i).is_klass()) {
+      count++;
+    }
+  }
+  if (count == 0) {
+    return;
+  }
+
+  ResourceMark rm;
+  fprintf(_dump_file, "%s %d %d %d", ik->name()->as_C_string(),
+          pool->length(), ik->methods()->length(), count);
+  for (int i = 1; i < pool->length(); i++) {
+    if (pool->tag_at(i).is_klass()) {
+      fprintf(_dump_file, " %d", i);
+    }
+  }
+  fprintf(_dump_file, "\n");
+}
+
+void ResolutionJournal::dump() {
+  if (!UseResolutionJournal) {
+    return;
+  }
+
+  const char* file_name = journal_file_name();
+  FILE* file = fopen(file_name, "wt");
+  if (file == NULL) {
+    warning("Unable to write resolution journal to %s", file_name);
+    return;
+  }
+  _dump_file = file;
+  {
+    MutexLocker ml(SystemDictionary_lock);
+    SystemDictionary::classes_do(dump_klass);
+  }
+  _dump_file = NULL;
+  fclose(file);
+}
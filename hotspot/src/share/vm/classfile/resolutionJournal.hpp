@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2018, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_CLASSFILE_RESOLUTIONJOURNAL_HPP
+#define SHARE_VM_CLASSFILE_RESOLUTIONJOURNAL_HPP
+
+#include "memory/allocation.hpp"
+#include "oops/instanceKlass.hpp"
+#include "utilities/exceptions.hpp"
+
+// Journals which constant pool class entries a run resolved, and replays
+// those resolutions at class link time on the next run. Loading and
+// verifying the referenced classes is the dominant cost of the lazy
+// resolution storm during warmup; pulling it forward to link time batches
+// it into startup instead of spreading it over the first requests.
+//
+// The journal is a text file, one line per class:
+//
+//   <class name> <cp length> <method count> <n> <idx> ... <idx>
+//
+// Classes are matched by name; the constant pool length and method count
+// act as a fingerprint, so a class that changed between runs is silently
+// skipped. Replay is best effort: stale indices and resolution failures
+// are ignored, and errors surface at the original use sites as usual.
+class ResolutionJournal : AllStatic {
+private:
+  class JournalEntry;
+
+  static JournalEntry** _buckets;
+
+  static JournalEntry* find(const char* name);
+  static void dump_klass(Klass* k);
+  static const char* journal_file_name();
+
+public:
+  // Load the journal from the previous run, if any. Called during VM startup.
+  static void initialize();
+
+  // Write the journal for the next run. Called on orderly VM shutdown.
+  static void dump();
+
+  // Resolve the journaled constant pool entries of the newly linked class.
+  static void bulk_resolve(instanceKlassHandle k, TRAPS);
+};
+
+#endif // SHARE_VM_CLASSFILE_RESOLUTIONJOURNAL_HPP
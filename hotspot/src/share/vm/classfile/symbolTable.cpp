@@ -648,6 +648,18 @@ bool StringTable::_needs_rehashing = false;
 
 volatile int StringTable::_parallel_claimed_idx = 0;
 
+Mutex* StringTable::_stripe_locks[StringTable::_stripe_count];
+
+void StringTable::create_table() {
+  assert(_the_table == NULL, "One string table allowed.");
+  _the_table = new StringTable();
+  for (int i = 0; i < _stripe_count; i++) {
+    // Ranked above StringTable_lock (leaf): basic_add takes the latter for
+    // entry allocation while holding a stripe lock.
+    _stripe_locks[i] = new Mutex(Mutex::leaf + 1, "StringTable stripe", true);
+  }
+}
+
 // Pick hashing algorithm
 unsigned int StringTable::hash_string(const jchar* s, int len) {
   return use_alternate_hashcode() ? AltHashing::halfsiphash_32(seed(), s, len) :
@@ -702,8 +714,14 @@ oop StringTable::basic_add(int index_arg, Handle string, jchar* name,
     return test;
   }
 
-  HashtableEntry<oop, mtSymbol>* entry = new_entry(hashValue, string());
-  add_entry(index, entry);
+  // The entry allocator (free list and block carving) is shared by all
+  // stripes; keep its critical section to just the allocation.
+  HashtableEntry<oop, mtSymbol>* entry;
+  {
+    MutexLockerEx ml(StringTable_lock, Mutex::_no_safepoint_check_flag);
+    entry = new_entry(hashValue, string());
+  }
+  add_entry_par(index, entry);
   return string();
 }
 
@@ -771,14 +789,28 @@ oop StringTable::intern(Handle string_or_null, jchar* name,
   }
 #endif
 
-  // Grab the StringTable_lock before getting the_table() because it could
-  // change at safepoint.
-  oop added_or_found;
-  {
-    MutexLocker ml(StringTable_lock, THREAD);
+  // Grab the stripe lock covering the bucket before getting the_table()
+  // because it could change at safepoint.
+  oop added_or_found = NULL;
+  for (;;) {
+    Mutex* lock = stripe_lock(index);
+    MutexLocker ml(lock, THREAD);
+    // A rehash at a safepoint may have switched to the alternate hash code
+    // and moved the string to a bucket covered by a different stripe; if
+    // so, retry with the right lock.  basic_add recomputes the same index
+    // from the same inputs, so the lock held below covers the bucket it
+    // inserts into.
+    if (use_alternate_hashcode()) {
+      hashValue = hash_string(name, len);
+      index = the_table()->hash_to_index(hashValue);
+      if (stripe_lock(index) != lock) {
+        continue;
+      }
+    }
     // Otherwise, add to symbol to table
     added_or_found = the_table()->basic_add(index, string, name, len,
                                   hashValue, CHECK_NULL);
+    break;
   }
 
   ensure_string_alive(added_or_found);
@@ -1057,7 +1089,9 @@ StringTable::VerifyRetTypes StringTable::verify_entry(int bkt, int e_cnt,
 // - String values are unique across all entries
 //
 int StringTable::verify_and_compare_entries() {
-  assert(StringTable_lock->is_locked(), "sanity check");
+  // Inserts are striped across several locks, so only a safepoint excludes
+  // concurrent modification of the whole table.
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
 
   int  fail_cnt = 0;
 
@@ -40,6 +40,7 @@
 //  - symbolTableEntrys are allocated in blocks to reduce the space overhead.
 
 class BoolObjectClosure;
+class Mutex;
 class outputStream;
 
 
@@ -268,6 +269,17 @@ private:
   // Claimed high water mark for parallel chunked scanning
   static volatile int _parallel_claimed_idx;
 
+  // Striped insert locks.  Bucket chains are guarded by a fixed set of
+  // locks keyed by bucket index, so concurrent interns of different
+  // strings rarely contend; lookups remain lock-free.  StringTable_lock
+  // only serializes the shared entry allocator and ranks below these.
+  enum { _stripe_count = 64 }; // Power of two.
+  static Mutex* _stripe_locks[_stripe_count];
+
+  static Mutex* stripe_lock(int index) {
+    return _stripe_locks[index & (_stripe_count - 1)];
+  }
+
   static oop intern(Handle string_or_null, jchar* chars, int length, TRAPS);
   oop basic_add(int index, Handle string_or_null, jchar* name, int len,
                 unsigned int hashValue, TRAPS);
@@ -298,10 +310,7 @@ public:
   // Size of one bucket in the string table.  Used when checking for rollover.
   static uint bucket_size() { return sizeof(HashtableBucket<mtSymbol>); }
 
-  static void create_table() {
-    assert(_the_table == NULL, "One string table allowed.");
-    _the_table = new StringTable();
-  }
+  static void create_table();
 
   // GC support
   //   Delete pointers to otherwise-unreachable objects.
@@ -1825,17 +1825,29 @@ bool SystemDictionary::do_unloading(BoolObjectClosure* is_alive, bool clean_aliv
 }
 
 void SystemDictionary::roots_oops_do(OopClosure* strong, OopClosure* weak) {
-  strong->do_oop(&_java_system_loader);
-  strong->do_oop(&_system_loader_lock_obj);
-  CDS_ONLY(SystemDictionaryShared::roots_oops_do(strong);)
+  fixed_roots_oops_do(strong);
 
   // Adjust dictionary
   dictionary()->roots_oops_do(strong, weak);
+}
+
+void SystemDictionary::fixed_roots_oops_do(OopClosure* strong) {
+  strong->do_oop(&_java_system_loader);
+  strong->do_oop(&_system_loader_lock_obj);
+  CDS_ONLY(SystemDictionaryShared::roots_oops_do(strong);)
 
   // Visit extra methods
   invoke_method_table()->oops_do(strong);
 }
 
+int SystemDictionary::pd_cache_table_size() {
+  return dictionary()->pd_cache_table_size();
+}
+
+void SystemDictionary::pd_cache_buckets_oops_do(OopClosure* f, int start_idx, int end_idx) {
+  dictionary()->pd_cache_buckets_oops_do(f, start_idx, end_idx);
+}
+
 void SystemDictionary::oops_do(OopClosure* f) {
   f->do_oop(&_java_system_loader);
   f->do_oop(&_system_loader_lock_obj);
@@ -2283,10 +2295,9 @@ bool SystemDictionary::add_loader_constraint(Symbol* class_name,
 void SystemDictionary::add_resolution_error(constantPoolHandle pool, int which,
                                             Symbol* error, Symbol* message) {
   unsigned int hash = resolution_errors()->compute_hash(pool, which);
-  int index = resolution_errors()->hash_to_index(hash);
   {
     MutexLocker ml(SystemDictionary_lock, Thread::current());
-    resolution_errors()->add_entry(index, hash, pool, which, error, message);
+    resolution_errors()->add_entry(hash, pool, which, error, message);
   }
 }
 
@@ -2299,13 +2310,11 @@ void SystemDictionary::delete_resolution_error(ConstantPool* pool) {
 Symbol* SystemDictionary::find_resolution_error(constantPoolHandle pool, int which,
                                                 Symbol** message) {
   unsigned int hash = resolution_errors()->compute_hash(pool, which);
-  int index = resolution_errors()->hash_to_index(hash);
   {
     MutexLocker ml(SystemDictionary_lock, Thread::current());
-    ResolutionErrorEntry* entry = resolution_errors()->find_entry(index, hash, pool, which);
-    if (entry != NULL) {
-      *message = entry->message();
-      return entry->error();
+    Symbol* error = NULL;
+    if (resolution_errors()->find_entry(hash, pool, which, &error, message)) {
+      return error;
     } else {
       return NULL;
     }
@@ -353,6 +353,14 @@ public:
   static void oops_do(OopClosure* f);
   static void roots_oops_do(OopClosure* strong, OopClosure* weak);
 
+  // Striped root scanning support for Shenandoah. The handful of singleton
+  // roots go through fixed_roots_oops_do under a single claim; the protection
+  // domain cache, where nearly all of the heap oops behind roots_oops_do live,
+  // is visited in bucket ranges claimed by individual GC workers.
+  static void fixed_roots_oops_do(OopClosure* strong);
+  static int pd_cache_table_size();
+  static void pd_cache_buckets_oops_do(OopClosure* f, int start_idx, int end_idx);
+
   // System loader lock
   static oop system_loader_lock()           { return _system_loader_lock_obj; }
 
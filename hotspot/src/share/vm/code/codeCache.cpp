@@ -42,10 +42,12 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/icache.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/thread.hpp"
 #include "services/memoryService.hpp"
 #include "utilities/xmlstream.hpp"
 
@@ -120,24 +122,69 @@ class CodeBlob_sizes {
 // CodeCache implementation
 
 CodeHeap * CodeCache::_heap = new CodeHeap();
+CodeHeap* CodeCache::_heaps[CodeBlobType::NumTypes] = { NULL };
+int CodeCache::_number_of_heaps = 0;
+address CodeCache::_low_bound = NULL;
+address CodeCache::_high_bound = NULL;
 int CodeCache::_number_of_blobs = 0;
 int CodeCache::_number_of_adapters = 0;
 int CodeCache::_number_of_nmethods = 0;
 int CodeCache::_number_of_nmethods_with_dependencies = 0;
 bool CodeCache::_needs_cache_clean = false;
 nmethod* CodeCache::_scavenge_root_nmethods = NULL;
+volatile jlong CodeCache::_blob_free_epoch = 0;
 
 int CodeCache::_codemem_full_count = 0;
 
+CodeHeap* CodeCache::get_code_heap(int code_blob_type) {
+  assert(_number_of_heaps > 0, "code cache not initialized");
+  for (int i = 0; i < _number_of_heaps; i++) {
+    if (_heaps[i]->code_blob_type() == code_blob_type) {
+      return _heaps[i];
+    }
+  }
+  // With segmentation but without tiered compilation there is no profiled
+  // heap; profiled code goes to the non-profiled heap instead.
+  if (SegmentedCodeCache && code_blob_type == CodeBlobType::MethodProfiled) {
+    return get_code_heap(CodeBlobType::MethodNonProfiled);
+  }
+  // Without segmentation everything lives in the single heap.
+  return _heaps[0];
+}
+
+int CodeCache::heap_index(CodeHeap* heap) {
+  for (int i = 0; i < _number_of_heaps; i++) {
+    if (_heaps[i] == heap) return i;
+  }
+  ShouldNotReachHere();
+  return -1;
+}
+
+// Returns the blob following cb in its heap, moving on to the subsequent
+// heaps when the current one is exhausted.
+CodeBlob* CodeCache::next_blob(CodeHeap* heap, CodeBlob* cb) {
+  CodeBlob* next = (CodeBlob*)heap->next(cb);
+  for (int i = heap_index(heap) + 1; next == NULL && i < _number_of_heaps; i++) {
+    next = (CodeBlob*)_heaps[i]->first();
+  }
+  return next;
+}
+
 CodeBlob* CodeCache::first() {
   assert_locked_or_safepoint(CodeCache_lock);
-  return (CodeBlob*)_heap->first();
+  for (int i = 0; i < _number_of_heaps; i++) {
+    CodeBlob* cb = (CodeBlob*)_heaps[i]->first();
+    if (cb != NULL) return cb;
+  }
+  return NULL;
 }
 
 
 CodeBlob* CodeCache::next(CodeBlob* cb) {
   assert_locked_or_safepoint(CodeCache_lock);
-  return (CodeBlob*)_heap->next(cb);
+  CodeHeap* heap = get_code_heap_containing(cb);
+  assert(heap != NULL, "blob not in code cache");
+  return next_blob(heap, cb);
 }
 
 
@@ -154,27 +201,39 @@ nmethod* CodeCache::alive_nmethod(CodeBlob* cb) {
   return (nmethod*)cb;
 }
 
+// nmethod iteration skips heaps that hold no nmethods, so with a segmented
+// code cache the sweeper never touches the non-nmethod heap.
 nmethod* CodeCache::first_nmethod() {
   assert_locked_or_safepoint(CodeCache_lock);
-  CodeBlob* cb = first();
-  while (cb != NULL && !cb->is_nmethod()) {
-    cb = next(cb);
+  for (int i = 0; i < _number_of_heaps; i++) {
+    if (!_heaps[i]->contains_nmethods()) continue;
+    for (CodeBlob* cb = (CodeBlob*)_heaps[i]->first(); cb != NULL; cb = (CodeBlob*)_heaps[i]->next(cb)) {
+      if (cb->is_nmethod()) return (nmethod*)cb;
+    }
   }
-  return (nmethod*)cb;
+  return NULL;
 }
 
 nmethod* CodeCache::next_nmethod (CodeBlob* cb) {
   assert_locked_or_safepoint(CodeCache_lock);
-  cb = next(cb);
-  while (cb != NULL && !cb->is_nmethod()) {
-    cb = next(cb);
+  CodeHeap* heap = get_code_heap_containing(cb);
+  assert(heap != NULL, "blob not in code cache");
+  int i = heap_index(heap);
+  cb = (CodeBlob*)heap->next(cb);
+  while (true) {
+    while (cb != NULL) {
+      if (cb->is_nmethod()) return (nmethod*)cb;
+      cb = (CodeBlob*)_heaps[i]->next(cb);
+    }
+    do { i++; } while (i < _number_of_heaps && !_heaps[i]->contains_nmethods());
+    if (i >= _number_of_heaps) return NULL;
+    cb = (CodeBlob*)_heaps[i]->first();
   }
-  return (nmethod*)cb;
 }
 
 static size_t maxCodeCacheUsed = 0;
 
-CodeBlob* CodeCache::allocate(int size, bool is_critical) {
+CodeBlob* CodeCache::allocate(int size, bool is_critical, int code_blob_type) {
   // Do not seize the CodeCache lock here--if the caller has not
   // already done so, we are going to lose bigtime, since the code
   // cache will contain a garbage CodeBlob until the caller can
@@ -183,12 +242,24 @@ CodeBlob* CodeCache::allocate(int size, bool is_critical) {
   guarantee(size >= 0, "allocation request must be reasonable");
   assert_locked_or_safepoint(CodeCache_lock);
   CodeBlob* cb = NULL;
+  CodeHeap* heap = get_code_heap(code_blob_type);
+  CodeHeap* first_choice = heap;
   _number_of_blobs++;
   while (true) {
-    cb = (CodeBlob*)_heap->allocate(size, is_critical);
+    cb = (CodeBlob*)heap->allocate(size, is_critical);
     if (cb != NULL) break;
-    if (!_heap->expand_by(CodeCacheExpansionSize)) {
-      // Expansion failed
+    if (!heap->expand_by(CodeCacheExpansionSize)) {
+      // Expansion failed. With a segmented code cache try the sibling
+      // method heap once before reporting failure.
+      if (SegmentedCodeCache && heap == first_choice) {
+        CodeHeap* fallback = (heap->code_blob_type() == CodeBlobType::MethodNonProfiled)
+                           ? get_code_heap(CodeBlobType::MethodProfiled)
+                           : get_code_heap(CodeBlobType::MethodNonProfiled);
+        if (fallback != heap) {
+          heap = fallback;
+          continue;
+        }
+      }
       if (CodeCache_lock->owned_by_self()) {
         MutexUnlockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
         report_codemem_full();
@@ -199,13 +270,14 @@ CodeBlob* CodeCache::allocate(int size, bool is_critical) {
     }
     if (PrintCodeCacheExtension) {
       ResourceMark rm;
-      tty->print_cr("code cache extended to [" INTPTR_FORMAT ", " INTPTR_FORMAT "] (" SSIZE_FORMAT " bytes)",
-                    (intptr_t)_heap->low_boundary(), (intptr_t)_heap->high(),
-                    (address)_heap->high() - (address)_heap->low_boundary());
+      tty->print_cr("%s extended to [" INTPTR_FORMAT ", " INTPTR_FORMAT "] (" SSIZE_FORMAT " bytes)",
+                    heap->name(),
+                    (intptr_t)heap->low_boundary(), (intptr_t)heap->high(),
+                    (address)heap->high() - (address)heap->low_boundary());
     }
   }
-  maxCodeCacheUsed = MAX2(maxCodeCacheUsed, ((address)_heap->high_boundary() -
-                          (address)_heap->low_boundary()) - unallocated_capacity());
+  maxCodeCacheUsed = MAX2(maxCodeCacheUsed,
+                          (size_t)(high_bound() - low_bound()) - unallocated_capacity());
   verify_if_often();
   print_trace("allocation", cb, size);
   return cb;
@@ -227,12 +299,22 @@ void CodeCache::free(CodeBlob* cb) {
   }
   _number_of_blobs--;
 
-  _heap->deallocate(cb);
+  CodeHeap* heap = get_code_heap_containing(cb);
+  assert(heap != NULL, "blob not in code cache");
+  heap->deallocate(cb);
+
+  // Invalidate the per-thread lookup caches (jlong store is atomic also
+  // on 32 bit platforms; the update itself is serialized by the lock)
+  Atomic::store(Atomic::load(&_blob_free_epoch) + 1, &_blob_free_epoch);
 
   verify_if_often();
   assert(_number_of_blobs >= 0, "sanity check");
 }
 
+jlong CodeCache::blob_free_epoch() {
+  return Atomic::load(&_blob_free_epoch);
+}
+
 
 void CodeCache::commit(CodeBlob* cb) {
   // this is called by nmethod::nmethod, which must already own CodeCache_lock
@@ -267,7 +349,7 @@ void CodeCache::flush() {
 
 bool CodeCache::contains(void *p) {
   // It should be ok to call contains without holding a lock
-  return _heap->contains(p);
+  return get_code_heap_containing(p) != NULL;
 }
 
 
@@ -275,13 +357,52 @@ bool CodeCache::contains(void *p) {
 // looked up (i.e., one that has been marked for deletion). It only dependes on the _segmap to contain
 // valid indices, which it will always do, as long as the CodeBlob is not in the process of being recycled.
 CodeBlob* CodeCache::find_blob(void* start) {
+  Thread* const thread = ThreadLocalStorage::thread();
+  CodeBlobLookupCache* const cache = thread != NULL ? thread->codeblob_lookup_cache() : NULL;
+  if (cache != NULL) {
+    CodeBlob* const cached = cache->lookup((address)start);
+    if (cached != NULL) {
+      guarantee(!cached->is_zombie() || cached->is_locked_by_vm() || is_error_reported(), "unsafe access to zombie method");
+      return cached;
+    }
+  }
   CodeBlob* result = find_blob_unsafe(start);
   if (result == NULL) return NULL;
   // We could potientially look up non_entrant methods
   guarantee(!result->is_zombie() || result->is_locked_by_vm() || is_error_reported(), "unsafe access to zombie method");
+  if (cache != NULL) {
+    cache->add((address)start, result);
+  }
   return result;
 }
 
+CodeBlobLookupCache::CodeBlobLookupCache() : _epoch(0) {
+  memset(_pc, 0, sizeof(_pc));
+  memset(_blob, 0, sizeof(_blob));
+}
+
+CodeBlob* CodeBlobLookupCache::lookup(address pc) {
+  const jlong epoch = CodeCache::blob_free_epoch();
+  if (_epoch != epoch) {
+    // a blob was freed since the entries were cached; drop them all
+    memset(_pc, 0, sizeof(_pc));
+    _epoch = epoch;
+    return NULL;
+  }
+  const int ix = index_for(pc);
+  return _pc[ix] == pc ? _blob[ix] : NULL;
+}
+
+void CodeBlobLookupCache::add(address pc, CodeBlob* blob) {
+  assert(blob != NULL && blob->blob_contains(pc), "invariant");
+  const int ix = index_for(pc);
+  _pc[ix] = pc;
+  _blob[ix] = blob;
+  // _epoch is deliberately not refreshed here; if a free raced with the
+  // lookup that produced blob, the stale _epoch makes the next lookup
+  // discard the entries instead of trusting them.
+}
+
 nmethod* CodeCache::find_nmethod(void* start) {
   CodeBlob *cb = find_blob(start);
   assert(cb == NULL || cb->is_nmethod(), "did not find an nmethod");
@@ -312,12 +433,12 @@ void CodeCache::alive_nmethods_do(void f(nmethod* nm)) {
 }
 
 int CodeCache::alignment_unit() {
-  return (int)_heap->alignment_unit();
+  return (int)_heaps[0]->alignment_unit();
 }
 
 
 int CodeCache::alignment_offset() {
-  return (int)_heap->alignment_offset();
+  return (int)_heaps[0]->alignment_offset();
 }
 
 
@@ -585,13 +706,37 @@ void CodeCache::verify_oops() {
 
 address CodeCache::first_address() {
   assert_locked_or_safepoint(CodeCache_lock);
-  return (address)_heap->low_boundary();
+  return low_bound();
 }
 
 
 address CodeCache::last_address() {
   assert_locked_or_safepoint(CodeCache_lock);
-  return (address)_heap->high();
+  return high();
+}
+
+size_t CodeCache::capacity() {
+  size_t cap = 0;
+  for (int i = 0; i < _number_of_heaps; i++) {
+    cap += _heaps[i]->capacity();
+  }
+  return cap;
+}
+
+size_t CodeCache::max_capacity() {
+  size_t cap = 0;
+  for (int i = 0; i < _number_of_heaps; i++) {
+    cap += _heaps[i]->max_capacity();
+  }
+  return cap;
+}
+
+size_t CodeCache::unallocated_capacity() {
+  size_t unallocated = 0;
+  for (int i = 0; i < _number_of_heaps; i++) {
+    unallocated += _heaps[i]->unallocated_capacity();
+  }
+  return unallocated;
 }
 
 /**
@@ -606,6 +751,15 @@ double CodeCache::reverse_free_ratio() {
 
 void icache_init();
 
+void CodeCache::add_heap(CodeHeap* heap, ReservedSpace rs, size_t committed_size) {
+  if (!heap->reserve(rs, MIN2(committed_size, rs.size()), CodeCacheSegmentSize)) {
+    vm_exit_during_initialization("Could not reserve enough space for code cache");
+  }
+  assert(_number_of_heaps < (int)CodeBlobType::NumTypes, "too many code heaps");
+  _heaps[_number_of_heaps++] = heap;
+  MemoryService::add_code_heap_memory_pool(heap, heap->name());
+}
+
 void CodeCache::initialize() {
   assert(CodeCacheSegmentSize >= (uintx)CodeEntryAlignment, "CodeCacheSegmentSize must be large enough to align entry points");
 #ifdef COMPILER2
@@ -618,11 +772,76 @@ void CodeCache::initialize() {
   CodeCacheExpansionSize = round_to(CodeCacheExpansionSize, os::vm_page_size());
   InitialCodeCacheSize = round_to(InitialCodeCacheSize, os::vm_page_size());
   ReservedCodeCacheSize = round_to(ReservedCodeCacheSize, os::vm_page_size());
-  if (!_heap->reserve(ReservedCodeCacheSize, InitialCodeCacheSize, CodeCacheSegmentSize)) {
-    vm_exit_during_initialization("Could not reserve enough space for code cache");
-  }
+  if (SegmentedCodeCache) {
+    // Carve the heaps out of one contiguous reservation so that the
+    // [low_bound, high_bound) range and PC-relative reachability are the
+    // same as with a single heap. The non-nmethod heap comes first, so
+    // adapters and stubs end up at low addresses, away from the nmethods
+    // the sweeper scans.
+    size_t page_size = os::vm_page_size();
+    if (os::can_execute_large_page_memory()) {
+      page_size = os::page_size_for_region_unaligned(ReservedCodeCacheSize, 8);
+    }
+    const size_t granularity = os::vm_allocation_granularity();
+    const size_t r_align = MAX2(page_size, granularity);
+    const size_t rs_align = page_size == (size_t) os::vm_page_size() ? 0 :
+      MAX2(page_size, granularity);
+
+    size_t non_nmethod_size = NonNMethodCodeHeapSize;
+    if (non_nmethod_size == 0) {
+      non_nmethod_size = MIN2(ReservedCodeCacheSize / 2, (uintx)(8*M));
+    }
+    non_nmethod_size = align_size_up(non_nmethod_size, r_align);
+
+    size_t profiled_size = 0;
+    if (TieredCompilation) {
+      // Without tiered compilation no profiled nmethods are created and
+      // the space goes to the non-profiled heap.
+      profiled_size = (ProfiledCodeHeapSize != 0) ? ProfiledCodeHeapSize
+                    : (ReservedCodeCacheSize - non_nmethod_size) / 2;
+      profiled_size = align_size_down(profiled_size, r_align);
+    }
+    if (non_nmethod_size + profiled_size >= ReservedCodeCacheSize) {
+      vm_exit_during_initialization("Invalid code heap sizes: NonNMethodCodeHeapSize and "
+                                    "ProfiledCodeHeapSize must leave room in ReservedCodeCacheSize");
+    }
+    size_t non_profiled_size = ReservedCodeCacheSize - non_nmethod_size - profiled_size;
+    if (NonProfiledCodeHeapSize != 0 && NonProfiledCodeHeapSize < non_profiled_size) {
+      non_profiled_size = align_size_up(NonProfiledCodeHeapSize, r_align);
+    }
 
-  MemoryService::add_code_heap_memory_pool(_heap);
+    size_t total = align_size_up(non_nmethod_size + profiled_size + non_profiled_size, r_align);
+    ReservedCodeSpace rs(total, rs_align, rs_align > 0);
+    if (!rs.is_reserved()) {
+      vm_exit_during_initialization("Could not reserve enough space for code cache");
+    }
+    _low_bound  = (address)rs.base();
+    _high_bound = _low_bound + rs.size();
+
+    size_t committed = MAX2((size_t)align_size_up(InitialCodeCacheSize / 3, os::vm_page_size()),
+                            (size_t)os::vm_page_size());
+
+    ReservedSpace non_nmethod_space = rs.first_part(non_nmethod_size);
+    ReservedSpace rest              = rs.last_part(non_nmethod_size);
+    add_heap(new CodeHeap("CodeHeap 'non-nmethods'", CodeBlobType::NonNMethod),
+             non_nmethod_space, committed);
+    if (profiled_size > 0) {
+      add_heap(new CodeHeap("CodeHeap 'profiled nmethods'", CodeBlobType::MethodProfiled),
+               rest.first_part(profiled_size), committed);
+      rest = rest.last_part(profiled_size);
+    }
+    add_heap(new CodeHeap("CodeHeap 'non-profiled nmethods'", CodeBlobType::MethodNonProfiled),
+             rest, committed);
+  } else {
+    if (!_heap->reserve(ReservedCodeCacheSize, InitialCodeCacheSize, CodeCacheSegmentSize)) {
+      vm_exit_during_initialization("Could not reserve enough space for code cache");
+    }
+    _heaps[_number_of_heaps++] = _heap;
+    _low_bound  = (address)_heap->low_boundary();
+    _high_bound = (address)_heap->high_boundary();
+
+    MemoryService::add_code_heap_memory_pool(_heap, "Code Cache");
+  }
 
   // Initialize ICache flush mechanism
   // This service is needed for os::register_code_area
@@ -631,7 +850,7 @@ void CodeCache::initialize() {
   // Give OS a chance to register generated code area.
   // This is used on Windows 64 bit platforms to register
   // Structured Exception Handlers for our generated code.
-  os::register_code_area(_heap->low_boundary(), _heap->high_boundary());
+  os::register_code_area((char*)low_bound(), (char*)high_bound());
 }
 
 
@@ -706,16 +925,23 @@ int CodeCache::mark_for_deoptimization(DepChange& changes) {
 
 
 #ifdef HOTSWAP
-int CodeCache::mark_for_evol_deoptimization(instanceKlassHandle dependee) {
+static int method_ptr_compare(Method** a, Method** b) {
+  return *a < *b ? -1 : (*a == *b ? 0 : 1);
+}
+
+// One scan over the code cache for a whole redefinition operation, no matter
+// how many classes it changes: old_methods holds the old method versions of
+// every redefined class. Sorting it here enables the binary searches in
+// nmethod::is_evol_dependent_on.
+int CodeCache::mark_for_evol_deoptimization(GrowableArray<Method*>* old_methods) {
   MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
   int number_of_marked_CodeBlobs = 0;
 
-  // Deoptimize all methods of the evolving class itself
-  Array<Method*>* old_methods = dependee->methods();
+  old_methods->sort(method_ptr_compare);
+
+  // Deoptimize all compiled versions of the evolving methods themselves
   for (int i = 0; i < old_methods->length(); i++) {
-    ResourceMark rm;
-    Method* old_method = old_methods->at(i);
-    nmethod *nm = old_method->code();
+    nmethod* nm = old_methods->at(i)->code();
     if (nm != NULL) {
       nm->mark_for_deoptimization();
       number_of_marked_CodeBlobs++;
@@ -725,7 +951,7 @@ int CodeCache::mark_for_evol_deoptimization(instanceKlassHandle dependee) {
   FOR_ALL_ALIVE_NMETHODS(nm) {
     if (nm->is_marked_for_deoptimization()) {
       // ...Already marked in the previous pass; don't count it again.
-    } else if (nm->is_evol_dependent_on(dependee())) {
+    } else if (nm->is_evol_dependent_on(old_methods)) {
       ResourceMark rm;
       nm->mark_for_deoptimization();
       number_of_marked_CodeBlobs++;
@@ -776,7 +1002,9 @@ void CodeCache::make_marked_nmethods_not_entrant() {
 }
 
 void CodeCache::verify() {
-  _heap->verify();
+  for (int i = 0; i < _number_of_heaps; i++) {
+    _heaps[i]->verify();
+  }
   FOR_ALL_ALIVE_BLOBS(p) {
     p->verify();
   }
@@ -806,7 +1034,9 @@ void CodeCache::report_codemem_full() {
 
 void CodeCache::verify_if_often() {
   if (VerifyCodeCacheOften) {
-    _heap->verify();
+    for (int i = 0; i < _number_of_heaps; i++) {
+      _heaps[i]->verify();
+    }
   }
 }
 
@@ -978,17 +1208,36 @@ void CodeCache::print() {
 }
 
 void CodeCache::print_summary(outputStream* st, bool detailed) {
-  size_t total = (_heap->high_boundary() - _heap->low_boundary());
+  if (SegmentedCodeCache) {
+    for (int i = 0; i < _number_of_heaps; i++) {
+      CodeHeap* heap = _heaps[i];
+      size_t heap_total = (heap->high_boundary() - heap->low_boundary());
+      st->print_cr("%s: size=" SIZE_FORMAT "Kb used=" SIZE_FORMAT
+                   "Kb free=" SIZE_FORMAT "Kb",
+                   heap->name(), heap_total/K,
+                   (heap_total - heap->unallocated_capacity())/K,
+                   heap->unallocated_capacity()/K);
+      if (detailed) {
+        st->print_cr(" bounds [" INTPTR_FORMAT ", " INTPTR_FORMAT ", " INTPTR_FORMAT "]",
+                     p2i(heap->low_boundary()),
+                     p2i(heap->high()),
+                     p2i(heap->high_boundary()));
+      }
+    }
+  }
+  size_t total = (size_t)(high_bound() - low_bound());
   st->print_cr("CodeCache: size=" SIZE_FORMAT "Kb used=" SIZE_FORMAT
                "Kb max_used=" SIZE_FORMAT "Kb free=" SIZE_FORMAT "Kb",
                total/K, (total - unallocated_capacity())/K,
                maxCodeCacheUsed/K, unallocated_capacity()/K);
 
   if (detailed) {
-    st->print_cr(" bounds [" INTPTR_FORMAT ", " INTPTR_FORMAT ", " INTPTR_FORMAT "]",
-                 p2i(_heap->low_boundary()),
-                 p2i(_heap->high()),
-                 p2i(_heap->high_boundary()));
+    if (!SegmentedCodeCache) {
+      st->print_cr(" bounds [" INTPTR_FORMAT ", " INTPTR_FORMAT ", " INTPTR_FORMAT "]",
+                   p2i(low_bound()),
+                   p2i(high()),
+                   p2i(high_bound()));
+    }
     st->print_cr(" total_blobs=" UINT32_FORMAT " nmethods=" UINT32_FORMAT
                  " adapters=" UINT32_FORMAT,
                  nof_blobs(), nof_nmethods(), nof_adapters());
@@ -44,6 +44,32 @@ class OopClosure;
 class DepChange;
 class ShenandoahParallelCodeCacheIterator;
 
+// A small per-thread, direct-mapped cache of recent pc -> CodeBlob
+// resolutions, consulted by CodeCache::find_blob. Stack walking, exception
+// dispatch and stack sampling on deep stacks resolve the same return
+// addresses over and over; a hit here avoids the code heap segment map
+// walk. The entries are invalidated wholesale when any CodeBlob is freed,
+// detected by comparing against CodeCache::blob_free_epoch().
+class CodeBlobLookupCache : public CHeapObj<mtCode> {
+ private:
+  enum {
+    cache_size = 16   // must be a power of two
+  };
+  address   _pc[cache_size];
+  CodeBlob* _blob[cache_size];
+  jlong     _epoch;   // CodeCache::blob_free_epoch() the entries were cached under
+
+  static int index_for(address pc) {
+    // skip the low bits; code is aligned so they discriminate poorly
+    return (int)(((uintptr_t)pc >> 4) & (cache_size - 1));
+  }
+
+ public:
+  CodeBlobLookupCache();
+  CodeBlob* lookup(address pc);
+  void add(address pc, CodeBlob* blob);
+};
+
 class CodeCache : AllStatic {
   friend class VMStructs;
   friend class ShenandoahParallelCodeCacheIterator;
@@ -53,12 +79,24 @@ class CodeCache : AllStatic {
   // This may cause memory leak, but is necessary, for now. See 4423824,
   // 4422213 or 4436291 for details.
   static CodeHeap * _heap;
+  // With -XX:+SegmentedCodeCache the reserved space is carved into separate
+  // heaps for non-nmethod blobs, profiled and non-profiled nmethods, all
+  // sharing one contiguous reservation so that [_low_bound, _high_bound)
+  // stays a single range. _heaps[0.._number_of_heaps) lists the active heaps
+  // in address order; without segmentation it has the single entry _heap.
+  static CodeHeap* _heaps[CodeBlobType::NumTypes];
+  static int _number_of_heaps;
+  static address _low_bound;
+  static address _high_bound;
   static int _number_of_blobs;
   static int _number_of_adapters;
   static int _number_of_nmethods;
   static int _number_of_nmethods_with_dependencies;
   static bool _needs_cache_clean;
   static nmethod* _scavenge_root_nmethods;  // linked via nm->scavenge_root_link()
+  // Incremented whenever a CodeBlob is freed; per-thread lookup caches
+  // (CodeBlobLookupCache) compare against it to detect stale entries.
+  static volatile jlong _blob_free_epoch;
 
   static void verify_if_often() PRODUCT_RETURN;
 
@@ -71,15 +109,35 @@ class CodeCache : AllStatic {
   static void prune_scavenge_root_nmethods();
   static void unlink_scavenge_root_nmethod(nmethod* nm, nmethod* prev);
 
+  static void add_heap(CodeHeap* heap, ReservedSpace rs, size_t committed_size);
+  static int heap_index(CodeHeap* heap);
+  static CodeBlob* next_blob(CodeHeap* heap, CodeBlob* cb);
+
  public:
 
   // Initialization
   static void initialize();
 
+  // Mapping from compilation level and blob kind to code heap
+  static int get_code_blob_type(int comp_level) {
+    if (comp_level == CompLevel_full_profile || comp_level == CompLevel_limited_profile) {
+      return CodeBlobType::MethodProfiled;
+    }
+    return CodeBlobType::MethodNonProfiled;
+  }
+  static CodeHeap* get_code_heap(int code_blob_type);
+  static CodeHeap* get_code_heap_containing(const void* p) {
+    for (int i = 0; i < _number_of_heaps; i++) {
+      if (_heaps[i]->contains(p)) return _heaps[i];
+    }
+    return NULL;
+  }
+
   static void report_codemem_full();
 
   // Allocation/administration
-  static CodeBlob* allocate(int size, bool is_critical = false); // allocates a new CodeBlob
+  static CodeBlob* allocate(int size, bool is_critical = false,
+                            int code_blob_type = CodeBlobType::NonNMethod); // allocates a new CodeBlob
   static void commit(CodeBlob* cb);                 // called when the allocated CodeBlob has been filled
   static int alignment_unit();                      // guaranteed alignment of all CodeBlobs
   static int alignment_offset();                    // guaranteed offset of first CodeBlob byte within alignment unit (i.e., allocation header)
@@ -94,14 +152,18 @@ class CodeCache : AllStatic {
   // Lookup
   static CodeBlob* find_blob(void* start);
   static nmethod*  find_nmethod(void* start);
+  static jlong blob_free_epoch();
 
   // Lookup that does not fail if you lookup a zombie method (if you call this, be sure to know
   // what you are doing)
   static CodeBlob* find_blob_unsafe(void* start) {
     // NMT can walk the stack before code cache is created
-    if (_heap == NULL) return NULL;
+    if (_number_of_heaps == 0) return NULL;
+
+    CodeHeap* heap = get_code_heap_containing(start);
+    if (heap == NULL) return NULL;
 
-    CodeBlob* result = (CodeBlob*)_heap->find_start(start);
+    CodeBlob* result = (CodeBlob*)heap->find_start(start);
     // this assert is too strong because the heap code will return the
     // heapblock containing start. That block can often be larger than
     // the codeBlob itself. If you look up an address that is within
@@ -161,17 +223,18 @@ class CodeCache : AllStatic {
   static void print_summary(outputStream* st, bool detailed = true); // Prints a summary of the code cache usage
   static void log_state(outputStream* st);
 
-  // The full limits of the codeCache
-  static address  low_bound()                    { return (address) _heap->low_boundary(); }
-  static address  high_bound()                   { return (address) _heap->high_boundary(); }
-  static address  high()                         { return (address) _heap->high(); }
+  // The full limits of the codeCache. All heaps are carved out of one
+  // contiguous reservation, so this is always a single range.
+  static address  low_bound()                    { return _low_bound; }
+  static address  high_bound()                   { return _high_bound; }
+  static address  high()                         { return (address) _heaps[_number_of_heaps - 1]->high(); }
 
   // Profiling
   static address first_address();                // first address used for CodeBlobs
   static address last_address();                 // last  address used for CodeBlobs
-  static size_t  capacity()                      { return _heap->capacity(); }
-  static size_t  max_capacity()                  { return _heap->max_capacity(); }
-  static size_t  unallocated_capacity()          { return _heap->unallocated_capacity(); }
+  static size_t  capacity();
+  static size_t  max_capacity();
+  static size_t  unallocated_capacity();
   static double  reverse_free_ratio();
 
   static bool needs_cache_clean()                { return _needs_cache_clean; }
@@ -184,7 +247,7 @@ class CodeCache : AllStatic {
   // Deoptimization
   static int  mark_for_deoptimization(DepChange& changes);
 #ifdef HOTSWAP
-  static int  mark_for_evol_deoptimization(instanceKlassHandle dependee);
+  static int  mark_for_evol_deoptimization(GrowableArray<Method*>* old_methods);
 #endif // HOTSWAP
 
   static void mark_all_nmethods_for_deoptimization();
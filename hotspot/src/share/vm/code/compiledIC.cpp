@@ -212,7 +212,7 @@ CompiledIC::CompiledIC(RelocIterator* iter)
   initialize_from_iter(iter);
 }
 
-bool CompiledIC::set_to_megamorphic(CallInfo* call_info, Bytecodes::Code bytecode, TRAPS) {
+bool CompiledIC::set_to_megamorphic(CallInfo* call_info, Bytecodes::Code bytecode, KlassHandle receiver_klass, TRAPS) {
   assert(CompiledIC_lock->is_locked() || SafepointSynchronize::is_at_safepoint(), "");
   assert(!is_optimized(), "cannot set an optimized virtual call to megamorphic");
   assert(is_call_to_compiled() || is_call_to_interpreted(), "going directly to megamorphic?");
@@ -233,6 +233,13 @@ bool CompiledIC::set_to_megamorphic(CallInfo* call_info, Bytecodes::Code bytecod
 #endif //ASSERT
     CompiledICHolder* holder = new CompiledICHolder(call_info->resolved_method()->method_holder(),
                                                     call_info->resolved_klass()(), false);
+    if (MegamorphicReceiverPrediction && receiver_klass.not_null()) {
+      // Remember the receiver that caused the megamorphic transition, so
+      // the itable stub can dispatch repeat receivers without scanning.
+      // The fields are set before the holder is published, hence no
+      // synchronization with the stub is needed.
+      holder->set_receiver_prediction(receiver_klass(), call_info->selected_method()());
+    }
     holder->claim();
     InlineCacheBuffer::create_transition_stub(this, holder, entry);
   } else {
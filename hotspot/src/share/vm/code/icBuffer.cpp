@@ -113,7 +113,11 @@ void InlineCacheBuffer::init_next_stub() {
 
 void InlineCacheBuffer::initialize() {
   if (_buffer != NULL) return; // already initialized
-  _buffer = new StubQueue(new ICStubInterface, 10*K, InlineCacheBuffer_lock, "InlineCacheBuffer");
+  // A dispatch-heavy application can fill the buffer between safepoints and
+  // then pays for a forced safepoint per refill; such deployments can grow
+  // the buffer so that the regular safepoint cleanup absorbs the drain.
+  int size = (int)MAX2(InlineCacheBufferSize, (uintx)(10*K));
+  _buffer = new StubQueue(new ICStubInterface, size, InlineCacheBuffer_lock, "InlineCacheBuffer");
   assert (_buffer != NULL, "cannot allocate InlineCacheBuffer");
   init_next_stub();
 }
@@ -518,13 +518,13 @@ nmethod* nmethod::new_native_nmethod(methodHandle method,
   code_buffer->finalize_oop_references(method);
   // create nmethod
   nmethod* nm = NULL;
+  int native_nmethod_size = allocation_size(code_buffer, sizeof(nmethod));
+  CodeOffsets offsets;
+  offsets.set_value(CodeOffsets::Verified_Entry, vep_offset);
+  offsets.set_value(CodeOffsets::Frame_Complete, frame_complete);
   {
     MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
-    int native_nmethod_size = allocation_size(code_buffer, sizeof(nmethod));
-    CodeOffsets offsets;
-    offsets.set_value(CodeOffsets::Verified_Entry, vep_offset);
-    offsets.set_value(CodeOffsets::Frame_Complete, frame_complete);
-    nm = new (native_nmethod_size) nmethod(method(), native_nmethod_size,
+    nm = new (native_nmethod_size, CompLevel_none) nmethod(method(), native_nmethod_size,
                                             compile_id, &offsets,
                                             code_buffer, frame_size,
                                             basic_lock_owner_sp_offset,
@@ -554,15 +554,14 @@ nmethod* nmethod::new_dtrace_nmethod(methodHandle method,
   code_buffer->finalize_oop_references(method);
   // create nmethod
   nmethod* nm = NULL;
+  int nmethod_size = allocation_size(code_buffer, sizeof(nmethod));
+  CodeOffsets offsets;
+  offsets.set_value(CodeOffsets::Verified_Entry, vep_offset);
+  offsets.set_value(CodeOffsets::Dtrace_trap, trap_offset);
+  offsets.set_value(CodeOffsets::Frame_Complete, frame_complete);
   {
     MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
-    int nmethod_size = allocation_size(code_buffer, sizeof(nmethod));
-    CodeOffsets offsets;
-    offsets.set_value(CodeOffsets::Verified_Entry, vep_offset);
-    offsets.set_value(CodeOffsets::Dtrace_trap, trap_offset);
-    offsets.set_value(CodeOffsets::Frame_Complete, frame_complete);
-
-    nm = new (nmethod_size) nmethod(method(), nmethod_size,
+    nm = new (nmethod_size, CompLevel_none) nmethod(method(), nmethod_size,
                                     &offsets, code_buffer, frame_size);
 
     NOT_PRODUCT(if (nm != NULL)  nmethod_stats.note_nmethod(nm));
@@ -601,16 +600,17 @@ nmethod* nmethod::new_nmethod(methodHandle method,
   code_buffer->finalize_oop_references(method);
   // create nmethod
   nmethod* nm = NULL;
+  // Compute the size outside the critical section; burst compiles
+  // contend on CodeCache_lock during warmup, so keep it short.
+  int nmethod_size =
+    allocation_size(code_buffer, sizeof(nmethod))
+    + adjust_pcs_size(debug_info->pcs_size())
+    + round_to(dependencies->size_in_bytes() , oopSize)
+    + round_to(handler_table->size_in_bytes(), oopSize)
+    + round_to(nul_chk_table->size_in_bytes(), oopSize)
+    + round_to(debug_info->data_size()       , oopSize);
   { MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
-    int nmethod_size =
-      allocation_size(code_buffer, sizeof(nmethod))
-      + adjust_pcs_size(debug_info->pcs_size())
-      + round_to(dependencies->size_in_bytes() , oopSize)
-      + round_to(handler_table->size_in_bytes(), oopSize)
-      + round_to(nul_chk_table->size_in_bytes(), oopSize)
-      + round_to(debug_info->data_size()       , oopSize);
-
-    nm = new (nmethod_size)
+    nm = new (nmethod_size, comp_level)
     nmethod(method(), nmethod_size, compile_id, entry_bci, offsets,
             orig_pc_offset, debug_info, dependencies, code_buffer, frame_size,
             oop_maps,
@@ -827,9 +827,9 @@ nmethod::nmethod(
 }
 #endif // def HAVE_DTRACE_H
 
-void* nmethod::operator new(size_t size, int nmethod_size) throw() {
+void* nmethod::operator new(size_t size, int nmethod_size, int comp_level) throw() {
   // Not critical, may return null if there is too little continuous memory
-  return CodeCache::allocate(nmethod_size);
+  return CodeCache::allocate(nmethod_size, false, CodeCache::get_code_blob_type(comp_level));
 }
 
 nmethod::nmethod(
@@ -1749,6 +1749,10 @@ void static clean_ic_if_metadata_is_dead(CompiledIC *ic, BoolObjectClosure *is_a
     if (mark_on_stack) {
       Metadata::mark_on_stack(cichk_oop->holder_metadata());
       Metadata::mark_on_stack(cichk_oop->holder_klass());
+      if (cichk_oop->cached_receiver_klass() != NULL) {
+        Metadata::mark_on_stack(cichk_oop->cached_receiver_klass());
+        Metadata::mark_on_stack(cichk_oop->cached_method());
+      }
     }
 
     if (cichk_oop->is_loader_alive(is_alive)) {
@@ -2181,6 +2185,10 @@ void nmethod::metadata_do(void f(Metadata*)) {
           CompiledICHolder* cichk = ic->cached_icholder();
           f(cichk->holder_metadata());
           f(cichk->holder_klass());
+          if (cichk->cached_receiver_klass() != NULL) {
+            f(cichk->cached_receiver_klass());
+            f(cichk->cached_method());
+          }
         } else {
           Metadata* ic_oop = ic->cached_metadata();
           if (ic_oop != NULL) {
@@ -2550,27 +2558,29 @@ bool nmethod::check_dependency_on(DepChange& changes) {
   return found_check;
 }
 
-bool nmethod::is_evol_dependent_on(Klass* dependee) {
-  InstanceKlass *dependee_ik = InstanceKlass::cast(dependee);
-  Array<Method*>* dependee_methods = dependee_ik->methods();
+static int method_ptr_compare(Method* const& a, Method* const& b) {
+  return a < b ? -1 : (a == b ? 0 : 1);
+}
+
+bool nmethod::is_evol_dependent_on(GrowableArray<Method*>* old_methods) {
   for (Dependencies::DepStream deps(this); deps.next(); ) {
     if (deps.type() == Dependencies::evol_method) {
       Method* method = deps.method_argument(0);
-      for (int j = 0; j < dependee_methods->length(); j++) {
-        if (dependee_methods->at(j) == method) {
-          // RC_TRACE macro has an embedded ResourceMark
-          RC_TRACE(0x01000000,
-            ("Found evol dependency of nmethod %s.%s(%s) compile_id=%d on method %s.%s(%s)",
-            _method->method_holder()->external_name(),
-            _method->name()->as_C_string(),
-            _method->signature()->as_C_string(), compile_id(),
-            method->method_holder()->external_name(),
-            method->name()->as_C_string(),
-            method->signature()->as_C_string()));
-          if (TraceDependencies || LogCompilation)
-            deps.log_dependency(dependee);
-          return true;
-        }
+      bool found;
+      old_methods->find_sorted<Method*, method_ptr_compare>(method, found);
+      if (found) {
+        // RC_TRACE macro has an embedded ResourceMark
+        RC_TRACE(0x01000000,
+          ("Found evol dependency of nmethod %s.%s(%s) compile_id=%d on method %s.%s(%s)",
+          _method->method_holder()->external_name(),
+          _method->name()->as_C_string(),
+          _method->signature()->as_C_string(), compile_id(),
+          method->method_holder()->external_name(),
+          method->name()->as_C_string(),
+          method->signature()->as_C_string()));
+        if (TraceDependencies || LogCompilation)
+          deps.log_dependency(method->method_holder());
+        return true;
       }
     }
   }
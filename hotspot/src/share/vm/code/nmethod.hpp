@@ -296,7 +296,7 @@ class nmethod : public CodeBlob {
           int comp_level);
 
   // helper methods
-  void* operator new(size_t size, int nmethod_size) throw();
+  void* operator new(size_t size, int nmethod_size, int comp_level) throw();
 
   const char* reloc_string_for(u_char* begin, u_char* end);
   // Returns true if this thread changed the state of the nmethod or
@@ -746,9 +746,9 @@ public:
   bool check_dependency_on(DepChange& changes);
 
   // Evolution support. Tells if this compiled method is dependent on any of
-  // methods m() of class dependee, such that if m() in dependee is replaced,
-  // this compiled method will have to be deoptimized.
-  bool is_evol_dependent_on(Klass* dependee);
+  // the given old method versions (sorted by address), such that if one of
+  // them is replaced, this compiled method will have to be deoptimized.
+  bool is_evol_dependent_on(GrowableArray<Method*>* old_methods);
 
   // Fast breakpoint support. Tells if this compiled method is
   // dependent on the given method. Returns true if this nmethod
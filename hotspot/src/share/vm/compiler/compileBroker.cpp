@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "code/codeCache.hpp"
@@ -136,6 +137,11 @@ AbstractCompiler* CompileBroker::_compilers[2];
 volatile jint CompileBroker::_compilation_id     = 0;
 volatile jint CompileBroker::_osr_compilation_id = 0;
 
+// Compilation CPU budget control
+volatile jlong CompileBroker::_budget_last_sample = 0;
+volatile int   CompileBroker::_budget_cpu_scarce  = 0;
+double         CompileBroker::_budget_last_load   = 0.0;
+
 // Debugging information
 int  CompileBroker::_last_compile_type     = no_compile;
 int  CompileBroker::_last_compile_level    = CompLevel_none;
@@ -319,6 +325,7 @@ void CompileTask::initialize(int compile_id,
   _is_blocking = is_blocking;
   _comp_level = comp_level;
   _num_inlined_bytecodes = 0;
+  _arena_peak_bytes = 0;
 
   _is_complete = false;
   _is_success = false;
@@ -615,6 +622,9 @@ void CompileTask::log_task_done(CompileLog* log) {
   if (_num_inlined_bytecodes != 0) {
     log->print(" inlined_bytes='%d'", _num_inlined_bytecodes);
   }
+  if (_arena_peak_bytes != 0) {
+    log->print(" arena_peak_bytes='" SIZE_FORMAT "'", _arena_peak_bytes);
+  }
   log->stamp();
   log->end_elem();
   log->tail("task");
@@ -1735,6 +1745,56 @@ void CompileBroker::shutdown_compiler_runtime(AbstractCompiler* comp, CompilerTh
   }
 }
 
+// ------------------------------------------------------------------
+// CompileBroker::cpu_budget_exhausted
+//
+// Returns true if the system load exceeds the share of the CPU budget
+// granted to compilation. The load is sampled at most every 500 ms and
+// compared against the number of processors available to the process,
+// which takes cgroup CPU quotas into account in a container.
+bool CompileBroker::cpu_budget_exhausted() {
+  const jlong sample_interval = 500; // milliseconds
+  jlong now  = os::javaTimeMillis();
+  jlong last = _budget_last_sample;
+  if (now - last >= sample_interval &&
+      Atomic::cmpxchg(now, &_budget_last_sample, last) == last) {
+    double load;
+    if (os::loadavg(&load, 1) == 1) {
+      double budget = (double) os::active_processor_count() *
+                      (double) CompilationBudgetLoadPercent / 100.0;
+      _budget_last_load = load;
+      _budget_cpu_scarce = (load > budget) ? 1 : 0;
+    } else {
+      // Load average is unavailable on this platform; never defer.
+      _budget_cpu_scarce = 0;
+    }
+  }
+  return _budget_cpu_scarce != 0;
+}
+
+// ------------------------------------------------------------------
+// CompileBroker::maybe_defer_compilation
+//
+// Back off before compiling a non-blocking task while mutator threads
+// are starved for CPU. Blocking tasks have a Java thread waiting on the
+// result and are never deferred.
+void CompileBroker::maybe_defer_compilation(CompileTask* task, Thread* thread) {
+  if (!UseCompilationBudget || task->is_blocking()) {
+    return;
+  }
+  if (cpu_budget_exhausted()) {
+    EventCompilationDeferral event;
+    if (event.should_commit()) {
+      event.set_compileId(task->compile_id());
+      event.set_load((float) _budget_last_load);
+      event.set_availableProcessors(os::active_processor_count());
+      event.set_delay(CompilationBudgetDelay);
+      event.commit();
+    }
+    os::sleep(thread, CompilationBudgetDelay, false);
+  }
+}
+
 // ------------------------------------------------------------------
 // CompileBroker::compiler_thread_loop
 //
@@ -1794,6 +1854,10 @@ void CompileBroker::compiler_thread_loop() {
       continue;
     }
 
+    // Give request threads priority over background compilation when the
+    // CPU budget of the process is exhausted.
+    maybe_defer_compilation(task, thread);
+
     // Give compiler threads an extra quanta.  They tend to be bursty and
     // this helps the compiler to finish up the job.
     if( CompilerThreadHintNoPreempt )
@@ -2005,12 +2069,16 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
     TraceTime t1("compilation", &time);
     EventCompilation event;
 
+    // Track peak arena usage for this compilation.
+    thread->chunk_cache()->reset_peak();
+
     AbstractCompiler *comp = compiler(task_level);
     if (comp == NULL) {
       ci_env.record_method_not_compilable("no compiler", !TieredCompilation);
     } else {
       comp->compile_method(&ci_env, target, osr_bci);
     }
+    task->set_arena_peak_bytes(thread->chunk_cache()->peak_bytes());
 
     if (!ci_env.failing() && task->code() == NULL) {
       //assert(false, "compiler should always document failure");
@@ -2082,7 +2150,9 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
     if (task->code() != NULL) {
       tty->print("size: %d(%d) ", task->code()->total_size(), task->code()->insts_size());
     }
-    tty->print_cr("time: %d inlined: %d bytes", (int)time.milliseconds(), task->num_inlined_bytecodes());
+    tty->print_cr("time: %d inlined: %d bytes arena_peak: " SIZE_FORMAT "K",
+                  (int)time.milliseconds(), task->num_inlined_bytecodes(),
+                  task->arena_peak_bytes() / K);
   }
 
   if (PrintCodeCacheOnCompilation)
@@ -2440,3 +2510,107 @@ void CompileBroker::print_compiler_threads_on(outputStream* st) {
   st->cr();
 #endif
 }
+
+// Write one line per method in the code cache so that a later run can warm
+// up by replaying the compilations (-XX:CompilationProfileReplayFile).
+// Each line is "<comp_level> <class> <method> <signature>".
+void CompileBroker::dump_compilation_profile() {
+  assert(CompilationProfileDumpFile != NULL, "sanity");
+  fileStream fs(CompilationProfileDumpFile);
+  if (!fs.is_open()) {
+    warning("Could not open CompilationProfileDumpFile %s", CompilationProfileDumpFile);
+    return;
+  }
+  ResourceMark rm;
+  MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+  for (nmethod* nm = CodeCache::first_nmethod(); nm != NULL; nm = CodeCache::next_nmethod(nm)) {
+    // Only regular entry points are worth replaying; OSR and native
+    // wrapper compilations have no value until the method is hot again.
+    if (!nm->is_in_use() || nm->is_osr_method() || nm->is_native_method()) {
+      continue;
+    }
+    Method* m = nm->method();
+    if (m == NULL || m->is_method_handle_intrinsic() ||
+        m->method_holder()->is_anonymous()) {
+      // These methods cannot be looked up by name in the next run.
+      continue;
+    }
+    fs.print_cr("%d %s %s %s",
+                nm->comp_level(),
+                m->method_holder()->name()->as_C_string(),
+                m->name()->as_C_string(),
+                m->signature()->as_C_string());
+  }
+}
+
+// Queue again the compilations recorded by dump_compilation_profile() in a
+// previous run. Classes are resolved through the system class loader and
+// initialized, the same way CompileTheWorld does it; entries that fail to
+// resolve or that cannot be compiled in this run are silently skipped.
+void CompileBroker::replay_compilation_profile(TRAPS) {
+  assert(CompilationProfileReplayFile != NULL, "sanity");
+  FILE* fp = fopen(CompilationProfileReplayFile, "rt");
+  if (fp == NULL) {
+    warning("Could not open CompilationProfileReplayFile %s", CompilationProfileReplayFile);
+    return;
+  }
+  HandleMark hm(THREAD);
+  Handle loader (THREAD, SystemDictionary::java_system_loader());
+  char line[4096];
+  int total = 0;
+  int queued = 0;
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    char class_name[1024];
+    char method_name[1024];
+    char signature[2048];
+    int comp_level;
+    if (sscanf(line, "%d %1023s %1023s %2047s",
+               &comp_level, class_name, method_name, signature) != 4) {
+      continue;
+    }
+    total++;
+    // Clamp the recorded level to what this run supports.
+    if (TieredCompilation) {
+      if (comp_level > TieredStopAtLevel) {
+        comp_level = (int)TieredStopAtLevel;
+      }
+      if (comp_level < CompLevel_simple) {
+        continue;
+      }
+    } else {
+      comp_level = CompLevel_highest_tier;
+    }
+    ResourceMark rm(THREAD);
+    TempNewSymbol class_sym = SymbolTable::new_symbol(class_name, THREAD);
+    if (HAS_PENDING_EXCEPTION) { CLEAR_PENDING_EXCEPTION; continue; }
+    Klass* k = SystemDictionary::resolve_or_null(class_sym, loader, Handle(), THREAD);
+    if (HAS_PENDING_EXCEPTION) { CLEAR_PENDING_EXCEPTION; }
+    if (k == NULL || !k->oop_is_instance()) {
+      continue;
+    }
+    instanceKlassHandle ik (THREAD, k);
+    // compile_method() requires an initialized holder.
+    ik->initialize(THREAD);
+    if (HAS_PENDING_EXCEPTION) { CLEAR_PENDING_EXCEPTION; continue; }
+    TempNewSymbol name_sym = SymbolTable::new_symbol(method_name, THREAD);
+    if (HAS_PENDING_EXCEPTION) { CLEAR_PENDING_EXCEPTION; continue; }
+    TempNewSymbol sig_sym = SymbolTable::new_symbol(signature, THREAD);
+    if (HAS_PENDING_EXCEPTION) { CLEAR_PENDING_EXCEPTION; continue; }
+    methodHandle mh (THREAD, ik->find_method(name_sym, sig_sym));
+    if (mh.is_null() || mh->is_native() || mh->is_abstract()) {
+      continue;
+    }
+    if (!CompilationPolicy::can_be_compiled(mh, comp_level)) {
+      continue;
+    }
+    compile_method(mh, InvocationEntryBci, comp_level,
+                   methodHandle(), 0, "replayed profile", THREAD);
+    if (HAS_PENDING_EXCEPTION) { CLEAR_PENDING_EXCEPTION; continue; }
+    queued++;
+  }
+  fclose(fp);
+  if (PrintCompilation) {
+    tty->print_cr("Replayed compilation profile %s: queued %d of %d methods",
+                  CompilationProfileReplayFile, queued, total);
+  }
+}
@@ -55,6 +55,7 @@ class CompileTask : public CHeapObj<mtCompiler> {
   bool         _is_blocking;
   int          _comp_level;
   int          _num_inlined_bytecodes;
+  size_t       _arena_peak_bytes; // high-water arena usage during this compilation
   nmethodLocker* _code_handle;  // holder of eventual result
   CompileTask* _next, *_prev;
   bool         _is_free;
@@ -101,6 +102,9 @@ class CompileTask : public CHeapObj<mtCompiler> {
   int          num_inlined_bytecodes() const     { return _num_inlined_bytecodes; }
   void         set_num_inlined_bytecodes(int n)  { _num_inlined_bytecodes = n; }
 
+  size_t       arena_peak_bytes() const          { return _arena_peak_bytes; }
+  void         set_arena_peak_bytes(size_t n)    { _arena_peak_bytes = n; }
+
   CompileTask* next() const                      { return _next; }
   void         set_next(CompileTask* next)       { _next = next; }
   CompileTask* prev() const                      { return _prev; }
@@ -293,6 +297,17 @@ class CompileBroker: AllStatic {
 
   static GrowableArray<CompilerThread*>* _compiler_threads;
 
+  // Compilation CPU budget control. Samples the system load against the
+  // number of processors available to the process (which honors cgroup
+  // CPU quotas) and defers non-blocking compilations while the budget
+  // is exhausted.
+  static volatile jlong _budget_last_sample;
+  static volatile int   _budget_cpu_scarce;
+  static double         _budget_last_load;
+
+  static bool cpu_budget_exhausted();
+  static void maybe_defer_compilation(CompileTask* task, Thread* thread);
+
   // performance counters
   static PerfCounter* _perf_total_compilation;
   static PerfCounter* _perf_native_compilation;
@@ -454,6 +469,12 @@ class CompileBroker: AllStatic {
   // Print a detailed accounting of compilation time
   static void print_times();
 
+  // Ahead-of-time warmup support: record the set of compiled methods at
+  // VM exit (CompilationProfileDumpFile) and queue them again early in a
+  // subsequent run (CompilationProfileReplayFile).
+  static void dump_compilation_profile();
+  static void replay_compilation_profile(TRAPS);
+
   // Debugging output for failure
   static void print_last_compile();
 
@@ -6210,6 +6210,30 @@ void CMSRefProcTaskExecutor::execute(EnqueueTask& task)
   workers->run_task(&enq_task);
 }
 
+// Parallel scrubbing of the symbol and string tables after class unloading.
+// Workers claim fixed-size spans of buckets through the tables' claim
+// counters, the same striping G1 and Shenandoah use at remark.
+class CMSParScrubTablesTask: public AbstractGangTask {
+  BoolObjectClosure* _is_alive;
+public:
+  CMSParScrubTablesTask(BoolObjectClosure* is_alive):
+    AbstractGangTask("scrub symbol & string tables"),
+    _is_alive(is_alive)
+  {
+    SymbolTable::clear_parallel_claimed_index();
+    StringTable::clear_parallel_claimed_index();
+  }
+
+  void work(uint worker_id) {
+    int processed = 0;
+    int removed = 0;
+    SymbolTable::possibly_parallel_unlink(&processed, &removed);
+    processed = 0;
+    removed = 0;
+    StringTable::possibly_parallel_unlink(_is_alive, &processed, &removed);
+  }
+};
+
 void CMSCollector::refProcessingWork(bool asynch, bool clear_all_soft_refs) {
 
   ResourceMark rm;
@@ -6284,16 +6308,25 @@ void CMSCollector::refProcessingWork(bool asynch, bool clear_all_soft_refs) {
       Klass::clean_weak_klass_links(&_is_alive_closure);
     }
 
-    {
-      GCTraceTime t("scrub symbol table", PrintGCDetails, false, _gc_timer_cm, _gc_tracer_cm->gc_id());
-      // Clean up unreferenced symbols in symbol table.
-      SymbolTable::unlink();
-    }
+    if (CMSParallelRemarkEnabled && CollectedHeap::use_parallel_gc_threads()) {
+      GCTraceTime t("scrub symbol & string tables", PrintGCDetails, false, _gc_timer_cm, _gc_tracer_cm->gc_id());
+      GenCollectedHeap* gch = GenCollectedHeap::heap();
+      FlexibleWorkGang* workers = gch->workers();
+      assert(workers != NULL, "Need parallel worker threads.");
+      CMSParScrubTablesTask tsk(&_is_alive_closure);
+      workers->run_task(&tsk);
+    } else {
+      {
+        GCTraceTime t("scrub symbol table", PrintGCDetails, false, _gc_timer_cm, _gc_tracer_cm->gc_id());
+        // Clean up unreferenced symbols in symbol table.
+        SymbolTable::unlink();
+      }
 
-    {
-      GCTraceTime t("scrub string table", PrintGCDetails, false, _gc_timer_cm, _gc_tracer_cm->gc_id());
-      // Delete entries for dead interned strings.
-      StringTable::unlink(&_is_alive_closure);
+      {
+        GCTraceTime t("scrub string table", PrintGCDetails, false, _gc_timer_cm, _gc_tracer_cm->gc_id());
+        // Delete entries for dead interned strings.
+        StringTable::unlink(&_is_alive_closure);
+      }
     }
   }
 
@@ -6527,6 +6560,17 @@ void CMSCollector::sweepWork(ConcurrentMarkSweepGeneration* gen,
   // block iterate below; else the iterator might go awry if
   // a mutator (or promotion) causes block contents to change
   // (for instance if the allocator divvies up a block).
+  //
+  // The sweep stays single-threaded on purpose, even though the
+  // conc_workers() gang is available. The walk parses the heap block by
+  // block, so worker strides would have to be split at block boundaries
+  // that are only discoverable during the walk itself; free runs crossing
+  // a stride boundary would need handshakes between neighbouring workers
+  // to coalesce; and the yield protocol below, which releases and retakes
+  // the freelistLock and the bitMapLock mid-walk, would have to be
+  // coordinated across all workers. Per-worker free list dictionaries
+  // merged at the end would remove none of that, and the merge itself
+  // costs the same tree inserts the sweep performs today.
   // If we hold the free list lock, for all practical purposes
   // young generation GC's can't occur (they'll usually need to
   // promote), so we might as well prevent all young generation
@@ -28,9 +28,14 @@
 #include "gc_implementation/g1/g1CollectedHeap.inline.hpp"
 #include "gc_implementation/g1/g1HotCardCache.hpp"
 #include "runtime/java.hpp"
+#include "runtime/os.hpp"
 
 ConcurrentG1Refine::ConcurrentG1Refine(G1CollectedHeap* g1h, CardTableEntryClosure* refine_closure) :
   _threads(NULL), _n_threads(0),
+  _buffer_generation_rate(0.0),
+  _last_sample_time(0.0),
+  _last_sampled_processed(0),
+  _last_sampled_completed(0),
   _hot_card_cache(g1h)
 {
   // Ergomonically select initial concurrent refinement parameters
@@ -81,6 +86,59 @@ void ConcurrentG1Refine::reset_threshold_step() {
   }
 }
 
+void ConcurrentG1Refine::sample_card_generation_rate() {
+  DirtyCardQueueSet& dcqs = JavaThread::dirty_card_queue_set();
+  double now = os::elapsedTime();
+  jint processed = dcqs.processed_buffers_mut() + dcqs.processed_buffers_rs_thread();
+  jint completed = (jint)dcqs.completed_buffers_num();
+
+  if (_last_sample_time > 0.0 && now > _last_sample_time) {
+    // Buffers generated since the last sample: everything that got processed,
+    // plus the change in the queue length. Buffers drained during evacuation
+    // pauses bypass the processed counters, so clamp at zero.
+    jint generated = (processed - _last_sampled_processed) +
+                     (completed - _last_sampled_completed);
+    if (generated < 0) {
+      generated = 0;
+    }
+    double rate = (double)generated / (now - _last_sample_time);
+    // Exponential smoothing evens out sampling jitter, while still tracking
+    // a phase change within a few service intervals.
+    _buffer_generation_rate = 0.7 * _buffer_generation_rate + 0.3 * rate;
+    update_thread_thresholds();
+  }
+
+  _last_sample_time = now;
+  _last_sampled_processed = processed;
+  _last_sampled_completed = completed;
+}
+
+void ConcurrentG1Refine::update_thread_thresholds() {
+  // Predict where the queue would be one service interval from now if no
+  // worker were activated, and squeeze the activation steps together as the
+  // prediction approaches the yellow zone. Under a steady trickle the
+  // thresholds stay at their default spread and workers sleep; when a burst
+  // builds up, the workers come online before the queue spikes, and mutators
+  // are less likely to hit the red zone.
+  DirtyCardQueueSet& dcqs = JavaThread::dirty_card_queue_set();
+  double interval_sec = (double)G1ConcRefinementServiceIntervalMillis / 1000.0;
+  double predicted = (double)dcqs.completed_buffers_num() +
+                     _buffer_generation_rate * interval_sec;
+
+  double pressure = 0.0;
+  if (yellow_zone() > green_zone()) {
+    pressure = (predicted - (double)green_zone()) / (double)(yellow_zone() - green_zone());
+  }
+  pressure = MAX2(0.0, MIN2(pressure, 1.0));
+
+  int step = MAX2(1, (int)((double)thread_threshold_step() * (1.0 - pressure)));
+  for (uint i = 0; i < _n_worker_threads; i++) {
+    int threshold = MIN2<int>(step * (i + 1) + green_zone(), yellow_zone());
+    int deactivation_threshold = MAX2<int>(threshold - step, green_zone());
+    _threads[i]->update_thresholds(threshold, deactivation_threshold);
+  }
+}
+
 void ConcurrentG1Refine::init(G1RegionToSpaceMapper* card_counts_storage) {
   _hot_card_cache.initialize(card_counts_storage);
 }
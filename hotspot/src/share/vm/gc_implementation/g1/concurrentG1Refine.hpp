@@ -65,12 +65,23 @@ class ConcurrentG1Refine: public CHeapObj<mtGC> {
 
   int _thread_threshold_step;
 
+  // Smoothed update buffer generation rate, in buffers per second, sampled
+  // by the service thread. Used to activate worker threads ahead of a burst,
+  // instead of after the queue has already spiked into the yellow zone.
+  double _buffer_generation_rate;
+  double _last_sample_time;
+  jint _last_sampled_processed;
+  jint _last_sampled_completed;
+
   // We delay the refinement of 'hot' cards using the hot card cache.
   G1HotCardCache _hot_card_cache;
 
   // Reset the threshold step value based of the current zone boundaries.
   void reset_threshold_step();
 
+  // Recompute worker activation thresholds from the current generation rate.
+  void update_thread_thresholds();
+
  public:
   ConcurrentG1Refine(G1CollectedHeap* g1h, CardTableEntryClosure* refine_closure);
   ~ConcurrentG1Refine();
@@ -89,6 +100,9 @@ class ConcurrentG1Refine: public CHeapObj<mtGC> {
   // The RS sampling thread
   ConcurrentG1RefineThread * sampling_thread() const;
 
+  // Periodic activation controller work, called from the service thread.
+  void sample_card_generation_rate();
+
   static uint thread_num();
 
   void print_worker_threads_on(outputStream* st) const;
@@ -104,6 +104,9 @@ void ConcurrentG1RefineThread::run_young_rs_sampling() {
   while(!_should_terminate) {
     sample_young_list_rs_lengths();
 
+    // Piggyback the refinement activation controller on the service thread.
+    cg1r()->sample_card_generation_rate();
+
     if (os::supports_vtime()) {
       _vtime_accum = (os::elapsedVTime() - _vtime_start);
     } else {
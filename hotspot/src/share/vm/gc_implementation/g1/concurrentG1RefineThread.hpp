@@ -77,6 +77,15 @@ public:
 
   void initialize();
 
+  // Called by the service thread to shift the activation thresholds with
+  // the observed buffer generation rate. The updates are racy plain stores:
+  // the thresholds are heuristics, and the workers re-read them on every
+  // loop iteration.
+  void update_thresholds(int threshold, int deactivation_threshold) {
+    _threshold = threshold;
+    _deactivation_threshold = deactivation_threshold;
+  }
+
   // Printing
   void print() const;
   void print_on(outputStream* st) const;
@@ -113,7 +113,7 @@ void DirtyCardQueueSet::iterate_closure_all_threads(CardTableEntryClosure* cl,
   guarantee(b, "Should not be interrupted.");
 }
 
-bool DirtyCardQueueSet::mut_process_buffer(void** buf) {
+bool DirtyCardQueueSet::mut_process_buffer(void** buf, size_t& index) {
 
   // Used to determine if we had already claimed a par_id
   // before entering this method.
@@ -141,8 +141,28 @@ bool DirtyCardQueueSet::mut_process_buffer(void** buf) {
 
   bool b = false;
   if (worker_i != UINT_MAX) {
-    b = DirtyCardQueue::apply_closure_to_buffer(_mut_process_closure, buf, 0,
-                                                _sz, true, worker_i);
+    // Bound the number of cards a single handoff may refine, so that queue
+    // spikes show up as more buffers for the refinement threads instead of
+    // long stalls on random mutators. Once the queue has grown well past
+    // the red zone the brakes come off: at that point refinement has lost
+    // the race and mutators must pay full freight to bound the queue.
+    size_t stop_at = _sz;
+    if (G1ConcRefinementMutatorCardLimit > 0 &&
+        (int)_n_completed_buffers < 2 * _max_completed_queue) {
+      size_t limit_bytes = (size_t)G1ConcRefinementMutatorCardLimit * oopSize;
+      if (_sz - index > limit_bytes) {
+        stop_at = index + limit_bytes;
+      }
+    }
+
+    b = DirtyCardQueue::apply_closure_to_buffer(_mut_process_closure, buf, index,
+                                                stop_at, true, worker_i);
+    if (b && stop_at != _sz) {
+      // Card limit hit with the prefix fully processed: hand the rest of
+      // the buffer back to the caller for enqueueing.
+      index = stop_at;
+      b = false;
+    }
     if (b) Atomic::inc(&_processed_buffers_mut);
 
     // If we had not claimed an id before entering the method
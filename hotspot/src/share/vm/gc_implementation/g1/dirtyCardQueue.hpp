@@ -86,7 +86,7 @@ class DirtyCardQueueSet: public PtrQueueSet {
   DirtyCardQueue _shared_dirty_card_queue;
 
   // Override.
-  bool mut_process_buffer(void** buf);
+  bool mut_process_buffer(void** buf, size_t& index);
 
   // Protected by the _cbl_mon.
   FreeIdSet* _free_ids;
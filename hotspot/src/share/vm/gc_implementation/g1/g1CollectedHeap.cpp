@@ -562,7 +562,15 @@ HeapRegion* G1CollectedHeap::new_region(size_t word_size, bool is_old, bool do_e
     }
   }
 
-  res = _hrm.allocate_free_region(is_old);
+  if (!is_old && UseNUMA && os::numa_get_groups_num() > 1 &&
+      Thread::current()->is_Java_thread()) {
+    // A young region requested by a Java thread becomes a mutator (eden)
+    // region; prefer one on the allocating thread's node, since TLABs carved
+    // from it are what the thread touches most.
+    res = _hrm.allocate_free_region_prefer_node(is_old, (uint) os::numa_get_group_id());
+  } else {
+    res = _hrm.allocate_free_region(is_old);
+  }
 
   if (res == NULL) {
     if (G1ConcRegionFreeingVerbose) {
@@ -819,13 +827,17 @@ HeapWord* G1CollectedHeap::humongous_obj_allocate(size_t word_size, AllocationCo
   return result;
 }
 
-HeapWord* G1CollectedHeap::allocate_new_tlab(size_t word_size) {
+HeapWord* G1CollectedHeap::allocate_new_tlab(size_t min_size, size_t requested_size, size_t* actual_size) {
   assert_heap_not_locked_and_not_at_safepoint();
-  assert(!isHumongous(word_size), "we do not allow humongous TLABs");
+  assert(!isHumongous(requested_size), "we do not allow humongous TLABs");
 
   uint dummy_gc_count_before;
   uint dummy_gclocker_retry_count = 0;
-  return attempt_allocation(word_size, &dummy_gc_count_before, &dummy_gclocker_retry_count);
+  HeapWord* result = attempt_allocation(requested_size, &dummy_gc_count_before, &dummy_gclocker_retry_count);
+  if (result != NULL) {
+    *actual_size = requested_size;
+  }
+  return result;
 }
 
 HeapWord*
@@ -3708,7 +3720,7 @@ class RegisterHumongousWithInCSetFastTestClosure : public HeapRegionClosure {
   bool is_remset_small(HeapRegion* region) const {
     HeapRegionRemSet* const rset = region->rem_set();
     return G1EagerReclaimHumongousObjectsWithStaleRefs
-      ? rset->occupancy_less_or_equal_than(G1RSetSparseRegionEntries)
+      ? rset->occupancy_less_or_equal_than(G1EagerReclaimRemSetThreshold)
       : rset->is_empty();
   }
 
@@ -3783,7 +3795,7 @@ class RegisterHumongousWithInCSetFastTestClosure : public HeapRegionClosure {
       // re-evaluation of their remembered set entries during the following evacuation
       // phase.
       if (!r->rem_set()->is_empty()) {
-        guarantee(r->rem_set()->occupancy_less_or_equal_than(G1RSetSparseRegionEntries),
+        guarantee(r->rem_set()->occupancy_less_or_equal_than(G1EagerReclaimRemSetThreshold),
                   "Found a not-small remembered set here. This is inconsistent with previous assumptions.");
         G1SATBCardTableLoggingModRefBS* bs = g1h->g1_barrier_set();
         HeapRegionRemSetIterator hrrs(r->rem_set());
@@ -240,6 +240,26 @@ class G1AdjustPointersClosure: public HeapRegionClosure {
   }
 };
 
+// Adjusting pointers only rewrites oop fields within the claimed region, and
+// reads nothing but forwarding pointers installed in phase 2 from the other
+// regions, so regions can be processed independently. Humongous objects are
+// adjusted by whoever claims their start region.
+class G1ParAdjustPointersTask: public AbstractGangTask {
+  G1CollectedHeap* _g1h;
+public:
+  G1ParAdjustPointersTask(G1CollectedHeap* g1h) :
+    AbstractGangTask("G1ParAdjustPointersTask"),
+    _g1h(g1h)
+  { }
+
+  void work(uint worker_id) {
+    G1AdjustPointersClosure blk;
+    _g1h->heap_region_par_iterate_chunked(&blk, worker_id,
+                                          _g1h->workers()->active_workers(),
+                                          HeapRegion::ParAdjustPointersClaimValue);
+  }
+};
+
 void G1MarkSweep::mark_sweep_phase3() {
   G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
@@ -272,8 +292,22 @@ void G1MarkSweep::mark_sweep_phase3() {
 
   GenMarkSweep::adjust_marks();
 
-  G1AdjustPointersClosure blk;
-  g1h->heap_region_iterate(&blk);
+  if (G1CollectedHeap::use_parallel_gc_threads()) {
+    uint n_workers = g1h->workers()->active_workers();
+    assert(n_workers > 0, "Active workers not properly set");
+    assert(g1h->check_heap_region_claim_values(HeapRegion::InitialClaimValue),
+           "sanity check");
+    g1h->set_par_threads(n_workers);
+    G1ParAdjustPointersTask task(g1h);
+    g1h->workers()->run_task(&task);
+    g1h->set_par_threads(0);
+    assert(g1h->check_heap_region_claim_values(HeapRegion::ParAdjustPointersClaimValue),
+           "sanity check");
+    g1h->reset_heap_region_claim_values();
+  } else {
+    G1AdjustPointersClosure blk;
+    g1h->heap_region_iterate(&blk);
+  }
 }
 
 class G1SpaceCompactClosure: public HeapRegionClosure {
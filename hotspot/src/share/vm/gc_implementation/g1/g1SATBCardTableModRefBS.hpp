@@ -86,8 +86,8 @@ public:
   }
 
   template <class T> void write_ref_array_pre_work(T* dst, int count);
-  virtual void write_ref_array_pre(oop* dst, int count, bool dest_uninitialized);
-  virtual void write_ref_array_pre(narrowOop* dst, int count, bool dest_uninitialized);
+  virtual void write_ref_array_pre_work(oop* dst, int count, bool dest_uninitialized);
+  virtual void write_ref_array_pre_work(narrowOop* dst, int count, bool dest_uninitialized);
 
 /*
    Claimed and deferred bits are used together in G1 during the evacuation
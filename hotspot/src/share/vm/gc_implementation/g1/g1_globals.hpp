@@ -119,6 +119,13 @@
   product(intx, G1UpdateBufferSize, 256,                                    \
           "Size of an update buffer")                                       \
                                                                             \
+  product(intx, G1ConcRefinementMutatorCardLimit, 64,                       \
+          "The maximum number of cards a mutator refines on a single "      \
+          "update buffer handoff when refinement has fallen behind; the "   \
+          "rest of the buffer is left for the refinement threads. Bounds "  \
+          "mutator latency spikes at the red zone. A value of 0 means "     \
+          "mutators refine whole buffers.")                                 \
+                                                                            \
   product(intx, G1ConcRefinementYellowZone, 0,                              \
           "Number of enqueued update buffers that will "                    \
           "trigger concurrent processing. Will be selected ergonomically "  \
@@ -281,6 +288,12 @@
           "Try to reclaim dead large objects that have a few stale "        \
           "references at every young GC.")                                  \
                                                                             \
+  experimental(uintx, G1EagerReclaimRemSetThreshold, 0,                     \
+          "Maximum number of remembered set entries a humongous region "    \
+          "otherwise eligible for eager reclaim may have to be a "          \
+          "candidate for eager reclaim. Will be selected ergonomically "    \
+          "by default.")                                                    \
+                                                                            \
   experimental(bool, G1TraceEagerReclaimHumongousObjects, false,            \
           "Print some information about large object liveness "             \
           "at every young GC.")                                             \
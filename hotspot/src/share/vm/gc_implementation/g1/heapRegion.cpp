@@ -37,6 +37,7 @@
 #include "memory/space.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/orderAccess.inline.hpp"
+#include "runtime/os.hpp"
 #include "gc_implementation/g1/heapRegionTracer.hpp"
 
 PRAGMA_FORMAT_MUTE_WARNINGS_FOR_GCC
@@ -331,6 +332,17 @@ void HeapRegion::initialize(MemRegion mr, bool clear_space, bool mangle_space) {
   record_timestamp();
 }
 
+uint HeapRegion::numa_node() const {
+  assert(UseNUMA, "Only ask this with NUMA enabled");
+  return (uint)(_hrm_index % os::numa_get_groups_num());
+}
+
+void HeapRegion::numa_make_local() {
+  if (UseNUMA && os::numa_get_groups_num() > 1) {
+    os::numa_make_local((char*) bottom(), HeapRegion::GrainBytes, (int) numa_node());
+  }
+}
+
 void HeapRegion::report_region_type_change(G1HeapRegionTraceType::Type to) {
   HeapRegionTracer::send_region_type_change(_hrm_index,
                                             get_trace_type(),
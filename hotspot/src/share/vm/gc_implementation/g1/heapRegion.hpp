@@ -344,7 +344,8 @@ class HeapRegion: public G1OffsetTableContigSpace {
     ParEvacFailureClaimValue   = 6,
     AggregateCountClaimValue   = 7,
     VerifyCountClaimValue      = 8,
-    ParMarkRootClaimValue      = 9
+    ParMarkRootClaimValue      = 9,
+    ParAdjustPointersClaimValue = 10
   };
 
   // All allocated blocks are occupied by objects in a HeapRegion
@@ -361,6 +362,14 @@ class HeapRegion: public G1OffsetTableContigSpace {
   // sequence, otherwise -1.
   uint hrm_index() const { return _hrm_index; }
 
+  // The NUMA node this region's memory is bound to. Regions are interleaved
+  // round-robin across the nodes, see numa_make_local().
+  uint numa_node() const;
+  // Bind this region's memory to its node. Called when the region is
+  // committed; mutator region allocation prefers node-local regions, see
+  // G1CollectedHeap::new_region().
+  void numa_make_local();
+
   // The number of bytes marked live in the region in the last marking phase.
   size_t marked_bytes()    { return _prev_marked_bytes; }
   size_t live_bytes() {
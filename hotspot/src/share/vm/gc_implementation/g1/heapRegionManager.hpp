@@ -173,6 +173,18 @@ public:
     return hr;
   }
 
+  // Variant that prefers a free region on the given NUMA node, falling back
+  // to the regular policy when the node has no free regions.
+  HeapRegion* allocate_free_region_prefer_node(bool is_old, uint node) {
+    HeapRegion* hr = _free_list.remove_region_on_node(node);
+    if (hr == NULL) {
+      return allocate_free_region(is_old);
+    }
+    assert(hr->next() == NULL, "Single region should not have next");
+    assert(is_available(hr->hrm_index()), "Must be committed");
+    return hr;
+  }
+
   inline void allocate_free_regions_starting_at(uint first, uint num_regions);
 
   // Remove all regions from the free list.
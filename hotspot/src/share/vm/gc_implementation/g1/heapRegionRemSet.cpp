@@ -880,6 +880,17 @@ void HeapRegionRemSet::setup_remset_size() {
   if (FLAG_IS_DEFAULT(G1RSetRegionEntries)) {
     G1RSetRegionEntries = G1RSetRegionEntriesBase * (region_size_log_mb + 1);
   }
+  if (FLAG_IS_DEFAULT(G1EagerReclaimRemSetThreshold)) {
+    G1EagerReclaimRemSetThreshold = (uintx)G1RSetSparseRegionEntries;
+  } else if (G1EagerReclaimRemSetThreshold > (uintx)G1RSetSparseRegionEntries) {
+    // Occupancy checks against the remembered set are only cheap while the
+    // entries fit in the sparse table; raise G1RSetSparseRegionEntries to
+    // track more incoming references per humongous region.
+    warning("G1EagerReclaimRemSetThreshold (" UINTX_FORMAT ") is limited by "
+            "G1RSetSparseRegionEntries (" INTX_FORMAT ")",
+            G1EagerReclaimRemSetThreshold, G1RSetSparseRegionEntries);
+    G1EagerReclaimRemSetThreshold = (uintx)G1RSetSparseRegionEntries;
+  }
   guarantee(G1RSetSparseRegionEntries > 0 && G1RSetRegionEntries > 0 , "Sanity");
 }
 
@@ -128,6 +128,36 @@ void FreeRegionList::remove_all() {
   verify_optional();
 }
 
+HeapRegion* FreeRegionList::remove_region_on_node(uint node) {
+  check_mt_safety();
+  verify_optional();
+
+  for (HeapRegion* curr = _head; curr != NULL; curr = curr->next()) {
+    if (curr->numa_node() != node) {
+      continue;
+    }
+    if (curr->prev() != NULL) {
+      curr->prev()->set_next(curr->next());
+    } else {
+      _head = curr->next();
+    }
+    if (curr->next() != NULL) {
+      curr->next()->set_prev(curr->prev());
+    } else {
+      _tail = curr->prev();
+    }
+    curr->set_next(NULL);
+    curr->set_prev(NULL);
+    if (_last == curr) {
+      _last = NULL;
+    }
+    // remove() will verify the region and check mt safety.
+    remove(curr);
+    return curr;
+  }
+  return NULL;
+}
+
 void FreeRegionList::add_ordered(FreeRegionList* from_list) {
   check_mt_safety();
   from_list->check_mt_safety();
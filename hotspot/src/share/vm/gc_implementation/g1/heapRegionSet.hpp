@@ -232,6 +232,11 @@ public:
   // Removes from head or tail based on the given argument.
   HeapRegion* remove_region(bool from_head);
 
+  // Removes the first region on the given NUMA node, or returns NULL if the
+  // list has none. May scan the whole list, so callers should be prepared to
+  // fall back to remove_region().
+  HeapRegion* remove_region_on_node(uint node);
+
   // Merge two ordered lists. The result is also ordered. The order is
   // determined by hrm_index.
   void add_ordered(FreeRegionList* from_list);
@@ -202,11 +202,16 @@ bool PtrQueueSet::process_or_enqueue_complete_buffer(void** buf) {
     // We don't lock. It is fine to be epsilon-precise here.
     if (_max_completed_queue == 0 || _max_completed_queue > 0 &&
         _n_completed_buffers >= _max_completed_queue + _completed_queue_padding) {
-      bool b = mut_process_buffer(buf);
+      size_t index = 0;
+      bool b = mut_process_buffer(buf, index);
       if (b) {
         // True here means that the buffer hasn't been deallocated and the caller may reuse it.
         return true;
       }
+      // The mutator may have processed a prefix of the buffer before handing
+      // it off; enqueue only the unprocessed remainder.
+      enqueue_complete_buffer(buf, index);
+      return false;
     }
   }
   // The buffer will be enqueued. The caller will have to get a new one.
@@ -240,8 +240,10 @@ protected:
 protected:
   // A mutator thread does the the work of processing a buffer.
   // Returns "true" iff the work is complete (and the buffer may be
-  // deallocated).
-  virtual bool mut_process_buffer(void** buf) {
+  // deallocated). "index" is the first valid entry on the way in; on a
+  // "false" return it holds the first entry the mutator did not process,
+  // so the caller can enqueue just the unprocessed remainder.
+  virtual bool mut_process_buffer(void** buf, size_t& index) {
     ShouldNotReachHere();
     return false;
   }
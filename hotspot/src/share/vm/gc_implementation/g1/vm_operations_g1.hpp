@@ -114,6 +114,7 @@ public:
   VM_CGC_Operation(VoidClosure* cl, const char *printGCMsg, bool needs_pll)
     : _cl(cl), _printGCMessage(printGCMsg), _needs_pll(needs_pll) { }
   virtual VMOp_Type type() const { return VMOp_CGC_Operation; }
+  virtual LatencyClass latency_class() const { return _latency_batch; }
   virtual void doit();
   virtual bool doit_prologue();
   virtual void doit_epilogue();
@@ -320,6 +320,25 @@ void UpdateDensePrefixTask::do_it(GCTaskManager* manager, uint which) {
                                                          _region_index_end);
 }
 
+SummarizeChunkTask::SummarizeChunkTask(
+                                   PSParallelCompact::SpaceId space_id,
+                                   size_t region_index_start,
+                                   size_t region_index_end,
+                                   HeapWord* dest_addr) :
+  _space_id(space_id), _region_index_start(region_index_start),
+  _region_index_end(region_index_end), _dest_addr(dest_addr) {}
+
+void SummarizeChunkTask::do_it(GCTaskManager* manager, uint which) {
+
+  NOT_PRODUCT(GCTraceTime tm("SummarizeChunkTask",
+    PrintGCDetails && TraceParallelOldGCTasks, true, NULL, PSParallelCompact::gc_tracer()->gc_id()));
+
+  PSParallelCompact::summarize_quick_chunk(_space_id,
+                                           _region_index_start,
+                                           _region_index_end,
+                                           _dest_addr);
+}
+
 void DrainStacksCompactionTask::do_it(GCTaskManager* manager, uint which) {
   assert(Universe::heap()->is_gc_active(), "called outside gc");
 
@@ -235,6 +235,33 @@ class UpdateDensePrefixTask : public GCTask {
   virtual void do_it(GCTaskManager* manager, uint which);
 };
 
+//
+// SummarizeChunkTask
+//
+// This task summarizes a chunk of a space into itself during the quick
+// summarization pass of the summary phase.  The starting destination is
+// computed by the enqueuing code from prefix sums of the per-region live
+// data, which makes the chunks independent of each other.
+//
+
+class SummarizeChunkTask : public GCTask {
+ private:
+  PSParallelCompact::SpaceId _space_id;
+  size_t _region_index_start;
+  size_t _region_index_end;
+  HeapWord* _dest_addr;
+
+ public:
+  char* name() { return (char *)"summarize-chunk-task"; }
+
+  SummarizeChunkTask(PSParallelCompact::SpaceId space_id,
+                     size_t region_index_start,
+                     size_t region_index_end,
+                     HeapWord* dest_addr);
+
+  virtual void do_it(GCTaskManager* manager, uint which);
+};
+
 //
 // DrainStacksCompactionTask
 //
@@ -140,6 +140,10 @@ void PSAdaptiveSizePolicy::major_collection_end(size_t amount_live,
     // Sample for performance counter
     _avg_major_pause->sample(major_pause_in_seconds);
 
+    if (UseDynamicNumberOfGCThreads) {
+      _major_worker_feedback.sample_pause(major_pause_in_seconds);
+    }
+
     // Cost of collection (unit-less)
     double collection_cost = 0.0;
     if ((_latest_major_mutator_interval_seconds > 0.0) &&
@@ -192,6 +196,67 @@ void PSAdaptiveSizePolicy::major_collection_end(size_t amount_live,
   _major_timer.start();
 }
 
+void PSAdaptiveSizePolicy::minor_collection_end(GCCause::Cause gc_cause) {
+  AdaptiveSizePolicy::minor_collection_end(gc_cause);
+  // The base class has stopped and reset the minor timer; the pause it
+  // measured is the last sample of the pause average.
+  if (UseDynamicNumberOfGCThreads &&
+      (gc_cause != GCCause::_java_lang_system_gc ||
+       UseAdaptiveSizePolicyWithSystemGC)) {
+    _minor_worker_feedback.sample_pause(avg_minor_pause()->last_sample());
+  }
+}
+
+uint PSAdaptiveSizePolicy::PSWorkerFeedback::recommend(uint ergonomic_workers) {
+  if (_workers == 0) {
+    // First pause: take the ergonomic choice and probe downwards first,
+    // since the common mis-sizing is more workers than the phase can use.
+    _workers = ergonomic_workers;
+  }
+  // Never exceed the ergonomic choice, and keep at least two workers so
+  // work stealing stays alive.
+  uint min_workers = MIN2(2u, ergonomic_workers);
+  _workers = MAX2(min_workers, MIN2(_workers, ergonomic_workers));
+  return _workers;
+}
+
+void PSAdaptiveSizePolicy::PSWorkerFeedback::sample_pause(double seconds) {
+  if (_workers == 0) {
+    // No recommendation has been taken yet.
+    return;
+  }
+  _sum_pause += seconds;
+  _samples++;
+  if (_samples < SamplesPerStep) {
+    return;
+  }
+
+  double avg_pause = _sum_pause / (double)_samples;
+  if (_prev_workers != 0 && avg_pause > _prev_avg_pause * 1.05) {
+    // The last move regressed the pause beyond noise: step back to the
+    // previous choice and turn around.
+    uint regressed = _workers;
+    _workers = _prev_workers;
+    _direction = (regressed > _prev_workers) ? -1 : 1;
+  } else {
+    // Pause held or improved: remember this choice as the baseline and
+    // keep probing in the same direction.
+    _prev_workers = _workers;
+    _prev_avg_pause = avg_pause;
+    if (_direction < 0 && _workers > 1) {
+      _workers--;
+    } else {
+      _workers++;
+    }
+    if (TraceDynamicGCThreads) {
+      gclog_or_tty->print_cr("PSWorkerFeedback: avg pause %f at %u workers, "
+                             "probing %u", avg_pause, _prev_workers, _workers);
+    }
+  }
+  _sum_pause = 0.0;
+  _samples = 0;
+}
+
 // If the remaining free space in the old generation is less that
 // that expected to be needed by the next collection, do a full
 // collection now.
@@ -128,6 +128,42 @@ class PSAdaptiveSizePolicy : public AdaptiveSizePolicy {
   // boundary over live data.
   size_t _bytes_absorbed_from_eden;
 
+ public:
+  // Hill-climbing controller for the number of GC workers one pause kind
+  // should use. Scavenges and full compactions scale differently (a scavenge
+  // dominated by a single large promotion gains nothing from extra workers),
+  // so each keeps its own instance. Starting from the ergonomic choice, the
+  // controller probes one worker at a time and keeps a move only when the
+  // averaged pause time does not regress beyond noise.
+  class PSWorkerFeedback VALUE_OBJ_CLASS_SPEC {
+   private:
+    uint   _workers;          // current choice, 0 before the first pause
+    uint   _prev_workers;     // previous choice, 0 if none yet
+    double _prev_avg_pause;   // averaged pause observed at the previous choice
+    double _sum_pause;        // pauses accumulated at the current choice
+    uint   _samples;
+    int    _direction;        // +1 adding workers, -1 removing workers
+
+    // Number of pauses to average before judging a worker-count move.
+    static const uint SamplesPerStep = 3;
+
+   public:
+    PSWorkerFeedback() :
+      _workers(0), _prev_workers(0), _prev_avg_pause(0.0),
+      _sum_pause(0.0), _samples(0), _direction(-1) { }
+
+    // The worker count to use for the next pause. The ergonomic choice
+    // already discounts for other load on the machine and is never exceeded.
+    uint recommend(uint ergonomic_workers);
+
+    // Feed back the pause time observed with the current choice.
+    void sample_pause(double seconds);
+  };
+
+ private:
+  PSWorkerFeedback _minor_worker_feedback;
+  PSWorkerFeedback _major_worker_feedback;
+
  private:
 
   // Accessors
@@ -240,6 +276,13 @@ class PSAdaptiveSizePolicy : public AdaptiveSizePolicy {
   void major_collection_begin();
   void major_collection_end(size_t amount_live, GCCause::Cause gc_cause);
 
+  // Override, additionally feeds the pause into the scavenge worker
+  // feedback. The major side does the same in major_collection_end().
+  virtual void minor_collection_end(GCCause::Cause gc_cause);
+
+  PSWorkerFeedback* minor_worker_feedback() { return &_minor_worker_feedback; }
+  PSWorkerFeedback* major_worker_feedback() { return &_major_worker_feedback; }
+
   void tenured_allocation(size_t size) {
     _avg_pretenured->sample(size);
   }
@@ -658,38 +658,22 @@ ParallelCompactData::summarize_split_space(size_t src_region,
   return source_next;
 }
 
-bool ParallelCompactData::summarize(SplitInfo& split_info,
-                                    HeapWord* source_beg, HeapWord* source_end,
-                                    HeapWord** source_next,
-                                    HeapWord* target_beg, HeapWord* target_end,
-                                    HeapWord** target_next)
+size_t ParallelCompactData::summarize_chunk(SplitInfo& split_info,
+                                            size_t beg_region, size_t end_region,
+                                            HeapWord** dest_addr, HeapWord* target_end)
 {
-  if (TraceParallelOldGCSummaryPhase) {
-    HeapWord* const source_next_val = source_next == NULL ? NULL : *source_next;
-    tty->print_cr("sb=" PTR_FORMAT " se=" PTR_FORMAT " sn=" PTR_FORMAT
-                  "tb=" PTR_FORMAT " te=" PTR_FORMAT " tn=" PTR_FORMAT,
-                  source_beg, source_end, source_next_val,
-                  target_beg, target_end, *target_next);
-  }
-
-  size_t cur_region = addr_to_region_idx(source_beg);
-  const size_t end_region = addr_to_region_idx(region_align_up(source_end));
-
-  HeapWord *dest_addr = target_beg;
+  size_t cur_region = beg_region;
+  HeapWord* dest = *dest_addr;
   while (cur_region < end_region) {
     // The destination must be set even if the region has no data.
-    _region_data[cur_region].set_destination(dest_addr);
+    _region_data[cur_region].set_destination(dest);
 
     size_t words = _region_data[cur_region].data_size();
     if (words > 0) {
-      // If cur_region does not fit entirely into the target space, find a point
-      // at which the source space can be 'split' so that part is copied to the
-      // target space and the rest is copied elsewhere.
-      if (dest_addr + words > target_end) {
-        assert(source_next != NULL, "source_next is NULL when splitting");
-        *source_next = summarize_split_space(cur_region, split_info, dest_addr,
-                                             target_end, target_next);
-        return false;
+      // If cur_region does not fit entirely into the target space, stop here
+      // and let the caller decide how to split the source space.
+      if (dest + words > target_end) {
+        break;
       }
 
       // Compute the destination_count for cur_region, and if necessary, update
@@ -715,8 +699,8 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
         }
       }
 
-      HeapWord* const last_addr = dest_addr + words - 1;
-      const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+      HeapWord* const last_addr = dest + words - 1;
+      const size_t dest_region_1 = addr_to_region_idx(dest);
       const size_t dest_region_2 = addr_to_region_idx(last_addr);
 
       // Initially assume that the destination regions will be the same and
@@ -729,7 +713,7 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
         destination_count += 1;
         // Data from cur_region will be copied to the start of dest_region_2.
         _region_data[dest_region_2].set_source_region(cur_region);
-      } else if (region_offset(dest_addr) == 0) {
+      } else if (region_offset(dest) == 0) {
         // Data from cur_region will be copied to the start of the destination
         // region.
         _region_data[dest_region_1].set_source_region(cur_region);
@@ -737,12 +721,46 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
 
       _region_data[cur_region].set_destination_count(destination_count);
       _region_data[cur_region].set_data_location(region_to_addr(cur_region));
-      dest_addr += words;
+      dest += words;
     }
 
     ++cur_region;
   }
 
+  *dest_addr = dest;
+  return cur_region;
+}
+
+bool ParallelCompactData::summarize(SplitInfo& split_info,
+                                    HeapWord* source_beg, HeapWord* source_end,
+                                    HeapWord** source_next,
+                                    HeapWord* target_beg, HeapWord* target_end,
+                                    HeapWord** target_next)
+{
+  if (TraceParallelOldGCSummaryPhase) {
+    HeapWord* const source_next_val = source_next == NULL ? NULL : *source_next;
+    tty->print_cr("sb=" PTR_FORMAT " se=" PTR_FORMAT " sn=" PTR_FORMAT
+                  "tb=" PTR_FORMAT " te=" PTR_FORMAT " tn=" PTR_FORMAT,
+                  source_beg, source_end, source_next_val,
+                  target_beg, target_end, *target_next);
+  }
+
+  size_t cur_region = addr_to_region_idx(source_beg);
+  const size_t end_region = addr_to_region_idx(region_align_up(source_end));
+
+  HeapWord* dest_addr = target_beg;
+  cur_region = summarize_chunk(split_info, cur_region, end_region,
+                               &dest_addr, target_end);
+  if (cur_region < end_region) {
+    // The data in cur_region does not fit entirely into the target space; find
+    // a point at which the source space can be 'split' so that part is copied
+    // to the target space and the rest is copied elsewhere.
+    assert(source_next != NULL, "source_next is NULL when splitting");
+    *source_next = summarize_split_space(cur_region, split_info, dest_addr,
+                                         target_end, target_next);
+    return false;
+  }
+
   *target_next = dest_addr;
   return true;
 }
@@ -1667,16 +1685,64 @@ PSParallelCompact::provoke_split(bool & max_compaction)
 }
 #endif // #ifndef PRODUCT
 
+void PSParallelCompact::summarize_quick_chunk(SpaceId id,
+                                              size_t beg_region,
+                                              size_t end_region,
+                                              HeapWord* dest_addr)
+{
+  const MutableSpace* space = _space_info[id].space();
+  size_t result = _summary_data.summarize_chunk(_space_info[id].split_info(),
+                                                beg_region, end_region,
+                                                &dest_addr, space->end());
+  assert(result == end_region, "space must fit into itself");
+}
+
 void PSParallelCompact::summarize_spaces_quick()
 {
-  for (unsigned int i = 0; i < last_space_id; ++i) {
-    const MutableSpace* space = _space_info[i].space();
-    HeapWord** nta = _space_info[i].new_top_addr();
-    bool result = _summary_data.summarize(_space_info[i].split_info(),
-                                          space->bottom(), space->top(), NULL,
-                                          space->bottom(), space->end(), nta);
-    assert(result, "space must fit into itself");
-    _space_info[i].set_dense_prefix(space->bottom());
+  const uint active_workers = gc_task_manager()->active_workers();
+  if (active_workers > 1) {
+    // Each space is summarized into itself, so the spaces are independent and
+    // the regions of a space can be split into chunks whose starting
+    // destinations are prefix sums of the per-region live data.  The prefix
+    // sums are cheap; the per-region field construction done by the chunk
+    // tasks is the expensive part.
+    GCTaskQueue* q = GCTaskQueue::create();
+    for (unsigned int i = 0; i < last_space_id; ++i) {
+      const MutableSpace* space = _space_info[i].space();
+      const size_t beg_region =
+        _summary_data.addr_to_region_idx(space->bottom());
+      const size_t end_region =
+        _summary_data.addr_to_region_idx(_summary_data.region_align_up(space->top()));
+      const size_t chunk_size =
+        MAX2((end_region - beg_region + active_workers - 1) / active_workers,
+             (size_t)1);
+
+      HeapWord* dest_addr = space->bottom();
+      size_t chunk_beg = beg_region;
+      while (chunk_beg < end_region) {
+        const size_t chunk_end = MIN2(chunk_beg + chunk_size, end_region);
+        q->enqueue(new SummarizeChunkTask(SpaceId(i), chunk_beg, chunk_end,
+                                          dest_addr));
+        for (size_t cur = chunk_beg; cur < chunk_end; ++cur) {
+          dest_addr += _summary_data.region(cur)->data_size();
+        }
+        chunk_beg = chunk_end;
+      }
+      assert(dest_addr <= space->end(), "space must fit into itself");
+      _space_info[i].set_new_top(dest_addr);
+      _space_info[i].set_dense_prefix(space->bottom());
+    }
+    gc_task_manager()->execute_and_wait(q);
+  } else {
+    for (unsigned int i = 0; i < last_space_id; ++i) {
+      const MutableSpace* space = _space_info[i].space();
+      HeapWord** nta = _space_info[i].new_top_addr();
+      bool result = _summary_data.summarize(_space_info[i].split_info(),
+                                            space->bottom(), space->top(), NULL,
+                                            space->bottom(), space->end(), nta);
+      assert(result, "space must fit into itself");
+      _space_info[i].set_dense_prefix(space->bottom());
+    }
   }
 
 #ifndef PRODUCT
@@ -2054,6 +2120,13 @@ bool PSParallelCompact::invoke_no_policy(bool maximum_heap_compaction) {
 
     // Set the number of GC threads to be used in this collection
     gc_task_manager()->set_active_gang();
+    if (UseDynamicNumberOfGCThreads) {
+      // Full compactions keep their own pause-time feedback, separate from
+      // the scavenge one: the two phases scale very differently.
+      uint n = size_policy->major_worker_feedback()->recommend(
+          gc_task_manager()->active_workers());
+      gc_task_manager()->set_active_workers(n);
+    }
     gc_task_manager()->task_idle_workers();
     heap->set_par_threads(gc_task_manager()->active_workers());
 
@@ -407,6 +407,19 @@ public:
   HeapWord* summarize_split_space(size_t src_region, SplitInfo& split_info,
                                   HeapWord* destination, HeapWord* target_end,
                                   HeapWord** target_next);
+
+  // Fill in the destination and related fields for the regions in the range
+  // [beg_region, end_region), starting at *dest_addr.  Stops when the data in
+  // a region would extend past target_end.  Returns the index of the region
+  // that did not fit (end_region if all fit) and leaves *dest_addr at the
+  // first unused destination word.  The chunks of a space being summarized
+  // into itself are independent once their starting destinations are known
+  // (prefix sums of the per-region live data), so this can run in parallel;
+  // see PSParallelCompact::summarize_spaces_quick().
+  size_t summarize_chunk(SplitInfo& split_info,
+                         size_t beg_region, size_t end_region,
+                         HeapWord** dest_addr, HeapWord* target_end);
+
   bool summarize(SplitInfo& split_info,
                  HeapWord* source_beg, HeapWord* source_end,
                  HeapWord** source_next,
@@ -1248,6 +1261,14 @@ class PSParallelCompact : AllStatic {
                                                   size_t region_index_start,
                                                   size_t region_index_end);
 
+  // Summarize one chunk of a space into itself, starting at the given
+  // destination.  Used by SummarizeChunkTask to parallelize the quick
+  // summarization done at the start of the summary phase.
+  static void summarize_quick_chunk(SpaceId id,
+                                    size_t region_index_start,
+                                    size_t region_index_end,
+                                    HeapWord* dest_addr);
+
   // Return the address of the count + 1st live word in the range [beg, end).
   static HeapWord* skip_live_words(HeapWord* beg, HeapWord* end, size_t count);
 
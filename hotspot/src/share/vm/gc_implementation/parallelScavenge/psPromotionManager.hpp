@@ -81,7 +81,8 @@ class PSPromotionManager VALUE_OBJ_CLASS_SPEC {
   bool                                _old_gen_is_full;
 
   OopStarTaskQueue                    _claimed_stack_depth;
-  OverflowTaskQueue<oop, mtGC>        _claimed_stack_breadth;
+  OverflowTaskQueue<oop, mtGC, TASKQUEUE_SIZE,
+                    SlabStack<oop, mtGC> > _claimed_stack_breadth;
 
   bool                                _totally_drain;
   uint                                _target_stack_size;
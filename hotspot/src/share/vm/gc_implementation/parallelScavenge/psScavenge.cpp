@@ -385,6 +385,14 @@ bool PSScavenge::invoke_no_policy() {
 
     // Set the number of GC threads to be used in this collection
     gc_task_manager()->set_active_gang();
+    if (UseDynamicNumberOfGCThreads) {
+      // Refine the ergonomic choice with pause-time feedback: a scavenge
+      // dominated by a single large promotion gains nothing from the extra
+      // workers, and the machine may have better uses for them.
+      uint n = size_policy->minor_worker_feedback()->recommend(
+          gc_task_manager()->active_workers());
+      gc_task_manager()->set_active_workers(n);
+    }
     gc_task_manager()->task_idle_workers();
     // Get the active number of workers here and use that value
     // throughout the methods.
@@ -118,6 +118,7 @@ class VM_GC_Operation: public VM_Operation {
   virtual void doit_epilogue();
 
   virtual bool allow_nested_vm_operations() const  { return true; }
+  virtual LatencyClass latency_class() const       { return _latency_batch; }
   bool prologue_succeeded() const { return _prologue_succeeded; }
 
   void set_gc_locked() { _gc_locked = true; }
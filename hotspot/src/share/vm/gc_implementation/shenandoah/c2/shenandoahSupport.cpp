@@ -113,6 +113,82 @@ bool ShenandoahBarrierC2Support::is_gc_state_load(Node *n) {
   return true;
 }
 
+// Returns the URShiftX node computing the region index in the address math
+// built by test_in_cset, or NULL if the shape does not match. IGVN may have
+// swapped the AddX inputs and folded the table base to a constant, so accept
+// the index on either side.
+static Node* cset_index_input(Node* add) {
+  for (uint i = 1; i <= 2; i++) {
+    Node* in = add->in(i);
+    if (in->Opcode() == Op_URShiftX &&
+        in->in(2)->find_int_con(-1) == ShenandoahHeapRegion::region_size_bytes_shift_jint() &&
+        in->in(1)->Opcode() == Op_CastP2X) {
+      return in;
+    }
+  }
+  return NULL;
+}
+
+bool ShenandoahBarrierC2Support::is_in_cset_load(Node* n) {
+  if (n->Opcode() != Op_LoadB && n->Opcode() != Op_LoadUB) {
+    return false;
+  }
+  // Matches the raw pointer math from test_in_cset:
+  // LoadB(CastX2P(AddX(CastP2X(cset_addr), URShiftX(CastP2X(val), region_shift))))
+  Node* addr = n->in(MemNode::Address);
+  if (addr->Opcode() != Op_CastX2P) {
+    return false;
+  }
+  Node* add = addr->in(1);
+  if (add->Opcode() != Op_AddX) {
+    return false;
+  }
+  return cset_index_input(add) != NULL;
+}
+
+bool ShenandoahBarrierC2Support::is_in_cset_test(Node* iff) {
+  if (!UseShenandoahGC) {
+    return false;
+  }
+  if (iff->Opcode() != Op_If) {
+    return false;
+  }
+  Node* bol = iff->in(1);
+  if (!bol->is_Bool() || bol->as_Bool()->_test._test != BoolTest::ne) {
+    return false;
+  }
+  Node* cmp = bol->in(1);
+  if (cmp->Opcode() != Op_CmpI) {
+    return false;
+  }
+  if (cmp->in(2)->find_int_con(-1) != 0) {
+    return false;
+  }
+  return is_in_cset_load(cmp->in(1));
+}
+
+Node* ShenandoahBarrierC2Support::in_cset_test_val(Node* iff) {
+  assert(is_in_cset_test(iff), "Should match the shape");
+  Node* load = iff->in(1)->in(1)->in(1);
+  Node* add = load->in(MemNode::Address)->in(1);
+  Node* idx = cset_index_input(add);
+  return idx->in(1)->in(1);
+}
+
+bool ShenandoahBarrierC2Support::is_invariant_in_cset_test(IfNode* iff, const IdealLoopTree* loop, PhaseIdealLoop* phase) {
+  if (!ShenandoahCsetLoopUnswitching) {
+    return false;
+  }
+  if (!is_in_cset_test(iff)) {
+    return false;
+  }
+  // The tested reference must be loop invariant. The cset byte itself can
+  // only change at safepoints, and unswitching is restricted to loops
+  // without safepoints, so the test result holds for the whole loop.
+  Node* val = in_cset_test_val(iff);
+  return !loop->is_member(phase->get_loop(phase->get_ctrl(val)));
+}
+
 bool ShenandoahBarrierC2Support::has_safepoint_between(Node* start, Node* stop, PhaseIdealLoop *phase) {
   assert(phase->is_dominator(stop, start), "bad inputs");
   ResourceMark rm;
@@ -1129,7 +1205,39 @@ static Node* create_phis_on_call_return(Node* ctrl, Node* c, Node* n, Node* n_cl
   return phi;
 }
 
+// Dominance-based barrier elision. Two barriers on the same value produce
+// the same to-space reference: once any barrier has run, the reference in
+// hand stays valid for the rest of the method because references held in
+// frames are fixed up by the GC at safepoints when the phase changes (the
+// same invariant that lets needs_barrier_impl() treat Parm, Call returns
+// and other barriers as barrier-free sources). GVN cannot commonize such a
+// pair since the barriers are pinned at different controls, so walk the
+// barrier list and replace every barrier with another barrier on the same
+// value whose control dominates it.
+void ShenandoahBarrierC2Support::eliminate_dominated_barriers(PhaseIdealLoop* phase) {
+  for (int i = phase->C->shenandoah_barriers_count() - 1; i >= 0; i--) {
+    ShenandoahLoadReferenceBarrierNode* lrb = phase->C->shenandoah_barrier(i);
+    Node* val = lrb->in(ShenandoahLoadReferenceBarrierNode::ValueIn);
+    Node* ctrl = phase->get_ctrl(lrb);
+    for (int j = 0; j < phase->C->shenandoah_barriers_count(); j++) {
+      ShenandoahLoadReferenceBarrierNode* dom_lrb = phase->C->shenandoah_barrier(j);
+      if (dom_lrb == lrb ||
+          dom_lrb->in(ShenandoahLoadReferenceBarrierNode::ValueIn) != val) {
+        continue;
+      }
+      Node* dom_ctrl = phase->get_ctrl(dom_lrb);
+      // Break the tie for barriers at the same control by list position,
+      // so a pair cannot replace each other.
+      if (dom_ctrl == ctrl ? j < i : phase->is_dominator(dom_ctrl, ctrl)) {
+        phase->igvn().replace_node(lrb, dom_lrb);
+        break;
+      }
+    }
+  }
+}
+
 void ShenandoahBarrierC2Support::pin_and_expand(PhaseIdealLoop* phase) {
+  eliminate_dominated_barriers(phase);
 
   Unique_Node_List uses;
   Node_Stack stack(0);
@@ -1651,6 +1759,69 @@ void ShenandoahBarrierC2Support::move_gc_state_test_out_of_loop(IfNode* iff, Pha
   }
 }
 
+void ShenandoahBarrierC2Support::move_in_cset_test_out_of_loop(IfNode* iff, PhaseIdealLoop* phase) {
+  IdealLoopTree *loop = phase->get_loop(iff);
+  Node* loop_head = loop->_head;
+  Node* entry_c = loop_head->in(LoopNode::EntryControl);
+
+  Node* bol = iff->in(1);
+  Node* cmp = bol->in(1);
+  Node* load = cmp->in(1);
+
+  assert(is_in_cset_load(load), "broken");
+  assert(!loop->is_member(phase->get_loop(phase->get_ctrl(in_cset_test_val(iff)))), "must be invariant");
+
+  if (!phase->is_dominator(load->in(0), entry_c)) {
+    // The whole address chain is control dependent on the test, clone it
+    // above the loop along with the load. The tested reference is loop
+    // invariant, so it is available at the loop entry.
+    Node* addr = load->in(MemNode::Address);   // CastX2P
+    Node* add  = addr->in(1);                  // AddX
+    Node* idx  = cset_index_input(add);        // URShiftX
+    Node* base = (add->in(1) == idx) ? add->in(2) : add->in(1);
+    Node* cast = idx->in(1);                   // CastP2X of the tested value
+
+    cast = cast->clone();
+    if (cast->in(0) != NULL) {
+      cast->set_req(0, entry_c);
+    }
+    phase->register_new_node(cast, entry_c);
+    idx = idx->clone();
+    idx->set_req(1, cast);
+    phase->register_new_node(idx, entry_c);
+    if (phase->has_ctrl(base) && loop->is_member(phase->get_loop(phase->get_ctrl(base)))) {
+      base = base->clone();
+      if (base->in(0) != NULL) {
+        base->set_req(0, entry_c);
+      }
+      phase->register_new_node(base, entry_c);
+    }
+    add = add->clone();
+    add->set_req(1, base);
+    add->set_req(2, idx);
+    phase->register_new_node(add, entry_c);
+    addr = addr->clone();
+    addr->set_req(1, add);
+    phase->register_new_node(addr, entry_c);
+
+    Node* mem_ctrl = NULL;
+    Node* mem = dom_mem(load->in(MemNode::Memory), loop_head, Compile::AliasIdxRaw, mem_ctrl, phase);
+    load = load->clone();
+    load->set_req(MemNode::Memory, mem);
+    load->set_req(MemNode::Address, addr);
+    load->set_req(0, entry_c);
+    phase->register_new_node(load, entry_c);
+    cmp = cmp->clone();
+    cmp->set_req(1, load);
+    phase->register_new_node(cmp, entry_c);
+    bol = bol->clone();
+    bol->set_req(1, cmp);
+    phase->register_new_node(bol, entry_c);
+
+    phase->igvn().replace_input_of(iff, 1, bol);
+  }
+}
+
 bool ShenandoahBarrierC2Support::identical_backtoback_ifs(Node* n, PhaseIdealLoop* phase) {
   if (!n->is_If() || n->is_CountedLoopEnd()) {
     return false;
@@ -1835,7 +2006,7 @@ IfNode* ShenandoahBarrierC2Support::find_unswitching_candidate(const IdealLoopTr
           if (bol->in(1)->is_Cmp()) {
             // If condition is invariant and not a loop exit,
             // then found reason to unswitch.
-            if (is_heap_stable_test(iff) &&
+            if ((is_heap_stable_test(iff) || is_invariant_in_cset_test(iff, loop, phase)) &&
                 (loop_has_sfpts == -1 || loop_has_sfpts == 0)) {
               assert(!loop->is_loop_exit(iff), "both branches should be in the loop");
               if (loop_has_sfpts == -1) {
@@ -1866,6 +2037,7 @@ IfNode* ShenandoahBarrierC2Support::find_unswitching_candidate(const IdealLoopTr
 
 void ShenandoahBarrierC2Support::optimize_after_expansion(VectorSet &visited, Node_Stack &stack, Node_List &old_new, PhaseIdealLoop* phase) {
   Node_List heap_stable_tests;
+  Node_List unswitch_tests;
   stack.push(phase->C->start(), 0);
   do {
     Node* n = stack.node();
@@ -1879,8 +2051,14 @@ void ShenandoahBarrierC2Support::optimize_after_expansion(VectorSet &visited, No
       }
     } else {
       stack.pop();
-      if (n->is_If() && is_heap_stable_test(n)) {
-        heap_stable_tests.push(n);
+      if (n->is_If()) {
+        if (is_heap_stable_test(n)) {
+          heap_stable_tests.push(n);
+        } else if (ShenandoahCsetLoopUnswitching && is_in_cset_test(n)) {
+          // Cset membership tests are unswitching candidates too, but they
+          // are never merged back-to-back: each tests a different value.
+          unswitch_tests.push(n);
+        }
       }
     }
   } while (stack.size() > 0);
@@ -1889,12 +2067,13 @@ void ShenandoahBarrierC2Support::optimize_after_expansion(VectorSet &visited, No
     Node* n = heap_stable_tests.at(i);
     assert(is_heap_stable_test(n), "only evacuation test");
     merge_back_to_back_tests(n, phase);
+    unswitch_tests.push(n);
   }
 
   if (!phase->C->major_progress()) {
     VectorSet seen(Thread::current()->resource_area());
-    for (uint i = 0; i < heap_stable_tests.size(); i++) {
-      Node* n = heap_stable_tests.at(i);
+    for (uint i = 0; i < unswitch_tests.size(); i++) {
+      Node* n = unswitch_tests.at(i);
       IdealLoopTree* loop = phase->get_loop(n);
       if (loop != phase->ltree_root() &&
           loop->_child == NULL &&
@@ -1906,7 +2085,11 @@ void ShenandoahBarrierC2Support::optimize_after_expansion(VectorSet &visited, No
           IfNode* iff = find_unswitching_candidate(loop, phase);
           if (iff != NULL) {
             Node* bol = iff->in(1);
-            move_gc_state_test_out_of_loop(iff, phase);
+            if (is_heap_stable_test(iff)) {
+              move_gc_state_test_out_of_loop(iff, phase);
+            } else {
+              move_in_cset_test_out_of_loop(iff, phase);
+            }
             if (loop->policy_unswitching(phase)) {
               phase->do_unswitching(loop, old_new);
             } else {
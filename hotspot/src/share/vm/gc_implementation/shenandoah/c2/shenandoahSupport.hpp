@@ -68,7 +68,10 @@ private:
   static void fix_null_check(Node* unc, Node* unc_ctrl, Node* new_unc_ctrl, Unique_Node_List& uses,
                              PhaseIdealLoop* phase);
   static void test_in_cset(Node*& ctrl, Node*& not_cset_ctrl, Node* val, Node* raw_mem, PhaseIdealLoop* phase);
+  static Node* in_cset_test_val(Node* iff);
+  static bool is_invariant_in_cset_test(IfNode* iff, const IdealLoopTree* loop, PhaseIdealLoop* phase);
   static void move_gc_state_test_out_of_loop(IfNode* iff, PhaseIdealLoop* phase);
+  static void move_in_cset_test_out_of_loop(IfNode* iff, PhaseIdealLoop* phase);
   static void merge_back_to_back_tests(Node* n, PhaseIdealLoop* phase);
   static bool identical_backtoback_ifs(Node *n, PhaseIdealLoop* phase);
   static void fix_ctrl(Node* barrier, Node* region, const MemoryGraphFixer& fixer, Unique_Node_List& uses, Unique_Node_List& uses_to_ignore, uint last, PhaseIdealLoop* phase);
@@ -81,8 +84,11 @@ public:
 
   static bool is_gc_state_load(Node* n);
   static bool is_heap_stable_test(Node* iff);
+  static bool is_in_cset_load(Node* n);
+  static bool is_in_cset_test(Node* iff);
 
   static bool expand(Compile* C, PhaseIterGVN& igvn);
+  static void eliminate_dominated_barriers(PhaseIdealLoop* phase);
   static void pin_and_expand(PhaseIdealLoop* phase);
   static void optimize_after_expansion(VectorSet& visited, Node_Stack& nstack, Node_List& old_new, PhaseIdealLoop* phase);
 
@@ -32,7 +32,8 @@
 #include "utilities/quickSort.hpp"
 
 ShenandoahAdaptiveHeuristics::ShenandoahAdaptiveHeuristics() :
-  ShenandoahHeuristics() {}
+  ShenandoahHeuristics(),
+  _evac_volume_history(new TruncatedSeq(10)) {}
 
 ShenandoahAdaptiveHeuristics::~ShenandoahAdaptiveHeuristics() {}
 
@@ -60,6 +61,33 @@ void ShenandoahAdaptiveHeuristics::choose_collection_set_from_regiondata(Shenand
 
   size_t capacity    = ShenandoahHeap::heap()->soft_max_capacity();
   size_t max_cset    = (size_t)((1.0 * capacity / 100 * ShenandoahEvacReserve) / ShenandoahEvacWaste);
+
+  // Learn the actual evacuation demand, and trim the reserve when the workload
+  // does not use it. Demand is measured over all plausible candidates, before
+  // the reserve cap is applied, so trimming the cap does not feed back into
+  // the estimate. The confidence margin absorbs cycle-to-cycle noise; on
+  // workload shifts the decaying history catches up within a few cycles, and
+  // ShenandoahEvacReserve stays the hard upper bound.
+  size_t evac_demand = 0;
+  for (size_t idx = 0; idx < size; idx++) {
+    ShenandoahHeapRegion* r = data[idx]._region;
+    if (r->garbage() > garbage_threshold) {
+      evac_demand += r->get_live_data_bytes();
+    }
+  }
+  _evac_volume_history->add((double) evac_demand);
+
+  if (ShenandoahAdaptiveEvacReserve && _evac_volume_history->num() >= (int) ShenandoahLearningSteps) {
+    double estimate = _evac_volume_history->davg() + ShenandoahEvacReserveConfidence * _evac_volume_history->dsd();
+    size_t learned_cset = MAX2((size_t) estimate, ShenandoahHeapRegion::region_size_bytes());
+    if (learned_cset < max_cset) {
+      log_info(gc, ergo)("Learned Evacuation Reserve: " SIZE_FORMAT "%s, trimmed from " SIZE_FORMAT "%s",
+                         byte_size_in_proper_unit(learned_cset), proper_unit_for_byte_size(learned_cset),
+                         byte_size_in_proper_unit(max_cset),     proper_unit_for_byte_size(max_cset));
+      max_cset = learned_cset;
+    }
+  }
+
   size_t free_target = (capacity / 100 * ShenandoahMinFreeThreshold) + max_cset;
   size_t min_garbage = (free_target > actual_free ? (free_target - actual_free) : 0);
 
@@ -29,6 +29,11 @@
 #include "utilities/numberSeq.hpp"
 
 class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
+private:
+  // Decaying history of evacuation demand (live bytes in collection set
+  // candidates), used to size the evacuation reserve adaptively.
+  TruncatedSeq* _evac_volume_history;
+
 public:
   ShenandoahAdaptiveHeuristics();
 
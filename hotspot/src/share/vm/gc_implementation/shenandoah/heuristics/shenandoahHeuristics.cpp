@@ -30,6 +30,8 @@
 #include "gc_implementation/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahUtils.hpp"
 #include "gc_implementation/shenandoah/heuristics/shenandoahHeuristics.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "runtime/atomic.hpp"
 
 int ShenandoahHeuristics::compare_by_garbage(RegionData a, RegionData b) {
   if (a._garbage > b._garbage)
@@ -41,6 +43,11 @@ int ShenandoahHeuristics::compare_by_garbage(RegionData a, RegionData b) {
 
 ShenandoahHeuristics::ShenandoahHeuristics() :
   _region_data(NULL),
+  _last_pin_events(NULL),
+  _region_scores_valid(false),
+  _scored_cand_idx(0),
+  _scored_humongous_idx(0),
+  _scored_humongous(NULL),
   _degenerated_cycles_in_a_row(0),
   _successful_cycles_in_a_row(0),
   _cycle_start(os::elapsedTime()),
@@ -48,7 +55,8 @@ ShenandoahHeuristics::ShenandoahHeuristics() :
   _gc_times_learned(0),
   _gc_time_penalties(0),
   _gc_time_history(new TruncatedSeq(5)),
-  _metaspace_oom()
+  _metaspace_oom(),
+  _defer_gc_until_millis(0)
 {
   // No unloading during concurrent mark? Communicate that to heuristics
   if (!ClassUnloadingWithConcurrentMark) {
@@ -59,10 +67,82 @@ ShenandoahHeuristics::ShenandoahHeuristics() :
   assert(num_regions > 0, "Sanity");
 
   _region_data = NEW_C_HEAP_ARRAY(RegionData, num_regions, mtGC);
+
+  _last_pin_events = NEW_C_HEAP_ARRAY(size_t, num_regions, mtGC);
+  for (size_t i = 0; i < num_regions; i++) {
+    _last_pin_events[i] = 0;
+  }
+
+  _scored_humongous = NEW_C_HEAP_ARRAY(ShenandoahHeapRegion*, num_regions, mtGC);
 }
 
 ShenandoahHeuristics::~ShenandoahHeuristics() {
   FREE_C_HEAP_ARRAY(RegionGarbage, _region_data, mtGC);
+  FREE_C_HEAP_ARRAY(size_t, _last_pin_events, mtGC);
+  FREE_C_HEAP_ARRAY(ShenandoahHeapRegion*, _scored_humongous, mtGC);
+}
+
+void ShenandoahHeuristics::begin_region_scoring() {
+  _scored_cand_idx = 0;
+  _scored_humongous_idx = 0;
+  _scored_total_garbage = 0;
+  _scored_immediate_garbage = 0;
+  _scored_immediate_regions = 0;
+  _scored_free = 0;
+  _scored_free_regions = 0;
+  _scored_pinned_deferred_regions = 0;
+  _scored_pinned_deferred_garbage = 0;
+  _region_scores_valid = true;
+}
+
+void ShenandoahHeuristics::score_region(ShenandoahHeapRegion* region) {
+  assert(_region_scores_valid, "Scoring pass should be open");
+
+  size_t garbage = region->garbage();
+  Atomic::add_ptr((intptr_t) garbage, &_scored_total_garbage);
+
+  if (region->is_empty()) {
+    Atomic::add_ptr(1, &_scored_free_regions);
+    Atomic::add_ptr((intptr_t) ShenandoahHeapRegion::region_size_bytes(), &_scored_free);
+  } else if (region->is_regular()) {
+    if (!region->has_live()) {
+      // We can recycle it right away and put it in the free set.
+      Atomic::add_ptr(1, &_scored_immediate_regions);
+      Atomic::add_ptr((intptr_t) garbage, &_scored_immediate_garbage);
+      ShenandoahHeapLocker locker(ShenandoahHeap::heap()->lock());
+      region->make_trash_immediate();
+    } else if (region->pin_events() != _last_pin_events[region->index()]) {
+      // The region took critical pins since the last selection, defer it.
+      // See the matching branch in choose_collection_set().
+      _last_pin_events[region->index()] = region->pin_events();
+      Atomic::add_ptr(1, &_scored_pinned_deferred_regions);
+      Atomic::add_ptr((intptr_t) garbage, &_scored_pinned_deferred_garbage);
+    } else {
+      // This is our candidate for later consideration.
+      jint idx = Atomic::add(1, &_scored_cand_idx) - 1;
+      _region_data[idx]._region = region;
+      _region_data[idx]._garbage = garbage;
+    }
+  } else if (region->is_humongous_start()) {
+#ifdef ASSERT
+    bool reg_live = region->has_live();
+    bool bm_live = ShenandoahHeap::heap()->complete_marking_context()->is_marked(oop(region->bottom()));
+    assert(reg_live == bm_live,
+           err_msg("Humongous liveness and marks should agree. Region live: %s; Bitmap live: %s; Region Live Words: " SIZE_FORMAT,
+                   BOOL_TO_STR(reg_live), BOOL_TO_STR(bm_live), region->get_live_data_words()));
+#endif
+    if (!region->has_live()) {
+      // Trashing the object touches its continuation regions, which other
+      // workers may be visiting right now. Only record the start here, the
+      // object is reclaimed and accounted when the scores are consumed.
+      jint idx = Atomic::add(1, &_scored_humongous_idx) - 1;
+      _scored_humongous[idx] = region;
+    }
+  } else if (region->is_trash()) {
+    // Count in just trashed collection set, during coalesced CM-with-UR
+    Atomic::add_ptr(1, &_scored_immediate_regions);
+    Atomic::add_ptr((intptr_t) garbage, &_scored_immediate_garbage);
+  }
 }
 
 void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collection_set) {
@@ -90,49 +170,100 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
   size_t free = 0;
   size_t free_regions = 0;
 
+  size_t pinned_deferred_regions = 0;
+  size_t pinned_deferred_garbage = 0;
+
   ShenandoahMarkingContext* const ctx = heap->complete_marking_context();
 
-  for (size_t i = 0; i < num_regions; i++) {
-    ShenandoahHeapRegion* region = heap->get_region(i);
+  if (_region_scores_valid) {
+    // Regions were already scored in parallel during the final mark region
+    // state update, see score_region(). The only serial work left here is
+    // reclaiming the dead humongous objects, which span multiple regions
+    // and therefore could not be trashed from the parallel pass.
+    _region_scores_valid = false;
+
+    cand_idx          = (size_t) _scored_cand_idx;
+    total_garbage     = (size_t) _scored_total_garbage;
+    immediate_garbage = (size_t) _scored_immediate_garbage;
+    immediate_regions = (size_t) _scored_immediate_regions;
+    free              = (size_t) _scored_free;
+    free_regions      = (size_t) _scored_free_regions;
+    pinned_deferred_regions = (size_t) _scored_pinned_deferred_regions;
+    pinned_deferred_garbage = (size_t) _scored_pinned_deferred_garbage;
+
+    for (jint h = 0; h < _scored_humongous_idx; h++) {
+      ShenandoahHeapRegion* region = _scored_humongous[h];
+      assert(region->is_humongous_start() && !region->has_live(),
+             err_msg("Region " SIZE_FORMAT " should be a dead humongous start", region->index()));
+
+      size_t h_garbage = region->garbage();
+      size_t h_regions = 1;
+      for (size_t i = region->index() + 1; i < num_regions; i++) {
+        ShenandoahHeapRegion* c = heap->get_region(i);
+        if (!c->is_humongous_continuation()) break;
+        h_garbage += c->garbage();
+        h_regions++;
+      }
 
-    size_t garbage = region->garbage();
-    total_garbage += garbage;
+      heap->trash_humongous_region_at(region);
 
-    if (region->is_empty()) {
-      free_regions++;
-      free += ShenandoahHeapRegion::region_size_bytes();
-    } else if (region->is_regular()) {
-      if (!region->has_live()) {
-        // We can recycle it right away and put it in the free set.
-        immediate_regions++;
-        immediate_garbage += garbage;
-        region->make_trash_immediate();
-      } else {
-        // This is our candidate for later consideration.
-        candidates[cand_idx]._region = region;
-        candidates[cand_idx]._garbage = garbage;
-        cand_idx++;
-      }
-    } else if (region->is_humongous_start()) {
-      // Reclaim humongous regions here, and count them as the immediate garbage
+      // Count the whole object as the immediate garbage
+      immediate_regions += h_regions;
+      immediate_garbage += h_garbage;
+    }
+  } else {
+    // No prepared scores, e.g. when selection does not follow the final mark
+    // region state update. Scan and classify all regions serially.
+    for (size_t i = 0; i < num_regions; i++) {
+      ShenandoahHeapRegion* region = heap->get_region(i);
+
+      size_t garbage = region->garbage();
+      total_garbage += garbage;
+
+      if (region->is_empty()) {
+        free_regions++;
+        free += ShenandoahHeapRegion::region_size_bytes();
+      } else if (region->is_regular()) {
+        if (!region->has_live()) {
+          // We can recycle it right away and put it in the free set.
+          immediate_regions++;
+          immediate_garbage += garbage;
+          region->make_trash_immediate();
+        } else if (region->pin_events() != _last_pin_events[i]) {
+          // The region took critical pins since the last selection. Evacuating
+          // it is likely to collide with another pin, which would fail the
+          // evacuation and force the cycle onto the degenerated path. Defer
+          // it for now: if pins stop, it becomes a candidate next cycle.
+          _last_pin_events[i] = region->pin_events();
+          pinned_deferred_regions++;
+          pinned_deferred_garbage += garbage;
+        } else {
+          // This is our candidate for later consideration.
+          candidates[cand_idx]._region = region;
+          candidates[cand_idx]._garbage = garbage;
+          cand_idx++;
+        }
+      } else if (region->is_humongous_start()) {
+        // Reclaim humongous regions here, and count them as the immediate garbage
 #ifdef ASSERT
-      bool reg_live = region->has_live();
-      bool bm_live = ctx->is_marked(oop(region->bottom()));
-      assert(reg_live == bm_live,
-             err_msg("Humongous liveness and marks should agree. Region live: %s; Bitmap live: %s; Region Live Words: " SIZE_FORMAT,
-                     BOOL_TO_STR(reg_live), BOOL_TO_STR(bm_live), region->get_live_data_words()));
+        bool reg_live = region->has_live();
+        bool bm_live = ctx->is_marked(oop(region->bottom()));
+        assert(reg_live == bm_live,
+               err_msg("Humongous liveness and marks should agree. Region live: %s; Bitmap live: %s; Region Live Words: " SIZE_FORMAT,
+                       BOOL_TO_STR(reg_live), BOOL_TO_STR(bm_live), region->get_live_data_words()));
 #endif
-      if (!region->has_live()) {
-        heap->trash_humongous_region_at(region);
-
-        // Count only the start. Continuations would be counted on "trash" path
+        if (!region->has_live()) {
+          heap->trash_humongous_region_at(region);
+
+          // Count only the start. Continuations would be counted on "trash" path
+          immediate_regions++;
+          immediate_garbage += garbage;
+        }
+      } else if (region->is_trash()) {
+        // Count in just trashed collection set, during coalesced CM-with-UR
         immediate_regions++;
         immediate_garbage += garbage;
       }
-    } else if (region->is_trash()) {
-      // Count in just trashed collection set, during coalesced CM-with-UR
-      immediate_regions++;
-      immediate_garbage += garbage;
     }
   }
 
@@ -170,10 +301,40 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
                      byte_size_in_proper_unit(collection_set->garbage()),
                      proper_unit_for_byte_size(collection_set->garbage()),
                      cset_percent);
+
+  if (pinned_deferred_regions > 0) {
+    log_info(gc, ergo)("Pinned: " SIZE_FORMAT " recently pinned regions deferred from collection set, "
+                       SIZE_FORMAT "%s garbage withheld",
+                       pinned_deferred_regions,
+                       byte_size_in_proper_unit(pinned_deferred_garbage),
+                       proper_unit_for_byte_size(pinned_deferred_garbage));
+
+    EventShenandoahPinnedRegionsDeferred evt;
+    if (evt.should_commit()) {
+      evt.set_deferredRegions(pinned_deferred_regions);
+      evt.set_garbageWithheld(pinned_deferred_garbage);
+      evt.commit();
+    }
+  }
 }
 
 void ShenandoahHeuristics::record_cycle_start() {
   _cycle_start = os::elapsedTime();
+  // The externally hinted cycle is now starting, consume the hint
+  _start_gc_hint.unset();
+}
+
+void ShenandoahHeuristics::record_schedule_start_hint() {
+  _start_gc_hint.set();
+}
+
+void ShenandoahHeuristics::record_schedule_defer_hint(jlong defer_ms) {
+  _defer_gc_until_millis = (jlong)(os::elapsedTime() * 1000) + defer_ms;
+  log_info(gc)("Discretionary GC triggers muted for " JLONG_FORMAT " ms on external request", defer_ms);
+}
+
+bool ShenandoahHeuristics::in_defer_window() const {
+  return (jlong)(os::elapsedTime() * 1000) < _defer_gc_until_millis;
 }
 
 void ShenandoahHeuristics::record_cycle_end() {
@@ -279,6 +440,10 @@ double ShenandoahHeuristics::time_since_last_gc() const {
   return os::elapsedTime() - _cycle_start;
 }
 
+double ShenandoahHeuristics::average_gc_time() const {
+  return _gc_time_history->avg();
+}
+
 bool ShenandoahHeuristics::should_start_gc() const {
   // Perform GC to cleanup metaspace
   if (has_metaspace_oom()) {
@@ -287,7 +452,12 @@ bool ShenandoahHeuristics::should_start_gc() const {
     return true;
   }
 
-  if (ShenandoahGuaranteedGCInterval > 0) {
+  if (_start_gc_hint.is_set()) {
+    log_info(gc)("Trigger: Externally hinted cycle start");
+    return true;
+  }
+
+  if (ShenandoahGuaranteedGCInterval > 0 && !in_defer_window()) {
     double last_time_ms = (os::elapsedTime() - _last_cycle_end) * 1000;
     if (last_time_ms > ShenandoahGuaranteedGCInterval) {
       log_info(gc)("Trigger: Time since last GC (%.0f ms) is larger than guaranteed interval (" UINTX_FORMAT " ms)",
@@ -71,6 +71,29 @@ protected:
 
   RegionData* _region_data;
 
+  // Per-region snapshot of ShenandoahHeapRegion::pin_events() at the last
+  // collection set selection, used to defer recently pinned regions.
+  size_t* _last_pin_events;
+
+  // Parallel region scoring state. Scoring piggybacks on the final mark
+  // region state update: workers classify regions and publish collection
+  // set candidates into _region_data while they flush liveness, so that
+  // choose_collection_set() does not rescan all regions serially in the
+  // pause. Trashing a dead humongous object spans its continuations, which
+  // other workers may be visiting concurrently, so only the start regions
+  // are recorded here and the objects are reclaimed at consume time.
+  bool _region_scores_valid;
+  volatile jint _scored_cand_idx;
+  volatile jint _scored_humongous_idx;
+  ShenandoahHeapRegion** _scored_humongous;
+  volatile intptr_t _scored_total_garbage;
+  volatile intptr_t _scored_immediate_garbage;
+  volatile intptr_t _scored_immediate_regions;
+  volatile intptr_t _scored_free;
+  volatile intptr_t _scored_free_regions;
+  volatile intptr_t _scored_pinned_deferred_regions;
+  volatile intptr_t _scored_pinned_deferred_garbage;
+
   uint _degenerated_cycles_in_a_row;
   uint _successful_cycles_in_a_row;
 
@@ -84,6 +107,13 @@ protected:
   // There may be many threads that contend to set this flag
   ShenandoahSharedFlag _metaspace_oom;
 
+  // External scheduling hints, fed in via the "GC.shenandoah_schedule"
+  // diagnostic command and WhiteBox. The start hint is consumed when the
+  // next cycle starts. The defer hint only mutes discretionary triggers:
+  // urgent triggers (allocation pressure, metaspace OOM) override it.
+  ShenandoahSharedFlag _start_gc_hint;
+  volatile jlong _defer_gc_until_millis;
+
   static int compare_by_garbage(RegionData a, RegionData b);
 
   virtual void choose_collection_set_from_regiondata(ShenandoahCollectionSet* set,
@@ -92,6 +122,8 @@ protected:
 
   void adjust_penalty(intx step);
 
+  bool in_defer_window() const;
+
 public:
   ShenandoahHeuristics();
   virtual ~ShenandoahHeuristics();
@@ -100,6 +132,9 @@ public:
   void clear_metaspace_oom()      { _metaspace_oom.unset(); }
   bool has_metaspace_oom() const  { return _metaspace_oom.is_set(); }
 
+  void record_schedule_start_hint();
+  void record_schedule_defer_hint(jlong defer_ms);
+
   virtual void record_cycle_start();
 
   virtual void record_cycle_end();
@@ -125,6 +160,13 @@ public:
 
   virtual void choose_collection_set(ShenandoahCollectionSet* collection_set);
 
+  // Parallel region scoring, called around/from the final mark region state
+  // update pass. begin_region_scoring() runs single-threaded before the
+  // parallel iteration; score_region() is called by the workers and is
+  // thread-safe.
+  void begin_region_scoring();
+  void score_region(ShenandoahHeapRegion* region);
+
   virtual bool can_process_references();
   virtual bool should_process_references();
 
@@ -138,6 +180,12 @@ public:
   virtual void initialize();
 
   double time_since_last_gc() const;
+
+  // Read-only view of the trigger model, published via performance counters
+  // and the GC.shenandoah_ergonomics diagnostic command.
+  double average_gc_time() const;
+  intx gc_time_penalties() const   { return _gc_time_penalties; }
+  size_t gc_times_learned() const  { return _gc_times_learned;  }
 };
 
 #endif // SHARE_VM_GC_SHENANDOAH_HEURISTICS_SHENANDOAHHEURISTICS_HPP
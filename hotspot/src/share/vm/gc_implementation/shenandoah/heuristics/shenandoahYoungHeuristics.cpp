@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2019, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#include "gc_implementation/shenandoah/heuristics/shenandoahYoungHeuristics.hpp"
+#include "gc_implementation/shenandoah/shenandoahCollectionSet.hpp"
+#include "gc_implementation/shenandoah/shenandoahFreeSet.hpp"
+#include "gc_implementation/shenandoah/shenandoahHeap.inline.hpp"
+#include "gc_implementation/shenandoah/shenandoahHeapRegion.inline.hpp"
+#include "gc_implementation/shenandoah/shenandoahLogging.hpp"
+#include "utilities/quickSort.hpp"
+
+ShenandoahYoungHeuristics::ShenandoahYoungHeuristics() :
+  ShenandoahAdaptiveHeuristics() {}
+
+void ShenandoahYoungHeuristics::choose_collection_set_from_regiondata(ShenandoahCollectionSet* cset,
+                                                                      RegionData* data, size_t size,
+                                                                      size_t actual_free) {
+  // Every candidate region had survived the mark that produced this data,
+  // which is our notion of region age. Regions that get recycled reset their
+  // age and re-enter the heap as young.
+  for (size_t idx = 0; idx < size; idx++) {
+    data[idx]._region->increment_age();
+  }
+
+  size_t garbage_threshold     = ShenandoahHeapRegion::region_size_bytes() * ShenandoahGarbageThreshold / 100;
+  size_t old_garbage_threshold = ShenandoahHeapRegion::region_size_bytes() * ShenandoahOldGarbageThreshold / 100;
+
+  // Same budgeting as in adaptive: cap the cset by evacuation reserve, and
+  // make sure enough garbage is reclaimed to not re-trigger the GC at once.
+  size_t capacity    = ShenandoahHeap::heap()->soft_max_capacity();
+  size_t max_cset    = (size_t)((1.0 * capacity / 100 * ShenandoahEvacReserve) / ShenandoahEvacWaste);
+  size_t free_target = (capacity / 100 * ShenandoahMinFreeThreshold) + max_cset;
+  size_t min_garbage = (free_target > actual_free ? (free_target - actual_free) : 0);
+
+  // Better select garbage-first regions within each generation
+  QuickSort::sort<RegionData>(data, (int)size, compare_by_garbage, false);
+
+  size_t cur_cset = 0;
+  size_t cur_garbage = 0;
+
+  size_t young_regions = 0;
+  size_t old_regions = 0;
+
+  for (size_t idx = 0; idx < size; idx++) {
+    ShenandoahHeapRegion* r = data[idx]._region;
+
+    bool is_old = (r->age() >= ShenandoahTenuringThreshold);
+    if (is_old && (r->garbage() < old_garbage_threshold)) {
+      // Old region that did not accumulate enough garbage yet: leave it in
+      // place, it would likely stay live, and evacuating it is a waste.
+      continue;
+    }
+
+    size_t new_cset    = cur_cset + r->get_live_data_bytes();
+    size_t new_garbage = cur_garbage + r->garbage();
+
+    if (new_cset > max_cset) {
+      break;
+    }
+
+    if ((new_garbage < min_garbage) || (r->garbage() > garbage_threshold)) {
+      cset->add_region(r);
+      cur_cset = new_cset;
+      cur_garbage = new_garbage;
+      if (is_old) {
+        old_regions++;
+      } else {
+        young_regions++;
+      }
+    }
+  }
+
+  log_info(gc, ergo)("Young CSet Selection. Young Regions: " SIZE_FORMAT ", Old Regions: " SIZE_FORMAT ", "
+                     "Max CSet: " SIZE_FORMAT "%s, Min Garbage: " SIZE_FORMAT "%s",
+                     young_regions, old_regions,
+                     byte_size_in_proper_unit(max_cset),    proper_unit_for_byte_size(max_cset),
+                     byte_size_in_proper_unit(min_garbage), proper_unit_for_byte_size(min_garbage));
+}
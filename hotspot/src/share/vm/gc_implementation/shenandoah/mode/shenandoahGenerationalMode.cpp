@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2019, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc_implementation/shenandoah/heuristics/shenandoahYoungHeuristics.hpp"
+#include "gc_implementation/shenandoah/mode/shenandoahGenerationalMode.hpp"
+#include "gc_implementation/shenandoah/shenandoahLogging.hpp"
+
+void ShenandoahGenerationalMode::initialize_flags() const {
+  SHENANDOAH_ERGO_ENABLE_FLAG(ExplicitGCInvokesConcurrent);
+  SHENANDOAH_ERGO_ENABLE_FLAG(ShenandoahImplicitGCInvokesConcurrent);
+
+  // Generational mode runs on top of the SATB barriers. Additionally, it
+  // maintains region ages and the remembered set, see ShenandoahRememberedSet.
+  SHENANDOAH_CHECK_FLAG_SET(ShenandoahLoadRefBarrier);
+  SHENANDOAH_CHECK_FLAG_UNSET(ShenandoahStoreValEnqueueBarrier);
+  SHENANDOAH_CHECK_FLAG_SET(ShenandoahSATBBarrier);
+  SHENANDOAH_CHECK_FLAG_SET(ShenandoahCASBarrier);
+  SHENANDOAH_CHECK_FLAG_SET(ShenandoahCloneBarrier);
+}
+
+ShenandoahHeuristics* ShenandoahGenerationalMode::initialize_heuristics() const {
+  // Region tenuring is managed by the heuristics itself, other heuristics
+  // would not keep ages up to date. Ignore the heuristics selection, but warn
+  // when user asked for something else explicitly.
+  if (!FLAG_IS_DEFAULT(ShenandoahGCHeuristics) &&
+      (ShenandoahGCHeuristics == NULL || strcmp(ShenandoahGCHeuristics, "young") != 0)) {
+    log_info(gc)("Generational mode overrides -XX:ShenandoahGCHeuristics with \"young\"");
+  }
+  return new ShenandoahYoungHeuristics();
+}
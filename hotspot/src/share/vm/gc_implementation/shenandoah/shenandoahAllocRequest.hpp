@@ -70,8 +70,8 @@ private:
   {}
 
 public:
-  static inline ShenandoahAllocRequest for_tlab(size_t requested_size) {
-    return ShenandoahAllocRequest(requested_size, requested_size, _alloc_tlab);
+  static inline ShenandoahAllocRequest for_tlab(size_t min_size, size_t requested_size) {
+    return ShenandoahAllocRequest(min_size, requested_size, _alloc_tlab);
   }
 
   static inline ShenandoahAllocRequest for_gclab(size_t min_size, size_t requested_size) {
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2019, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#include "gc_implementation/shenandoah/shenandoahAllocTracker.hpp"
+#include "gc_implementation/shenandoah/shenandoahHeap.inline.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "runtime/vframe.hpp"
+#include "utilities/copy.hpp"
+
+ShenandoahAllocTracker::ShenandoahAllocTracker(size_t num_regions) :
+  _site_table(NULL),
+  _region_table(NULL),
+  _num_regions(num_regions),
+  _sample_budget((intptr_t)ShenandoahAllocSiteSampleInterval) {
+
+  _site_table = NEW_C_HEAP_ARRAY(SiteEntry, SiteTableSize, mtGC);
+  Copy::zero_to_bytes((char*)_site_table, SiteTableSize * sizeof(SiteEntry));
+
+  _region_table = NEW_C_HEAP_ARRAY(RegionEntry, num_regions, mtGC);
+  Copy::zero_to_bytes((char*)_region_table, num_regions * sizeof(RegionEntry));
+}
+
+ShenandoahAllocTracker::~ShenandoahAllocTracker() {
+  for (uint i = 0; i < SiteTableSize; i++) {
+    if (_site_table[i]._stack != NULL) {
+      os::free(_site_table[i]._stack, mtGC);
+    }
+  }
+  FREE_C_HEAP_ARRAY(SiteEntry, _site_table, mtGC);
+  FREE_C_HEAP_ARRAY(RegionEntry, _region_table, mtGC);
+}
+
+void ShenandoahAllocTracker::record_alloc(ShenandoahAllocRequest& req, HeapWord* obj) {
+  assert(req.is_mutator_alloc(), "Only mutator allocations have application sites");
+
+  size_t bytes = req.actual_size() * HeapWordSize;
+  intptr_t left = Atomic::add_ptr(-((intptr_t)bytes), &_sample_budget);
+  if (left > 0) {
+    return;
+  }
+
+  // Budget depleted, take the sample on this thread. Replenishing with a plain
+  // add means a few racing threads may all sample when the budget crosses zero
+  // together; the sample rate is approximate anyway.
+  Atomic::add_ptr((intptr_t)ShenandoahAllocSiteSampleInterval, &_sample_budget);
+  take_sample(obj, bytes);
+}
+
+void ShenandoahAllocTracker::take_sample(HeapWord* obj, size_t bytes) {
+  Thread* thr = Thread::current();
+  if (!thr->is_Java_thread()) {
+    // VM-internal allocation, no application site to blame.
+    return;
+  }
+  JavaThread* jt = (JavaThread*)thr;
+  if (!jt->has_last_Java_frame()) {
+    return;
+  }
+
+  ResourceMark rm;
+
+  Method* methods[SiteStackDepth];
+  int bcis[SiteStackDepth];
+  uint depth = 0;
+  intptr_t hash = 0;
+  for (vframeStream vfst(jt); !vfst.at_end() && depth < SiteStackDepth; vfst.next()) {
+    methods[depth] = vfst.method();
+    bcis[depth] = vfst.bci();
+    hash = hash * 31 + ((intptr_t)methods[depth] ^ (intptr_t)bcis[depth]);
+    depth++;
+  }
+  if (depth == 0) {
+    return;
+  }
+  if (hash == 0) {
+    // Zero marks a free table slot, nudge the hash off it.
+    hash = 1;
+  }
+
+  jint site_idx = record_site(hash, methods, bcis, depth, bytes);
+  if (site_idx >= 0) {
+    record_region(site_idx, obj, bytes);
+  }
+}
+
+jint ShenandoahAllocTracker::record_site(intptr_t hash, Method** methods, int* bcis, uint depth, size_t bytes) {
+  uint idx = (uint)((uintptr_t)hash % SiteTableSize);
+  for (uint probes = 0; probes < SiteTableSize; probes++) {
+    SiteEntry* e = &_site_table[idx];
+    intptr_t cur = e->_hash;
+    if (cur == 0) {
+      cur = Atomic::cmpxchg_ptr(hash, &e->_hash, (intptr_t)0);
+      if (cur == 0) {
+        // Claimed the slot: render the stack once. Concurrent readers may
+        // briefly see the counters before the text; printing tolerates that.
+        stringStream ss;
+        for (uint i = 0; i < depth; i++) {
+          ss.print_cr("    %s @ %d", methods[i]->name_and_sig_as_C_string(), bcis[i]);
+        }
+        e->_stack = os::strdup(ss.as_string(), mtGC);
+        cur = hash;
+      }
+    }
+    if (cur == hash) {
+      Atomic::add_ptr(1, &e->_samples);
+      Atomic::add_ptr((intptr_t)bytes, &e->_bytes);
+      return (jint)idx;
+    }
+    idx++;
+    if (idx == SiteTableSize) {
+      idx = 0;
+    }
+  }
+  // Table is full, drop the sample. With over a thousand distinct sites the
+  // profile is dominated by noise anyway; bumping SiteTableSize is the fix.
+  return -1;
+}
+
+void ShenandoahAllocTracker::record_region(jint site_idx, HeapWord* obj, size_t bytes) {
+  size_t region_idx = ShenandoahHeap::heap()->heap_region_index_containing(obj);
+  assert(region_idx < _num_regions, "sanity");
+  RegionEntry* e = &_region_table[region_idx];
+
+  double now = os::elapsedTime();
+  if (e->_first_sample == 0.0) {
+    // Benign race: samples are sparse, and close-by timestamps are equivalent.
+    e->_first_sample = now;
+  }
+  e->_last_sample = now;
+
+  jint tagged = site_idx + 1; // zero marks a free slot
+  for (uint i = 0; i < RegionSiteSlots; i++) {
+    jint cur = e->_sites[i];
+    if (cur == 0) {
+      cur = Atomic::cmpxchg(tagged, &e->_sites[i], 0);
+      if (cur == 0) {
+        cur = tagged;
+      }
+    }
+    if (cur == tagged) {
+      Atomic::add_ptr((intptr_t)bytes, &e->_bytes[i]);
+      return;
+    }
+  }
+  // All slots hold other sites; drop. This biases each region's view to the
+  // sites that started filling it, see the class comment.
+}
+
+void ShenandoahAllocTracker::clear_region(size_t region_idx) {
+  assert(region_idx < _num_regions, "sanity");
+  Copy::zero_to_bytes((char*)&_region_table[region_idx], sizeof(RegionEntry));
+}
+
+void ShenandoahAllocTracker::print_on(outputStream* out) const {
+  out->print_cr("Sampled allocation sites, one sample per " SIZE_FORMAT "%s allocated:",
+                byte_size_in_proper_unit(ShenandoahAllocSiteSampleInterval),
+                proper_unit_for_byte_size(ShenandoahAllocSiteSampleInterval));
+  out->cr();
+
+  for (uint i = 0; i < SiteTableSize; i++) {
+    SiteEntry* e = &_site_table[i];
+    if (e->_hash == 0 || e->_samples == 0) {
+      continue;
+    }
+    out->print_cr("  Site #%u: " SIZE_FORMAT " samples, " SIZE_FORMAT "%s sampled",
+                  i, (size_t)e->_samples,
+                  byte_size_in_proper_unit((size_t)e->_bytes),
+                  proper_unit_for_byte_size((size_t)e->_bytes));
+    if (e->_stack != NULL) {
+      out->print_raw(e->_stack);
+    } else {
+      out->print_cr("    (stack not rendered yet)");
+    }
+    out->cr();
+  }
+
+  out->print_cr("Per-region attribution, since each region's last recycle:");
+  out->cr();
+
+  double now = os::elapsedTime();
+  for (size_t r = 0; r < _num_regions; r++) {
+    RegionEntry* e = &_region_table[r];
+    if (e->_first_sample == 0.0) {
+      continue;
+    }
+    out->print("  Region " SIZE_FORMAT ": age %.3fs, last sample %.3fs ago, sites:",
+               r, now - e->_first_sample, now - e->_last_sample);
+    for (uint i = 0; i < RegionSiteSlots; i++) {
+      jint site = e->_sites[i];
+      if (site == 0) {
+        break;
+      }
+      out->print(" #%d (" SIZE_FORMAT "%s)",
+                 site - 1,
+                 byte_size_in_proper_unit((size_t)e->_bytes[i]),
+                 proper_unit_for_byte_size((size_t)e->_bytes[i]));
+    }
+    out->cr();
+  }
+}
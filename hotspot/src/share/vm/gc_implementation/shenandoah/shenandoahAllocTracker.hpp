@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2019, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_SHENANDOAH_SHENANDOAHALLOCTRACKER_HPP
+#define SHARE_VM_GC_SHENANDOAH_SHENANDOAHALLOCTRACKER_HPP
+
+#include "gc_implementation/shenandoah/shenandoahAllocRequest.hpp"
+#include "gc_implementation/shenandoah/shenandoahPadding.hpp"
+#include "memory/allocation.hpp"
+#include "utilities/ostream.hpp"
+
+class Method;
+
+// Sampled allocation-site profiler, enabled with -XX:+ShenandoahAllocSiteSampling.
+//
+// Every mutator allocation that reaches ShenandoahHeap::allocate_memory counts
+// down a shared byte budget; when the budget runs out, the allocating thread
+// walks its own Java stack, hashes the top frames into an allocation site ID,
+// and charges the allocation to that site and to the heap region the object
+// landed in. Since both TLAB refills and shared allocations funnel through
+// allocate_memory, this covers interpreter and compiled allocation paths
+// without touching them, at the cost of seeing TLAB-granularity samples.
+//
+// The per-region attribution is reset when the region gets recycled, so it
+// describes the current tenancy of the region: regions that grow old without
+// being recycled expose the allocation sites that populate them, which is
+// what slow-leak hunts need. Dump with the GC.shenandoah_alloc_sites jcmd.
+class ShenandoahAllocTracker : public CHeapObj<mtGC> {
+private:
+  static const uint SiteTableSize = 1021; // open hashing below, keep it prime
+  static const uint SiteStackDepth = 8;
+  static const uint RegionSiteSlots = 4;
+
+  // One sampled allocation site. The hash covers the top SiteStackDepth
+  // frames. The stack trace is rendered into C-heap once, when the site is
+  // first seen, so the entry stays printable even if the methods are
+  // unloaded later. (An unloaded-and-reloaded method can alias the hash of
+  // its previous incarnation; for a sampling profiler that is acceptable.)
+  struct SiteEntry {
+    volatile intptr_t _hash;    // zero means the slot is free
+    char*             _stack;   // rendered stack trace
+    volatile intptr_t _samples;
+    volatile intptr_t _bytes;   // sampled bytes; scale by hit rate for estimates
+  };
+
+  // Per-region attribution: the first few sites sampled in the region since
+  // its last recycle, and the time window of those samples. Sites past the
+  // available slots are dropped, which biases the view towards the sites
+  // that started filling the region - the interesting ones for leaks.
+  struct RegionEntry {
+    volatile jint     _sites[RegionSiteSlots]; // site table index + 1, zero is free
+    volatile intptr_t _bytes[RegionSiteSlots];
+    double            _first_sample;
+    double            _last_sample;
+  };
+
+  SiteEntry*        _site_table;
+  RegionEntry*      _region_table;
+  size_t            _num_regions;
+
+  shenandoah_padding(0);
+  volatile intptr_t _sample_budget;
+  shenandoah_padding(1);
+
+  void take_sample(HeapWord* obj, size_t bytes);
+  jint record_site(intptr_t hash, Method** methods, int* bcis, uint depth, size_t bytes);
+  void record_region(jint site_idx, HeapWord* obj, size_t bytes);
+
+public:
+  ShenandoahAllocTracker(size_t num_regions);
+  ~ShenandoahAllocTracker();
+
+  // Count the allocation against the sampling budget, and take a sample
+  // when the budget is depleted. Called outside the heap lock, on mutator
+  // allocation paths only.
+  void record_alloc(ShenandoahAllocRequest& req, HeapWord* obj);
+
+  // Forget the attribution for a recycled region.
+  void clear_region(size_t region_idx);
+
+  void print_on(outputStream* out) const;
+};
+
+#endif // SHARE_VM_GC_SHENANDOAH_SHENANDOAHALLOCTRACKER_HPP
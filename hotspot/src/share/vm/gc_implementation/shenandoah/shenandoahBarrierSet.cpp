@@ -28,7 +28,10 @@
 #include "gc_implementation/shenandoah/shenandoahBarrierSetClone.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahCollectorPolicy.hpp"
 #include "gc_implementation/shenandoah/shenandoahHeap.inline.hpp"
+#include "gc_implementation/shenandoah/shenandoahHeapRegion.hpp"
+#include "gc_implementation/shenandoah/shenandoahRememberedSet.hpp"
 #include "gc_implementation/shenandoah/heuristics/shenandoahHeuristics.hpp"
+#include "gc_implementation/shenandoah/mode/shenandoahMode.hpp"
 #include "runtime/interfaceSupport.hpp"
 #include "utilities/macros.hpp"
 
@@ -156,10 +159,32 @@ void ShenandoahBarrierSet::write_ref_field_pre_work(narrowOop* field, oop new_va
   inline_write_ref_field_pre(field, new_val);
 }
 
+bool ShenandoahBarrierSet::arraycopy_pre_work(oop* src, oop* dst, int length) {
+  arraycopy_barrier(src, dst, (size_t)length);
+  return true;
+}
+
+bool ShenandoahBarrierSet::arraycopy_pre_work(narrowOop* src, narrowOop* dst, int length) {
+  arraycopy_barrier(src, dst, (size_t)length);
+  return true;
+}
+
 void ShenandoahBarrierSet::write_ref_field_work(void* v, oop o, bool release) {
   shenandoah_assert_not_in_cset_loc_except(v, _heap->cancelled_gc());
   shenandoah_assert_not_forwarded_except  (v, o, o == NULL || _heap->cancelled_gc() || !_heap->is_concurrent_mark_in_progress());
   shenandoah_assert_not_in_cset_except    (v, o, o == NULL || _heap->cancelled_gc() || !_heap->is_concurrent_mark_in_progress());
+
+  // In generational mode, record old-to-young stores in the remembered set.
+  // Only the runtime store paths come here; compiled stores are handled by
+  // their own barriers.
+  if (o != NULL && _heap->mode()->is_generational() && _heap->is_in(v)) {
+    ShenandoahHeapRegion* loc_region = _heap->heap_region_containing(v);
+    ShenandoahHeapRegion* obj_region = _heap->heap_region_containing(o);
+    if (loc_region->age() >= ShenandoahTenuringThreshold &&
+        obj_region->age() <  ShenandoahTenuringThreshold) {
+      _heap->rem_set()->mark_dirty(v);
+    }
+  }
 }
 
 oop ShenandoahBarrierSet::load_reference_barrier_not_null(oop obj) {
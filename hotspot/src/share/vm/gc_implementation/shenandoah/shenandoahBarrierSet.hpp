@@ -90,6 +90,12 @@ public:
   inline void clone_barrier(oop src);
   void clone_barrier_runtime(oop src);
 
+  // Virtual hooks behind BarrierSet::arraycopy_pre(). These process the
+  // entire copied range, so they return true to let callers skip the
+  // per-element pre-barriers for the copy itself.
+  bool arraycopy_pre_work(oop* src, oop* dst, int length);
+  bool arraycopy_pre_work(narrowOop* src, narrowOop* dst, int length);
+
   // We export this to make it available in cases where the static
   // type of the barrier set is known.  Note that it is non-virtual.
   template <class T> inline void inline_write_ref_field_pre(T* field, oop newVal);
@@ -111,6 +111,11 @@ void ShenandoahBarrierSet::arraycopy_barrier(T* src, T* dst, size_t count) {
   if (count == 0) {
     return;
   }
+  // Runtime-visible array references have passed through the load reference
+  // barrier, so neither copied range can itself be in the collection set;
+  // the phase filters below only need to look at the elements.
+  shenandoah_assert_not_in_cset_loc_except(src, _heap->cancelled_gc());
+  shenandoah_assert_not_in_cset_loc_except(dst, _heap->cancelled_gc());
   int gc_state = _heap->gc_state();
   if ((gc_state & ShenandoahHeap::MARKING) != 0) {
     arraycopy_marking(src, dst, count);
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2019, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#include "gc_implementation/shenandoah/shenandoahCardSummary.hpp"
+
+ShenandoahCardSummary::ShenandoahCardSummary(HeapWord* heap_base, size_t heap_size_bytes) :
+  _heap_base(heap_base),
+  _num_cards(heap_size_bytes >> CardSizeBytesShift),
+  _recorded(_num_cards, false /* in_resource_area */) {
+  assert(is_size_aligned(heap_size_bytes, CardSizeBytes), "Heap should cover whole cards");
+  _recorded.clear();
+}
+
+void ShenandoahCardSummary::clear() {
+  _recorded.clear_large();
+}
+
+size_t ShenandoahCardSummary::recorded_card_count() const {
+  return _recorded.count_one_bits();
+}
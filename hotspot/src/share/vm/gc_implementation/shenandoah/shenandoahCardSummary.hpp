@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2019, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_SHENANDOAH_SHENANDOAHCARDSUMMARY_HPP
+#define SHARE_VM_GC_SHENANDOAH_SHENANDOAHCARDSUMMARY_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/bitMap.hpp"
+
+/*
+ * Card-granular summary of where the reference slots of live objects are,
+ * recorded by the marking workers as they visit each slot. The summary is
+ * value-independent: a card is recorded because a live object has a reference
+ * field there, not because of what the field contained when marking saw it.
+ * Mutators may overwrite the slots afterwards, but they cannot add reference
+ * slots to an existing object, so below TAMS the summary remains a superset
+ * of the slots that update-refs has to visit. Clean cards below TAMS are
+ * provably free of references and can be skipped wholesale.
+ *
+ * The summary is rebuilt from scratch by every marking pass; it is cleared
+ * together with the mark bitmaps and is only meaningful while the marking
+ * context that built it is complete.
+ */
+class ShenandoahCardSummary : public CHeapObj<mtGC> {
+private:
+  static const size_t CardSizeBytesShift = 9; // 512-byte cards, same as ShenandoahRememberedSet
+  static const size_t CardSizeBytes = (size_t)1 << CardSizeBytesShift;
+
+  HeapWord* const _heap_base;
+  const size_t _num_cards;
+  BitMap _recorded;
+
+  inline size_t card_index_for(const void* addr) const {
+    size_t idx = (pointer_delta((HeapWord*)addr, _heap_base) * HeapWordSize) >> CardSizeBytesShift;
+    assert(idx < _num_cards, err_msg("Card index in bounds: " SIZE_FORMAT, idx));
+    return idx;
+  }
+
+public:
+  ShenandoahCardSummary(HeapWord* heap_base, size_t heap_size_bytes);
+
+  // Called by marking workers, possibly concurrently.
+  inline void record(const void* addr) {
+    size_t idx = card_index_for(addr);
+    // Cards are shared between workers; skip the atomic when the bit is there.
+    if (!_recorded.at(idx)) {
+      _recorded.par_set_bit(idx);
+    }
+  }
+
+  // Returns the start of the first recorded card intersecting [start, end),
+  // or NULL when every card in the range is clean.
+  inline HeapWord* first_recorded(HeapWord* start, HeapWord* end) const {
+    assert(start < end, "Sanity");
+    size_t l = card_index_for(start);
+    size_t r = (pointer_delta(end, _heap_base) * HeapWordSize + CardSizeBytes - 1) >> CardSizeBytesShift;
+    size_t idx = _recorded.get_next_one_offset(l, r);
+    if (idx == r) {
+      return NULL;
+    }
+    return _heap_base + ((idx << CardSizeBytesShift) / HeapWordSize);
+  }
+
+  // Called when the mark bitmaps are reset; no marking is running then.
+  void clear();
+
+  size_t recorded_card_count() const;
+  size_t card_size_bytes() const { return CardSizeBytes; }
+};
+
+#endif // SHARE_VM_GC_SHENANDOAH_SHENANDOAHCARDSUMMARY_HPP
@@ -29,6 +29,7 @@
 #include "gc_implementation/shenandoah/shenandoahHeapRegionSet.hpp"
 #include "gc_implementation/shenandoah/shenandoahUtils.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/orderAccess.inline.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/copy.hpp"
 
@@ -39,6 +40,9 @@ ShenandoahCollectionSet::ShenandoahCollectionSet(ShenandoahHeap* heap, ReservedS
   _cset_map(_map_space.base() + ((uintx)heap_base >> _region_size_bytes_shift)),
   _biased_cset_map(_map_space.base()),
   _heap(heap),
+  _evac_complete_map(NULL),
+  _claim_map(NULL),
+  _has_evacuations_map(NULL),
   _garbage(0),
   _used(0),
   _region_count(0),
@@ -76,6 +80,15 @@ ShenandoahCollectionSet::ShenandoahCollectionSet(ShenandoahHeap* heap, ReservedS
 
   Copy::zero_to_bytes(_cset_map, _map_size);
   Copy::zero_to_bytes(_biased_cset_map, page_size);
+
+  _evac_complete_map = NEW_C_HEAP_ARRAY(jbyte, _map_size, mtGC);
+  Copy::zero_to_bytes((char*)_evac_complete_map, _map_size);
+
+  _claim_map = NEW_C_HEAP_ARRAY(jbyte, _map_size, mtGC);
+  Copy::zero_to_bytes((char*)_claim_map, _map_size);
+
+  _has_evacuations_map = NEW_C_HEAP_ARRAY(jbyte, _map_size, mtGC);
+  Copy::zero_to_bytes((char*)_has_evacuations_map, _map_size);
 }
 
 void ShenandoahCollectionSet::add_region(ShenandoahHeapRegion* r) {
@@ -83,17 +96,36 @@ void ShenandoahCollectionSet::add_region(ShenandoahHeapRegion* r) {
   assert(Thread::current()->is_VM_thread(), "Must be VMThread");
   assert(!is_in(r), "Already in collection set");
   _cset_map[r->index()] = 1;
+  _evac_complete_map[r->index()] = 0;
+  _claim_map[r->index()] = 0;
+  _has_evacuations_map[r->index()] = 0;
   _region_count++;
   _garbage += r->garbage();
   _used += r->used();
+  r->record_cset_selection(r->get_live_data_bytes());
 
   // Update the region status too. State transition would be checked internally.
   r->make_cset();
 }
 
+void ShenandoahCollectionSet::remove_region(ShenandoahHeapRegion* r) {
+  assert(ShenandoahSafepoint::is_at_shenandoah_safepoint(), "Must be at a safepoint");
+  assert(is_in(r), "Must be in collection set");
+  assert(!has_evacuations(r->index()), "Must not have evacuated objects");
+  _cset_map[r->index()] = 0;
+  _region_count--;
+  _garbage -= r->garbage();
+  _used -= r->used();
+  // Nothing was evacuated (asserted above), take the selection back.
+  r->record_cset_removal(r->get_live_data_bytes());
+}
+
 void ShenandoahCollectionSet::clear() {
   assert(ShenandoahSafepoint::is_at_shenandoah_safepoint(), "Must be at a safepoint");
   Copy::zero_to_bytes(_cset_map, _map_size);
+  Copy::zero_to_bytes((char*)_evac_complete_map, _map_size);
+  Copy::zero_to_bytes((char*)_claim_map, _map_size);
+  Copy::zero_to_bytes((char*)_has_evacuations_map, _map_size);
 
 #ifdef ASSERT
   for (size_t index = 0; index < _heap->num_regions(); index ++) {
@@ -108,31 +140,53 @@ void ShenandoahCollectionSet::clear() {
   _current_index = 0;
 }
 
+void ShenandoahCollectionSet::clear_current_index() {
+  // Restart the scans from scratch: drop the claims too, otherwise the
+  // retried scan would consider every region already handed out.
+  Copy::zero_to_bytes((char*)_claim_map, _map_size);
+  OrderAccess::storestore();
+  _current_index = 0;
+}
+
+bool ShenandoahCollectionSet::try_claim(size_t region_idx) {
+  return _claim_map[region_idx] == 0 &&
+         Atomic::cmpxchg((jbyte)1, &_claim_map[region_idx], (jbyte)0) == 0;
+}
+
 ShenandoahHeapRegion* ShenandoahCollectionSet::claim_next() {
+  // The claim map is authoritative; _current_index only tracks the frontier
+  // of the sequential scan, so that claimants do not rescan the prefix that
+  // is already handed out. It is safe for the cursor to lag behind.
   size_t num_regions = _heap->num_regions();
-  if (_current_index >= (jint)num_regions) {
-    return NULL;
+  while (true) {
+    size_t index = (size_t)_current_index;
+    if (index >= num_regions) {
+      return NULL;
+    }
+    if (is_in(index) && try_claim(index)) {
+      return _heap->get_region(index);
+    }
+    Atomic::cmpxchg((jint)(index + 1), &_current_index, (jint)index);
   }
+}
 
-  jint saved_current = _current_index;
-  size_t index = (size_t)saved_current;
-
-  while(index < num_regions) {
-    if (is_in(index)) {
-      jint cur = Atomic::cmpxchg((jint)(index + 1), &_current_index, saved_current);
-      assert(cur >= (jint)saved_current, "Must move forward");
-      if (cur == saved_current) {
-        assert(is_in(index), "Invariant");
-        return _heap->get_region(index);
-      } else {
-        index = (size_t)cur;
-        saved_current = cur;
-      }
-    } else {
-      index ++;
+ShenandoahHeapRegion* ShenandoahCollectionSet::claim_next_prefer_node(size_t node, size_t* cursor) {
+  // Regions are interleaved over the nodes round-robin (see
+  // ShenandoahHeapRegion::numa_node()), so striding by the node count walks
+  // exactly the node-local regions. The cursor is caller-local: claims come
+  // from the shared claim map, so stale cursors only cause wasted probes.
+  size_t num_regions = _heap->num_regions();
+  size_t stride = os::numa_get_groups_num();
+  for (size_t index = *cursor; index < num_regions; index += stride) {
+    *cursor = index + stride;
+    if (is_in(index) && try_claim(index)) {
+      return _heap->get_region(index);
     }
   }
-  return NULL;
+  *cursor = num_regions;
+
+  // Node-local regions are exhausted, steal from the sequential scan.
+  return claim_next();
 }
 
 ShenandoahHeapRegion* ShenandoahCollectionSet::next() {
@@ -41,6 +41,21 @@ private:
 
   ShenandoahHeap* const _heap;
 
+  // One byte per region: set when the region was fully evacuated, so that
+  // the STW retry after a degeneration can skip it. See set_evac_complete().
+  jbyte*                _evac_complete_map;
+
+  // One byte per region: set when a worker has claimed the region. This is
+  // the actual claim; _current_index is only a hint for the sequential scan.
+  // It lets NUMA-preferring claimants and the sequential fallback coexist
+  // without handing out the same region twice.
+  jbyte*                _claim_map;
+
+  // One byte per region: set just before the first forwarded copy out of
+  // the region can become visible. A region with this byte still clear has
+  // no to-space copies at all, see mark_has_evacuations().
+  jbyte*                _has_evacuations_map;
+
   size_t                _garbage;
   size_t                _used;
   size_t                _region_count;
@@ -58,15 +73,38 @@ public:
   // MT version
   ShenandoahHeapRegion* claim_next();
 
+  // MT version that prefers regions on the given NUMA node. The caller keeps
+  // *cursor across calls, starting it at the node id; once the node-local
+  // regions are exhausted, this falls back to claim_next().
+  ShenandoahHeapRegion* claim_next_prefer_node(size_t node, size_t* cursor);
+
   // Single-thread version
   ShenandoahHeapRegion* next();
 
   size_t count()  const { return _region_count; }
   bool is_empty() const { return _region_count == 0; }
 
-  void clear_current_index() {
-    _current_index = 0;
-  }
+  void clear_current_index();
+
+  // A region is "evacuation complete" when a worker has scanned all its live
+  // objects without entering the OOM-during-evacuation protocol: every live
+  // object then has a forwarded copy, and evacuation retries after a
+  // degeneration can skip the region instead of rescanning it.
+  void set_evac_complete(size_t region_idx)      { _evac_complete_map[region_idx] = 1; }
+  bool is_evac_complete(size_t region_idx) const { return _evac_complete_map[region_idx] == 1; }
+
+  // Evacuating workers mark the source region before they try to install
+  // the forwarding pointer, so the mark is conservative: it may be set for
+  // a region that ends up with no copies, but it is never clear for a
+  // region that has one. The degenerated path relies on that to retire
+  // untouched regions from the collection set, see remove_region().
+  void mark_has_evacuations(size_t region_idx)  { _has_evacuations_map[region_idx] = 1; }
+  bool has_evacuations(size_t region_idx) const { return _has_evacuations_map[region_idx] == 1; }
+
+  // Remove the region from the collection set. Only valid at a safepoint,
+  // for regions that have no evacuated objects; the caller reverts the
+  // region state separately, under the heap lock.
+  void remove_region(ShenandoahHeapRegion* r);
 
   inline bool is_in(ShenandoahHeapRegion* r) const;
   inline bool is_in(size_t region_idx)       const;
@@ -80,6 +118,8 @@ public:
   void clear();
 
 private:
+  bool try_claim(size_t region_idx);
+
   char* map_address() const {
     return _cset_map;
   }
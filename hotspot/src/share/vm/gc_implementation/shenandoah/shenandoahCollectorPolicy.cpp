@@ -29,6 +29,7 @@
 #include "gc_implementation/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahLogging.hpp"
 #include "gc_implementation/shenandoah/heuristics/shenandoahHeuristics.hpp"
+#include "jfr/jfrEvents.hpp"
 
 ShenandoahCollectorPolicy::ShenandoahCollectorPolicy() :
   _success_concurrent_gcs(0),
@@ -140,6 +141,12 @@ void ShenandoahCollectorPolicy::record_alloc_failure_to_degenerated(ShenandoahHe
   assert(point < ShenandoahHeap::_DEGENERATED_LIMIT, "sanity");
   _alloc_failure_degenerated++;
   _degen_points[point]++;
+
+  EventShenandoahDegeneratedGC evt;
+  if (evt.should_commit()) {
+    evt.set_point(ShenandoahHeap::degen_point_to_string(point));
+    evt.commit();
+  }
 }
 
 void ShenandoahCollectorPolicy::record_degenerated_upgrade_to_full() {
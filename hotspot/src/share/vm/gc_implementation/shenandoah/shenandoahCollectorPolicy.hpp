@@ -98,6 +98,10 @@ public:
 
   size_t cycle_counter() const;
 
+  size_t success_concurrent_gcs()  const { return _success_concurrent_gcs;  }
+  size_t success_degenerated_gcs() const { return _success_degenerated_gcs; }
+  size_t success_full_gcs()        const { return _success_full_gcs;        }
+
   void print_gc_stats(outputStream* out) const;
 };
 
@@ -428,7 +428,7 @@ void ShenandoahConcurrentMark::mark_from_roots() {
 
     // enable ("weak") refs discovery
     rp->enable_discovery(true /*verify_no_refs*/, true);
-    rp->setup_policy(_heap->collector_policy()->should_clear_all_soft_refs());
+    _heap->setup_soft_ref_policy();
   }
 
   shenandoah_assert_rp_isalive_not_installed();
@@ -701,7 +701,12 @@ void ShenandoahConcurrentMark::weak_refs_work_doit(bool full_gc) {
   WorkGang* workers = _heap->workers();
   uint nworkers = workers->active_workers();
 
-  rp->setup_policy(_heap->collector_policy()->should_clear_all_soft_refs());
+  _heap->setup_soft_ref_policy();
+
+  // Discovery runs with max_workers queues, so when the pause runs with the
+  // same number of workers, every discovered list has its own processing
+  // worker and RP skips the serial splicing of the discovered lists. With
+  // fewer active workers, RP balances the lists onto the active queues first.
   rp->set_active_mt_degree(nworkers);
 
   assert(task_queues()->is_empty(), "Should be empty");
@@ -945,6 +950,14 @@ void ShenandoahConcurrentMark::mark_loop_work(T* cl, ShenandoahLiveData* live_da
   ShenandoahObjToScanQueue* q;
   ShenandoahMarkTask t;
 
+  // Tasks are popped in batches and their object headers prefetched before
+  // the visits, see do_task_batch. A batch of one degenerates to the plain
+  // pop-then-visit loop without prefetching.
+  static const uint BATCH_SLOTS = 64;
+  guarantee(ShenandoahMarkQueuePrefetch <= BATCH_SLOTS, "adjust slot count");
+  const uint batch = MAX2<uint>(1, (uint) ShenandoahMarkQueuePrefetch);
+  ShenandoahMarkTask batch_tasks[BATCH_SLOTS];
+
   /*
    * Process outstanding queues, if any.
    *
@@ -961,14 +974,14 @@ void ShenandoahConcurrentMark::mark_loop_work(T* cl, ShenandoahLiveData* live_da
       return;
     }
 
-    for (uint i = 0; i < stride; i++) {
-      if (q->pop(t)) {
-        do_task<T>(q, cl, live_data, &t);
-      } else {
+    for (uint i = 0; i < stride; ) {
+      uint n = do_task_batch<T>(q, cl, live_data, batch_tasks, MIN2(batch, (uint)(stride - i)));
+      if (n == 0) {
         assert(q->is_empty(), "Must be empty");
         q = queues->claim_next();
         break;
       }
+      i += n;
     }
   }
 
@@ -995,9 +1008,14 @@ void ShenandoahConcurrentMark::mark_loop_work(T* cl, ShenandoahLiveData* live_da
     }
 
     uint work = 0;
-    for (uint i = 0; i < stride; i++) {
-      if (q->pop(t) ||
-          queues->steal(worker_id, &seed, t)) {
+    while (work < stride) {
+      uint n = do_task_batch<T>(q, cl, live_data, batch_tasks, MIN2(batch, (uint)(stride - work)));
+      if (n > 0) {
+        work += n;
+      } else if (queues->steal(worker_id, &seed, t)) {
+        // Local queue is empty, steal one task at a time; successful steals
+        // refill the local queue with the stolen object's children, so the
+        // next iteration is back to batched draining.
         do_task<T>(q, cl, live_data, &t);
         work++;
       } else {
@@ -67,6 +67,25 @@ void ShenandoahConcurrentMark::do_task(ShenandoahObjToScanQueue* q, T* cl, Shena
   }
 }
 
+template <class T>
+uint ShenandoahConcurrentMark::do_task_batch(ShenandoahObjToScanQueue* q, T* cl, ShenandoahLiveData* live_data, ShenandoahMarkTask* tasks, uint limit) {
+  uint n = q->pop_batch(tasks, limit);
+  if (n > 1) {
+    // Prefetch the headers before visiting the batch: do_task reads the mark
+    // and klass words of every object right away, and popping a batch ahead
+    // gives the prefetches time to complete. One read per object covers both
+    // words, they share the first cache line. Chunked array tasks get the
+    // same treatment; for those the header access is merely less dominant.
+    for (uint i = 0; i < n; i++) {
+      Prefetch::read((void*) tasks[i].obj(), oopDesc::mark_offset_in_bytes());
+    }
+  }
+  for (uint i = 0; i < n; i++) {
+    do_task<T>(q, cl, live_data, &tasks[i]);
+  }
+  return n;
+}
+
 inline void ShenandoahConcurrentMark::count_liveness(ShenandoahLiveData* live_data, oop obj) {
   size_t region_idx = _heap->heap_region_index_containing(obj);
   ShenandoahHeapRegion* region = _heap->get_region(region_idx);
@@ -214,7 +233,22 @@ public:
 
   template<StringDedupMode STRING_DEDUP>
   void do_buffer_impl(void **buffer, size_t size) {
+    // Buffers are filtered at enqueue, but entries routinely get marked
+    // from other paths between the enqueue and the drain, especially during
+    // heavy mutation. Filter the whole buffer against the mark bitmap first,
+    // compacting the entries that still need marking, and prefetch their
+    // headers, anticipating the accesses during the actual marking pass.
+    // Already-marked entries get dropped without any task queue work.
+    size_t keep = 0;
     for (size_t i = 0; i < size; ++i) {
+      oop obj = oop(buffer[i]);
+      if (!_mark_context->is_marked(obj)) {
+        Prefetch::read((void*) obj, oopDesc::mark_offset_in_bytes());
+        buffer[keep++] = (void*) obj;
+      }
+    }
+
+    for (size_t i = 0; i < keep; ++i) {
       oop *p = (oop *) &buffer[i];
       ShenandoahConcurrentMark::mark_through_ref<oop, NONE, STRING_DEDUP>(p, _heap, _queue, _mark_context, _dedup_queue);
     }
@@ -223,6 +257,14 @@ public:
 
 template<class T, UpdateRefsMode UPDATE_REFS, StringDedupMode STRING_DEDUP>
 inline void ShenandoahConcurrentMark::mark_through_ref(T *p, ShenandoahHeap* heap, ShenandoahObjToScanQueue* q, ShenandoahMarkingContext* const mark_context, ShenandoahStrDedupQueue* dq) {
+  if (ShenandoahUpdateRefsCardSummaries && heap->is_in(p)) {
+    // Record the slot location regardless of its current value: mutators may
+    // overwrite the slot after this visit, but cannot add reference slots to
+    // a live object, so the summary stays a superset of the slots that
+    // update-refs has to visit. Roots and SATB buffer entries arrive here
+    // with off-heap slot addresses, hence the is_in() filter.
+    heap->card_summary()->record(p);
+  }
   T o = oopDesc::load_heap_oop(p);
   if (! oopDesc::is_null(o)) {
     oop obj = oopDesc::decode_heap_oop_not_null(o);
@@ -36,8 +36,11 @@
 #include "gc_implementation/shenandoah/shenandoahVMOperations.hpp"
 #include "gc_implementation/shenandoah/shenandoahWorkerPolicy.hpp"
 #include "gc_implementation/shenandoah/heuristics/shenandoahHeuristics.hpp"
+#include "memory/heapInspection.hpp"
 #include "memory/iterator.hpp"
+#include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "runtime/orderAccess.inline.hpp"
 
 #ifdef _WINDOWS
 #pragma warning(disable : 4355)
@@ -49,9 +52,12 @@ ShenandoahControlThread::ShenandoahControlThread() :
   ConcurrentGCThread(),
   _alloc_failure_waiters_lock(Mutex::leaf, "ShenandoahAllocFailureGC_lock", true),
   _gc_waiters_lock(Mutex::leaf, "ShenandoahRequestedGC_lock", true),
+  _histogram_lock(Mutex::leaf, "ShenandoahClassHistogram_lock", true),
   _periodic_task(this),
   _requested_gc_cause(GCCause::_no_cause_specified),
   _degen_point(ShenandoahHeap::_degenerated_outside_cycle),
+  _histogram_out(NULL),
+  _histogram_epoch(0),
   _allocs_seen(0) {
 
   reset_gc_id();
@@ -130,6 +136,9 @@ void ShenandoahControlThread::run() {
     // Check if we have seen a new target for soft max heap size.
     bool soft_max_changed = check_soft_max_changed();
 
+    // Check if an external memory-pressure signal asked for immediate uncommit.
+    bool uncommit_requested = _uncommit_requested.try_unset();
+
     // Choose which GC mode to run in. The block below should select a single mode.
     GCMode mode = none;
     GCCause::Cause cause = GCCause::_last_gc_cause;
@@ -315,12 +324,14 @@ void ShenandoahControlThread::run() {
 
     double current = os::elapsedTime();
 
-    if (ShenandoahUncommit && (explicit_gc_requested || soft_max_changed || (current - last_shrink_time > shrink_period))) {
+    if (ShenandoahUncommit && (explicit_gc_requested || soft_max_changed || uncommit_requested ||
+                               (current - last_shrink_time > shrink_period))) {
       // Explicit GC tries to uncommit everything down to min capacity.
       // Soft max change tries to uncommit everything down to target capacity.
+      // Explicit uncommit request tries to uncommit everything down to min capacity.
       // Periodic uncommit tries to uncommit suitable regions down to min capacity.
 
-      double shrink_before = (explicit_gc_requested || soft_max_changed) ?
+      double shrink_before = (explicit_gc_requested || soft_max_changed || uncommit_requested) ?
                              current :
                              current - (ShenandoahUncommitDelay / 1000.0);
 
@@ -333,6 +344,11 @@ void ShenandoahControlThread::run() {
       last_shrink_time = current;
     }
 
+    // Service a class histogram request when no cycle is running or starting.
+    if (!gc_requested && _histogram_requested.is_set()) {
+      service_class_histogram();
+    }
+
     // Wait before performing the next action. If allocation happened during this wait,
     // we exit sooner, to let heuristics re-evaluate new conditions. If we are at idle,
     // back off exponentially.
@@ -345,6 +361,16 @@ void ShenandoahControlThread::run() {
     os::naked_short_sleep(sleep);
   }
 
+  // Unblock a histogram requester that raced with the shutdown.
+  if (_histogram_requested.is_set()) {
+    MonitorLockerEx ml(&_histogram_lock);
+    _histogram_out->print_cr("VM is shutting down, histogram not generated");
+    _histogram_out = NULL;
+    _histogram_epoch++;
+    _histogram_requested.unset();
+    ml.notify_all();
+  }
+
   // Wait for the actual stop(), can't leave run_service() earlier.
   while (! _should_terminate) {
     os::naked_short_sleep(ShenandoahControlIntervalMin);
@@ -542,6 +568,127 @@ void ShenandoahControlThread::service_uncommit(double shrink_before, size_t shri
   }
 }
 
+// Records every visited object into the KlassInfoTable, like the closure
+// heapInspection uses for the safepointed histogram.
+class ShenandoahHistogramRecordClosure : public ObjectClosure {
+private:
+  KlassInfoTable* _cit;
+  size_t _missed_count;
+public:
+  ShenandoahHistogramRecordClosure(KlassInfoTable* cit) : _cit(cit), _missed_count(0) {}
+
+  void do_object(oop obj) {
+    if (!_cit->record_instance(obj)) {
+      _missed_count++;
+    }
+  }
+
+  size_t missed_count() const { return _missed_count; }
+};
+
+class ShenandoahHistogramPrintClosure : public KlassInfoClosure {
+private:
+  KlassInfoHisto* _histo;
+public:
+  ShenandoahHistogramPrintClosure(KlassInfoHisto* histo) : _histo(histo) {}
+
+  void do_cinfo(KlassInfoEntry* cie) {
+    _histo->add(cie);
+  }
+};
+
+void ShenandoahControlThread::service_class_histogram() {
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  outputStream* out = _histogram_out;
+
+  if (!heap->marking_context()->is_complete()) {
+    out->print_cr("No complete marking bitmap yet, retry after the first completed GC cycle");
+  } else {
+    // Walk only objects that were marked live by the most recent completed
+    // cycle: they sit below each region's TAMS, and neither their contents
+    // nor the bitmap under them change until the next cycle starts -- which
+    // cannot happen while this loop runs on the control thread. Objects
+    // allocated or evacuated since that mark sit above TAMS and are missed;
+    // that is the staleness this command trades for not stopping mutators.
+    ResourceMark rm;
+    KlassInfoTable cit(false);
+    if (cit.allocation_failed()) {
+      out->print_cr("WARNING: Ran out of C-heap; histogram not generated");
+    } else {
+      ShenandoahMarkingContext* ctx = heap->complete_marking_context();
+      ShenandoahHistogramRecordClosure cl(&cit);
+      bool aborted = false;
+      for (size_t i = 0; i < heap->num_regions(); i++) {
+        // Give way to a pending cycle: it would move objects under this walk.
+        if (_alloc_failure_gc.is_set() || _gc_requested.is_set() || in_graceful_shutdown()) {
+          aborted = true;
+          break;
+        }
+        ShenandoahHeapRegion* r = heap->get_region(i);
+        if (r->is_humongous_continuation()) {
+          continue;
+        }
+        // Trash regions hold the stale copies of already-evacuated objects
+        // and can be recycled for new allocations under this walk.
+        if (r->is_cset() || r->is_trash() || r->is_empty()) {
+          continue;
+        }
+        // Order the TAMS read after the state check. Mutators recycle trash
+        // regions under the heap lock, resetting TAMS to bottom before the
+        // region turns empty/regular; without the barrier this thread could
+        // pair the fresh state with the stale TAMS and walk the stale bitmap
+        // over memory that is being re-allocated. The recycling side is
+        // ordered by the heap lock release.
+        OrderAccess::loadload();
+        HeapWord* tams = ctx->top_at_mark_start(r);
+        if (tams <= r->bottom()) {
+          continue;
+        }
+        heap->marked_object_iterate(r, &cl, tams);
+      }
+
+      if (aborted) {
+        out->print_cr("Aborted: a GC cycle was requested during the walk, retry later");
+      } else {
+        if (cl.missed_count() != 0) {
+          out->print_cr("WARNING: Ran out of C-heap; undercounted " SIZE_FORMAT
+                        " total instances in data below",
+                        cl.missed_count());
+        }
+        const char* title = "\n"
+                  " num     #instances         #bytes  class name\n"
+                  "----------------------------------------------";
+        KlassInfoHisto histo(&cit, title);
+        ShenandoahHistogramPrintClosure hc(&histo);
+        cit.iterate(&hc);
+        histo.sort();
+        histo.print_histo_on(out, false, false, NULL);
+      }
+    }
+  }
+  out->flush();
+
+  MonitorLockerEx ml(&_histogram_lock);
+  _histogram_out = NULL;
+  _histogram_epoch++;
+  _histogram_requested.unset();
+  ml.notify_all();
+}
+
+void ShenandoahControlThread::run_class_histogram(outputStream* out) {
+  MonitorLockerEx ml(&_histogram_lock);
+  // Wait out somebody else's request first; only one can be in flight.
+  while (_histogram_requested.is_set()) {
+    ml.wait();
+  }
+  _histogram_out = out;
+  _histogram_requested.set();
+  size_t requested_at = _histogram_epoch;
+  while (_histogram_epoch == requested_at) {
+    ml.wait();
+  }
+}
+
 bool ShenandoahControlThread::is_explicit_gc(GCCause::Cause cause) const {
   return GCCause::is_user_requested_gc(cause) ||
          GCCause::is_serviceability_requested_gc(cause);
@@ -668,6 +815,10 @@ void ShenandoahControlThread::notify_heap_changed() {
   }
 }
 
+void ShenandoahControlThread::request_uncommit() {
+  _uncommit_requested.set();
+}
+
 void ShenandoahControlThread::pacing_notify_alloc(size_t words) {
   assert(ShenandoahPacing, "should only call when pacing is enabled");
   Atomic::add(words, &_allocs_seen);
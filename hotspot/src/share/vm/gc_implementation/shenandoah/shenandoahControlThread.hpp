@@ -76,6 +76,7 @@ private:
   // to make complete explicit cycle for for demanding customers.
   Monitor _alloc_failure_waiters_lock;
   Monitor _gc_waiters_lock;
+  Monitor _histogram_lock;
   ShenandoahPeriodicTask _periodic_task;
   ShenandoahPeriodicSATBFlushTask _periodic_satb_flush_task;
   ShenandoahPeriodicPacerNotify _periodic_pacer_notify_task;
@@ -92,11 +93,18 @@ private:
   ShenandoahSharedFlag _alloc_failure_gc;
   ShenandoahSharedFlag _graceful_shutdown;
   ShenandoahSharedFlag _heap_changed;
+  ShenandoahSharedFlag _uncommit_requested;
   ShenandoahSharedFlag _do_counters_update;
   ShenandoahSharedFlag _force_counters_update;
   GCCause::Cause       _requested_gc_cause;
   ShenandoahHeap::ShenandoahDegenPoint _degen_point;
 
+  // Concurrent class histogram request, all guarded by _histogram_lock:
+  // requesters block until _histogram_epoch advances past their request.
+  ShenandoahSharedFlag _histogram_requested;
+  outputStream*        _histogram_out;
+  size_t               _histogram_epoch;
+
   shenandoah_padding(0);
   volatile intptr_t _allocs_seen;
   shenandoah_padding(1);
@@ -108,6 +116,7 @@ private:
   void service_stw_full_cycle(GCCause::Cause cause);
   void service_stw_degenerated_cycle(GCCause::Cause cause, ShenandoahHeap::ShenandoahDegenPoint point);
   void service_uncommit(double shrink_before, size_t shrink_until);
+  void service_class_histogram();
 
   bool try_set_alloc_failure_gc();
   void notify_alloc_failure_waiters();
@@ -151,6 +160,16 @@ public:
 
   void notify_heap_changed();
 
+  // Request immediate uncommit of empty regions, disregarding the uncommit
+  // delay. Served on the next control loop iteration.
+  void request_uncommit();
+
+  // Print a class histogram from the most recent complete marking bitmap,
+  // without stopping the mutators. Runs on the control thread between GC
+  // cycles, so it cannot race with one; gives way if a cycle is requested.
+  // Blocks until the histogram (or a diagnostic message) is printed.
+  void run_class_histogram(outputStream* out);
+
   void pacing_notify_alloc(size_t words);
 
   void start();
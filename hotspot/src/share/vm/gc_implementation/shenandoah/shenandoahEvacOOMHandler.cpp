@@ -26,6 +26,7 @@
 #include "gc_implementation/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahUtils.hpp"
 #include "gc_implementation/shenandoah/shenandoahEvacOOMHandler.hpp"
+#include "jfr/jfrEvents.hpp"
 
 const jint ShenandoahEvacOOMHandler::OOM_MARKER_MASK = 0x80000000;
 
@@ -92,6 +93,9 @@ void ShenandoahEvacOOMHandler::handle_out_of_memory_during_evacuation() {
   assert(Thread::current()->is_evac_allowed(), "sanity");
   assert(!Thread::current()->is_oom_during_evac(), "TL oom-during-evac must not be set");
 
+  // Event duration covers the wait for other threads to leave the protocol
+  EventShenandoahEvacuationOOM evt;
+
   jint threads_in_evac = OrderAccess::load_acquire(&_threads_in_evac);
   while (true) {
     jint other = Atomic::cmpxchg((threads_in_evac - 1) | OOM_MARKER_MASK,
@@ -99,6 +103,11 @@ void ShenandoahEvacOOMHandler::handle_out_of_memory_during_evacuation() {
     if (other == threads_in_evac) {
       // Success: wait for other threads to get out of the protocol and return.
       wait_for_no_evac_threads();
+
+      if (evt.should_commit()) {
+        evt.set_threadsInEvac((unsigned)(threads_in_evac & ~OOM_MARKER_MASK));
+        evt.commit();
+      }
       return;
     } else {
       // Failure: try again with updated new value.
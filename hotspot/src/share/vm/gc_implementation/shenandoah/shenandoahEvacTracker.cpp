@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2018, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#include "gc_implementation/shenandoah/shenandoahEvacTracker.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/copy.hpp"
+
+ShenandoahEvacTracker::ShenandoahEvacTracker(size_t num_regions, uint num_workers) :
+  _num_regions(num_regions),
+  _num_workers(num_workers) {
+
+  _from_regions = NEW_C_HEAP_ARRAY(Stats, num_regions, mtGC);
+  _to_region_bytes = NEW_C_HEAP_ARRAY(intptr_t, num_regions, mtGC);
+  _workers = NEW_C_HEAP_ARRAY(Stats, num_workers + 1, mtGC);
+  reset();
+}
+
+uint ShenandoahEvacTracker::worker_bucket(Thread* thread) const {
+  if (thread->is_Worker_thread()) {
+    uint id = ((WorkerThread*)thread)->id();
+    assert(id < _num_workers, "sanity");
+    return id;
+  }
+  // All mutator threads doing write-barrier evacuations share the last bucket.
+  return _num_workers;
+}
+
+void ShenandoahEvacTracker::record(Stats* stats, size_t bytes, jlong nanos) {
+  Atomic::add_ptr(1, &stats->_objects);
+  Atomic::add_ptr((intptr_t)bytes, &stats->_bytes);
+  Atomic::add_ptr((intptr_t)nanos, &stats->_nanos);
+}
+
+void ShenandoahEvacTracker::record_evac(size_t from_region, size_t to_region, Thread* thread,
+                                        size_t bytes, jlong nanos) {
+  assert(from_region < _num_regions && to_region < _num_regions, "sanity");
+  record(&_from_regions[from_region], bytes, nanos);
+  Atomic::add_ptr((intptr_t)bytes, &_to_region_bytes[to_region]);
+  record(&_workers[worker_bucket(thread)], bytes, nanos);
+}
+
+void ShenandoahEvacTracker::reset() {
+  Copy::zero_to_bytes((char*)_from_regions, _num_regions * sizeof(Stats));
+  Copy::zero_to_bytes((char*)_to_region_bytes, _num_regions * sizeof(intptr_t));
+  Copy::zero_to_bytes((char*)_workers, (_num_workers + 1) * sizeof(Stats));
+}
+
+static double bandwidth_mb_s(intptr_t bytes, intptr_t nanos) {
+  if (nanos <= 0) {
+    return 0.0;
+  }
+  return ((double)bytes / (double)M) / ((double)nanos / (double)NANOSECS_PER_SEC);
+}
+
+void ShenandoahEvacTracker::print_on(outputStream* st) const {
+  st->print_cr("Evacuation statistics, since the last cycle started evacuating:");
+  st->cr();
+
+  intptr_t total_objects = 0;
+  intptr_t total_bytes = 0;
+  intptr_t total_nanos = 0;
+  size_t touched_regions = 0;
+  for (size_t r = 0; r < _num_regions; r++) {
+    Stats* s = &_from_regions[r];
+    if (s->_objects == 0) {
+      continue;
+    }
+    touched_regions++;
+    total_objects += s->_objects;
+    total_bytes += s->_bytes;
+    total_nanos += s->_nanos;
+  }
+
+  st->print_cr("  " SIZE_FORMAT " objects, " SIZE_FORMAT "%s, from " SIZE_FORMAT " regions, "
+               "%.3f ms copy time, %.0f MB/s aggregate",
+               (size_t)total_objects,
+               byte_size_in_proper_unit((size_t)total_bytes),
+               proper_unit_for_byte_size((size_t)total_bytes),
+               touched_regions,
+               (double)total_nanos / (double)NANOSECS_PER_MILLISEC,
+               bandwidth_mb_s(total_bytes, total_nanos));
+  st->cr();
+
+  if (touched_regions == 0) {
+    return;
+  }
+
+  // Copy time is summed across threads that evacuated the region concurrently,
+  // so per-region bandwidth is per-thread copy bandwidth, not wall-clock rate.
+  st->print_cr("  Source regions by copy bandwidth:");
+  const uint BucketCount = 12;
+  size_t buckets[BucketCount];
+  for (uint b = 0; b < BucketCount; b++) {
+    buckets[b] = 0;
+  }
+  for (size_t r = 0; r < _num_regions; r++) {
+    Stats* s = &_from_regions[r];
+    if (s->_objects == 0) {
+      continue;
+    }
+    // Power-of-two MB/s buckets: <1, 1-2, ..., 512-1024, >=1024.
+    double mb_s = bandwidth_mb_s(s->_bytes, s->_nanos);
+    uint b = 0;
+    while (b < BucketCount - 1 && mb_s >= (double)((size_t)1 << b)) {
+      b++;
+    }
+    buckets[b]++;
+  }
+  for (uint b = 0; b < BucketCount; b++) {
+    if (buckets[b] == 0) {
+      continue;
+    }
+    if (b == 0) {
+      st->print("    <%4d MB/s: ", 1);
+    } else {
+      st->print("    >=%3d MB/s: ", 1 << (b - 1));
+    }
+    st->print_cr(SIZE_FORMAT " regions", buckets[b]);
+  }
+  st->cr();
+
+  const uint TopCount = 10;
+
+  st->print_cr("  Slowest source regions:");
+  size_t chosen[TopCount];
+  uint nchosen = 0;
+  for (uint n = 0; n < TopCount; n++) {
+    size_t best = _num_regions;
+    double best_mb_s = 0.0;
+    for (size_t r = 0; r < _num_regions; r++) {
+      Stats* s = &_from_regions[r];
+      if (s->_objects == 0) {
+        continue;
+      }
+      bool already = false;
+      for (uint c = 0; c < nchosen; c++) {
+        if (chosen[c] == r) {
+          already = true;
+          break;
+        }
+      }
+      if (already) {
+        continue;
+      }
+      double mb_s = bandwidth_mb_s(s->_bytes, s->_nanos);
+      if (best == _num_regions || mb_s < best_mb_s) {
+        best = r;
+        best_mb_s = mb_s;
+      }
+    }
+    if (best == _num_regions) {
+      break;
+    }
+    chosen[nchosen++] = best;
+    Stats* s = &_from_regions[best];
+    st->print_cr("    Region " SIZE_FORMAT ": " SIZE_FORMAT " objects, " SIZE_FORMAT "%s, %.0f MB/s",
+                 best, (size_t)s->_objects,
+                 byte_size_in_proper_unit((size_t)s->_bytes),
+                 proper_unit_for_byte_size((size_t)s->_bytes),
+                 best_mb_s);
+  }
+  st->cr();
+
+  st->print_cr("  Hottest destination regions:");
+  nchosen = 0;
+  for (uint n = 0; n < TopCount; n++) {
+    size_t best = _num_regions;
+    intptr_t best_bytes = 0;
+    for (size_t r = 0; r < _num_regions; r++) {
+      if (_to_region_bytes[r] == 0) {
+        continue;
+      }
+      bool already = false;
+      for (uint c = 0; c < nchosen; c++) {
+        if (chosen[c] == r) {
+          already = true;
+          break;
+        }
+      }
+      if (already) {
+        continue;
+      }
+      if (best == _num_regions || _to_region_bytes[r] > best_bytes) {
+        best = r;
+        best_bytes = _to_region_bytes[r];
+      }
+    }
+    if (best == _num_regions) {
+      break;
+    }
+    chosen[nchosen++] = best;
+    st->print_cr("    Region " SIZE_FORMAT ": " SIZE_FORMAT "%s",
+                 best,
+                 byte_size_in_proper_unit((size_t)best_bytes),
+                 proper_unit_for_byte_size((size_t)best_bytes));
+  }
+  st->cr();
+
+  st->print_cr("  Per-thread totals:");
+  for (uint w = 0; w <= _num_workers; w++) {
+    Stats* s = &_workers[w];
+    if (s->_objects == 0) {
+      continue;
+    }
+    if (w < _num_workers) {
+      st->print("    Worker %u: ", w);
+    } else {
+      st->print("    Mutators: ");
+    }
+    st->print_cr(SIZE_FORMAT " objects, " SIZE_FORMAT "%s, %.0f MB/s",
+                 (size_t)s->_objects,
+                 byte_size_in_proper_unit((size_t)s->_bytes),
+                 proper_unit_for_byte_size((size_t)s->_bytes),
+                 bandwidth_mb_s(s->_bytes, s->_nanos));
+  }
+}
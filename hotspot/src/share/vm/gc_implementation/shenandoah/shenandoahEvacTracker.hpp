@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2018, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_SHENANDOAH_SHENANDOAHEVACTRACKER_HPP
+#define SHARE_VM_GC_SHENANDOAH_SHENANDOAHEVACTRACKER_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/ostream.hpp"
+
+class Thread;
+
+// Per-region evacuation statistics, enabled with -XX:+ShenandoahEvacTracking.
+// Every successful evacuation records the copied bytes and the copy time
+// against the source region, the destination region and the evacuating
+// worker (mutator threads share one bucket). The counters are reset when a
+// cycle starts evacuating, so a dump via the GC.shenandoah_evac_stats jcmd
+// shows the most recently started cycle, and are cheap enough to update from
+// the evacuation path: three atomic adds per evacuated object, plus two
+// clock reads.
+//
+// The report buckets source regions by achieved copy bandwidth and lists
+// the slowest sources and the hottest destinations by region number, which
+// is what distinguishes GCLAB pressure (uniformly low worker bandwidth)
+// from placement problems (low bandwidth confined to specific regions).
+class ShenandoahEvacTracker : public CHeapObj<mtGC> {
+private:
+  struct Stats {
+    volatile intptr_t _objects;
+    volatile intptr_t _bytes;
+    volatile intptr_t _nanos;
+  };
+
+  size_t _num_regions;
+  uint   _num_workers;        // one bucket per worker, plus one for mutators
+
+  Stats* _from_regions;       // indexed by source region number
+  volatile intptr_t* _to_region_bytes; // bytes evacuated into each region
+  Stats* _workers;
+
+  uint worker_bucket(Thread* thread) const;
+  static void record(Stats* stats, size_t bytes, jlong nanos);
+
+public:
+  ShenandoahEvacTracker(size_t num_regions, uint num_workers);
+
+  void record_evac(size_t from_region, size_t to_region, Thread* thread,
+                   size_t bytes, jlong nanos);
+
+  // Called when a cycle starts evacuating; racy clears are acceptable
+  // for diagnostics.
+  void reset();
+
+  void print_on(outputStream* st) const;
+};
+
+#endif // SHARE_VM_GC_SHENANDOAH_SHENANDOAHEVACTRACKER_HPP
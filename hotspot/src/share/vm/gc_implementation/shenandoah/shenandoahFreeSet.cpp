@@ -30,7 +30,8 @@ ShenandoahFreeSet::ShenandoahFreeSet(ShenandoahHeap* heap,size_t max_regions) :
         _heap(heap),
         _mutator_free_bitmap(max_regions, /* in_resource_area = */ false),
         _collector_free_bitmap(max_regions, /* in_resource_area = */ false),
-        _max(max_regions)
+        _max(max_regions),
+        _humongous_reserve_end(max_regions * ShenandoahHumongousReserve / 100)
 {
   clear_internal();
 }
@@ -75,8 +76,29 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
     case ShenandoahAllocRequest::_alloc_tlab:
     case ShenandoahAllocRequest::_alloc_shared: {
 
-      // Try to allocate in the mutator view
-      for (size_t idx = _mutator_leftmost; idx <= _mutator_rightmost; idx++) {
+      // On NUMA, prefer node-local regions for TLAB refills: TLABs are the
+      // bulk of mutator allocations, and remote-node TLABs cost the mutator
+      // on every object access afterwards.
+      if (UseNUMA && req.type() == ShenandoahAllocRequest::_alloc_tlab && os::numa_get_groups_num() > 1) {
+        size_t node = (size_t) os::numa_get_group_id();
+        for (size_t idx = MAX2(_mutator_leftmost, _humongous_reserve_end); idx <= _mutator_rightmost; idx++) {
+          if (is_mutator_free(idx)) {
+            ShenandoahHeapRegion* r = _heap->get_region(idx);
+            if (r->numa_node() != node) {
+              continue;
+            }
+            HeapWord* result = try_allocate_in(r, req, in_new_region);
+            if (result != NULL) {
+              return result;
+            }
+          }
+        }
+        // No node-local space, fall through to any region below.
+      }
+
+      // Try to allocate in the mutator view, skipping the humongous
+      // partition at the low end; see allocate_contiguous().
+      for (size_t idx = MAX2(_mutator_leftmost, _humongous_reserve_end); idx <= _mutator_rightmost; idx++) {
         if (is_mutator_free(idx)) {
           HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
           if (result != NULL) {
@@ -85,6 +107,19 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
         }
       }
 
+      // Only the humongous partition has space left, use it.
+      if (_humongous_reserve_end > 0) {
+        size_t hi = MIN2(_mutator_rightmost, _humongous_reserve_end - 1);
+        for (size_t idx = _mutator_leftmost; idx <= hi; idx++) {
+          if (is_mutator_free(idx)) {
+            HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+            if (result != NULL) {
+              return result;
+            }
+          }
+        }
+      }
+
       // There is no recovery. Mutator does not touch collector view at all.
       break;
     }
@@ -170,6 +205,12 @@ HeapWord* ShenandoahFreeSet::try_allocate_in(ShenandoahHeapRegion* r, Shenandoah
 
     if (req.is_gc_alloc()) {
       r->set_update_watermark(r->top());
+      if (ShenandoahPipelinedUpdateRefs) {
+        // The newly covered span can hold evacuee copies with from-space
+        // references; invalidate any pipelined "refs updated" claim so the
+        // update-refs phase rescans this region.
+        r->cancel_evac_update_refs();
+      }
     }
   }
 
@@ -234,6 +275,77 @@ void ShenandoahFreeSet::adjust_bounds() {
   }
 }
 
+bool ShenandoahFreeSet::find_contiguous(size_t lo, size_t hi, size_t num, size_t& beg, size_t& end) {
+  if (lo > hi) {
+    return false;
+  }
+
+  if (ShenandoahHumongousBestFit) {
+    // Best fit: scan all free runs once, and carve the allocation from the
+    // smallest run that fits. First fit would chip away at the large runs
+    // and leave the small ones untouched, so a steady humongous churn
+    // eventually destroys the runs that the largest objects need.
+    size_t best_beg = _max;
+    size_t best_len = 0;
+    size_t run_beg  = _max;
+    size_t run_len  = 0;
+
+    for (size_t idx = lo; idx <= hi; idx++) {
+      if (is_mutator_free(idx) && is_empty_or_trash(_heap->get_region(idx))) {
+        if (run_len == 0) {
+          run_beg = idx;
+        }
+        run_len++;
+      } else {
+        if (run_len >= num && (best_len == 0 || run_len < best_len)) {
+          best_beg = run_beg;
+          best_len = run_len;
+        }
+        run_len = 0;
+      }
+    }
+    // Close out the run that touches the upper bound.
+    if (run_len >= num && (best_len == 0 || run_len < best_len)) {
+      best_beg = run_beg;
+      best_len = run_len;
+    }
+
+    if (best_len == 0) {
+      // No run is long enough
+      return false;
+    }
+
+    beg = best_beg;
+    end = beg + num - 1;
+    return true;
+  } else {
+    beg = lo;
+    end = beg;
+
+    while (true) {
+      if (end > hi) {
+        // Hit the end
+        return false;
+      }
+
+      // If regions are not adjacent, then current [beg; end] is useless, and we may fast-forward.
+      // If region is not completely free, the current [beg; end] is useless, and we may fast-forward.
+      if (!is_mutator_free(end) || !is_empty_or_trash(_heap->get_region(end))) {
+        end++;
+        beg = end;
+        continue;
+      }
+
+      if ((end - beg + 1) == num) {
+        // found the match
+        return true;
+      }
+
+      end++;
+    }
+  }
+}
+
 HeapWord* ShenandoahFreeSet::allocate_contiguous(ShenandoahAllocRequest& req) {
   shenandoah_assert_heaplocked();
 
@@ -248,30 +360,25 @@ HeapWord* ShenandoahFreeSet::allocate_contiguous(ShenandoahAllocRequest& req) {
   // Find the continuous interval of $num regions, starting from $beg and ending in $end,
   // inclusive. Contiguous allocations are biased to the beginning.
 
-  size_t beg = _mutator_leftmost;
-  size_t end = beg;
-
-  while (true) {
-    if (end >= _max) {
-      // Hit the end, goodbye
-      return NULL;
-    }
-
-    // If regions are not adjacent, then current [beg; end] is useless, and we may fast-forward.
-    // If region is not completely free, the current [beg; end] is useless, and we may fast-forward.
-    if (!is_mutator_free(end) || !is_empty_or_trash(_heap->get_region(end))) {
-      end++;
-      beg = end;
-      continue;
-    }
-
-    if ((end - beg + 1) == num) {
-      // found the match
-      break;
-    }
-
-    end++;
-  };
+  size_t beg = 0;
+  size_t end = 0;
+
+  // Try the humongous partition first, a left prefix of the heap sized by
+  // ShenandoahHumongousReserve. Keeping the buffers there stops their churn
+  // from fragmenting the space the single-region allocations live in. The
+  // partition is a preference, not a hard split: both sides fall back to
+  // the whole range when their preferred side is full.
+  bool found = false;
+  if (_humongous_reserve_end > 0 && _mutator_leftmost < _humongous_reserve_end) {
+    found = find_contiguous(_mutator_leftmost, MIN2(_mutator_rightmost, _humongous_reserve_end - 1), num, beg, end);
+  }
+  if (!found) {
+    found = find_contiguous(_mutator_leftmost, _mutator_rightmost, num, beg, end);
+  }
+  if (!found) {
+    // No run is long enough, goodbye
+    return NULL;
+  }
 
   size_t remainder = words_size & ShenandoahHeapRegion::region_size_words_mask();
 
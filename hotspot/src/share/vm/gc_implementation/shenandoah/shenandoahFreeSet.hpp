@@ -35,6 +35,10 @@ private:
   BitMap _collector_free_bitmap;
   size_t _max;
 
+  // First region index past the humongous partition, which is a left prefix
+  // of the heap sized by ShenandoahHumongousReserve. Zero when disabled.
+  size_t _humongous_reserve_end;
+
   // Left-most and right-most region indexes. There are no free regions outside
   // of [left-most; right-most] index intervals
   size_t _mutator_leftmost, _mutator_rightmost;
@@ -51,6 +55,7 @@ private:
   HeapWord* try_allocate_in(ShenandoahHeapRegion* region, ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_single(ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_contiguous(ShenandoahAllocRequest& req);
+  bool find_contiguous(size_t lo, size_t hi, size_t num, size_t& beg, size_t& end);
 
   void flip_to_gc(ShenandoahHeapRegion* r);
 
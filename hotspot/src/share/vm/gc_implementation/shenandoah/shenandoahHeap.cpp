@@ -27,6 +27,8 @@
 #include "gc_implementation/shared/gcTimer.hpp"
 #include "gc_implementation/shenandoah/shenandoahGCTraceTime.hpp"
 
+#include "gc_implementation/shenandoah/shenandoahAllocTracker.hpp"
+#include "gc_implementation/shenandoah/shenandoahEvacTracker.hpp"
 #include "gc_implementation/shenandoah/shenandoahBarrierSet.hpp"
 #include "gc_implementation/shenandoah/shenandoahClosures.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahCollectionSet.hpp"
@@ -47,6 +49,7 @@
 #include "gc_implementation/shenandoah/shenandoahPadding.hpp"
 #include "gc_implementation/shenandoah/shenandoahParallelCleaning.hpp"
 #include "gc_implementation/shenandoah/shenandoahRootProcessor.inline.hpp"
+#include "gc_implementation/shenandoah/shenandoahSoftRefPolicy.hpp"
 #include "gc_implementation/shenandoah/shenandoahTaskqueue.hpp"
 #include "gc_implementation/shenandoah/shenandoahUtils.hpp"
 #include "gc_implementation/shenandoah/shenandoahVerifier.hpp"
@@ -55,6 +58,9 @@
 #include "gc_implementation/shenandoah/shenandoahWorkGroup.hpp"
 #include "gc_implementation/shenandoah/shenandoahWorkerPolicy.hpp"
 #include "gc_implementation/shenandoah/heuristics/shenandoahHeuristics.hpp"
+#include "gc_implementation/shenandoah/shenandoahCardSummary.hpp"
+#include "gc_implementation/shenandoah/shenandoahRememberedSet.hpp"
+#include "gc_implementation/shenandoah/mode/shenandoahGenerationalMode.hpp"
 #include "gc_implementation/shenandoah/mode/shenandoahIUMode.hpp"
 #include "gc_implementation/shenandoah/mode/shenandoahPassiveMode.hpp"
 #include "gc_implementation/shenandoah/mode/shenandoahSATBMode.hpp"
@@ -81,7 +87,7 @@ public:
     ShenandoahHeapRegion* r = _regions.next();
     while (r != NULL) {
       if (r->is_committed()) {
-        os::pretouch_memory((char *) r->bottom(), (char *) r->end());
+        os::pretouch_memory((char *) r->bottom(), (char *) r->end(), _page_size);
       }
       r = _regions.next();
     }
@@ -109,7 +115,7 @@ public:
       assert (end <= _bitmap_size, err_msg("end is sane: " SIZE_FORMAT " < " SIZE_FORMAT, end, _bitmap_size));
 
       if (r->is_committed()) {
-        os::pretouch_memory(_bitmap_base + start, _bitmap_base + end);
+        os::pretouch_memory(_bitmap_base + start, _bitmap_base + end, _page_size);
       }
 
       r = _regions.next();
@@ -160,6 +166,12 @@ jint ShenandoahHeap::initialize() {
   size_t bitmap_page_size = UseLargePages ? (size_t)os::large_page_size() : (size_t)os::vm_page_size();
   size_t region_page_size = UseLargePages ? (size_t)os::large_page_size() : (size_t)os::vm_page_size();
 
+  // Reserving the bitmap and region table spaces with a large preferred page
+  // size backs them with explicit large pages where the OS commits them
+  // upfront (the "special" reservations below). Otherwise, the commit paths
+  // pass the page size as the alignment hint, which advises the committed
+  // ranges into transparent huge pages.
+
   //
   // Reserve and commit memory for heap
   //
@@ -250,7 +262,12 @@ jint ShenandoahHeap::initialize() {
   }
 
   // Reserve aux bitmap for use in object_iterate(). We don't commit it here.
-  ReservedSpace aux_bitmap(_bitmap_size, bitmap_page_size);
+  // In THP mode, prefer base pages here: the aux bitmap is committed only for
+  // the short duration of a heap iteration, and advising it into huge pages
+  // would just churn the THP allocator for nothing.
+  size_t aux_bitmap_page_size = UseTransparentHugePages ?
+                                (size_t)os::vm_page_size() : bitmap_page_size;
+  ReservedSpace aux_bitmap(_bitmap_size, aux_bitmap_page_size);
   MemTracker::record_virtual_memory_type(aux_bitmap.base(), mtGC);
   _aux_bitmap_region = MemRegion((HeapWord*) aux_bitmap.base(), aux_bitmap.size() / HeapWordSize);
   _aux_bitmap_region_special = aux_bitmap.special();
@@ -311,6 +328,10 @@ jint ShenandoahHeap::initialize() {
       ShenandoahHeapRegion* r = new (loc) ShenandoahHeapRegion(start, i, is_committed);
       assert(is_ptr_aligned(r, SHENANDOAH_CACHE_LINE_SIZE), "Sanity");
 
+      if (is_committed) {
+        r->numa_make_local();
+      }
+
       _marking_context->initialize_top_at_mark_start(r);
       _regions[i] = r;
       assert(!collection_set()->is_in(i), "New region should not be in collection set");
@@ -322,25 +343,25 @@ jint ShenandoahHeap::initialize() {
     _free_set->rebuild();
   }
 
+  _pretouch_heap_page_size = heap_page_size;
+  _pretouch_bitmap_page_size = bitmap_page_size;
+
+#ifdef LINUX
+  // UseTransparentHugePages would madvise that backing memory can be coalesced into huge
+  // pages. But, the kernel needs to know that every small page is used, in order to coalesce
+  // them into huge one. Therefore, we need to pretouch with smaller pages.
+  if (UseTransparentHugePages) {
+    _pretouch_heap_page_size = (size_t)os::vm_page_size();
+    _pretouch_bitmap_page_size = (size_t)os::vm_page_size();
+  }
+#endif
+
   if (AlwaysPreTouch) {
     // For NUMA, it is important to pre-touch the storage under bitmaps with worker threads,
     // before initialize() below zeroes it with initializing thread. For any given region,
     // we touch the region and the corresponding bitmaps from the same thread.
     ShenandoahPushWorkerScope scope(workers(), _max_workers, false);
 
-    _pretouch_heap_page_size = heap_page_size;
-    _pretouch_bitmap_page_size = bitmap_page_size;
-
-#ifdef LINUX
-    // UseTransparentHugePages would madvise that backing memory can be coalesced into huge
-    // pages. But, the kernel needs to know that every small page is used, in order to coalesce
-    // them into huge one. Therefore, we need to pretouch with smaller pages.
-    if (UseTransparentHugePages) {
-      _pretouch_heap_page_size = (size_t)os::vm_page_size();
-      _pretouch_bitmap_page_size = (size_t)os::vm_page_size();
-    }
-#endif
-
     // OS memory managers may want to coalesce back-to-back pages. Make their jobs
     // simpler by pre-touching continuous spaces (heap and bitmap) separately.
 
@@ -382,8 +403,26 @@ jint ShenandoahHeap::initialize() {
     _pacer = NULL;
   }
 
+  if (ShenandoahAllocSiteSampling) {
+    _alloc_tracker = new ShenandoahAllocTracker(_num_regions);
+  }
+
+  if (ShenandoahEvacTracking) {
+    _evac_tracker = new ShenandoahEvacTracker(_num_regions, _max_workers);
+  }
+
+  if (mode()->is_generational()) {
+    _rem_set = new ShenandoahRememberedSet(base(), heap_rs.size());
+  }
+
+  if (ShenandoahUpdateRefsCardSummaries) {
+    _card_summary = new ShenandoahCardSummary(base(), heap_rs.size());
+  }
+
   _control_thread = new ShenandoahControlThread();
 
+  ShenandoahLogger::engage_async();
+
   log_info(gc, init)("Initialize Shenandoah heap: " SIZE_FORMAT "%s initial, " SIZE_FORMAT "%s min, " SIZE_FORMAT "%s max",
                      byte_size_in_proper_unit(_initial_size),  proper_unit_for_byte_size(_initial_size),
                      byte_size_in_proper_unit(_minimum_size),  proper_unit_for_byte_size(_minimum_size),
@@ -406,6 +445,8 @@ void ShenandoahHeap::initialize_heuristics() {
       _gc_mode = new ShenandoahIUMode();
     } else if (strcmp(ShenandoahGCMode, "passive") == 0) {
       _gc_mode = new ShenandoahPassiveMode();
+    } else if (strcmp(ShenandoahGCMode, "generational") == 0) {
+      _gc_mode = new ShenandoahGenerationalMode();
     } else {
       vm_exit_during_initialization("Unknown -XX:ShenandoahGCMode option");
     }
@@ -453,6 +494,7 @@ ShenandoahHeap::ShenandoahHeap(ShenandoahCollectorPolicy* policy) :
   _bytes_allocated_since_gc_start(0),
   _max_workers((uint)MAX2(ConcGCThreads, ParallelGCThreads)),
   _ref_processor(NULL),
+  _soft_ref_policy(NULL),
   _marking_context(NULL),
   _bitmap_size(0),
   _bitmap_regions_per_slice(0),
@@ -463,10 +505,15 @@ ShenandoahHeap::ShenandoahHeap(ShenandoahCollectorPolicy* policy) :
   _aux_bit_map(),
   _verifier(NULL),
   _pacer(NULL),
+  _alloc_tracker(NULL),
+  _evac_tracker(NULL),
+  _rem_set(NULL),
+  _card_summary(NULL),
   _gc_timer(new (ResourceObj::C_HEAP, mtGC) ConcurrentGCTimer()),
   _phase_timings(NULL)
 {
   _heap = this;
+  _cld_purge_list = NULL;
 
   log_info(gc, init)("GC threads: " UINTX_FORMAT " parallel, " UINTX_FORMAT " concurrent", ParallelGCThreads, ConcGCThreads);
 
@@ -519,6 +566,12 @@ void ShenandoahHeap::reset_mark_bitmap() {
   assert_gc_workers(_workers->active_workers());
   mark_incomplete_marking_context();
 
+  // The card summary describes what the last marking saw; it is rebuilt
+  // along with the bitmaps, so it resets on the same schedule.
+  if (_card_summary != NULL) {
+    _card_summary->clear();
+  }
+
   ShenandoahResetBitmapTask task;
   _workers->run_task(&task);
 }
@@ -689,6 +742,22 @@ bool ShenandoahHeap::is_in(const void* p) const {
   return p >= heap_base && p < last_region_end;
 }
 
+void ShenandoahHeap::uncommit_region_run(size_t lo, size_t hi) {
+  shenandoah_assert_heaplocked();
+  assert(lo < hi, "sanity");
+
+  // Uncommit region memory for the whole run with a single syscall, then
+  // let every region finish its own bitmap slice and accounting.
+  ShenandoahHeapRegion* first = get_region(lo);
+  size_t run_bytes = (hi - lo) * ShenandoahHeapRegion::region_size_bytes();
+  if (!is_heap_region_special() && !os::uncommit_memory((char*) first->bottom(), run_bytes)) {
+    report_java_out_of_memory("Unable to uncommit regions");
+  }
+  for (size_t idx = lo; idx < hi; idx++) {
+    get_region(idx)->make_uncommitted_batched();
+  }
+}
+
 void ShenandoahHeap::op_uncommit(double shrink_before, size_t shrink_until) {
   assert (ShenandoahUncommit, "should be enabled");
 
@@ -697,6 +766,14 @@ void ShenandoahHeap::op_uncommit(double shrink_before, size_t shrink_until) {
   // could enjoy the near committed regions. GC allocations are much less frequent,
   // and therefore can accept the committing costs.
 
+  // Uncommits are batched: a contiguous run of empty regions goes away with a
+  // single syscall, which matters on large heaps with many regions. The pass
+  // is also time-budgeted: the control thread picks up the leftovers on the
+  // next uncommit pass, so there is no need to compete with allocators for
+  // the heap lock for longer than the budget allows.
+
+  double start = os::elapsedTime();
+
   size_t count = 0;
   for (size_t i = num_regions(); i > 0; i--) { // care about size_t underflow
     ShenandoahHeapRegion* r = get_region(i - 1);
@@ -707,11 +784,32 @@ void ShenandoahHeap::op_uncommit(double shrink_before, size_t shrink_until) {
           break;
         }
 
-        r->make_uncommitted();
-        count++;
+        // Extend the run downwards over contiguous uncommittable regions,
+        // limited by the batch size and the shrink target.
+        size_t hi = i;     // exclusive
+        size_t lo = i - 1; // inclusive
+        size_t can_uncommit = (committed() - shrink_until) / ShenandoahHeapRegion::region_size_bytes();
+        size_t max_batch = MIN2((size_t) ShenandoahUncommitBatch, can_uncommit);
+        while (lo > 0 && (hi - lo) < max_batch) {
+          ShenandoahHeapRegion* cur = get_region(lo - 1);
+          if (!cur->is_empty_committed() || !(cur->empty_time() < shrink_before)) {
+            break;
+          }
+          lo--;
+        }
+
+        uncommit_region_run(lo, hi);
+        count += hi - lo;
+        i = lo + 1; // for-loop decrement continues the scan below the run
       }
     }
     SpinPause(); // allow allocators to take the lock
+
+    if (ShenandoahUncommitTimeBudget > 0 &&
+        (os::elapsedTime() - start) * 1000 > ShenandoahUncommitTimeBudget) {
+      // Out of time budget. Leftover regions are uncommitted on later passes.
+      break;
+    }
   }
 
   if (count > 0) {
@@ -768,9 +866,17 @@ HeapWord* ShenandoahHeap::allocate_from_gclab_slow(Thread* thread, size_t size)
   return obj;
 }
 
-HeapWord* ShenandoahHeap::allocate_new_tlab(size_t word_size) {
-  ShenandoahAllocRequest req = ShenandoahAllocRequest::for_tlab(word_size);
-  return allocate_memory(req);
+HeapWord* ShenandoahHeap::allocate_new_tlab(size_t min_size,
+                                            size_t requested_size,
+                                            size_t* actual_size) {
+  ShenandoahAllocRequest req = ShenandoahAllocRequest::for_tlab(min_size, requested_size);
+  HeapWord* res = allocate_memory(req);
+  if (res != NULL) {
+    *actual_size = req.actual_size();
+  } else {
+    *actual_size = 0;
+  }
+  return res;
 }
 
 HeapWord* ShenandoahHeap::allocate_new_gclab(size_t min_size,
@@ -853,6 +959,12 @@ HeapWord* ShenandoahHeap::allocate_memory(ShenandoahAllocRequest& req) {
       if (ShenandoahPacing && (pacer_epoch > 0) && (requested > actual)) {
         pacer()->unpace_for_alloc(pacer_epoch, requested - actual);
       }
+
+      // All mutator allocations funnel through here, including TLAB refills,
+      // which makes this the single place to sample allocation sites.
+      if (_alloc_tracker != NULL) {
+        _alloc_tracker->record_alloc(req, result);
+      }
     } else {
       increase_used(actual*HeapWordSize);
     }
@@ -888,6 +1000,21 @@ public:
   }
 };
 
+class ShenandoahEvacUpdateHeapRefsClosure : public ExtendedOopClosure {
+private:
+  ShenandoahHeap* const _heap;
+
+  template <class T>
+  inline void do_oop_work(T* p) {
+    _heap->evac_update_with_forwarded(p);
+  }
+public:
+  ShenandoahEvacUpdateHeapRefsClosure() : _heap(ShenandoahHeap::heap()) {}
+
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+};
+
 class ShenandoahEvacuationTask : public AbstractGangTask {
 private:
   ShenandoahHeap* const _sh;
@@ -918,10 +1045,32 @@ private:
   void do_work() {
     ShenandoahConcurrentEvacuateRegionObjectClosure cl(_sh);
     ShenandoahHeapRegion* r;
-    while ((r =_cs->claim_next()) != NULL) {
+
+    // Workers are bound to NUMA nodes round-robin (see ShenandoahGangWorker),
+    // and so are the regions. Preferring node-local regions keeps both the
+    // evacuating scans and the target allocations on the worker's node.
+    bool prefer_local = UseNUMA && os::numa_get_groups_num() > 1;
+    size_t node = prefer_local ? (size_t)os::numa_get_group_id() : 0;
+    size_t node_cursor = node;
+
+    while ((r = prefer_local ? _cs->claim_next_prefer_node(node, &node_cursor)
+                             : _cs->claim_next()) != NULL) {
       assert(r->has_live(), err_msg("Region " SIZE_FORMAT " should have been reclaimed early", r->index()));
+
+      if (_cs->is_evac_complete(r->index())) {
+        // Fully evacuated before the cycle degenerated, nothing left to do.
+        continue;
+      }
+
       _sh->marked_object_iterate(r, &cl);
 
+      // If this worker never entered the OOM-during-evacuation protocol, the
+      // completed scan evacuated every live object in the region. Remember
+      // that, so an evacuation retry after a degeneration skips the region.
+      if (!Thread::current()->is_oom_during_evac()) {
+        _cs->set_evac_complete(r->index());
+      }
+
       if (ShenandoahPacing) {
         _sh->pacer()->report_evac(r->used() >> LogHeapWordSize);
       }
@@ -930,6 +1079,40 @@ private:
         break;
       }
     }
+
+    if (_concurrent && ShenandoahPipelinedUpdateRefs && !_sh->cancelled_gc()) {
+      pipelined_update_refs();
+    }
+  }
+
+  void pipelined_update_refs() {
+    // Workers that ran out of collection set regions start updating heap
+    // references right away, overlapping with evacuation still going on in
+    // other workers. This is safe during the evacuation phase: references
+    // to evacuated objects are updated in place, stragglers are evacuated
+    // on the fly. Fully processed regions are skipped by update-refs.
+    ShenandoahEvacUpdateHeapRefsClosure cl;
+    size_t num_regions = _sh->num_regions();
+    for (size_t i = 0; i < num_regions; i++) {
+      ShenandoahHeapRegion* r = _sh->get_region(i);
+      if (!r->is_active() || r->is_cset() || !r->claim_evac_update_refs()) {
+        continue;
+      }
+
+      HeapWord* update_watermark = r->get_update_watermark();
+      _sh->marked_object_oop_iterate(r, &cl, update_watermark);
+
+      if (_sh->cancelled_gc()) {
+        // Did not finish this region for sure. Leave it claimed but not done:
+        // update-refs phase would rescan it, which is safe and idempotent.
+        return;
+      }
+      r->finish_evac_update_refs();
+
+      if (ShenandoahPacing) {
+        _sh->pacer()->report_evac(pointer_delta(update_watermark, r->bottom()));
+      }
+    }
   }
 };
 
@@ -1059,6 +1242,14 @@ void ShenandoahHeap::resize_all_tlabs() {
   _workers->threads_do(&cl);
 }
 
+void ShenandoahHeap::resize_all_gclabs() {
+  assert(UseTLAB && ResizeTLAB, "Sanity");
+
+  ShenandoahResizeGCLABClosure cl;
+  Threads::java_threads_do(&cl);
+  _workers->threads_do(&cl);
+}
+
 class ShenandoahAccumulateStatisticsGCLABClosure : public ThreadClosure {
 public:
   void do_thread(Thread* thread) {
@@ -1404,10 +1595,13 @@ class ShenandoahFinalMarkUpdateRegionStateClosure : public ShenandoahHeapRegionC
 private:
   ShenandoahMarkingContext* const _ctx;
   ShenandoahHeapLock* const _lock;
+  ShenandoahHeuristics* const _heuristics;
 
 public:
   ShenandoahFinalMarkUpdateRegionStateClosure() :
-    _ctx(ShenandoahHeap::heap()->complete_marking_context()), _lock(ShenandoahHeap::heap()->lock()) {}
+    _ctx(ShenandoahHeap::heap()->complete_marking_context()),
+    _lock(ShenandoahHeap::heap()->lock()),
+    _heuristics(ShenandoahHeap::heap()->heuristics()) {}
 
   void heap_region_do(ShenandoahHeapRegion* r) {
     if (r->is_active()) {
@@ -1437,12 +1631,20 @@ public:
       // Remember limit for updating refs. It's guaranteed that we get no
       // from-space-refs written from here on.
       r->set_update_watermark_at_safepoint(r->top());
+
+      // Also drop possibly stale pipelined update-refs state from the
+      // previous cycle, see ShenandoahEvacuationTask.
+      r->reset_refs_update_state();
     } else {
       assert(!r->has_live(),
              err_msg("Region " SIZE_FORMAT " should have no live data", r->index()));
       assert(_ctx->top_at_mark_start(r) == r->top(),
              err_msg("Region " SIZE_FORMAT " should have correct TAMS", r->index()));
     }
+
+    // Liveness and pinning status are now final, score the region for the
+    // upcoming collection set selection.
+    _heuristics->score_region(r);
   }
 
   bool is_thread_safe() { return true; }
@@ -1469,6 +1671,9 @@ void ShenandoahHeap::op_final_mark() {
 
     {
       ShenandoahGCPhase phase(ShenandoahPhaseTimings::final_update_region_states);
+      // Collection set scoring piggybacks on this pass, so that Choose
+      // Collection Set below does not rescan all regions serially.
+      heuristics()->begin_region_scoring();
       ShenandoahFinalMarkUpdateRegionStateClosure cl;
       parallel_heap_region_iterate(&cl);
 
@@ -1503,10 +1708,21 @@ void ShenandoahHeap::op_final_mark() {
         verifier()->verify_before_evacuation();
       }
 
+      if (_evac_tracker != NULL) {
+        _evac_tracker->reset();
+      }
+
       set_evacuation_in_progress(true);
       // From here on, we need to update references.
       set_has_forwarded_objects(true);
 
+      // Resize GCLABs from the fill rates observed during the previous
+      // evacuation, so that fast-evacuating threads get larger labs and
+      // contend less on the free set for refills.
+      if (UseTLAB && ResizeTLAB) {
+        resize_all_gclabs();
+      }
+
       if (!is_degenerated_gc_in_progress()) {
         evacuate_and_update_roots();
       }
@@ -1558,10 +1774,20 @@ void ShenandoahHeap::op_updaterefs() {
 }
 
 void ShenandoahHeap::op_cleanup_early() {
+  if (_cld_purge_list != NULL) {
+    // Free the metadata for class unloading decided at final mark. The list
+    // is already detached from the graph, nothing else can reach it.
+    ShenandoahGCPhase phase(ShenandoahPhaseTimings::conc_cleanup_early_purge);
+    ClassLoaderDataGraph::purge_list(_cld_purge_list);
+    _cld_purge_list = NULL;
+  }
+  // Unmap the virtual space nodes that the last safepoint purge unlinked.
+  Metaspace::delete_purged_nodes();
   free_set()->recycle_trash();
 }
 
 void ShenandoahHeap::op_cleanup_complete() {
+  Metaspace::delete_purged_nodes();
   free_set()->recycle_trash();
 }
 
@@ -1650,7 +1876,7 @@ void ShenandoahHeap::op_degenerated(ShenandoahDegenPoint point) {
 
         // enable ("weak") refs discovery
         rp->enable_discovery(true /*verify_no_refs*/, true);
-        rp->setup_policy(_heap->collector_policy()->should_clear_all_soft_refs());
+        _heap->setup_soft_ref_policy();
       }
 
       op_reset();
@@ -1677,10 +1903,12 @@ void ShenandoahHeap::op_degenerated(ShenandoahDegenPoint point) {
 
         // Degeneration under oom-evac protocol might have left some objects in
         // collection set un-evacuated. Restart evacuation from the beginning to
-        // capture all objects. For all the objects that are already evacuated,
-        // it would be a simple check, which is supposed to be fast. This is also
-        // safe to do even without degeneration, as CSet iterator is at beginning
-        // in preparation for evacuation anyway.
+        // capture all objects. Regions that were fully evacuated before the
+        // degeneration are skipped outright, and for the already-evacuated
+        // objects in the remaining regions it would be a simple check, which
+        // is supposed to be fast. This is also safe to do even without
+        // degeneration, as CSet iterator is at beginning in preparation for
+        // evacuation anyway.
         //
         // Before doing that, we need to make sure we never had any cset-pinned
         // regions. This may happen if allocation failure happened when evacuating
@@ -1690,6 +1918,9 @@ void ShenandoahHeap::op_degenerated(ShenandoahDegenPoint point) {
         // it, we fail degeneration right away and slide into Full GC to recover.
 
         {
+          // This is the pin-induced retry cost: time it, so chronically
+          // pinned workloads show up in GC stats.
+          ShenandoahGCPhase phase(ShenandoahPhaseTimings::degen_sync_pinned);
           sync_pinned_region_status();
           collection_set()->clear_current_index();
 
@@ -1705,6 +1936,32 @@ void ShenandoahHeap::op_degenerated(ShenandoahDegenPoint point) {
           collection_set()->clear_current_index();
         }
 
+        if (ShenandoahDegenCSetRetirement) {
+          // Regions that nobody managed to evacuate from have no to-space
+          // copies, so they do not have to be re-evacuated under STW: they
+          // can leave the collection set and live on as regular regions
+          // until the next cycle picks them up again. Regions with even a
+          // single copy must stay, because their objects can be reachable
+          // through both the original and the forwardee.
+          ShenandoahHeapLocker locker(lock());
+          size_t dropped = 0;
+
+          collection_set()->clear_current_index();
+          ShenandoahHeapRegion* r;
+          while ((r = collection_set()->next()) != NULL) {
+            if (!collection_set()->has_evacuations(r->index())) {
+              collection_set()->remove_region(r);
+              r->make_regular_bypass();
+              dropped++;
+            }
+          }
+          collection_set()->clear_current_index();
+
+          if (dropped > 0) {
+            log_info(gc)("Degenerated GC: retired " SIZE_FORMAT " untouched regions from the collection set", dropped);
+          }
+        }
+
         op_stw_evac();
         if (cancelled_gc()) {
           op_degenerated_fail();
@@ -1848,9 +2105,19 @@ void ShenandoahHeap::ref_processing_init() {
           mt_discovery ? "parallel" : "serial",
           mt_processing ? "parallel" : "serial");
 
+  _soft_ref_policy = new ShenandoahSoftRefPolicy();
+
   shenandoah_assert_rp_isalive_not_installed();
 }
 
+void ShenandoahHeap::setup_soft_ref_policy() {
+  if (ShenandoahPressureSoftRefs && !collector_policy()->should_clear_all_soft_refs()) {
+    _ref_processor->setup_policy(_soft_ref_policy);
+  } else {
+    _ref_processor->setup_policy(collector_policy()->should_clear_all_soft_refs());
+  }
+}
+
 void ShenandoahHeap::acquire_pending_refs_lock() {
   _control_thread->slt()->manipulatePLL(SurrogateLockerThread::acquirePLL);
 }
@@ -1900,6 +2167,10 @@ void ShenandoahHeap::stop() {
   if (ShenandoahStringDedup::is_enabled()) {
     ShenandoahStringDedup::stop();
   }
+
+  // Step 5. GC threads are gone; drain the async log ring and fall back
+  // to synchronous logging for the remaining VM shutdown messages.
+  ShenandoahLogger::disengage_async();
 }
 
 void ShenandoahHeap::unload_classes_and_cleanup_tables(bool full_gc) {
@@ -1954,7 +2225,22 @@ void ShenandoahHeap::unload_classes_and_cleanup_tables(bool full_gc) {
     ShenandoahGCPhase phase(full_gc ?
                             ShenandoahPhaseTimings::full_gc_purge_cldg :
                             ShenandoahPhaseTimings::purge_cldg);
-    ClassLoaderDataGraph::purge();
+    if (!full_gc && ShenandoahConcurrentClassPurge) {
+      // Defer the actual metadata freeing to the concurrent cleanup phase,
+      // see op_cleanup_early(). Only detach the dead loaders here.
+      assert(_cld_purge_list == NULL, "Previous purge list should be drained");
+      _cld_purge_list = ClassLoaderDataGraph::detach_unloading_list();
+    } else {
+      // A cycle cancelled right after final mark has already detached its
+      // unloading list but never reached op_cleanup_early() to drain it.
+      // Free it before purging anew, lest the next detach overwrite the
+      // pointer and permanently leak the dead loaders' metaspace.
+      if (_cld_purge_list != NULL) {
+        ClassLoaderDataGraph::purge_list(_cld_purge_list);
+        _cld_purge_list = NULL;
+      }
+      ClassLoaderDataGraph::purge();
+    }
   }
 }
 
@@ -2129,10 +2415,12 @@ public:
     ShenandoahUpdateHeapRefsClosure cl;
     ShenandoahHeapRegion* r = _regions->next();
     ShenandoahMarkingContext* const ctx = _heap->complete_marking_context();
+    // Regions are the claim and balance unit here. Humongous object interiors
+    // are split by their continuation regions, see marked_object_oop_iterate.
     while (r != NULL) {
       HeapWord* update_watermark = r->get_update_watermark();
       assert (update_watermark >= r->bottom(), "sanity");
-      if (r->is_active() && !r->is_cset()) {
+      if (r->is_active() && !r->is_cset() && !r->is_refs_updated()) {
         _heap->marked_object_oop_iterate(r, &cl, update_watermark);
       }
       if (ShenandoahPacing) {
@@ -2168,6 +2456,13 @@ void ShenandoahHeap::op_init_updaterefs() {
   {
     ShenandoahGCPhase phase(ShenandoahPhaseTimings::init_update_refs_prepare);
 
+    // Evacuation is done, GCLAB fill rates are known. Accumulate the
+    // statistics that drive GCLAB resizing for the next cycle before the
+    // labs are retired.
+    if (UseTLAB) {
+      accumulate_statistics_all_gclabs();
+    }
+
     make_parsable(true);
 
     // Reset iterator.
@@ -2313,12 +2608,15 @@ bool ShenandoahHeap::commit_bitmap_slice(ShenandoahHeapRegion* r) {
   size_t len = _bitmap_bytes_per_slice;
   char* start = (char*) _bitmap_region.start() + off;
 
-  if (!os::commit_memory(start, len, false)) {
+  // Pass the slice size as the alignment hint, so that the commit is advised
+  // into transparent huge pages, same as the initial bitmap commit. This also
+  // re-applies the advice to slices that were uncommitted in between.
+  if (!os::commit_memory(start, len, _bitmap_bytes_per_slice, false)) {
     return false;
   }
 
   if (AlwaysPreTouch) {
-    os::pretouch_memory(start, start + len);
+    os::pretouch_memory(start, start + len, _pretouch_bitmap_page_size);
   }
 
   return true;
@@ -34,6 +34,10 @@
 
 class ConcurrentGCTimer;
 
+class ShenandoahAllocTracker;
+class ShenandoahEvacTracker;
+class ShenandoahSoftRefPolicy;
+class ShenandoahCardSummary;
 class ShenandoahCollectionSet;
 class ShenandoahCollectorPolicy;
 class ShenandoahConcurrentMark;
@@ -41,6 +45,7 @@ class ShenandoahControlThread;
 class ShenandoahGCSession;
 class ShenandoahGCStateResetter;
 class ShenandoahFreeSet;
+class ClassLoaderData;
 class ShenandoahHeapRegion;
 class ShenandoahHeapRegionClosure;
 class ShenandoahMarkCompact;
@@ -50,6 +55,7 @@ class ShenandoahMarkingContext;
 class ShenandoahMode;
 class ShenandoahPhaseTimings;
 class ShenandoahPacer;
+class ShenandoahRememberedSet;
 class ShenandoahVerifier;
 class ShenandoahWorkGang;
 class VMStructs;
@@ -380,6 +386,9 @@ private:
   void op_cleanup_complete();
   void op_uncommit(double shrink_before, size_t shrink_until);
 
+  // Uncommits the contiguous run of regions [lo, hi) with a single syscall
+  void uncommit_region_run(size_t lo, size_t hi);
+
   // Messages for GC trace event, they have to be immortal for
   // passing around the logging/tracing systems
   const char* init_mark_event_message() const;
@@ -398,19 +407,28 @@ private:
   ShenandoahConcurrentMark*  _scm;
   ShenandoahMarkCompact*     _full_gc;
   ShenandoahPacer*           _pacer;
+  ShenandoahAllocTracker*    _alloc_tracker;
+  ShenandoahEvacTracker*     _evac_tracker;
+  ShenandoahRememberedSet*   _rem_set;
+  ShenandoahCardSummary*     _card_summary;
   ShenandoahVerifier*        _verifier;
 
   ShenandoahPhaseTimings*    _phase_timings;
 
-  ShenandoahControlThread*   control_thread()          { return _control_thread;    }
   ShenandoahMarkCompact*     full_gc()                 { return _full_gc;           }
 
 public:
+  ShenandoahControlThread*   control_thread()          { return _control_thread;    }
   ShenandoahCollectorPolicy* shenandoah_policy() const { return _shenandoah_policy; }
+  ShenandoahMode*            mode()              const { return _gc_mode;           }
   ShenandoahHeuristics*      heuristics()        const { return _heuristics;        }
   ShenandoahFreeSet*         free_set()          const { return _free_set;          }
   ShenandoahConcurrentMark*  concurrent_mark()         { return _scm;               }
   ShenandoahPacer*           pacer()             const { return _pacer;             }
+  ShenandoahAllocTracker*    alloc_tracker()     const { return _alloc_tracker;     }
+  ShenandoahEvacTracker*     evac_tracker()      const { return _evac_tracker;      }
+  ShenandoahRememberedSet*   rem_set()           const { return _rem_set;           }
+  ShenandoahCardSummary*     card_summary()      const { return _card_summary;      }
 
   ShenandoahPhaseTimings*    phase_timings()     const { return _phase_timings;     }
 
@@ -434,6 +452,7 @@ public:
 private:
   ReferenceProcessor*  _ref_processor;
   ShenandoahSharedFlag _process_references;
+  ShenandoahSoftRefPolicy* _soft_ref_policy;
 
   void ref_processing_init();
 
@@ -442,11 +461,19 @@ public:
   void set_process_references(bool pr);
   bool process_references() const;
 
+  // Picks the soft reference policy for the upcoming cycle.
+  void setup_soft_ref_policy();
+
 // ---------- Class Unloading
 //
 private:
   ShenandoahSharedFlag _unload_classes;
 
+  // Unloading list detached at final mark for concurrent purging.
+  // Only touched by the safepoint and by the control thread after it,
+  // no synchronization needed.
+  ClassLoaderData* _cld_purge_list;
+
 public:
   void set_unload_classes(bool uc);
   bool unload_classes() const;
@@ -536,7 +563,7 @@ public:
   // Shenandoah supports TLAB allocation
   bool supports_tlab_allocation() const { return true; }
 
-  HeapWord* allocate_new_tlab(size_t word_size);
+  HeapWord* allocate_new_tlab(size_t min_size, size_t requested_size, size_t* actual_size);
   size_t tlab_capacity(Thread *thr) const;
   size_t unsafe_max_tlab_alloc(Thread *thread) const;
   size_t max_tlab_size() const;
@@ -544,6 +571,7 @@ public:
 
   void resize_tlabs();
   void resize_all_tlabs();
+  void resize_all_gclabs();
 
   void accumulate_statistics_tlabs();
   void accumulate_statistics_all_gclabs();
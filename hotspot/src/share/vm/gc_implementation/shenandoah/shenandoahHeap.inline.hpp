@@ -28,10 +28,12 @@
 #include "memory/threadLocalAllocBuffer.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahAsserts.hpp"
 #include "gc_implementation/shenandoah/shenandoahBarrierSet.inline.hpp"
+#include "gc_implementation/shenandoah/shenandoahCardSummary.hpp"
 #include "gc_implementation/shenandoah/shenandoahCollectionSet.hpp"
 #include "gc_implementation/shenandoah/shenandoahCollectionSet.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahForwarding.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahControlThread.hpp"
+#include "gc_implementation/shenandoah/shenandoahEvacTracker.hpp"
 #include "gc_implementation/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahHeap.hpp"
 #include "gc_implementation/shenandoah/shenandoahHeapRegionSet.hpp"
@@ -254,13 +256,29 @@ inline oop ShenandoahHeap::evacuate_object(oop p, Thread* thread) {
   }
 
   // Copy the object:
+  jlong evac_start = 0;
+  if (_evac_tracker != NULL) {
+    evac_start = os::javaTimeNanos();
+  }
   Copy::aligned_disjoint_words((HeapWord*) p, copy, size);
 
+  // Mark the source region as evacuated-from before the copy can become
+  // visible through the forwarding pointer. Degenerated GC may only retire
+  // regions whose mark was never set, so the mark has to win the race
+  // against the CAS below; over-marking on a failed CAS is harmless.
+  collection_set()->mark_has_evacuations(heap_region_index_containing(p));
+
   // Try to install the new forwarding pointer.
   oop copy_val = oop(copy);
   oop result = ShenandoahForwarding::try_update_forwardee(p, copy_val);
   if (result == copy_val) {
     // Successfully evacuated. Our copy is now the public one!
+    if (_evac_tracker != NULL) {
+      _evac_tracker->record_evac(heap_region_index_containing(p),
+                                 heap_region_index_containing(copy),
+                                 thread, size * HeapWordSize,
+                                 os::javaTimeNanos() - evac_start);
+    }
     shenandoah_assert_correct(NULL, copy_val);
     return copy_val;
   }  else {
@@ -379,11 +397,20 @@ inline void ShenandoahHeap::marked_object_iterate(ShenandoahHeapRegion* region,
     guarantee(dist <= SLOT_COUNT, "adjust slot count");
     HeapWord* slots[SLOT_COUNT];
 
+    // The header prefetch only covers the first cache line of each object.
+    // Slots are visited in address order, so the usual linear-scan prefetch
+    // at the VM_Version-tuned interval covers the payload lines of larger
+    // objects that the closure is about to walk through.
+    const intx scan_dist = PrefetchScanIntervalInBytes;
+
     int avail;
     do {
       avail = 0;
       for (int c = 0; (c < dist) && (cb < limit_bitmap); c++) {
         Prefetch::read(cb, oopDesc::mark_offset_in_bytes());
+        if (scan_dist > 0) {
+          Prefetch::read(cb, scan_dist);
+        }
         slots[avail++] = cb;
         cb += skip_bitmap_delta;
         if (cb < limit_bitmap) {
@@ -421,9 +448,15 @@ inline void ShenandoahHeap::marked_object_iterate(ShenandoahHeapRegion* region,
   // This restarts the scan at TAMS, which makes sure we traverse all objects,
   // regardless of what happened at Step 1.
   HeapWord* cs = tams;
+  const intx scan_dist = PrefetchScanIntervalInBytes;
   while (cs < limit) {
     assert (cs >= tams, err_msg("only objects past TAMS here: "   PTR_FORMAT " (" PTR_FORMAT ")", p2i(cs), p2i(tams)));
     assert (cs < limit, err_msg("only objects below limit here: " PTR_FORMAT " (" PTR_FORMAT ")", p2i(cs), p2i(limit)));
+    if (scan_dist > 0) {
+      // This walk reads every header for the size and lets the closure touch
+      // the fields; stay ahead of it at the VM_Version-tuned interval.
+      Prefetch::read(cs, scan_dist);
+    }
     oop obj = oop(cs);
     int size = obj->size();
     assert(!oopDesc::is_null(obj), "sanity");
@@ -445,6 +478,43 @@ public:
   }
 };
 
+template <class T>
+class ShenandoahObjectToOopFilteredClosure : public ObjectClosure {
+  T* _cl;
+  ShenandoahCardSummary* const _summary;
+  HeapWord* const _tams;
+public:
+  ShenandoahObjectToOopFilteredClosure(T* cl, ShenandoahCardSummary* summary, HeapWord* tams) :
+    _cl(cl), _summary(summary), _tams(tams) {}
+
+  void do_object(oop obj) {
+    HeapWord* const addr = (HeapWord*) obj;
+    if (addr >= _tams) {
+      // Allocated after mark start: marking did not visit it, so the
+      // summary does not cover it.
+      obj->oop_iterate(_cl);
+      return;
+    }
+    if (obj->klass()->oop_is_instanceRef()) {
+      // Reference discovery can hide the referent slot from marking.
+      obj->oop_iterate(_cl);
+      return;
+    }
+    HeapWord* const end = addr + obj->size();
+    HeapWord* const first = _summary->first_recorded(addr, end);
+    if (first == NULL) {
+      // No reference slots anywhere under the object: nothing to update.
+      return;
+    }
+    if (first <= addr) {
+      obj->oop_iterate(_cl);
+    } else {
+      // Clean prefix: only walk the fields from the first recorded card on.
+      obj->oop_iterate(_cl, MemRegion(first, end));
+    }
+  }
+};
+
 template <class T>
 class ShenandoahObjectToOopBoundedClosure : public ObjectClosure {
   T* _cl;
@@ -460,6 +530,13 @@ public:
 
 template<class T>
 inline void ShenandoahHeap::marked_object_oop_iterate(ShenandoahHeapRegion* region, T* cl, HeapWord* top) {
+  // For humongous objects, this visits only the part that intersects the
+  // claimed region: every worker that claims a start or continuation region
+  // updates the object slice under it. This is what splits the interiors of
+  // huge arrays across update-refs workers, without the task queues and
+  // chunked array tasks that marking uses. Objects below the humongous
+  // threshold are bounded by their region, which is the claim granularity
+  // anyway.
   if (region->is_humongous()) {
     HeapWord* bottom = region->bottom();
     if (top > bottom) {
@@ -467,6 +544,14 @@ inline void ShenandoahHeap::marked_object_oop_iterate(ShenandoahHeapRegion* regi
       ShenandoahObjectToOopBoundedClosure<T> objs(cl, bottom, top);
       marked_object_iterate(region, &objs);
     }
+  } else if (_card_summary != NULL) {
+    // Marking recorded the cards holding the reference slots of every object
+    // below TAMS; skip the objects whose cards are all clean. Humongous
+    // interiors above keep the plain bounded walk: their per-object overhead
+    // is already amortized over the whole region.
+    HeapWord* tams = complete_marking_context()->top_at_mark_start(region);
+    ShenandoahObjectToOopFilteredClosure<T> objs(cl, _card_summary, tams);
+    marked_object_iterate(region, &objs, top);
   } else {
     ShenandoahObjectToOopClosure<T> objs(cl);
     marked_object_iterate(region, &objs, top);
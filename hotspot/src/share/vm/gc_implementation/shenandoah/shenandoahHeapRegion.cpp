@@ -25,9 +25,12 @@
 
 #include "memory/allocation.hpp"
 #include "gc_implementation/shared/spaceDecorator.hpp"
+#include "gc_implementation/shenandoah/shenandoahAllocTracker.hpp"
 #include "gc_implementation/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahHeapRegion.hpp"
 #include "gc_implementation/shenandoah/shenandoahMarkingContext.inline.hpp"
+#include "gc_implementation/shenandoah/shenandoahRememberedSet.hpp"
+#include "gc_implementation/shenandoah/mode/shenandoahMode.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "memory/space.inline.hpp"
 #include "memory/resourceArea.hpp"
@@ -58,11 +61,16 @@ ShenandoahHeapRegion::ShenandoahHeapRegion(HeapWord* start, size_t index, bool c
   _new_top(NULL),
   _empty_time(os::elapsedTime()),
   _state(committed ? _empty_committed : _empty_uncommitted),
+  _age(0),
+  _cset_selections(0),
+  _bytes_evacuated(0),
+  _refs_update_state(0),
   _top(start),
   _tlab_allocs(0),
   _gclab_allocs(0),
   _live_data(0),
   _critical_pins(0),
+  _pin_events(0),
   _update_watermark(start) {
 
   assert(Universe::on_page_boundary(_bottom) && Universe::on_page_boundary(_end),
@@ -283,6 +291,21 @@ void ShenandoahHeapRegion::make_uncommitted() {
   }
 }
 
+void ShenandoahHeapRegion::make_uncommitted_batched() {
+  shenandoah_assert_heaplocked();
+  switch (_state) {
+    case _empty_committed:
+      // Region memory is already uncommitted by the caller as the part of a
+      // larger batch, see ShenandoahHeap::uncommit_region_run. Only the
+      // bitmap slice and the accounting are handled here.
+      do_uncommit_finish();
+      set_state(_empty_uncommitted);
+      return;
+    default:
+      report_illegal_transition("uncommiting");
+  }
+}
+
 void ShenandoahHeapRegion::make_committed_bypass() {
   shenandoah_assert_heaplocked();
   assert (ShenandoahHeap::heap()->is_full_gc_in_progress(), "only for full GC");
@@ -393,6 +416,17 @@ void ShenandoahHeapRegion::recycle() {
   set_top(bottom());
   clear_live_data();
   reset_alloc_metadata();
+  reset_age();
+  reset_refs_update_state();
+
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  if (heap->mode()->is_generational()) {
+    heap->rem_set()->clear_range(bottom(), end());
+  }
+
+  if (heap->alloc_tracker() != NULL) {
+    heap->alloc_tracker()->clear_region(index());
+  }
 
   ShenandoahHeap::heap()->marking_context()->reset_top_at_mark_start(this);
   set_update_watermark(bottom());
@@ -615,16 +649,33 @@ size_t ShenandoahHeapRegion::setup_sizes(size_t max_heap_size) {
   return max_heap_size;
 }
 
+size_t ShenandoahHeapRegion::numa_node() const {
+  assert(UseNUMA, "Only ask this with NUMA enabled");
+  return _index % os::numa_get_groups_num();
+}
+
+void ShenandoahHeapRegion::numa_make_local() {
+  // Interleave regions across NUMA nodes round-robin. Free set prefers
+  // node-local regions for TLAB refills, see ShenandoahFreeSet::allocate_single.
+  if (UseNUMA && os::numa_get_groups_num() > 1) {
+    os::numa_make_local((char*) bottom(), RegionSizeBytes, (int) numa_node());
+  }
+}
+
 void ShenandoahHeapRegion::do_commit() {
   ShenandoahHeap* heap = ShenandoahHeap::heap();
-  if (!heap->is_heap_region_special() && !os::commit_memory((char *) bottom(), RegionSizeBytes, false)) {
+  // Pass the region size as the alignment hint, so that regions committed
+  // after startup are advised into transparent huge pages, same as the
+  // initial heap commit.
+  if (!heap->is_heap_region_special() && !os::commit_memory((char *) bottom(), RegionSizeBytes, RegionSizeBytes, false)) {
     report_java_out_of_memory("Unable to commit region");
   }
+  numa_make_local();
   if (!heap->commit_bitmap_slice(this)) {
     report_java_out_of_memory("Unable to commit bitmaps for region");
   }
   if (AlwaysPreTouch) {
-    os::pretouch_memory((char*)bottom(), (char*)end());
+    os::pretouch_memory((char*)bottom(), (char*)end(), heap->pretouch_heap_page_size());
   }
   heap->increase_committed(ShenandoahHeapRegion::region_size_bytes());
 }
@@ -634,14 +685,43 @@ void ShenandoahHeapRegion::do_uncommit() {
   if (!heap->is_heap_region_special() && !os::uncommit_memory((char *) bottom(), RegionSizeBytes)) {
     report_java_out_of_memory("Unable to uncommit region");
   }
+  do_uncommit_finish();
+}
+
+void ShenandoahHeapRegion::do_uncommit_finish() {
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
   if (!heap->uncommit_bitmap_slice(this)) {
     report_java_out_of_memory("Unable to uncommit bitmaps for region");
   }
   heap->decrease_committed(ShenandoahHeapRegion::region_size_bytes());
 }
 
+bool ShenandoahHeapRegion::claim_evac_update_refs() {
+  return Atomic::cmpxchg(1, &_refs_update_state, 0) == 0;
+}
+
+void ShenandoahHeapRegion::finish_evac_update_refs() {
+  // Only publish "refs updated" if the claim is still intact: a concurrent
+  // GC allocation may have raised the update watermark past the span this
+  // walker scanned, cancelling the claim. Losing the race leaves the region
+  // for the update-refs phase, or for another pipelined walker, to rescan.
+  Atomic::cmpxchg(2, &_refs_update_state, 1);
+}
+
+void ShenandoahHeapRegion::cancel_evac_update_refs() {
+  // Ordered after the watermark raise, and paired with the cmpxchg in
+  // finish_evac_update_refs: whichever of the two lands second leaves the
+  // state not "updated", so the update-refs phase rescans the region.
+  OrderAccess::release_store(&_refs_update_state, 0);
+}
+
+bool ShenandoahHeapRegion::is_refs_updated() const {
+  return OrderAccess::load_acquire((volatile jint*)&_refs_update_state) == 2;
+}
+
 void ShenandoahHeapRegion::record_pin() {
   Atomic::add(1, &_critical_pins);
+  Atomic::add(1, &_pin_events);
 }
 
 void ShenandoahHeapRegion::record_unpin() {
@@ -655,6 +735,12 @@ size_t ShenandoahHeapRegion::pin_count() const {
   return (size_t)v;
 }
 
+size_t ShenandoahHeapRegion::pin_events() const {
+  jint v = OrderAccess::load_acquire((volatile jint*)&_pin_events);
+  assert(v >= 0, "sanity");
+  return (size_t)v;
+}
+
 void ShenandoahHeapRegion::set_state(RegionState to) {
   EventShenandoahHeapRegionStateChange evt;
   if (evt.should_commit()){
@@ -177,6 +177,7 @@ public:
   void make_trash_immediate();
   void make_empty();
   void make_uncommitted();
+  void make_uncommitted_batched();
   void make_committed_bypass();
 
   // Individual states:
@@ -206,6 +207,10 @@ public:
   void record_unpin();
   size_t pin_count() const;
 
+  // Cumulative count of critical pins the region has ever taken, never
+  // decremented. Heuristics use it to spot chronically pinned regions.
+  size_t pin_events() const;
+
 private:
   static size_t RegionCount;
   static size_t RegionSizeBytes;
@@ -230,6 +235,17 @@ private:
 
   // Seldom updated fields
   RegionState _state;
+  uint _age;
+
+  // Cumulative per-region history, deliberately not reset by recycle():
+  // tells apart regions that cycle garbage from regions that stay dense.
+  size_t _cset_selections;
+  size_t _bytes_evacuated;
+
+  // Pipelined update-refs state, see ShenandoahEvacuationTask. Moves from
+  // 0 (untouched) to 1 (claimed by evacuation-phase updater) to 2 (fully
+  // updated, so update-refs phase can skip the region).
+  volatile jint _refs_update_state;
 
   // Frequently updated fields
   HeapWord* _top;
@@ -239,6 +255,7 @@ private:
 
   volatile jint _live_data;
   volatile jint _critical_pins;
+  volatile jint _pin_events;
 
   HeapWord* volatile _update_watermark;
 
@@ -382,9 +399,41 @@ public:
   inline void set_update_watermark(HeapWord* w);
   inline void set_update_watermark_at_safepoint(HeapWord* w);
 
+  // Region age, in GC cycles the live region had survived. Only maintained
+  // in generational mode, see ShenandoahYoungHeuristics.
+  uint age() const      { return _age; }
+  void increment_age()  { _age++;      }
+  void reset_age()      { _age = 0;    }
+
+  // Cumulative history accounting, updated by the collection set at the
+  // safepoints that select/deselect the region.
+  size_t cset_selections() const { return _cset_selections; }
+  size_t bytes_evacuated() const { return _bytes_evacuated; }
+  void record_cset_selection(size_t live_bytes) {
+    _cset_selections++;
+    _bytes_evacuated += live_bytes;
+  }
+  void record_cset_removal(size_t live_bytes) {
+    assert(_cset_selections > 0 && _bytes_evacuated >= live_bytes, "history underflow");
+    _cset_selections--;
+    _bytes_evacuated -= live_bytes;
+  }
+
+  // NUMA node the region memory interleaves to, when UseNUMA is enabled
+  size_t numa_node() const;
+  void numa_make_local();
+
+  // Pipelined update-refs support, see ShenandoahEvacuationTask
+  bool claim_evac_update_refs();
+  void finish_evac_update_refs();
+  void cancel_evac_update_refs();
+  bool is_refs_updated() const;
+  void reset_refs_update_state() { _refs_update_state = 0; }
+
 private:
   void do_commit();
   void do_uncommit();
+  void do_uncommit_finish();
 
   inline void internal_increase_live_data(size_t s);
 
@@ -29,6 +29,7 @@
 #include "gc_implementation/shenandoah/shenandoahHeapRegionCounters.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/perfData.hpp"
+#include "utilities/ostream.hpp"
 
 ShenandoahHeapRegionCounters::ShenandoahHeapRegionCounters() :
   _last_sample_millis(0)
@@ -93,6 +94,7 @@ void ShenandoahHeapRegionCounters::update() {
       {
         ShenandoahHeapLocker locker(heap->lock());
         size_t rs = ShenandoahHeapRegion::region_size_bytes();
+        double now = os::elapsedTime();
         for (uint i = 0; i < num_regions; i++) {
           ShenandoahHeapRegion* r = heap->get_region(i);
           jlong data = 0;
@@ -101,6 +103,9 @@ void ShenandoahHeapRegionCounters::update() {
           data |= ((100 * r->get_tlab_allocs() / rs)     & PERCENT_MASK) << TLAB_SHIFT;
           data |= ((100 * r->get_gclab_allocs() / rs)    & PERCENT_MASK) << GCLAB_SHIFT;
           data |= ((100 * r->get_shared_allocs() / rs)   & PERCENT_MASK) << SHARED_SHIFT;
+          data |= MIN2<jlong>((jlong) r->cset_selections(),      CSET_MASK) << CSET_SHIFT;
+          data |= MIN2<jlong>((jlong)(r->bytes_evacuated() / rs), EVAC_MASK) << EVAC_SHIFT;
+          data |= MIN2<jlong>((jlong)(now - r->empty_time()),     AGE_MASK)  << AGE_SHIFT;
           data |= (r->state_ordinal() & STATUS_MASK) << STATUS_SHIFT;
           _regions_data[i]->set_value(data);
         }
@@ -108,3 +113,55 @@ void ShenandoahHeapRegionCounters::update() {
     }
   }
 }
+
+void ShenandoahHeapRegionCounters::write_region_history(const char* path, outputStream* out) {
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  fileStream fs(path, "wb");
+  if (!fs.is_open()) {
+    out->print_cr("Failed to open %s for writing", path);
+    return;
+  }
+
+  size_t num_regions = heap->num_regions();
+  size_t rs = ShenandoahHeapRegion::region_size_bytes();
+
+  // All fields are in the native byte order of the dumping VM.
+  // Header: magic "SHRH", format version, region geometry, wallclock time.
+  u4 magic      = 0x53485248;
+  u4 version    = 1;
+  u8 rsize      = (u8) rs;
+  u8 nregions   = (u8) num_regions;
+  u8 time_ms    = (u8) os::javaTimeMillis();
+  fs.write((char*) &magic,    sizeof(magic));
+  fs.write((char*) &version,  sizeof(version));
+  fs.write((char*) &rsize,    sizeof(rsize));
+  fs.write((char*) &nregions, sizeof(nregions));
+  fs.write((char*) &time_ms,  sizeof(time_ms));
+
+  {
+    ShenandoahHeapLocker locker(heap->lock());
+    double now = os::elapsedTime();
+    // Per-region record, 20 bytes, regions in index order:
+    // state ordinal, used/live percent, GC-cycle age, cset selections,
+    // seconds since last reset, cumulative bytes evacuated out.
+    for (size_t i = 0; i < num_regions; i++) {
+      ShenandoahHeapRegion* r = heap->get_region(i);
+      u1 state      = (u1) r->state_ordinal();
+      u1 used_pct   = (u1) (100 * r->used() / rs);
+      u1 live_pct   = (u1) (100 * r->get_live_data_bytes() / rs);
+      u1 age        = (u1) MIN2<uint>(r->age(), 255);
+      u4 selections = (u4) MIN2<size_t>(r->cset_selections(), max_juint);
+      u4 reset_age  = (u4) (now - r->empty_time());
+      u8 evacuated  = (u8) r->bytes_evacuated();
+      fs.write((char*) &state,      sizeof(state));
+      fs.write((char*) &used_pct,   sizeof(used_pct));
+      fs.write((char*) &live_pct,   sizeof(live_pct));
+      fs.write((char*) &age,        sizeof(age));
+      fs.write((char*) &selections, sizeof(selections));
+      fs.write((char*) &reset_age,  sizeof(reset_age));
+      fs.write((char*) &evacuated,  sizeof(evacuated));
+    }
+  }
+
+  out->print_cr("Region history for " SIZE_FORMAT " regions written to %s", num_regions, path);
+}
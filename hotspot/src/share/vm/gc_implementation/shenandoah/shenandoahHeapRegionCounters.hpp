@@ -50,21 +50,29 @@
  * - bits 14-20  tlab allocated memory in percent
  * - bits 21-27  gclab allocated memory in percent
  * - bits 28-34  shared allocated memory in percent
- * - bits 35-41  <reserved>
- * - bits 42-50  <reserved>
- * - bits 51-57  <reserved>
+ * - bits 35-41  times selected into the collection set, saturated at 127
+ * - bits 42-50  bytes evacuated out, in region-size multiples, saturated at 511
+ * - bits 51-57  seconds since the region was last reset, saturated at 127
  *      - bits describe the state as recorded in ShenandoahHeapRegion
  */
+class outputStream;
+
 class ShenandoahHeapRegionCounters : public CHeapObj<mtGC>  {
 private:
   static const jlong PERCENT_MASK = 0x7f;
   static const jlong STATUS_MASK  = 0x3f;
+  static const jlong CSET_MASK    = 0x7f;
+  static const jlong EVAC_MASK    = 0x1ff;
+  static const jlong AGE_MASK     = 0x7f;
 
   static const jlong USED_SHIFT   = 0;
   static const jlong LIVE_SHIFT   = 7;
   static const jlong TLAB_SHIFT   = 14;
   static const jlong GCLAB_SHIFT  = 21;
   static const jlong SHARED_SHIFT = 28;
+  static const jlong CSET_SHIFT   = 35;
+  static const jlong EVAC_SHIFT   = 42;
+  static const jlong AGE_SHIFT    = 51;
 
   static const jlong STATUS_SHIFT = 58;
 
@@ -78,6 +86,11 @@ public:
   ShenandoahHeapRegionCounters();
   ~ShenandoahHeapRegionCounters();
   void update();
+
+  // Writes the unsaturated per-region history (selections into the cset,
+  // bytes evacuated out, age since last reset) as a compact binary dump for
+  // the offline fragmentation dashboards. Serves GC.shenandoah_region_history.
+  static void write_region_history(const char* path, outputStream* out);
 };
 
 #endif // SHARE_VM_GC_SHENANDOAH_SHENANDOAHHEAPREGIONCOUNTERS_HPP
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2018, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#include "gc_implementation/shenandoah/shenandoahLock.hpp"
+#include "runtime/atomic.inline.hpp"
+#include "runtime/orderAccess.inline.hpp"
+#include "runtime/os.hpp"
+
+void ShenandoahLock::lock() {
+  assert(_owner != Thread::current(), "reentrant locking attempt, would deadlock");
+
+  const jint ticket = Atomic::add(1, &_next_ticket) - 1;
+
+  // Spin/yield/sleep ladder, same shape as Thread::SpinAcquire. With the
+  // FIFO hand-off the wait queue can be deep under heavy contention, so
+  // backing off to the scheduler matters more than with an unfair lock.
+  int ctr = 0;
+  int yields = 0;
+  while (OrderAccess::load_acquire(&_now_serving) != ticket) {
+    ++ctr;
+    if ((ctr & 0xFFF) == 0 || !os::is_MP()) {
+      if (yields > 5) {
+        os::naked_short_sleep(1);
+      } else {
+        os::NakedYield();
+        ++yields;
+      }
+    } else {
+      SpinPause();
+    }
+  }
+
+#ifdef ASSERT
+  assert(_owner == NULL, "must not be owned");
+  _owner = Thread::current();
+#endif
+}
+
+void ShenandoahLock::unlock() {
+#ifdef ASSERT
+  assert(_owner == Thread::current(), "sanity");
+  _owner = NULL;
+#endif
+  // Only the lock holder writes _now_serving; hand off to the next ticket.
+  OrderAccess::release_store(&_now_serving, _now_serving + 1);
+}
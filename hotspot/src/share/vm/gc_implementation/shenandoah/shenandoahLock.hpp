@@ -29,42 +29,30 @@
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.hpp"
 
+// Ticket spinlock: waiters take a ticket on arrival and are admitted
+// strictly in ticket order. Unlike a test-and-test-and-set spin, a heavily
+// contended allocation path cannot starve the control thread (or a slower
+// mutator) indefinitely, and each waiter spins on a single location
+// instead of hammering the lock word.
 class ShenandoahLock  {
 private:
-  enum LockState { unlocked = 0, locked = 1 };
-
   shenandoah_padding(0);
-  volatile int _state;
+  volatile jint _next_ticket;
   shenandoah_padding(1);
-  volatile Thread* _owner;
+  volatile jint _now_serving;
   shenandoah_padding(2);
+  volatile Thread* _owner;
+  shenandoah_padding(3);
 
 public:
-  ShenandoahLock() : _state(unlocked), _owner(NULL) {};
-
-  void lock() {
-#ifdef ASSERT
-    assert(_owner != Thread::current(), "reentrant locking attempt, would deadlock");
-#endif
-    Thread::SpinAcquire(&_state, "Shenandoah Heap Lock");
-#ifdef ASSERT
-    assert(_state == locked, "must be locked");
-    assert(_owner == NULL, "must not be owned");
-    _owner = Thread::current();
-#endif
-  }
+  ShenandoahLock() : _next_ticket(0), _now_serving(0), _owner(NULL) {};
 
-  void unlock() {
-#ifdef ASSERT
-    assert (_owner == Thread::current(), "sanity");
-    _owner = NULL;
-#endif
-    Thread::SpinRelease(&_state);
-  }
+  void lock();
+  void unlock();
 
   bool owned_by_self() {
 #ifdef ASSERT
-    return _state == locked && _owner == Thread::current();
+    return _owner == Thread::current();
 #else
     ShouldNotReachHere();
     return false;
@@ -25,8 +25,134 @@
 
 #include <stdio.h> // for va_list and friends
 #include "gc_implementation/shenandoah/shenandoahLogging.hpp"
+#include "prims/jvm.h"
+#include "runtime/atomic.inline.hpp"
+#include "runtime/orderAccess.inline.hpp"
+#include "runtime/os.hpp"
+#include "runtime/task.hpp"
+#include "utilities/events.hpp"
 #include "utilities/ostream.hpp"
 
+// ShenandoahLogRing buffers formatted log lines so that GC threads never
+// touch the GC log file directly. Producers claim a slot with a cas on
+// the ticket counter, format into it, and publish with a releasing
+// store; a PeriodicTask on the watcher thread drains published records
+// in order. When the ring is full the caller falls back to the
+// synchronous path, so no message is ever dropped. The ring registers
+// itself as an EventLog, which makes still-pending messages show up in
+// the hs_err event dump after a crash.
+class ShenandoahLogRing : public EventLog {
+ private:
+  struct Record {
+    volatile jlong _ready;       // claim ticket + 1; written last
+    double         _timestamp;
+    jint           _indentation;
+    char           _msg[232];
+  };
+
+  const jlong    _length;
+  Record*        _records;
+  volatile jlong _claimed;       // next ticket to hand out
+  volatile jlong _flushed;       // next ticket to drain; flusher only
+
+  void print_record(outputStream* out, Record* r) {
+    out->bol();
+    out->sp(r->_indentation * 4);
+    out->print_cr("%s", r->_msg);
+  }
+
+ public:
+  ShenandoahLogRing(jlong length) :
+    _length(length), _claimed(0), _flushed(0) {
+    _records = NEW_C_HEAP_ARRAY(Record, length, mtGC);
+    memset((void*)_records, 0, length * sizeof(Record));
+  }
+
+  // Claim a slot and format the message into it. Returns false without
+  // consuming the va_list if the ring is full.
+  bool log(const char* format, va_list ap) {
+    jlong ticket;
+    while (true) {
+      ticket = _claimed;
+      if (ticket - _flushed >= _length) {
+        return false;
+      }
+      if (Atomic::cmpxchg(ticket + 1, &_claimed, ticket) == ticket) break;
+    }
+    Record* r = &_records[ticket % _length];
+    r->_timestamp = os::elapsedTime();
+    r->_indentation = gclog_or_tty->indentation();
+    jio_vsnprintf(r->_msg, sizeof(r->_msg), format, ap);
+    // Publish only after the record is complete.
+    OrderAccess::release_store(&r->_ready, ticket + 1);
+    return true;
+  }
+
+  // Drain published records in order, stopping at the first slot whose
+  // producer has not published yet. Called from the watcher thread, and
+  // once more from the disengaging thread after GC threads are stopped.
+  void flush() {
+    while (_flushed < _claimed) {
+      Record* r = &_records[_flushed % _length];
+      if (OrderAccess::load_acquire(&r->_ready) != _flushed + 1) break;
+      print_record(gclog_or_tty, r);
+      // Let producers see the reclaimed capacity.
+      OrderAccess::release_store(&_flushed, _flushed + 1);
+    }
+  }
+
+  // Crash-time dump of everything not yet flushed to the GC log.
+  void print_log_on(outputStream* out) {
+    jlong claimed = _claimed;
+    jlong flushed = _flushed;
+    out->print_cr("Shenandoah async log buffer (" JLONG_FORMAT " messages pending):",
+                  claimed - flushed);
+    for (jlong t = flushed; t < claimed; t++) {
+      Record* r = &_records[t % _length];
+      if (r->_ready != t + 1) continue;  // still being written
+      out->print("Event: %.3f ", r->_timestamp);
+      out->print_cr("%s", r->_msg);
+    }
+    out->cr();
+  }
+};
+
+class ShenandoahLogFlusherTask : public PeriodicTask {
+ private:
+  enum { flush_interval_ms = 50 };
+  ShenandoahLogRing* _ring;
+ public:
+  ShenandoahLogFlusherTask(ShenandoahLogRing* ring) :
+    PeriodicTask(flush_interval_ms), _ring(ring) {}
+  void task() { _ring->flush(); }
+};
+
+static ShenandoahLogRing*        _log_ring    = NULL;
+static ShenandoahLogFlusherTask* _log_flusher = NULL;
+
+void ShenandoahLogger::engage_async() {
+  if (!ShenandoahAsyncLogging) return;
+  assert(_log_ring == NULL, "Async logging engaged twice");
+
+  jlong entries = (jlong)MAX2(ShenandoahAsyncLoggingBufferEntries, (uintx)2);
+  _log_ring = new ShenandoahLogRing(entries);
+  _log_flusher = new ShenandoahLogFlusherTask(_log_ring);
+  _log_flusher->enroll();
+}
+
+void ShenandoahLogger::disengage_async() {
+  if (_log_ring == NULL) return;
+
+  _log_flusher->disenroll();
+  delete _log_flusher;
+  _log_flusher = NULL;
+
+  // GC threads are stopped by now; drain what the watcher thread had
+  // not flushed yet. The ring object stays registered as an EventLog.
+  _log_ring->flush();
+  _log_ring = NULL;
+}
+
 void ShenandoahLogger::handle_warning(const char* format, ...) {
   va_list ap;
   va_start(ap, format);
@@ -56,6 +182,10 @@ void ShenandoahLogger::handle_info(const char* format, ...) {
 }
 
 void ShenandoahLogger::handle_generic(const char* format, va_list ap) {
+  ShenandoahLogRing* ring = _log_ring;
+  if (ring != NULL && ring->log(format, ap)) {
+    return;
+  }
   gclog_or_tty->bol();
   gclog_or_tty->sp(gclog_or_tty->indentation()*4);
   gclog_or_tty->vprint_cr(format, ap);
@@ -33,6 +33,13 @@ public:
   static void handle_debug(const char* format, ...);
   static void handle_info(const char* format, ...);
   static void handle_warning(const char* format, ...);
+
+  // Asynchronous mode (+ShenandoahAsyncLogging): messages go through an
+  // in-memory ring flushed to the GC log by the watcher thread, keeping
+  // file I/O off GC threads. Engaged at heap startup, disengaged (with a
+  // final drain) when the heap is stopped.
+  static void engage_async();
+  static void disengage_async();
 private:
   static void handle_generic(const char* format, va_list ap);
 };
@@ -154,8 +154,11 @@ void ShenandoahMarkCompact::do_it(GCCause::Cause gc_cause) {
   // Setup workers for the rest
   OrderAccess::fence();
 
-  // Initialize worker slices
-  ShenandoahHeapRegionSet** worker_slices = NEW_C_HEAP_ARRAY(ShenandoahHeapRegionSet*, heap->max_workers(), mtGC);
+  // Initialize worker slices in the coordinator scratch space; everything
+  // carved out of it below is reclaimed when the mark leaves scope.
+  ShenandoahScratchSpace* scratch = heap->workers()->coordinator_scratch();
+  ShenandoahScratchMark scratch_mark(scratch);
+  ShenandoahHeapRegionSet** worker_slices = scratch->allocate_array<ShenandoahHeapRegionSet*>(heap->max_workers());
   for (uint i = 0; i < heap->max_workers(); i++) {
     worker_slices[i] = new ShenandoahHeapRegionSet();
   }
@@ -187,11 +190,10 @@ void ShenandoahMarkCompact::do_it(GCCause::Cause gc_cause) {
   // Resize metaspace
   MetaspaceGC::compute_new_size();
 
-  // Free worker slices
+  // Free worker slices; the slice array itself goes with the scratch space
   for (uint i = 0; i < heap->max_workers(); i++) {
     delete worker_slices[i];
   }
-  FREE_C_HEAP_ARRAY(ShenandoahHeapRegionSet*, worker_slices, mtGC);
 
   CodeCache::gc_epilogue();
   JvmtiExport::gc_epilogue();
@@ -570,7 +572,8 @@ void ShenandoahMarkCompact::distribute_slices(ShenandoahHeapRegionSet** worker_s
   // subset of dense prefix.
   size_t prefix_idx = 0;
 
-  size_t* live = NEW_C_HEAP_ARRAY(size_t, n_workers, mtGC);
+  // Checked out for the whole sliding phase, see do_it()
+  size_t* live = heap->workers()->coordinator_scratch()->allocate_array<size_t>(n_workers);
 
   for (size_t wid = 0; wid < n_workers; wid++) {
     ShenandoahHeapRegionSet* slice = worker_slices[wid];
@@ -619,7 +622,6 @@ void ShenandoahMarkCompact::distribute_slices(ShenandoahHeapRegionSet** worker_s
     }
   }
 
-  FREE_C_HEAP_ARRAY(size_t, live, mtGC);
 
 #ifdef ASSERT
   BitMap map(n_regions, true /* in_resource_area */);
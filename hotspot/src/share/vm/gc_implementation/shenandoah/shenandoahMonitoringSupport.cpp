@@ -25,9 +25,14 @@
 #include "gc_implementation/shared/hSpaceCounters.hpp"
 #include "gc_implementation/shared/collectorCounters.hpp"
 #include "gc_implementation/shared/generationCounters.hpp"
+#include "gc_implementation/shenandoah/heuristics/shenandoahHeuristics.hpp"
+#include "gc_implementation/shenandoah/shenandoahCollectorPolicy.hpp"
+#include "gc_implementation/shenandoah/shenandoahFreeSet.hpp"
 #include "gc_implementation/shenandoah/shenandoahMonitoringSupport.hpp"
 #include "gc_implementation/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahHeapRegionCounters.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/perfData.hpp"
 
 class ShenandoahYoungGenerationCounters : public GenerationCounters {
 public:
@@ -66,6 +71,49 @@ ShenandoahMonitoringSupport::ShenandoahMonitoringSupport(ShenandoahHeap* heap) :
   _space_counters = new HSpaceCounters("Heap", 0, heap->max_capacity(), heap->initial_capacity(), _heap_counters);
 
   _heap_region_counters = new ShenandoahHeapRegionCounters();
+
+  _ergo_alloc_rate         = NULL;
+  _ergo_alloc_headroom     = NULL;
+  _ergo_avg_cycle_time     = NULL;
+  _ergo_time_to_exhaustion = NULL;
+  _ergo_penalties          = NULL;
+  _ergo_times_learned      = NULL;
+  _ergo_success_concurrent = NULL;
+  _ergo_success_degenerated = NULL;
+  _ergo_success_full       = NULL;
+
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    ResourceMark rm;
+    const char* ns = PerfDataManager::name_space("shenandoah", "ergo");
+
+    const char* cname = PerfDataManager::counter_name(ns, "alloc_rate");
+    _ergo_alloc_rate = PerfDataManager::create_long_variable(SUN_GC, cname, PerfData::U_Bytes, CHECK);
+
+    cname = PerfDataManager::counter_name(ns, "alloc_headroom");
+    _ergo_alloc_headroom = PerfDataManager::create_long_variable(SUN_GC, cname, PerfData::U_Bytes, CHECK);
+
+    cname = PerfDataManager::counter_name(ns, "avg_cycle_time");
+    _ergo_avg_cycle_time = PerfDataManager::create_long_variable(SUN_GC, cname, PerfData::U_None, CHECK);
+
+    cname = PerfDataManager::counter_name(ns, "time_to_exhaustion");
+    _ergo_time_to_exhaustion = PerfDataManager::create_long_variable(SUN_GC, cname, PerfData::U_None, CHECK);
+
+    cname = PerfDataManager::counter_name(ns, "penalties");
+    _ergo_penalties = PerfDataManager::create_long_variable(SUN_GC, cname, PerfData::U_None, CHECK);
+
+    cname = PerfDataManager::counter_name(ns, "times_learned");
+    _ergo_times_learned = PerfDataManager::create_long_variable(SUN_GC, cname, PerfData::U_None, CHECK);
+
+    cname = PerfDataManager::counter_name(ns, "success_concurrent");
+    _ergo_success_concurrent = PerfDataManager::create_long_variable(SUN_GC, cname, PerfData::U_Events, CHECK);
+
+    cname = PerfDataManager::counter_name(ns, "success_degenerated");
+    _ergo_success_degenerated = PerfDataManager::create_long_variable(SUN_GC, cname, PerfData::U_Events, CHECK);
+
+    cname = PerfDataManager::counter_name(ns, "success_full");
+    _ergo_success_full = PerfDataManager::create_long_variable(SUN_GC, cname, PerfData::U_Events, CHECK);
+  }
 }
 
 CollectorCounters* ShenandoahMonitoringSupport::stw_collection_counters() {
@@ -93,5 +141,86 @@ void ShenandoahMonitoringSupport::update_counters() {
 
     MetaspaceCounters::update_performance_counters();
     CompressedClassSpaceCounters::update_performance_counters();
+
+    update_ergo_counters();
   }
 }
+
+// Recompute the quantities the adaptive trigger works from, the same way
+// ShenandoahAdaptiveHeuristics::should_start_gc() does. The snapshot is
+// advisory: it races with allocation and cycle starts, which is fine for
+// monitoring consumers.
+void ShenandoahMonitoringSupport::snapshot_ergo(ErgoSnapshot* snap) {
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  ShenandoahHeuristics* heuristics = heap->heuristics();
+
+  size_t max_capacity = heap->max_capacity();
+  size_t capacity = heap->soft_max_capacity();
+  size_t available = heap->free_set()->available();
+
+  // Treat available without the soft tail.
+  size_t soft_tail = max_capacity - capacity;
+  available = (available > soft_tail) ? (available - soft_tail) : 0;
+
+  size_t spike_headroom = capacity / 100 * ShenandoahAllocSpikeFactor;
+  size_t penalties      = capacity / 100 * heuristics->gc_time_penalties();
+
+  size_t allocation_headroom = available;
+  allocation_headroom -= MIN2(allocation_headroom, spike_headroom);
+  allocation_headroom -= MIN2(allocation_headroom, penalties);
+
+  double time_since_last = heuristics->time_since_last_gc();
+  double allocation_rate = (time_since_last > 0) ?
+          heap->bytes_allocated_since_gc_start() / time_since_last : 0;
+
+  snap->_alloc_rate     = (size_t) allocation_rate;
+  snap->_alloc_headroom = allocation_headroom;
+  snap->_avg_cycle_time = heuristics->average_gc_time();
+
+  if (allocation_rate > 1) {
+    snap->_time_to_exhaustion_ms = (jlong) (allocation_headroom / allocation_rate * 1000);
+  } else {
+    snap->_time_to_exhaustion_ms = -1;
+  }
+}
+
+void ShenandoahMonitoringSupport::update_ergo_counters() {
+  if (_ergo_alloc_rate == NULL) return;
+
+  ErgoSnapshot snap;
+  snapshot_ergo(&snap);
+
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  ShenandoahHeuristics* heuristics = heap->heuristics();
+  ShenandoahCollectorPolicy* policy = heap->shenandoah_policy();
+
+  _ergo_alloc_rate->set_value(snap._alloc_rate);
+  _ergo_alloc_headroom->set_value(snap._alloc_headroom);
+  _ergo_avg_cycle_time->set_value((jlong) (snap._avg_cycle_time * 1000));
+  _ergo_time_to_exhaustion->set_value(snap._time_to_exhaustion_ms);
+  _ergo_penalties->set_value(heuristics->gc_time_penalties());
+  _ergo_times_learned->set_value(heuristics->gc_times_learned());
+  _ergo_success_concurrent->set_value(policy->success_concurrent_gcs());
+  _ergo_success_degenerated->set_value(policy->success_degenerated_gcs());
+  _ergo_success_full->set_value(policy->success_full_gcs());
+}
+
+void ShenandoahMonitoringSupport::print_ergonomics_on(outputStream* st) {
+  ErgoSnapshot snap;
+  snapshot_ergo(&snap);
+
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  ShenandoahHeuristics* heuristics = heap->heuristics();
+  ShenandoahCollectorPolicy* policy = heap->shenandoah_policy();
+
+  st->print_cr("heuristics: %s", heuristics->name());
+  st->print_cr("allocation_rate_bytes_per_second: " SIZE_FORMAT, snap._alloc_rate);
+  st->print_cr("allocation_headroom_bytes: " SIZE_FORMAT, snap._alloc_headroom);
+  st->print_cr("average_cycle_time_ms: %.3f", snap._avg_cycle_time * 1000);
+  st->print_cr("predicted_time_to_exhaustion_ms: " JLONG_FORMAT, snap._time_to_exhaustion_ms);
+  st->print_cr("gc_time_penalties_percent: " INTX_FORMAT, heuristics->gc_time_penalties());
+  st->print_cr("gc_times_learned: " SIZE_FORMAT, heuristics->gc_times_learned());
+  st->print_cr("successful_concurrent_cycles: " SIZE_FORMAT, policy->success_concurrent_gcs());
+  st->print_cr("successful_degenerated_cycles: " SIZE_FORMAT, policy->success_degenerated_gcs());
+  st->print_cr("successful_full_cycles: " SIZE_FORMAT, policy->success_full_gcs());
+}
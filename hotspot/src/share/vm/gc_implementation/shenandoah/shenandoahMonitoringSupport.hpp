@@ -31,6 +31,8 @@ class HSpaceCounters;
 class ShenandoahHeap;
 class CollectorCounters;
 class ShenandoahHeapRegionCounters;
+class PerfVariable;
+class outputStream;
 
 class ShenandoahMonitoringSupport : public CHeapObj<mtGC> {
 private:
@@ -43,12 +45,35 @@ private:
 
   ShenandoahHeapRegionCounters* _heap_region_counters;
 
+  // Heuristic model export for external observers (autoscalers et al),
+  // published under sun.gc.shenandoah.ergo and refreshed together with
+  // the rest of the counters.
+  PerfVariable* _ergo_alloc_rate;
+  PerfVariable* _ergo_alloc_headroom;
+  PerfVariable* _ergo_avg_cycle_time;
+  PerfVariable* _ergo_time_to_exhaustion;
+  PerfVariable* _ergo_penalties;
+  PerfVariable* _ergo_times_learned;
+  PerfVariable* _ergo_success_concurrent;
+  PerfVariable* _ergo_success_degenerated;
+  PerfVariable* _ergo_success_full;
+
+  struct ErgoSnapshot {
+    size_t _alloc_rate;             // bytes per second, since last cycle start
+    size_t _alloc_headroom;         // bytes, after spike and penalty reserves
+    double _avg_cycle_time;         // seconds
+    jlong  _time_to_exhaustion_ms;  // -1 when allocation rate is negligible
+  };
+  void snapshot_ergo(ErgoSnapshot* snap);
+  void update_ergo_counters();
+
 public:
  ShenandoahMonitoringSupport(ShenandoahHeap* heap);
  CollectorCounters* stw_collection_counters();
  CollectorCounters* full_stw_collection_counters();
  CollectorCounters* concurrent_collection_counters();
  void update_counters();
+ void print_ergonomics_on(outputStream* st);
 };
 
 #endif // SHARE_VM_GC_SHENANDOAH_SHENANDOAHMONITORINGSUPPORT_HPP
@@ -186,23 +186,12 @@ size_t ShenandoahPacer::update_and_get_progress_history() {
 
 void ShenandoahPacer::restart_with(jlong non_taxable_bytes, jdouble tax_rate) {
   STATIC_ASSERT(sizeof(size_t) <= sizeof(intptr_t));
-  {
-    intptr_t initial = (size_t) (non_taxable_bytes * tax_rate) >> LogHeapWordSize;
-    intptr_t cur;
-    do {
-      cur = OrderAccess::load_acquire(&_budget);
-    } while (Atomic::cmpxchg_ptr(initial, &_budget, cur) != cur);
-  }
+  intptr_t initial = (size_t) (non_taxable_bytes * tax_rate) >> LogHeapWordSize;
+  Atomic::xchg_ptr(initial, &_budget);
 
   OrderAccess::release_store(&_tax_rate, tax_rate);
 
-  {
-    intptr_t cur, val;
-    do {
-      cur = OrderAccess::load_acquire(&_epoch);
-      val = cur + 1;
-    } while (Atomic::cmpxchg_ptr(val, &_epoch, cur) != cur);
-  }
+  Atomic::add_ptr(1, &_epoch);
 
   // Shake up stalled waiters after budget update.
   _need_notify_waiters.try_set();
@@ -29,7 +29,10 @@
 #include "gc_implementation/shenandoah/shenandoahWorkerDataArray.hpp"
 #include "gc_implementation/shenandoah/shenandoahUtils.hpp"
 #include "gc_implementation/shenandoah/heuristics/shenandoahHeuristics.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "memory/resourceArea.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/perfData.hpp"
 #include "utilities/ostream.hpp"
 
 #define SHENANDOAH_PHASE_NAME_FORMAT "%-30s"
@@ -59,6 +62,33 @@ ShenandoahPhaseTimings::ShenandoahPhaseTimings(uint max_workers) :
     SHENANDOAH_PAR_PHASE_DO(,, SHENANDOAH_WORKER_DATA_NULL)
 #undef SHENANDOAH_WORKER_DATA_NULL
     _cycle_data[i] = uninitialized();
+    _pause_histograms[i] = NULL;
+  }
+
+  // Publish the STW pause phases as log2-scaled microsecond histograms
+  // in the perf memory segment, so external samplers can read pause
+  // distributions without attaching to the VM. 24 buckets put the last
+  // regular bucket at ~8s; longer pauses land in the overflow bucket.
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    ResourceMark rm;
+    static const struct {
+      Phase phase;
+      const char* name;
+    } exported_pauses[] = {
+      { init_mark,         "init_mark"         },
+      { final_mark,        "final_mark"        },
+      { init_update_refs,  "init_update_refs"  },
+      { final_update_refs, "final_update_refs" },
+      { degen_gc,          "degen_gc"          },
+      { full_gc,           "full_gc"           },
+    };
+    const char* ns = PerfDataManager::name_space("shenandoah", "pauses");
+    for (uint i = 0; i < sizeof(exported_pauses) / sizeof(exported_pauses[0]); i++) {
+      const char* cname = PerfDataManager::counter_name(ns, exported_pauses[i].name);
+      _pause_histograms[exported_pauses[i].phase] =
+              PerfDataManager::create_long_histogram(SUN_GC, cname, PerfData::U_None, 24, CHECK);
+    }
   }
 
   // Then punch in the worker-related data.
@@ -205,10 +235,53 @@ void ShenandoahPhaseTimings::flush_par_workers_to_cycle() {
   }
 }
 
+void ShenandoahPhaseTimings::send_phase_events() {
+  if (!EventShenandoahPhaseStatistics::is_enabled()) {
+    return;
+  }
+
+  for (uint i = 0; i < _num_phases; i++) {
+    double v = _cycle_data[i];
+    if (v == uninitialized()) continue;
+
+    EventShenandoahPhaseStatistics evt;
+    evt.set_name(_phase_names[i]);
+    evt.set_time((jlong)(v * NANOSECS_PER_SEC));
+
+    double min = 0, avg = 0, max = 0;
+    if (_worker_data[i] != NULL) {
+      double sum = 0;
+      uint workers = 0;
+      for (uint c = 0; c < _max_workers; c++) {
+        double tv = _worker_data[i]->get(c);
+        if (tv != ShenandoahWorkerData::uninitialized()) {
+          if (workers == 0 || tv < min) min = tv;
+          if (workers == 0 || tv > max) max = tv;
+          sum += tv;
+          workers++;
+        }
+      }
+      if (workers > 0) {
+        avg = sum / workers;
+      }
+    }
+    evt.set_workerMin((jlong)(min * NANOSECS_PER_SEC));
+    evt.set_workerAvg((jlong)(avg * NANOSECS_PER_SEC));
+    evt.set_workerMax((jlong)(max * NANOSECS_PER_SEC));
+    evt.commit();
+  }
+}
+
 void ShenandoahPhaseTimings::flush_cycle_to_global() {
+  // Per-cycle and per-worker data is about to be reset, send it to JFR first
+  send_phase_events();
+
   for (uint i = 0; i < _num_phases; i++) {
     if (_cycle_data[i] != uninitialized()) {
       _global_data[i].add(_cycle_data[i]);
+      if (_pause_histograms[i] != NULL) {
+        _pause_histograms[i]->record((jlong)(_cycle_data[i] * 1000000.0));
+      }
       _cycle_data[i] = uninitialized();
     }
     if (_worker_data[i] != NULL) {
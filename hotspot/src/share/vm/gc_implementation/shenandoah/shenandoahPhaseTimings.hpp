@@ -30,6 +30,7 @@
 #include "gc_implementation/shenandoah/shenandoahWorkerDataArray.hpp"
 #include "gc_implementation/shenandoah/shenandoahWorkerDataArray.inline.hpp"
 
+class PerfLongHistogram;
 class ShenandoahCollectorPolicy;
 class outputStream;
 
@@ -97,6 +98,7 @@ class outputStream;
   SHENANDOAH_PAR_PHASE_DO(evac_,                    "    E: ", f)                      \
                                                                                        \
   f(conc_cleanup_early,                             "Concurrent Cleanup")              \
+  f(conc_cleanup_early_purge,                       "  Purge Unloaded Metadata")       \
   f(conc_evac,                                      "Concurrent Evacuation")           \
                                                                                        \
   f(init_update_refs_gross,                         "Pause Init  Update Refs (G)")     \
@@ -119,6 +121,7 @@ class outputStream;
                                                                                        \
   f(degen_gc_gross,                                 "Pause Degenerated GC (G)")        \
   f(degen_gc,                                       "Pause Degenerated GC (N)")        \
+  f(degen_sync_pinned,                              "  Sync Pinned")                   \
   f(degen_gc_update_roots,                          "  Degen Update Roots")            \
   SHENANDOAH_PAR_PHASE_DO(degen_gc_update_,         "    DU: ", f)                     \
                                                                                        \
@@ -197,6 +200,11 @@ private:
   ShenandoahWorkerData* _worker_data[_num_phases];
   ShenandoahCollectorPolicy* _policy;
 
+  // Log2-scaled microsecond distributions of the STW pause phases,
+  // published in the perf memory segment for external samplers.
+  // NULL for phases that are not exported.
+  PerfLongHistogram* _pause_histograms[_num_phases];
+
   static bool is_worker_phase(Phase phase);
   static bool is_root_work_phase(Phase phase);
 
@@ -206,6 +214,8 @@ private:
   void set_cycle_data(Phase phase, double time);
   static double uninitialized() { return -1; }
 
+  void send_phase_events();
+
 public:
   ShenandoahPhaseTimings(uint max_workers);
 
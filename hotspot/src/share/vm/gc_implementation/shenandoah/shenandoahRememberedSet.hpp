@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2019, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_SHENANDOAH_SHENANDOAHREMEMBEREDSET_HPP
+#define SHARE_VM_GC_SHENANDOAH_SHENANDOAHREMEMBEREDSET_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/bitMap.hpp"
+
+/*
+ * Remembered set for the generational mode: card-granular dirty marks for
+ * locations in old regions that had stored references to young regions.
+ * Dirty cards over-approximate the old-to-young pointer set: cards are
+ * marked by the store paths and only cleaned wholesale when the owning
+ * region is recycled, or when a mark had visited the card.
+ */
+class ShenandoahRememberedSet : public CHeapObj<mtGC> {
+private:
+  static const size_t CardSizeBytesShift = 9; // 512-byte cards, same as CardTableModRefBS
+  static const size_t CardSizeBytes = (size_t)1 << CardSizeBytesShift;
+
+  HeapWord* const _heap_base;
+  const size_t _num_cards;
+  BitMap _dirty;
+
+  inline size_t card_index_for(const void* addr) const {
+    size_t idx = (pointer_delta((HeapWord*)addr, _heap_base) * HeapWordSize) >> CardSizeBytesShift;
+    assert(idx < _num_cards, err_msg("Card index in bounds: " SIZE_FORMAT, idx));
+    return idx;
+  }
+
+public:
+  ShenandoahRememberedSet(HeapWord* heap_base, size_t heap_size_bytes);
+
+  // Called by store paths, possibly concurrently.
+  inline void mark_dirty(const void* addr) {
+    _dirty.par_set_bit(card_index_for(addr));
+  }
+
+  inline bool is_dirty(const void* addr) const {
+    return _dirty.at(card_index_for(addr));
+  }
+
+  // Called under heap lock when the region is recycled.
+  void clear_range(HeapWord* start, HeapWord* end);
+
+  size_t dirty_card_count() const;
+  size_t card_size_bytes() const { return CardSizeBytes; }
+};
+
+#endif // SHARE_VM_GC_SHENANDOAH_SHENANDOAHREMEMBEREDSET_HPP
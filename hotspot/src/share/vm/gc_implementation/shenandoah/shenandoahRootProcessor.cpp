@@ -60,12 +60,21 @@ static void universe_oops_do(OopClosure* closure) {
   Universe::oops_do(closure);
 }
 
+ShenandoahJNIHandleRoots::ShenandoahJNIHandleRoots(ShenandoahPhaseTimings::Phase phase) :
+  _phase(phase) {
+}
+
+void ShenandoahJNIHandleRoots::oops_do(OopClosure* cl, uint worker_id) {
+  ShenandoahWorkerTimingsTracker timer(_phase, ShenandoahPhaseTimings::JNIRoots, worker_id);
+  JNIHandles::possibly_parallel_oops_do(cl);
+}
+
 ShenandoahSerialRoots::ShenandoahSerialRoots(ShenandoahPhaseTimings::Phase phase) :
   _phase(phase),
   _universe_roots(&universe_oops_do, phase, ShenandoahPhaseTimings::UniverseRoots),
   _management_roots(&Management::oops_do, phase, ShenandoahPhaseTimings::ManagementRoots),
   _jvmti_roots(&JvmtiExport::oops_do, phase, ShenandoahPhaseTimings::JVMTIRoots),
-  _jni_handle_roots(&JNIHandles::oops_do, phase, ShenandoahPhaseTimings::JNIRoots),
+  _jni_handle_roots(phase),
   _flat_profiler_roots(&FlatProfiler::oops_do, phase, ShenandoahPhaseTimings::FlatProfilerRoots) {
 }
 
@@ -83,10 +92,14 @@ void ShenandoahSerialRoots::oops_do(OopClosure* cl, uint worker_id) {
 }
 
 ShenandoahSystemDictionaryRoots::ShenandoahSystemDictionaryRoots(ShenandoahPhaseTimings::Phase phase) :
-  _phase(phase), _claimed(0) {
+  _phase(phase), _claimed(0), _claimed_bucket(0) {
 }
 
 void ShenandoahSystemDictionaryRoots::strong_oops_do(OopClosure* oops, uint worker_id) {
+  // The strong/weak split needs the strongly-reachable pre-marking pass over
+  // the dictionary to complete before the protection domain cache is scanned,
+  // and there is no phase barrier inside a root group. Keep this path under a
+  // single claim; it only runs in class-unloading cycles.
   if (_claimed == 0 && Atomic::cmpxchg(1, &_claimed, 0) == 0) {
     ShenandoahWorkerTimingsTracker timer(_phase, ShenandoahPhaseTimings::SystemDictionaryRoots, worker_id);
     SystemDictionary::roots_oops_do(oops, NULL);
@@ -94,9 +107,25 @@ void ShenandoahSystemDictionaryRoots::strong_oops_do(OopClosure* oops, uint work
 }
 
 void ShenandoahSystemDictionaryRoots::oops_do(OopClosure* oops, uint worker_id) {
+  ShenandoahWorkerTimingsTracker timer(_phase, ShenandoahPhaseTimings::SystemDictionaryRoots, worker_id);
+
+  // The few singleton roots go under a single claim; the protection domain
+  // cache, which holds nearly all of the heap oops behind the system
+  // dictionary, is striped over bucket ranges so that every worker can help.
   if (_claimed == 0 && Atomic::cmpxchg(1, &_claimed, 0) == 0) {
-    ShenandoahWorkerTimingsTracker timer(_phase, ShenandoahPhaseTimings::SystemDictionaryRoots, worker_id);
-    SystemDictionary::roots_oops_do(oops, oops);
+    SystemDictionary::fixed_roots_oops_do(oops);
+  }
+
+  const int limit = SystemDictionary::pd_cache_table_size();
+  const int chunk_size = MAX2<int>(32, limit / (int)(ParallelGCThreads * 10));
+  for (;;) {
+    int start_idx = Atomic::add(chunk_size, &_claimed_bucket) - chunk_size;
+    if (start_idx >= limit) {
+      // End of table
+      break;
+    }
+    int end_idx = MIN2(limit, start_idx + chunk_size);
+    SystemDictionary::pd_cache_buckets_oops_do(oops, start_idx, end_idx);
   }
 }
 
@@ -116,6 +145,12 @@ ShenandoahThreadRoots::ShenandoahThreadRoots(ShenandoahPhaseTimings::Phase phase
 }
 
 void ShenandoahThreadRoots::oops_do(OopClosure* oops_cl, CLDClosure* cld_cl, CodeBlobClosure* code_cl, uint worker_id) {
+  // Thread stacks can only be scanned inside the pause in this runtime:
+  // without handshakes and stack watermarks, a stack is stable only when its
+  // owner is stopped at the global safepoint, and the per-thread claim parity
+  // is only advanced there. The scan is parallel over threads, which is the
+  // best we can do for stacks-heavy applications here; moving it concurrent
+  // needs the JDK 14+ stack watermark machinery.
   ShenandoahWorkerTimingsTracker timer(_phase, ShenandoahPhaseTimings::ThreadRoots, worker_id);
   ResourceMark rm;
   Threads::possibly_parallel_oops_do(oops_cl, cld_cl, code_cl);
@@ -137,11 +172,25 @@ void ShenandoahWeakRoot::weak_oops_do(BoolObjectClosure* is_alive, OopClosure* k
   }
 }
 
+ShenandoahJNIWeakRoots::ShenandoahJNIWeakRoots(ShenandoahPhaseTimings::Phase phase, ShenandoahPhaseTimings::ParPhase par_phase) :
+  _phase(phase), _par_phase(par_phase) {
+}
+
+void ShenandoahJNIWeakRoots::oops_do(OopClosure* keep_alive, uint worker_id) {
+  AlwaysTrueClosure always_true;
+  weak_oops_do(&always_true, keep_alive, worker_id);
+}
+
+void ShenandoahJNIWeakRoots::weak_oops_do(BoolObjectClosure* is_alive, OopClosure* keep_alive, uint worker_id) {
+  ShenandoahWorkerTimingsTracker t(_phase, _par_phase, worker_id);
+  JNIHandles::possibly_parallel_weak_oops_do(is_alive, keep_alive);
+}
+
 ShenandoahWeakRoots::ShenandoahWeakRoots(ShenandoahPhaseTimings::Phase phase) :
 #if INCLUDE_JFR
   _jfr_weak_roots(phase, ShenandoahPhaseTimings::JFRWeakRoots, &LeakProfiler::oops_do),
 #endif // INCLUDE_JFR
-  _jni_weak_roots(phase, ShenandoahPhaseTimings::JNIWeakRoots, &JNIHandles::weak_oops_do) {
+  _jni_weak_roots(phase, ShenandoahPhaseTimings::JNIWeakRoots) {
 }
 
 void ShenandoahWeakRoots::oops_do(OopClosure* keep_alive, uint worker_id) {
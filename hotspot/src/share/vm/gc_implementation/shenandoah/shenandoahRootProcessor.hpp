@@ -51,13 +51,23 @@ public:
   void oops_do(OopClosure* cl, uint worker_id);
 };
 
+// JNI global handles are striped over several block chains; all workers
+// participate and claim stripes until the storage is exhausted.
+class ShenandoahJNIHandleRoots {
+private:
+  const ShenandoahPhaseTimings::Phase _phase;
+public:
+  ShenandoahJNIHandleRoots(ShenandoahPhaseTimings::Phase phase);
+  void oops_do(OopClosure* oops, uint worker_id);
+};
+
 class ShenandoahSerialRoots {
 private:
   const ShenandoahPhaseTimings::Phase _phase;
   ShenandoahSerialRoot            _universe_roots;
   ShenandoahSerialRoot            _management_roots;
   ShenandoahSerialRoot            _jvmti_roots;
-  ShenandoahSerialRoot            _jni_handle_roots;
+  ShenandoahJNIHandleRoots        _jni_handle_roots;
   ShenandoahSerialRoot            _flat_profiler_roots;
   ShenandoahSynchronizerIterator  _om_iterator;
 public:
@@ -69,6 +79,7 @@ class ShenandoahSystemDictionaryRoots {
 private:
   const ShenandoahPhaseTimings::Phase _phase;
   volatile int _claimed;
+  volatile int _claimed_bucket;
 public:
   ShenandoahSystemDictionaryRoots(ShenandoahPhaseTimings::Phase phase);
   void strong_oops_do(OopClosure* oops, uint worker_id);
@@ -106,10 +117,21 @@ public:
   void weak_oops_do(BoolObjectClosure* is_alive, OopClosure* keep_alive, uint worker_id);
 };
 
+// As ShenandoahJNIHandleRoots, but for the weak global handle stripes.
+class ShenandoahJNIWeakRoots {
+private:
+  const ShenandoahPhaseTimings::Phase    _phase;
+  const ShenandoahPhaseTimings::ParPhase _par_phase;
+public:
+  ShenandoahJNIWeakRoots(ShenandoahPhaseTimings::Phase phase, ShenandoahPhaseTimings::ParPhase par_phase);
+  void oops_do(OopClosure* keep_alive, uint worker_id);
+  void weak_oops_do(BoolObjectClosure* is_alive, OopClosure* keep_alive, uint worker_id);
+};
+
 class ShenandoahWeakRoots {
 private:
   JFR_ONLY(ShenandoahWeakRoot _jfr_weak_roots;)
-  ShenandoahWeakRoot          _jni_weak_roots;
+  ShenandoahJNIWeakRoots      _jni_weak_roots;
 public:
   ShenandoahWeakRoots(ShenandoahPhaseTimings::Phase phase);
   void oops_do(OopClosure* keep_alive, uint worker_id);
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#include "gc_implementation/shenandoah/shenandoahLogging.hpp"
+#include "gc_implementation/shenandoah/shenandoahScratchSpace.hpp"
+
+ShenandoahScratchSpace::ShenandoahScratchSpace() :
+  _head(NULL), _top(NULL), _end(NULL), _used(0), _high_water(0) {
+  DEBUG_ONLY(_in_use = false;)
+}
+
+ShenandoahScratchSpace::~ShenandoahScratchSpace() {
+  assert(!_in_use, "should not be checked out");
+  free_blocks();
+}
+
+ShenandoahScratchSpace::Block* ShenandoahScratchSpace::alloc_block(size_t min_bytes) {
+  size_t size = align_size_up_(MAX2(min_bytes, (size_t)InitialBlockSize),
+                               (size_t)BlockSizeGranularity);
+  Block* b = (Block*)NEW_C_HEAP_ARRAY(char, sizeof(Block) + size, mtGC);
+  b->_next = NULL;
+  b->_size = size;
+  return b;
+}
+
+void ShenandoahScratchSpace::free_blocks() {
+  Block* b = _head;
+  while (b != NULL) {
+    Block* next = b->_next;
+    FREE_C_HEAP_ARRAY(char, (char*)b, mtGC);
+    b = next;
+  }
+  _head = NULL;
+  _top = NULL;
+  _end = NULL;
+}
+
+void* ShenandoahScratchSpace::allocate_slow(size_t bytes) {
+  // Chain an overflow block; release() consolidates the chain, so the
+  // space left unused in the old block is not lost for the next checkout.
+  Block* b = alloc_block(MAX2(bytes, _head != NULL ? 2 * _head->_size : (size_t)0));
+  b->_next = _head;
+  _head = b;
+  _top = b->base();
+  _end = _top + b->_size;
+  void* res = _top;
+  _top += bytes;
+  _used += bytes;
+  return res;
+}
+
+void ShenandoahScratchSpace::checkout() {
+  assert(!_in_use, "checkouts do not nest");
+  DEBUG_ONLY(_in_use = true;)
+  _used = 0;
+  if (_head != NULL) {
+    _top = _head->base();
+    _end = _top + _head->_size;
+  }
+}
+
+void ShenandoahScratchSpace::release() {
+  assert(_in_use, "must be checked out");
+  if (_used > _high_water) {
+    _high_water = _used;
+    log_debug(gc, task)("Scratch space high water mark: " SIZE_FORMAT "K",
+                        _high_water / K);
+  }
+  // Consolidate to a single block that covers the whole phase, so the next
+  // checkout does not touch the C-heap at all.
+  if (_head != NULL && (_head->_next != NULL || _head->_size < _high_water)) {
+    free_blocks();
+    _head = alloc_block(_high_water);
+    _top = _head->base();
+    _end = _top + _head->_size;
+  }
+  DEBUG_ONLY(_in_use = false;)
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_SHENANDOAH_SHENANDOAHSCRATCHSPACE_HPP
+#define SHARE_VM_GC_SHENANDOAH_SHENANDOAHSCRATCHSPACE_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// Reusable bump-pointer scratch space for temporary GC-phase allocations.
+// A worker (or the coordinating thread) checks its space out at phase start,
+// carves temporary arrays out of it instead of going to the C-heap, and
+// releases it when the phase ends. The backing memory is retained between
+// checkouts and consolidated to the observed high water mark, so once warmed
+// up a phase allocates nothing from the C-heap at all.
+//
+// Allocations are only reclaimed wholesale at release; there is no
+// per-object free. Checkouts do not nest.
+class ShenandoahScratchSpace : public CHeapObj<mtGC> {
+private:
+  enum {
+    InitialBlockSize     = 16 * K,
+    BlockSizeGranularity =  4 * K
+  };
+
+  struct Block {
+    Block* _next;
+    size_t _size;   // usable bytes following the header
+    char* base()    { return (char*)(this + 1); }
+  };
+
+  Block* _head;        // current allocation block; overflow blocks are chained
+  char*  _top;
+  char*  _end;
+  size_t _used;        // bytes handed out in the current checkout
+  size_t _high_water;  // largest checkout observed
+  DEBUG_ONLY(bool _in_use;)
+
+  static Block* alloc_block(size_t min_bytes);
+  void free_blocks();
+  void* allocate_slow(size_t bytes);
+
+public:
+  ShenandoahScratchSpace();
+  ~ShenandoahScratchSpace();
+
+  void* allocate(size_t bytes) {
+    assert(_in_use, "scratch space is not checked out");
+    bytes = align_size_up_(bytes, sizeof(intptr_t));
+    if (_top + bytes > _end) {
+      return allocate_slow(bytes);
+    }
+    void* res = _top;
+    _top += bytes;
+    _used += bytes;
+    return res;
+  }
+
+  template <typename T>
+  T* allocate_array(size_t length) {
+    return (T*)allocate(length * sizeof(T));
+  }
+
+  // Checkout protocol, normally driven by ShenandoahScratchMark.
+  void checkout();
+  void release();
+
+  size_t high_water() const { return _high_water; }
+};
+
+class ShenandoahScratchMark : public StackObj {
+private:
+  ShenandoahScratchSpace* const _scratch;
+public:
+  ShenandoahScratchMark(ShenandoahScratchSpace* scratch) : _scratch(scratch) {
+    _scratch->checkout();
+  }
+  ~ShenandoahScratchMark() {
+    _scratch->release();
+  }
+};
+
+#endif // SHARE_VM_GC_SHENANDOAH_SHENANDOAHSCRATCHSPACE_HPP
@@ -26,6 +26,7 @@
 
 #include "gc_implementation/shenandoah/shenandoahPadding.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/orderAccess.hpp"
 
 typedef jbyte ShenandoahSharedValue;
@@ -72,19 +73,27 @@ typedef struct ShenandoahSharedFlag {
   }
 
   bool try_set() {
-    if (is_set()) {
-      return false;
+    while (true) {
+      if (is_set()) {
+        return false;
+      }
+      if (Atomic::cmpxchg_weak_acq_rel((ShenandoahSharedValue)SET, &value, (ShenandoahSharedValue)UNSET)) {
+        return true; // success
+      }
+      // Weak CAS failed: either lost the race (caught by the reload above),
+      // or failed spuriously (retry).
     }
-    ShenandoahSharedValue old = Atomic::cmpxchg((ShenandoahSharedValue)SET, &value, (ShenandoahSharedValue)UNSET);
-    return old == UNSET; // success
   }
 
   bool try_unset() {
-    if (!is_set()) {
-      return false;
+    while (true) {
+      if (!is_set()) {
+        return false;
+      }
+      if (Atomic::cmpxchg_weak_acq_rel((ShenandoahSharedValue)UNSET, &value, (ShenandoahSharedValue)SET)) {
+        return true; // success
+      }
     }
-    ShenandoahSharedValue old = Atomic::cmpxchg((ShenandoahSharedValue)UNSET, &value, (ShenandoahSharedValue)SET);
-    return old == SET; // success
   }
 
   volatile ShenandoahSharedValue* addr_of() {
@@ -126,7 +135,8 @@ typedef struct ShenandoahSharedBitmap {
       }
 
       ShenandoahSharedValue nv = ov | mask_val;
-      if (Atomic::cmpxchg(nv, &value, ov) == ov) {
+      // The loop already tolerates spurious failure.
+      if (Atomic::cmpxchg_weak_acq_rel(nv, &value, ov)) {
         // successfully set
         return;
       }
@@ -144,7 +154,7 @@ typedef struct ShenandoahSharedBitmap {
       }
 
       ShenandoahSharedValue nv = ov & ~mask_val;
-      if (Atomic::cmpxchg(nv, &value, ov) == ov) {
+      if (Atomic::cmpxchg_weak_acq_rel(nv, &value, ov)) {
         // successfully unset
         return;
       }
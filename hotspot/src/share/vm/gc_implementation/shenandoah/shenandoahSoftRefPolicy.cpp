@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2018, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#include "classfile/javaClasses.hpp"
+#include "gc_implementation/shenandoah/shenandoahFreeSet.hpp"
+#include "gc_implementation/shenandoah/shenandoahHeap.hpp"
+#include "gc_implementation/shenandoah/shenandoahSoftRefPolicy.hpp"
+
+void ShenandoahSoftRefPolicy::setup() {
+  // Reads of the free set racing with allocations are fine: the interval
+  // only steers which age bucket gets cleared this cycle.
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  size_t available = heap->free_set()->available();
+  _max_interval = (jlong)(available / M) * SoftRefLRUPolicyMSPerMB;
+  assert(_max_interval >= 0, "Sanity check");
+}
+
+bool ShenandoahSoftRefPolicy::should_clear_reference(oop p, jlong timestamp_clock) {
+  jlong interval = timestamp_clock - java_lang_ref_SoftReference::timestamp(p);
+  assert(interval >= 0, "Sanity check");
+
+  // The interval will be zero if the ref was accessed since the last cycle.
+  return interval > _max_interval;
+}
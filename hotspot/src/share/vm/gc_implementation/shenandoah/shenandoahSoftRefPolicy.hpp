@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2018, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_GC_SHENANDOAH_SHENANDOAHSOFTREFPOLICY_HPP
+#define SHARE_VM_GC_SHENANDOAH_SHENANDOAHSOFTREFPOLICY_HPP
+
+#include "memory/referencePolicy.hpp"
+
+// Clears soft references by age against the *current* free set, enabled
+// with -XX:+ShenandoahPressureSoftRefs.
+//
+// The stock LRU policies key the clearing interval off heap occupancy
+// snapshotted at the previous collection. With concurrent GC that snapshot
+// is both stale and, on the full-GC path where it is usually consulted,
+// effectively "heap is full": soft-reference-heavy caches survive every
+// concurrent cycle untouched and then get wiped wholesale when the policy
+// finally flips, producing a request-latency cliff.
+//
+// This policy recomputes the interval at the start of every cycle from the
+// free set. With plenty of free heap the interval matches LRUMaxHeapPolicy
+// and nothing is cleared; as free space shrinks, the interval shrinks with
+// it, so each successive cycle clears the next-older age bucket of
+// references and cache memory drains smoothly instead of in cliffs.
+class ShenandoahSoftRefPolicy : public ReferencePolicy {
+private:
+  jlong _max_interval;
+
+public:
+  ShenandoahSoftRefPolicy() : _max_interval(0) { }
+
+  virtual void setup();
+  virtual bool should_clear_reference(oop p, jlong timestamp_clock);
+};
+
+#endif // SHARE_VM_GC_SHENANDOAH_SHENANDOAHSOFTREFPOLICY_HPP
@@ -47,15 +47,17 @@ void ShenandoahStrDedupQueue::oops_do(OopClosure* cl) {
 }
 
 ShenandoahStrDedupQueueSet::ShenandoahStrDedupQueueSet(uint n) :
-  _num_queues(n), _free_list(NULL), _num_free_queues(0), _terminated(false), _claimed(0) {
+  _num_queues(n), _terminated(false), _claimed(0) {
   _lock = new Monitor(Mutex::leaf, "ShenandoahStrDedupQueueLock", false);
 
   _local_queues = NEW_C_HEAP_ARRAY(ShenandoahStrDedupQueue*, num_queues(), mtGC);
   _outgoing_work_list = NEW_C_HEAP_ARRAY(QueueChunkedList*, num_queues(), mtGC);
+  _recycled_list = NEW_C_HEAP_ARRAY(QueueChunkedList*, num_queues(), mtGC);
 
   for (uint index = 0; index < num_queues(); index ++) {
     _local_queues[index] = new ShenandoahStrDedupQueue(this, index);
     _outgoing_work_list[index] = NULL;
+    _recycled_list[index] = NULL;
   }
 }
 
@@ -74,17 +76,15 @@ ShenandoahStrDedupQueueSet::~ShenandoahStrDedupQueueSet() {
       q = q->next();
       delete tmp;
     }
-  }
 
-  q = _free_list;
-  while (q != NULL) {
-    tmp = q;
-    q = tmp->next();
-    delete tmp;
+    if (_recycled_list[index] != NULL) {
+      delete _recycled_list[index];
+    }
   }
 
   FREE_C_HEAP_ARRAY(ShenandoahStrDedupQueue*, _local_queues, mtGC);
   FREE_C_HEAP_ARRAY(QueueChunkedList*, _outgoing_work_list, mtGC);
+  FREE_C_HEAP_ARRAY(QueueChunkedList*, _recycled_list, mtGC);
 
   delete _lock;
 }
@@ -127,35 +127,28 @@ void ShenandoahStrDedupQueueSet::terminate() {
   locker.notify_all();
 }
 
-void ShenandoahStrDedupQueueSet::release_chunked_list(QueueChunkedList* q) {
+void ShenandoahStrDedupQueueSet::release_chunked_list(QueueChunkedList* q, uint queue_num) {
   assert(q != NULL, "null queue");
-  MutexLockerEx locker(lock(), Mutex::_no_safepoint_check_flag);
-  if (_num_free_queues >= 2 * num_queues()) {
+  assert(queue_num < num_queues(), "Invalid queue number");
+
+  // Park the drained chunk in the per-queue slot, so the producer can take
+  // it without locking. If the slot is occupied, the producer is not keeping
+  // up with the drain, let the chunk go.
+  if (Atomic::cmpxchg_ptr(q, &_recycled_list[queue_num], (QueueChunkedList*)NULL) != NULL) {
     delete q;
-  } else {
-    q->set_next(_free_list);
-    _free_list = q;
-    _num_free_queues ++;
   }
 }
 
-QueueChunkedList* ShenandoahStrDedupQueueSet::allocate_no_lock() {
-  assert_lock_strong(lock());
+QueueChunkedList* ShenandoahStrDedupQueueSet::allocate_chunked_list(uint queue_num) {
+  assert(queue_num < num_queues(), "Invalid queue number");
 
-  if (_free_list != NULL) {
-    QueueChunkedList* q = _free_list;
-    _free_list = _free_list->next();
-    _num_free_queues --;
+  QueueChunkedList* q = (QueueChunkedList*)Atomic::xchg_ptr(NULL, &_recycled_list[queue_num]);
+  if (q != NULL) {
     q->reset();
-    return q;
   } else {
-    return new QueueChunkedList();
+    q = new QueueChunkedList();
   }
-}
-
-QueueChunkedList* ShenandoahStrDedupQueueSet::allocate_chunked_list() {
-  MutexLockerEx locker(_lock, Mutex::_no_safepoint_check_flag);
-  return allocate_no_lock();
+  return q;
 }
 
 QueueChunkedList* ShenandoahStrDedupQueueSet::push_and_get_atomic(QueueChunkedList* q, uint queue_num) {
@@ -167,12 +160,10 @@ QueueChunkedList* ShenandoahStrDedupQueueSet::push_and_get_atomic(QueueChunkedLi
     q->set_next(head);
   }
 
-  {
-    MutexLockerEx locker(lock(), Mutex::_no_safepoint_check_flag);
-    q = allocate_no_lock();
-    lock()->notify();
-  }
-  return q;
+  // No doorbell for the dedup thread here: it polls the outgoing lists on a
+  // short timeout, see ShenandoahStrDedupThread::poll. Evacuation workers
+  // never touch the lock.
+  return allocate_chunked_list(queue_num);
 }
 
 QueueChunkedList* ShenandoahStrDedupQueueSet::remove_work_list_atomic(uint queue_num) {
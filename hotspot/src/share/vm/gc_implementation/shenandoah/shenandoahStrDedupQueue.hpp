@@ -90,9 +90,14 @@ private:
   uint                          _num_queues;
   QueueChunkedList* volatile *  _outgoing_work_list;
 
-  QueueChunkedList*   _free_list;
-  uint                _num_free_queues;
-
+  // Per-queue single-slot chunk caches. The dedup thread parks a drained
+  // chunk here, the producer takes it with a single exchange when it needs
+  // a replacement. Keeps the enqueue path free of locks and of most
+  // malloc traffic.
+  QueueChunkedList* volatile *  _recycled_list;
+
+  // Only covers idle wait and termination of the dedup thread. Never taken
+  // on the producer paths.
   Monitor*            _lock;
 
   bool                _terminated;
@@ -125,10 +130,9 @@ public:
 private:
   inline uint num_queues_nv() const { return _num_queues; }
 
-  void release_chunked_list(QueueChunkedList* l);
+  void release_chunked_list(QueueChunkedList* l, uint queue_num);
 
-  QueueChunkedList* allocate_chunked_list();
-  QueueChunkedList* allocate_no_lock();
+  QueueChunkedList* allocate_chunked_list(uint queue_num);
 
   // Atomic publish and retrieve outgoing work list.
   // We don't have ABA problem, since there is only one dedup thread.
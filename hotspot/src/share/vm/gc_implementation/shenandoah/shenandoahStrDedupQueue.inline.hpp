@@ -29,7 +29,7 @@
 
 void ShenandoahStrDedupQueue::push(oop java_string) {
   if (_current_list == NULL) {
-    _current_list = _queue_set->allocate_chunked_list();
+    _current_list = _queue_set->allocate_chunked_list(queue_num());
   } else if (_current_list->is_full()) {
     _current_list = _queue_set->push_and_get_atomic(_current_list, queue_num());
   }
@@ -55,6 +55,12 @@ void ShenandoahStrDedupThread::run() {
     ShenandoahStrDedupStats stats;
 
     assert(is_work_list_empty(), "Work list must be empty");
+
+    // Pre-allocate the destination table if the last drain pushed the table
+    // over a resize threshold. Runs outside the suspendible set, so zeroing
+    // a large table does not delay safepoints.
+    ShenandoahStringDedup::prepare_resized_table();
+
     // Queue has been shutdown
     if (!poll(&stats)) {
       assert(queues()->has_terminated(), "Must be terminated");
@@ -97,7 +103,7 @@ void ShenandoahStrDedupThread::run() {
         // Advance list only after processed. Otherwise, we may miss scanning
         // during safepoints
         _work_list[queue_index] = cur_list->next();
-        queues()->release_chunked_list(cur_list);
+        queues()->release_chunked_list(cur_list, queue_index);
         cur_list = _work_list[queue_index];
       }
     }
@@ -186,8 +192,11 @@ bool ShenandoahStrDedupThread::poll(ShenandoahStrDedupStats* stats) {
 
     {
       stats->mark_idle();
+      // Producers publish work lists without taking the lock, so there is
+      // no doorbell to wait for: poll the outgoing lists on a short timeout.
+      // Termination still notifies to cut the wait short.
       MonitorLockerEx locker(queues()->lock(), Monitor::_no_safepoint_check_flag);
-      locker.wait(Mutex::_no_safepoint_check_flag);
+      locker.wait(Mutex::_no_safepoint_check_flag, 10);
     }
   }
   return false;
@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 
 #include "classfile/altHashing.hpp"
+#include "gc_implementation/shared/suspendibleThreadSet.hpp"
 #include "gc_implementation/shenandoah/shenandoahCollectionSet.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahMarkingContext.inline.hpp"
@@ -34,6 +35,7 @@
 #include "gc_implementation/shenandoah/shenandoahStringDedup.hpp"
 #include "gc_implementation/shenandoah/shenandoahWorkGroup.hpp"
 #include "gc_implementation/shenandoah/shenandoahUtils.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/workgroup.hpp"
 
@@ -43,6 +45,8 @@ ShenandoahStrDedupThread*   ShenandoahStringDedup::_thread = NULL;
 ShenandoahStrDedupStats     ShenandoahStringDedup::_stats;
 bool                        ShenandoahStringDedup::_enabled = false;
 
+ShenandoahStrDedupTable* volatile ShenandoahStringDedup::_prepared_table = NULL;
+
 void ShenandoahStringDedup::initialize() {
   if (UseStringDeduplication) {
     _queues = new ShenandoahStrDedupQueueSet(ShenandoahHeap::heap()->max_workers());
@@ -157,11 +161,17 @@ public:
       _dedup_table_cleanup_task = new ShenandoahStrDedupTableRehashTask(the_table, _dest_table);
       ShenandoahStringDedup::dedup_stats().inc_table_rehashed();
     } else if (the_table->need_expand()) {
-      _dest_table = new ShenandoahStrDedupTable(table_size, the_table->hash_seed());
+      _dest_table = ShenandoahStringDedup::claim_prepared_table(table_size, the_table->hash_seed());
+      if (_dest_table == NULL) {
+        _dest_table = new ShenandoahStrDedupTable(table_size, the_table->hash_seed());
+      }
       _dedup_table_cleanup_task = new ShenandoahStrDedupExpandTableTask(the_table, _dest_table);
       ShenandoahStringDedup::dedup_stats().inc_table_expanded();
     } else if (the_table->need_shrink()) {
-      _dest_table = new ShenandoahStrDedupTable(table_size, the_table->hash_seed());
+      _dest_table = ShenandoahStringDedup::claim_prepared_table(table_size, the_table->hash_seed());
+      if (_dest_table == NULL) {
+        _dest_table = new ShenandoahStrDedupTable(table_size, the_table->hash_seed());
+      }
       _dedup_table_cleanup_task = new ShenandoahStrDedupShrinkTableTask(the_table, _dest_table);
       ShenandoahStringDedup::dedup_stats().inc_table_shrinked();
     } else {
@@ -197,6 +207,64 @@ void ShenandoahStringDedup::parallel_cleanup() {
   ShenandoahHeap::heap()->workers()->run_task(&task);
 }
 
+/* Pre-allocate the destination table for an upcoming resize. Allocating and
+ * NULL-initializing a bucket array of up to 2^24 entries on the VM thread adds
+ * milliseconds to the cleanup pause on large tables; the resize decision
+ * itself only depends on the entry count, which only the dedup thread
+ * advances, so the table can be built here ahead of time. The decision is
+ * re-made at the safepoint: a prepared table of the wrong size or seed is
+ * simply discarded, see claim_prepared_table().
+ */
+void ShenandoahStringDedup::prepare_resized_table() {
+  assert(Thread::current() == _thread, "Only by dedup thread");
+
+  if (_prepared_table != NULL) {
+    // Previously prepared table not yet consumed
+    return;
+  }
+
+  size_t table_size = 0;
+  jint   hash_seed  = 0;
+  {
+    // The current table is only replaced at safepoints. Capture the resize
+    // decision while joined, so the table cannot be swapped under us.
+    SuspendibleThreadSetJoiner sts_join;
+    ShenandoahStrDedupTable* the_table = _table;
+    if (the_table->need_rehash()) {
+      // Rehash picks a new hash seed at the safepoint, do not second-guess it
+      return;
+    }
+
+    if (the_table->need_expand()) {
+      table_size = MIN2(the_table->size() * 2, ShenandoahStrDedupTable::max_size());
+    } else if (the_table->need_shrink()) {
+      table_size = MAX2(the_table->size() / 2, ShenandoahStrDedupTable::min_size());
+    } else {
+      return;
+    }
+    hash_seed = the_table->hash_seed();
+  }
+
+  // Allocate and initialize the table outside the suspendible set: zeroing
+  // a large bucket array takes a while, and must not hold up safepoints.
+  ShenandoahStrDedupTable* table = new ShenandoahStrDedupTable(table_size, hash_seed);
+  if (Atomic::cmpxchg_ptr(table, &_prepared_table, (ShenandoahStrDedupTable*)NULL) != NULL) {
+    delete table;
+  }
+}
+
+ShenandoahStrDedupTable* ShenandoahStringDedup::claim_prepared_table(size_t size, jint hash_seed) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Must be at a safepoint");
+
+  ShenandoahStrDedupTable* table = (ShenandoahStrDedupTable*)Atomic::xchg_ptr(NULL, &_prepared_table);
+  if (table != NULL && (table->size() != size || table->hash_seed() != hash_seed)) {
+    // Prepared against a stale decision, drop it
+    delete table;
+    table = NULL;
+  }
+  return table;
+}
+
 void ShenandoahStringDedup::stop() {
   assert(ShenandoahStringDedup::is_enabled(), "Must be enabled");
   assert(_thread != NULL, "Not dedup thread");
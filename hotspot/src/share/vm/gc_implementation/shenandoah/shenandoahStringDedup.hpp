@@ -105,6 +105,10 @@ private:
   static bool                        _enabled;
   static ShenandoahStrDedupStats     _stats;
 
+  // Destination table pre-allocated by the dedup thread for an upcoming
+  // resize, consumed by the safepoint cleanup task. See prepare_resized_table.
+  static ShenandoahStrDedupTable* volatile _prepared_table;
+
 public:
   // Initialize string deduplication.
   static void initialize();
@@ -137,6 +141,17 @@ public:
   // Parallel cleanup string dedup queues/table
   static void parallel_cleanup();
 
+  // Speculatively pre-allocate the destination table for an upcoming
+  // resize, so that the safepoint cleanup does not spend pause time
+  // allocating and zeroing the new bucket array. Called by the dedup
+  // thread between queue drains.
+  static void prepare_resized_table();
+
+  // Take the pre-allocated table, if it matches the resize decision made
+  // at the safepoint. A mismatched table is discarded. Returns NULL if
+  // nothing usable was prepared.
+  static ShenandoahStrDedupTable* claim_prepared_table(size_t size, jint hash_seed);
+
   static void stop();
 
   static inline bool is_candidate(oop obj) {
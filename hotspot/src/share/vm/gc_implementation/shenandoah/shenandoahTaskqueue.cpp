@@ -80,7 +80,12 @@ bool ShenandoahTaskTerminator::offer_termination(ShenandoahTerminatorTerminator*
         _blocker->lock_without_safepoint_check();
       }
     } else {
-      _blocker->wait(true, WorkStealingSleepMillis);
+      // Untimed wait: the spin-master rings the doorbell when new tasks show
+      // up, when GC is cancelled, or when the last thread arrives. Timed
+      // waits here would wake up all sleeping workers every sleep period to
+      // re-peek the queue set, which burns cores on the termination tail of
+      // large worker configurations.
+      _blocker->wait(true, 0);
 
       if (_offered_termination == _n_threads) {
         _blocker->unlock();
@@ -203,10 +208,13 @@ bool ShenandoahTaskTerminator::do_spin_master_work(ShenandoahTerminatorTerminato
       _total_peeks++;
 #endif
     size_t tasks = tasks_in_queue_set();
-    if (tasks > 0 || (terminator != NULL && terminator->should_exit_termination())) {
+    bool exit = (terminator != NULL && terminator->should_exit_termination());
+    if (tasks > 0 || exit) {
       MonitorLockerEx locker(_blocker, Mutex::_no_safepoint_check_flag);   // no safepoint check
 
-      if ((int) tasks >= _offered_termination - 1) {
+      if (exit || (int) tasks >= _offered_termination - 1) {
+        // Sleepers wait without timeout now, make sure everybody hears
+        // the termination-exit doorbell, not only as many as there are tasks.
         locker.notify_all();
       } else {
         for (; tasks > 1; tasks --) {
@@ -33,11 +33,13 @@
 class ShenandoahHeap;
 class Thread;
 
+// Overflow segments come from SlabStack, so marking storms that spill many
+// workers into the overflow path do not contend on malloc.
 template<class E, MEMFLAGS F, unsigned int N = TASKQUEUE_SIZE>
-class BufferedOverflowTaskQueue: public OverflowTaskQueue<E, F, N>
+class BufferedOverflowTaskQueue: public OverflowTaskQueue<E, F, N, SlabStack<E, F> >
 {
 public:
-  typedef OverflowTaskQueue<E, F, N> taskqueue_t;
+  typedef OverflowTaskQueue<E, F, N, SlabStack<E, F> > taskqueue_t;
 
   BufferedOverflowTaskQueue() : _buf_empty(true) {};
 
@@ -49,6 +51,10 @@ public:
   // Attempt to pop from the queue. Returns true on success.
   inline bool pop(E &t);
 
+  // Attempt to pop up to "limit" tasks into the "tasks" array.
+  // Returns the number of tasks popped, zero when the queue is empty.
+  inline uint pop_batch(E* tasks, uint limit);
+
   inline void clear();
 
   inline bool is_empty()        const {
@@ -42,6 +42,15 @@ bool BufferedOverflowTaskQueue<E, F, N>::pop(E &t) {
   return taskqueue_t::pop_overflow(t);
 }
 
+template <class E, MEMFLAGS F, unsigned int N>
+uint BufferedOverflowTaskQueue<E, F, N>::pop_batch(E* tasks, uint limit) {
+  uint n = 0;
+  while (n < limit && pop(tasks[n])) {
+    n++;
+  }
+  return n;
+}
+
 template <class E, MEMFLAGS F, unsigned int N>
 inline bool BufferedOverflowTaskQueue<E, F, N>::push(E t) {
   if (_buf_empty) {
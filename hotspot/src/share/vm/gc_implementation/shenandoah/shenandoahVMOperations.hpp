@@ -39,6 +39,7 @@
 class VM_ShenandoahOperation : public VM_Operation {
 public:
   VM_ShenandoahOperation() {};
+  virtual LatencyClass latency_class() const { return _latency_batch; }
 };
 
 class VM_ShenandoahReferenceOperation : public VM_ShenandoahOperation {
@@ -464,6 +464,8 @@ private:
   ShenandoahHeap *_heap;
   ShenandoahLivenessData* _ld;
   MarkBitMap* _bitmap;
+  size_t _sample;
+  size_t _sample_cursor;
   volatile jint  _claimed;
   volatile jlong _processed;
 
@@ -471,13 +473,16 @@ public:
   ShenandoahVerifierMarkedRegionTask(MarkBitMap* bitmap,
                                      ShenandoahLivenessData* ld,
                                      const char* label,
-                                     ShenandoahVerifier::VerifyOptions options) :
+                                     ShenandoahVerifier::VerifyOptions options,
+                                     size_t sample, size_t sample_cursor) :
           AbstractGangTask("Shenandoah Parallel Verifier Marked Region"),
           _label(label),
           _options(options),
           _heap(ShenandoahHeap::heap()),
           _bitmap(bitmap),
           _ld(ld),
+          _sample(sample),
+          _sample_cursor(sample_cursor),
           _claimed(0),
           _processed(0) {};
 
@@ -494,6 +499,11 @@ public:
     while (true) {
       size_t v = (size_t) (Atomic::add(1, &_claimed) - 1);
       if (v < _heap->num_regions()) {
+        // In sampled mode, walk only every Nth region, with the start
+        // rotated between passes so coverage completes every N passes.
+        if (_sample > 1 && ((v + _sample_cursor) % _sample) != 0) {
+          continue;
+        }
         ShenandoahHeapRegion* r = _heap->get_region(v);
         if (!r->is_humongous() && !r->is_trash()) {
           work_regular(r, stack, cl);
@@ -687,7 +697,8 @@ void ShenandoahVerifier::verify_at_safepoint(const char *label,
   _verification_bit_map->clear();
 
   // Allocate temporary array for storing liveness data
-  ShenandoahLivenessData* ld = NEW_C_HEAP_ARRAY(ShenandoahLivenessData, _heap->num_regions(), mtGC);
+  ShenandoahScratchMark scratch_mark(&_scratch);
+  ShenandoahLivenessData* ld = _scratch.allocate_array<ShenandoahLivenessData>(_heap->num_regions());
   Copy::fill_to_bytes((void*)ld, _heap->num_regions()*sizeof(ShenandoahLivenessData), 0);
 
   const VerifyOptions& options = ShenandoahVerifier::VerifyOptions(forwarded, marked, cset, liveness, regions, gcstate);
@@ -711,9 +722,15 @@ void ShenandoahVerifier::verify_at_safepoint(const char *label,
   // version
 
   size_t count_marked = 0;
+  size_t sample = ShenandoahVerifyRegionSampling;
   if (ShenandoahVerifyLevel >= 4 && marked == _verify_marked_complete) {
     guarantee(_heap->marking_context()->is_complete(), "Marking context should be complete");
-    ShenandoahVerifierMarkedRegionTask task(_verification_bit_map, ld, label, options);
+    size_t sample_cursor = 0;
+    if (sample > 1) {
+      sample_cursor = _sample_cursor;
+      _sample_cursor = (_sample_cursor + 1) % sample;
+    }
+    ShenandoahVerifierMarkedRegionTask task(_verification_bit_map, ld, label, options, sample, sample_cursor);
     _heap->workers()->run_task(&task);
     count_marked = task.processed();
   } else {
@@ -721,9 +738,10 @@ void ShenandoahVerifier::verify_at_safepoint(const char *label,
   }
 
   // Step 4. Verify accumulated liveness data, if needed. Only reliable if verification level includes
-  // marked objects.
+  // marked objects. Region sampling leaves the liveness data incomplete, so the cross-check is
+  // skipped in sampled mode.
 
-  if (ShenandoahVerifyLevel >= 4 && marked == _verify_marked_complete && liveness == _verify_liveness_complete) {
+  if (ShenandoahVerifyLevel >= 4 && marked == _verify_marked_complete && liveness == _verify_liveness_complete && sample <= 1) {
     for (size_t i = 0; i < _heap->num_regions(); i++) {
       ShenandoahHeapRegion* r = _heap->get_region(i);
 
@@ -750,10 +768,14 @@ void ShenandoahVerifier::verify_at_safepoint(const char *label,
     }
   }
 
-  log_info(gc)("Verify %s, Level " INTX_FORMAT " (" SIZE_FORMAT " reachable, " SIZE_FORMAT " marked)",
-               label, ShenandoahVerifyLevel, count_reachable, count_marked);
+  if (sample > 1) {
+    log_info(gc)("Verify %s, Level " INTX_FORMAT " (" SIZE_FORMAT " reachable, " SIZE_FORMAT " marked, sampled 1/" SIZE_FORMAT " regions)",
+                 label, ShenandoahVerifyLevel, count_reachable, count_marked, sample);
+  } else {
+    log_info(gc)("Verify %s, Level " INTX_FORMAT " (" SIZE_FORMAT " reachable, " SIZE_FORMAT " marked)",
+                 label, ShenandoahVerifyLevel, count_reachable, count_marked);
+  }
 
-  FREE_C_HEAP_ARRAY(ShenandoahLivenessData, ld, mtGC);
 }
 
 void ShenandoahVerifier::verify_generic(VerifyOption vo) {
@@ -26,6 +26,7 @@
 
 #include "gc_implementation/shared/markBitMap.hpp"
 #include "gc_implementation/shenandoah/shenandoahRootVerifier.hpp"
+#include "gc_implementation/shenandoah/shenandoahScratchSpace.hpp"
 #include "oops/oopsHierarchy.hpp"
 #include "memory/allocation.hpp"
 #include "utilities/stack.hpp"
@@ -61,6 +62,13 @@ class ShenandoahVerifier : public CHeapObj<mtGC> {
 private:
   ShenandoahHeap* _heap;
   MarkBitMap* _verification_bit_map;
+
+  // Rotating start offset for ShenandoahVerifyRegionSampling, advanced on
+  // every verification pass. Only touched at safepoints.
+  size_t _sample_cursor;
+
+  // Reusable backing for the per-verification liveness array.
+  ShenandoahScratchSpace _scratch;
 public:
   typedef enum {
     // Disable marked objects verification.
@@ -168,7 +176,7 @@ private:
 
 public:
   ShenandoahVerifier(ShenandoahHeap* heap, MarkBitMap* verification_bitmap) :
-          _heap(heap), _verification_bit_map(verification_bitmap) {};
+          _heap(heap), _verification_bit_map(verification_bitmap), _sample_cursor(0) {};
 
   void verify_before_concmark();
   void verify_after_concmark();
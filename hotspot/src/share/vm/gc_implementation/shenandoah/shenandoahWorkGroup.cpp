@@ -26,6 +26,31 @@
 #include "gc_implementation/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahWorkGroup.hpp"
 #include "gc_implementation/shenandoah/shenandoahLogging.hpp"
+#include "runtime/os.hpp"
+
+void ShenandoahGangWorker::initialize() {
+  GangWorker::initialize();
+  if (UseNUMA && os::numa_get_groups_num() > 1) {
+    // Distribute workers over the nodes the same way the heap regions are
+    // interleaved, so every node gets both local workers and local regions.
+    // Binding is best effort; an unbound worker just loses the preference.
+    os::numa_bind_thread_to_node((int)(id() % os::numa_get_groups_num()));
+  }
+}
+
+ShenandoahWorkGang::ShenandoahWorkGang(const char* name, uint workers,
+                                       bool are_GC_task_threads,
+                                       bool are_ConcurrentGC_threads) :
+  FlexibleWorkGang(name, workers, are_GC_task_threads, are_ConcurrentGC_threads) {
+  _scratch = NEW_C_HEAP_ARRAY(ShenandoahScratchSpace*, workers + 1, mtGC);
+  for (uint i = 0; i <= workers; i++) {
+    _scratch[i] = new ShenandoahScratchSpace();
+  }
+}
+
+GangWorker* ShenandoahWorkGang::allocate_worker(uint which) {
+  return new ShenandoahGangWorker(this, which);
+}
 
 ShenandoahWorkerScope::ShenandoahWorkerScope(ShenandoahWorkGang* workers, uint nworkers, const char* msg, bool check) :
   _n_workers(nworkers),
@@ -24,6 +24,7 @@
 #ifndef SHARE_VM_GC_SHENANDOAH_SHENANDOAH_WORKGROUP_HPP
 #define SHARE_VM_GC_SHENANDOAH_SHENANDOAH_WORKGROUP_HPP
 
+#include "gc_implementation/shenandoah/shenandoahScratchSpace.hpp"
 #include "gc_implementation/shenandoah/shenandoahTaskqueue.hpp"
 #include "utilities/workgroup.hpp"
 #include "memory/allocation.hpp"
@@ -50,12 +51,37 @@ public:
   ~ShenandoahPushWorkerScope();
 };
 
+// Gang worker that pins itself to a NUMA node at startup. Workers spread
+// over the nodes round-robin, matching the round-robin region interleaving,
+// so node-local work claims (see ShenandoahCollectionSet) find their share.
+class ShenandoahGangWorker : public GangWorker {
+public:
+  ShenandoahGangWorker(AbstractWorkGang* gang, uint id) : GangWorker(gang, id) {}
+protected:
+  virtual void initialize();
+};
+
 class ShenandoahWorkGang : public FlexibleWorkGang {
+private:
+  // Per-worker reusable scratch spaces, plus one for the coordinating thread.
+  ShenandoahScratchSpace** _scratch;
+
 public:
   ShenandoahWorkGang(const char* name, uint workers,
                    bool are_GC_task_threads,
-                   bool are_ConcurrentGC_threads) :
-    FlexibleWorkGang(name, workers, are_GC_task_threads, are_ConcurrentGC_threads) {
+                   bool are_ConcurrentGC_threads);
+
+  virtual GangWorker* allocate_worker(uint which);
+
+  // Reusable scratch for temporary phase allocations, see
+  // ShenandoahScratchSpace. Workers index by their own id; the thread
+  // coordinating a phase (VM or control thread) uses the extra slot.
+  ShenandoahScratchSpace* scratch_space(uint worker_id) const {
+    assert(worker_id <= total_workers(), "sanity");
+    return _scratch[worker_id];
+  }
+  ShenandoahScratchSpace* coordinator_scratch() const {
+    return _scratch[total_workers()];
   }
 
   // Hide FlexibleWorkGang's implementation, avoid _active_workers == _total_workers
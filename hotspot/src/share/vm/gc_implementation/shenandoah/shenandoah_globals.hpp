@@ -58,12 +58,25 @@
           "deemed humongous. Value is in  percents of heap region size. "   \
           "This also caps the maximum TLAB size.")                          \
                                                                             \
+  diagnostic(bool, ShenandoahHumongousBestFit, true,                        \
+          "Allocate humongous objects from the smallest contiguous run "    \
+          "of free regions that fits, instead of the first one. Keeps "     \
+          "large runs intact under humongous churn.")                       \
+                                                                            \
+  experimental(uintx, ShenandoahHumongousReserve, 0,                        \
+          "Percent of heap regions, taken from the low end of the heap, "   \
+          "preferred for humongous allocations. Regular allocations "       \
+          "prefer the remaining regions, so humongous churn does not "      \
+          "fragment the small-object space. Zero disables the partition.")  \
+                                                                            \
   product(ccstr, ShenandoahGCMode, "satb",                                  \
           "GC mode to use.  Among other things, this defines which "        \
           "barriers are in in use. Possible values are:"                    \
           " satb - snapshot-at-the-beginning concurrent GC (three pass mark-evac-update);"  \
           " iu - incremental-update concurrent GC (three pass mark-evac-update);"  \
-          " passive - stop the world GC only (either degenerated or full)") \
+          " passive - stop the world GC only (either degenerated or full);" \
+          " generational - experimental SATB mode with region ages and "    \
+          "young-biased collection set selection")                          \
                                                                             \
   product(ccstr, ShenandoahGCHeuristics, "adaptive",                        \
           "GC heuristics to use. This fine-tunes the GC mode selected, "    \
@@ -96,6 +109,16 @@
           "garbage. This also affects how much internal fragmentation the " \
           "collector accepts. In percents of heap region size.")            \
                                                                             \
+  experimental(uintx, ShenandoahTenuringThreshold, 7,                       \
+          "In generational mode, how many GC cycles a live region should "  \
+          "survive before it is deemed old. Old regions are normally not "  \
+          "taken for collection, see ShenandoahOldGarbageThreshold.")       \
+                                                                            \
+  experimental(uintx, ShenandoahOldGarbageThreshold, 75,                    \
+          "In generational mode, how much garbage an old region has to "    \
+          "contain before it would be taken for collection, overriding "    \
+          "its age. In percents of heap region size.")                      \
+                                                                            \
   experimental(uintx, ShenandoahInitFreeThreshold, 70,                      \
           "How much heap should be free before some heuristics trigger the "\
           "initial (learning) cycles. Affects cycle frequency on startup "  \
@@ -140,6 +163,14 @@
           "other cleanup policy. This minimizes footprint at expense of"    \
           "more soft reference churn in applications.")                     \
                                                                             \
+  experimental(bool, ShenandoahPressureSoftRefs, false,                     \
+          "Clear soft references by age against the free space left in "    \
+          "the free set at the start of each cycle, instead of the "        \
+          "occupancy snapshot from the previous collection. Successive "    \
+          "cycles then clear progressively younger references as free "     \
+          "space shrinks, draining caches smoothly instead of all at "      \
+          "once on the full-GC path.")                                      \
+                                                                            \
   experimental(bool, ShenandoahUncommit, true,                              \
           "Allow to uncommit memory under unused regions and metadata. "    \
           "This optimizes footprint at expense of allocation latency in "   \
@@ -154,6 +185,18 @@
           "milliseconds. Setting this delay to 0 effectively uncommits "    \
           "regions almost immediately after they become unused.")           \
                                                                             \
+  experimental(uintx, ShenandoahUncommitBatch, 128,                         \
+          "Maximum number of contiguous regions to uncommit with a single " \
+          "syscall. Larger batches issue fewer syscalls on large heaps, "   \
+          "at expense of holding the heap lock longer on each batch.")      \
+                                                                            \
+  experimental(uintx, ShenandoahUncommitTimeBudget, 25,                     \
+          "Time budget, in milliseconds, for a single concurrent uncommit " \
+          "pass. Regions that do not fit the budget are uncommitted on "    \
+          "later passes. Limits the stretches of uncommit syscall "         \
+          "activity competing with application threads. Zero means "        \
+          "unbounded.")                                                     \
+                                                                            \
   experimental(bool, ShenandoahRegionSampling, false,                       \
           "Provide heap region sampling data via jvmstat.")                 \
                                                                             \
@@ -193,9 +236,35 @@
           " 3 = previous level, plus all reachable objects; "               \
           " 4 = previous level, plus all marked objects")                   \
                                                                             \
+  diagnostic(uintx, ShenandoahVerifyRegionSampling, 0,                      \
+          "Verify the marked objects of only every Nth region per pass, "   \
+          "rotating the starting region between passes so all regions are " \
+          "covered every N passes. Makes level 4 verification cheap "       \
+          "enough for always-on canary use. 0 or 1 verifies all regions. "  \
+          "Disables the per-region liveness cross-check, which needs a "    \
+          "full walk.")                                                     \
+                                                                            \
   diagnostic(bool, ShenandoahElasticTLAB, true,                             \
           "Use Elastic TLABs with Shenandoah")                              \
                                                                             \
+  diagnostic(bool, ShenandoahAllocSiteSampling, false,                      \
+          "Sample mutator allocations and attribute them to allocation "    \
+          "sites and heap regions. Useful for hunting slow heap growth. "   \
+          "Dump the profile with the GC.shenandoah_alloc_sites jcmd. "      \
+          "Imposes a small overhead on TLAB refills and shared "            \
+          "allocations.")                                                   \
+                                                                            \
+  diagnostic(uintx, ShenandoahAllocSiteSampleInterval, 512 * K,             \
+          "How many allocated bytes between two allocation site samples. "  \
+          "Lower values sharpen the profile, at a higher sampling "         \
+          "overhead. Effective with +ShenandoahAllocSiteSampling.")         \
+                                                                            \
+  diagnostic(bool, ShenandoahEvacTracking, false,                           \
+          "Track evacuation throughput per heap region and per worker. "    \
+          "Useful for hunting evacuation bandwidth problems. Dump the "     \
+          "statistics with the GC.shenandoah_evac_stats jcmd. Imposes a "   \
+          "small overhead on every evacuated object.")                      \
+                                                                            \
   experimental(uintx, ShenandoahEvacReserve, 5,                             \
           "How much of heap to reserve for evacuations. Larger values make "\
           "GC evacuate more live objects on every cycle, while leaving "    \
@@ -208,6 +277,30 @@
           "evacuation conflicts, at expense of evacuating less on each "    \
           "GC cycle.")                                                      \
                                                                             \
+  experimental(bool, ShenandoahAdaptiveEvacReserve, true,                   \
+          "Let adaptive heuristics learn actual evacuation volumes and "    \
+          "trim the evacuation reserve below ShenandoahEvacReserve when "   \
+          "the workload does not use it. Keeps less free headroom away "    \
+          "from the application when little evacuation work is pending.")   \
+                                                                            \
+  experimental(double, ShenandoahEvacReserveConfidence, 1.5,                \
+          "Confidence margin for the learned evacuation reserve, in "       \
+          "standard deviations above the average observed evacuation "      \
+          "volume. Larger values keep more reserve, and are more "          \
+          "resilient against workload shifts.")                             \
+                                                                            \
+  experimental(bool, ShenandoahPipelinedUpdateRefs, false,                  \
+          "Let evacuation workers that ran out of collection set regions "  \
+          "start updating heap references right away, overlapping with "    \
+          "the remaining evacuation. Shortens the combined concurrent "     \
+          "window at the expense of less predictable evacuation times.")    \
+                                                                            \
+  experimental(bool, ShenandoahUpdateRefsCardSummaries, false,              \
+          "Record card-granular summaries of where reference slots of "     \
+          "live objects are while marking, and let update-refs skip the "   \
+          "clean cards. Helps heaps dominated by old regions with few "     \
+          "references, at the cost of some marking throughput.")            \
+                                                                            \
   experimental(bool, ShenandoahEvacReserveOverflow, true,                   \
           "Allow evacuations to overflow the reserved space. Enabling it "  \
           "will make evacuations more resilient when evacuation "           \
@@ -251,6 +344,11 @@
           "much space is not available, next recovery step would be "       \
           "triggered.")                                                     \
                                                                             \
+  diagnostic(bool, ShenandoahConcurrentClassPurge, true,                    \
+          "Defer freeing the metadata of unloaded classes from the final "  \
+          "mark pause to the concurrent cleanup phase. Class unloading "    \
+          "decisions are still taken at the pause.")                        \
+                                                                            \
   diagnostic(bool, ShenandoahDegeneratedGC, true,                           \
           "Enable Degenerated GC as the graceful degradation step. "        \
           "Disabling this option leads to degradation to Full GC instead. " \
@@ -267,6 +365,12 @@
           "Many heuristics automatically enable this. This option is "      \
           "similar to global ExplicitGCInvokesConcurrent.")                 \
                                                                             \
+  diagnostic(bool, ShenandoahDegenCSetRetirement, true,                     \
+          "On degenerated GC, retire collection set regions that have no "  \
+          "evacuated objects yet, instead of re-evacuating them under "     \
+          "stop-the-world. Retired regions are collected on the next "      \
+          "cycle.")                                                         \
+                                                                            \
   diagnostic(bool, ShenandoahHumongousMoves, true,                          \
           "Allow moving humongous regions. This makes GC more resistant "   \
           "to external fragmentation that may otherwise fail other "        \
@@ -283,6 +387,11 @@
           "How many objects to prefetch ahead when traversing mark bitmaps."\
           "Set to 0 to disable prefetching.")                               \
                                                                             \
+  experimental(uintx, ShenandoahMarkQueuePrefetch, 16,                      \
+          "How many tasks to pop in one batch in the marking loops, "       \
+          "prefetching the object headers before visiting the batch. "      \
+          "Set to 0 to disable batching and prefetching.")                  \
+                                                                            \
   experimental(uintx, ShenandoahMarkLoopStride, 1000,                       \
           "How many items to process during one marking iteration before "  \
           "checking for cancellation, yielding, etc. Larger values improve "\
@@ -330,6 +439,11 @@
           "Turn it off for maximum compatibility with reflection or JNI "   \
           "code that manipulates final fields.")                            \
                                                                             \
+  diagnostic(bool, ShenandoahCsetLoopUnswitching, true,                     \
+          "Allow C2 to unswitch safepoint-free loops on loop-invariant "    \
+          "collection set membership tests, removing barrier mid-path "     \
+          "work from the loop body.")                                       \
+                                                                            \
   develop(bool, ShenandoahVerifyOptoBarriers, false,                        \
           "Verify no missing barriers in C2.")                              \
                                                                             \
@@ -345,6 +459,15 @@
   product(bool, ShenandoahLogWarning, false,                                \
           "Turns on logging in Shenandoah at warning level. ")              \
                                                                             \
+  product(bool, ShenandoahAsyncLogging, false,                              \
+          "Route Shenandoah log messages through an in-memory ring that "   \
+          "is flushed to the GC log by the watcher thread, keeping "        \
+          "formatted file I/O off GC threads. Unflushed messages are "      \
+          "printed in the hs_err event log on crash.")                      \
+                                                                            \
+  product(uintx, ShenandoahAsyncLoggingBufferEntries, 512,                  \
+          "Number of messages retained by the asynchronous log ring")       \
+                                                                            \
   diagnostic(bool, ShenandoahSelfFixing, true,                              \
           "Fix references with load reference barrier. Disabling this "     \
           "might degrade performance.")                                     \
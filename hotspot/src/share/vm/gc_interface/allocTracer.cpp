@@ -27,13 +27,59 @@
 #include "gc_interface/allocTracer.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "runtime/handles.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
 #include "utilities/globalDefinitions.hpp"
 #if INCLUDE_JFR
 #include "jfr/support/jfrAllocationTracer.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include <math.h>
 #endif
 
+#if INCLUDE_JFR
+
+// Draw the next sampling countdown from the exponential distribution around
+// the requested mean, so that every allocated byte is picked with the same
+// probability: the samples stay unbiased even when allocation sizes align
+// with TLAB boundaries.
+static u8 next_sample_interval(size_t mean) {
+  // os::random() is uniform over [0, 2^31); shift into (0, 1].
+  double u = ((double)os::random() + 1.0) / ((double)max_jint + 1.0);
+  return (u8)(-log(u) * (double)mean) + 1;
+}
+
+// Piggybacks on the TLAB slow path: charged with the retired buffer size at
+// refills and with the object size for outside-TLAB allocations, so the
+// per-allocation fast path stays untouched.
+static void send_allocation_sample(KlassHandle klass, size_t allocated_bytes, Thread* thread) {
+  EventObjectAllocationSample event;
+  if (!event.should_commit()) {
+    return;
+  }
+  JfrThreadLocal* tl = thread->jfr_thread_local();
+  u8 accumulated = tl->alloc_sample_accumulated() + allocated_bytes;
+  if (tl->alloc_sample_interval() == 0) {
+    // First slow path with the event enabled: arm the countdown only.
+    tl->set_alloc_sample_interval(next_sample_interval(ObjectAllocationSampleInterval));
+    tl->set_alloc_sample_accumulated(accumulated);
+    return;
+  }
+  if (accumulated < tl->alloc_sample_interval()) {
+    tl->set_alloc_sample_accumulated(accumulated);
+    return;
+  }
+  event.set_objectClass(klass());
+  event.set_weight(accumulated);
+  event.commit();
+  tl->set_alloc_sample_accumulated(0);
+  tl->set_alloc_sample_interval(next_sample_interval(ObjectAllocationSampleInterval));
+}
+
+#endif // INCLUDE_JFR
+
 void AllocTracer::send_allocation_outside_tlab_event(KlassHandle klass, HeapWord* obj, size_t alloc_size, Thread* thread) {
   JFR_ONLY(JfrAllocationTracer tracer(obj, alloc_size, thread);)
+  JFR_ONLY(send_allocation_sample(klass, alloc_size, thread);)
   EventObjectAllocationOutsideTLAB event;
   if (event.should_commit()) {
     event.set_objectClass(klass());
@@ -44,6 +90,7 @@ void AllocTracer::send_allocation_outside_tlab_event(KlassHandle klass, HeapWord
 
 void AllocTracer::send_allocation_in_new_tlab_event(KlassHandle klass, HeapWord* obj, size_t tlab_size, size_t alloc_size, Thread* thread) {
   JFR_ONLY(JfrAllocationTracer tracer(obj, alloc_size, thread);)
+  JFR_ONLY(send_allocation_sample(klass, tlab_size, thread);)
   EventObjectAllocationInNewTLAB event;
   if (event.should_commit()) {
     event.set_objectClass(klass());
@@ -273,6 +273,7 @@ HeapWord* CollectedHeap::allocate_from_tlab_slow(KlassHandle klass, Thread* thre
   // Discard tlab and allocate a new one.
   // To minimize fragmentation, the last TLAB may be smaller than the rest.
   size_t new_tlab_size = thread->tlab().compute_size(size);
+  size_t min_tlab_size = ThreadLocalAllocBuffer::compute_min_size(size);
 
   thread->tlab().clear_before_allocation();
 
@@ -280,15 +281,23 @@ HeapWord* CollectedHeap::allocate_from_tlab_slow(KlassHandle klass, Thread* thre
     return NULL;
   }
 
-  // Allocate a new TLAB...
-  HeapWord* obj = Universe::heap()->allocate_new_tlab(new_tlab_size);
+  // Allocate a new TLAB requesting new_tlab_size. Any size
+  // between min_tlab_size and new_tlab_size is accepted.
+  size_t actual_tlab_size = 0;
+  HeapWord* obj = Universe::heap()->allocate_new_tlab(min_tlab_size, new_tlab_size, &actual_tlab_size);
   if (obj == NULL) {
+    assert(actual_tlab_size == 0,
+           err_msg("Allocation failed, but actual size was updated. min: " SIZE_FORMAT ", desired: " SIZE_FORMAT ", actual " SIZE_FORMAT,
+                   min_tlab_size, new_tlab_size, actual_tlab_size));
     return NULL;
   }
+  assert(actual_tlab_size != 0,
+         err_msg("Allocation succeeded but actual size not updated. obj at: " PTR_FORMAT " min: " SIZE_FORMAT ", desired: " SIZE_FORMAT,
+                 p2i(obj), min_tlab_size, new_tlab_size));
 
   if (ZeroTLAB) {
     // ..and clear it.
-    Copy::zero_to_words(obj, new_tlab_size);
+    Copy::zero_to_words(obj, actual_tlab_size);
   } else {
     // ...and zap just allocated object.
 #ifdef ASSERT
@@ -296,10 +305,10 @@ HeapWord* CollectedHeap::allocate_from_tlab_slow(KlassHandle klass, Thread* thre
     // ensure that the returned space is not considered parsable by
     // any concurrent GC thread.
     size_t hdr_size = oopDesc::header_size();
-    Copy::fill_to_words(obj + hdr_size, new_tlab_size - hdr_size, badHeapWordVal);
+    Copy::fill_to_words(obj + hdr_size, actual_tlab_size - hdr_size, badHeapWordVal);
 #endif // ASSERT
   }
-  thread->tlab().fill(obj, obj + size, new_tlab_size);
+  thread->tlab().fill(obj, obj + size, actual_tlab_size);
   return obj;
 }
 
@@ -494,7 +503,7 @@ void CollectedHeap::post_initialize() {
   collector_policy()->post_heap_initialize();
 }
 
-HeapWord* CollectedHeap::allocate_new_tlab(size_t size) {
+HeapWord* CollectedHeap::allocate_new_tlab(size_t min_size, size_t requested_size, size_t* actual_size) {
   guarantee(false, "thread-local allocation buffers not supported");
   return NULL;
 }
@@ -127,7 +127,11 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   void pre_initialize();
 
   // Create a new tlab. All TLAB allocations must go through this.
-  virtual HeapWord* allocate_new_tlab(size_t size);
+  // Allocate a new TLAB of at least min_size and at most requested_size.
+  // The actual size of the TLAB is returned through actual_size. Heaps
+  // with discontiguous allocation areas may return less than requested_size
+  // to avoid refill failures at area boundaries.
+  virtual HeapWord* allocate_new_tlab(size_t min_size, size_t requested_size, size_t* actual_size);
 
   // Accumulate statistics on all tlabs.
   virtual void accumulate_statistics_all_tlabs();
@@ -529,6 +529,7 @@ void Bytecodes::initialize() {
   def(_fast_iload          , "fast_iload"          , "bi"   , NULL    , T_INT    ,  1, false, _iload);
   def(_fast_iload2         , "fast_iload2"         , "bi_i" , NULL    , T_INT    ,  2, false, _iload);
   def(_fast_icaload        , "fast_icaload"        , "bi_"  , NULL    , T_INT    ,  0, false, _iload);
+  def(_fast_iiadd          , "fast_iiadd"          , "bi_i_", NULL    , T_INT    ,  1, false, _iload);
 
   // Faster method invocation.
   def(_fast_invokevfinal   , "fast_invokevfinal"   , "bJJ"  , NULL    , T_ILLEGAL, -1, true, _invokevirtual   );
@@ -339,6 +339,12 @@ IRT_ENTRY(void, InterpreterRuntime::create_exception(JavaThread* thread, char* n
       note_trap(thread, Deoptimization::Reason_null_check, CHECK);
     }
   }
+  // hot throw sites get the preallocated stackless instance
+  oop fast_exception = SharedRuntime::fast_throw_exception(thread, s);
+  if (fast_exception != NULL) {
+    thread->set_vm_result(fast_exception);
+    return;
+  }
   // create exception
   Handle exception = Exceptions::new_exception(thread, s, message);
   thread->set_vm_result(exception());
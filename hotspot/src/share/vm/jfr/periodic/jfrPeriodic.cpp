@@ -536,9 +536,9 @@ TRACE_REQUEST_FUNC(CodeCacheConfiguration) {
   EventCodeCacheConfiguration event;
   event.set_initialSize(InitialCodeCacheSize);
   event.set_reservedSize(ReservedCodeCacheSize);
-  event.set_nonNMethodSize(0/*NonNMethodCodeHeapSize*/); // XXX
-  event.set_profiledSize(0/*ProfiledCodeHeapSize*/); // XXX
-  event.set_nonProfiledSize(0/*NonProfiledCodeHeapSize*/); // XXX
+  event.set_nonNMethodSize(NonNMethodCodeHeapSize);
+  event.set_profiledSize(ProfiledCodeHeapSize);
+  event.set_nonProfiledSize(NonProfiledCodeHeapSize);
   event.set_expansionSize(CodeCacheExpansionSize);
   event.set_minBlockLength(CodeCacheMinBlockLength);
   event.set_startAddress((u8)CodeCache::low_bound());
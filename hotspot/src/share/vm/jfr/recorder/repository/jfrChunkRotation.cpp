@@ -26,10 +26,13 @@
 #include "jfr/jni/jfrJavaSupport.hpp"
 #include "jfr/recorder/repository/jfrChunkRotation.hpp"
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
+#include "jfr/recorder/service/jfrOptionSet.hpp"
+#include "runtime/os.hpp"
 
 static jobject chunk_monitor = NULL;
 static intptr_t threshold = 0;
 static bool rotate = false;
+static jlong last_rotation_millis = 0;
 
 static jobject install_chunk_monitor(Thread* thread) {
   assert(chunk_monitor == NULL, "invariant");
@@ -55,6 +58,23 @@ static void notify() {
   JfrJavaSupport::notify_all(get_chunk_monitor(thread), thread);
 }
 
+// Streaming mode: finalize the current chunk once the configured interval
+// has elapsed, so consumers tailing the repository get self-contained
+// segments (each chunk carries its own constant pools) at a steady rate.
+static bool stream_interval_expired() {
+  const jlong interval = JfrOptionSet::stream_interval_millis();
+  if (interval <= 0) {
+    return false;
+  }
+  const jlong now = os::javaTimeMillis();
+  if (last_rotation_millis == 0) {
+    // first evaluation; measure the interval from here
+    last_rotation_millis = now;
+    return false;
+  }
+  return now - last_rotation_millis >= interval;
+}
+
 void JfrChunkRotation::evaluate(const JfrChunkWriter& writer) {
   assert(threshold > 0, "invariant");
   if (rotate) {
@@ -62,7 +82,8 @@ void JfrChunkRotation::evaluate(const JfrChunkWriter& writer) {
     return;
   }
   assert(!rotate, "invariant");
-  if (writer.size_written() > threshold) {
+  if (writer.size_written() > threshold ||
+      (stream_interval_expired() && writer.size_written() > 0)) {
     rotate = true;
     notify();
   }
@@ -74,6 +95,7 @@ bool JfrChunkRotation::should_rotate() {
 
 void JfrChunkRotation::on_rotation() {
   rotate = false;
+  last_rotation_millis = os::javaTimeMillis();
 }
 
 void JfrChunkRotation::set_threshold(intptr_t bytes) {
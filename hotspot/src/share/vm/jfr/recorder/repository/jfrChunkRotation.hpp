@@ -32,6 +32,9 @@ class JfrChunkWriter;
 //
 // Responsible for notifications about current chunk size now exceeding threshold.
 // This is a means to initiate a chunk rotation on the basis of the size written.
+// With a stream interval configured (see JfrOptionSet::stream_interval_millis()),
+// rotation is additionally requested on the basis of time, so that finished
+// chunks become available for consumption while the recording is running.
 //
 class JfrChunkRotation : AllStatic {
  public:
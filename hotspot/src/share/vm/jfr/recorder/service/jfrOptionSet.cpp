@@ -102,6 +102,14 @@ void JfrOptionSet::set_old_object_queue_size(jlong value) {
   _old_object_queue_size = value;
 }
 
+jlong JfrOptionSet::stream_interval_millis() {
+  return _stream_interval_millis;
+}
+
+void JfrOptionSet::set_stream_interval_millis(jlong value) {
+  _stream_interval_millis = value;
+}
+
 u4 JfrOptionSet::stackdepth() {
   return _stack_depth;
 }
@@ -170,6 +178,7 @@ const char* const default_sample_threads = "true";
 const char* const default_stack_depth = "64";
 const char* const default_retransform = "true";
 const char* const default_old_object_queue_size = "256";
+const char* const default_stream_interval = "0";
 DEBUG_ONLY(const char* const default_sample_protection = "false";)
 
 // statics
@@ -222,6 +231,14 @@ static DCmdArgument<jlong> _dcmd_old_object_queue_size (
   false,
   default_old_object_queue_size);
 
+static DCmdArgument<jlong> _dcmd_stream_interval(
+  "streaminterval",
+  "Interval (in milliseconds) at which the current chunk is finalized and a new chunk is started, "
+  "making finished chunks available for consumption while the recording is running (0 to disable)",
+  "JULONG",
+  false,
+  default_stream_interval);
+
 static DCmdArgument<bool> _dcmd_sample_threads(
   "samplethreads",
   "Thread sampling enable / disable (only sampling when event enabled and sampling enabled)",
@@ -265,6 +282,7 @@ static void register_parser_options() {
   _parser.add_dcmd_option(&_dcmd_sample_threads);
   _parser.add_dcmd_option(&_dcmd_retransform);
   _parser.add_dcmd_option(&_dcmd_old_object_queue_size);
+  _parser.add_dcmd_option(&_dcmd_stream_interval);
   DEBUG_ONLY(_parser.add_dcmd_option(&_dcmd_sample_protection);)
 }
 
@@ -303,6 +321,7 @@ jlong JfrOptionSet::_thread_buffer_size = 0;
 jlong JfrOptionSet::_memory_size = 0;
 jlong JfrOptionSet::_num_global_buffers = 0;
 jlong JfrOptionSet::_old_object_queue_size = 0;
+jlong JfrOptionSet::_stream_interval_millis = 0;
 u4 JfrOptionSet::_stack_depth = STACK_DEPTH_DEFAULT;
 jboolean JfrOptionSet::_sample_threads = JNI_TRUE;
 jboolean JfrOptionSet::_retransform = JNI_TRUE;
@@ -321,6 +340,7 @@ bool JfrOptionSet::initialize(Thread* thread) {
     set_retransform(_dcmd_retransform.value());
   }
   set_old_object_queue_size(_dcmd_old_object_queue_size.value());
+  set_stream_interval_millis(_dcmd_stream_interval.value());
   return adjust_memory_options();
 }
 
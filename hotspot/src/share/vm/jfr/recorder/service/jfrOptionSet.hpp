@@ -44,6 +44,7 @@ class JfrOptionSet : public AllStatic {
   static jlong _memory_size;
   static jlong _num_global_buffers;
   static jlong _old_object_queue_size;
+  static jlong _stream_interval_millis;
   static u4 _stack_depth;
   static jboolean _sample_threads;
   static jboolean _retransform;
@@ -66,6 +67,8 @@ class JfrOptionSet : public AllStatic {
   static void set_num_global_buffers(jlong value);
   static jint old_object_queue_size();
   static void set_old_object_queue_size(jlong value);
+  static jlong stream_interval_millis();
+  static void set_stream_interval_millis(jlong value);
   static u4 stackdepth();
   static void set_stackdepth(u4 depth);
   static bool sample_threads();
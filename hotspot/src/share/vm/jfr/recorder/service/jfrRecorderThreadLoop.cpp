@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
+#include "jfr/recorder/service/jfrOptionSet.hpp"
 #include "jfr/recorder/service/jfrPostBox.hpp"
 #include "jfr/recorder/service/jfrRecorderService.hpp"
 #include "jfr/recorder/service/jfrRecorderThread.hpp"
@@ -54,7 +55,14 @@ void recorderthread_entry(JavaThread* thread, Thread* unused) {
     // JFR MESSAGE LOOP PROCESSING - BEGIN
     while (!done) {
       if (post_box.is_empty()) {
-        JfrMsg_lock->wait(false);
+        const jlong stream_interval = JfrOptionSet::stream_interval_millis();
+        if (stream_interval > 0) {
+          // streaming mode; wake up at the stream interval to evaluate
+          // time-based chunk rotation even when no messages are posted
+          JfrMsg_lock->wait(false, (long)stream_interval);
+        } else {
+          JfrMsg_lock->wait(false);
+        }
       }
       msgs = post_box.collect();
       JfrMsg_lock->unlock();
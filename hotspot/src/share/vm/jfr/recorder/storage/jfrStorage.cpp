@@ -322,17 +322,26 @@ static bool full_buffer_registration(BufferPtr buffer, JfrStorageAgeMspace* age_
   assert(buffer != NULL, "invariant");
   assert(buffer->retired(), "invariant");
   assert(age_mspace != NULL, "invariant");
-  MutexLockerEx lock(JfrBuffer_lock, Mutex::_no_safepoint_check_flag);
-  JfrAgeNode* age_node = get_free_age_node(age_mspace, thread);
-  if (age_node == NULL) {
-    age_node = new_age_node(buffer, age_mspace, thread);
-    if (age_node == NULL) {
-      return false;
+  {
+    MutexLockerEx lock(JfrBuffer_lock, Mutex::_no_safepoint_check_flag);
+    JfrAgeNode* const age_node = get_free_age_node(age_mspace, thread);
+    if (age_node != NULL) {
+      assert(age_node->acquired_by_self(), "invariant");
+      age_node->set_retired_buffer(buffer);
+      control.increment_full();
+      return insert_full_age_node(age_node, age_mspace, thread);
     }
   }
+  // No free age node; allocate a transient one outside the lock. The
+  // allocation can hit the memory space slow path, and during an event spike
+  // every thread with a full buffer funnels through this registration.
+  JfrAgeNode* const age_node = new_age_node(buffer, age_mspace, thread);
+  if (age_node == NULL) {
+    return false;
+  }
   assert(age_node->acquired_by_self(), "invariant");
-  assert(age_node != NULL, "invariant");
   age_node->set_retired_buffer(buffer);
+  MutexLockerEx lock(JfrBuffer_lock, Mutex::_no_safepoint_check_flag);
   control.increment_full();
   return insert_full_age_node(age_node, age_mspace, thread);
 }
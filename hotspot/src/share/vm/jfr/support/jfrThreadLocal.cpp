@@ -53,6 +53,8 @@ JfrThreadLocal::JfrThreadLocal() :
   _cpu_time(0),
   _wallclock_time(os::javaTimeNanos()),
   _stack_trace_hash(0),
+  _alloc_sample_accumulated(0),
+  _alloc_sample_interval(0),
   _stackdepth(0),
   _entering_suspend_flag(0),
   _dead(false) {
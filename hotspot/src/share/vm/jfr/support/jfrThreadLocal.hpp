@@ -48,6 +48,8 @@ class JfrThreadLocal {
   jlong _cpu_time;
   jlong _wallclock_time;
   unsigned int _stack_trace_hash;
+  u8 _alloc_sample_accumulated;
+  u8 _alloc_sample_interval;
   mutable u4 _stackdepth;
   volatile jint _entering_suspend_flag;
   bool _dead;
@@ -196,6 +198,25 @@ class JfrThreadLocal {
     _wallclock_time = wallclock_time;
   }
 
+  // Allocation sampling state, see AllocTracer: bytes allocated by this
+  // thread since its last ObjectAllocationSample, and the randomized
+  // countdown until the next one (0 until the first sample is armed).
+  u8 alloc_sample_accumulated() const {
+    return _alloc_sample_accumulated;
+  }
+
+  void set_alloc_sample_accumulated(u8 bytes) {
+    _alloc_sample_accumulated = bytes;
+  }
+
+  u8 alloc_sample_interval() const {
+    return _alloc_sample_interval;
+  }
+
+  void set_alloc_sample_interval(u8 bytes) {
+    _alloc_sample_interval = bytes;
+  }
+
   traceid trace_id() const {
     return _trace_id;
   }
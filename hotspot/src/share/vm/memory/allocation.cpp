@@ -32,6 +32,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.inline.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/ostream.hpp"
@@ -286,6 +287,18 @@ class ChunkPool: public CHeapObj<mtInternal> {
     _num_chunks++;
   }
 
+  // Return a pre-linked list of n chunks in a single critical section;
+  // used for batch transfers from the per-thread caches.
+  void free_list(Chunk* head, Chunk* tail, size_t n) {
+    assert(head->length() + Chunk::aligned_overhead_size() == _size, "bad size");
+    ThreadCritical tc;
+    _num_used -= n;
+
+    tail->set_next(_first);
+    _first = head;
+    _num_chunks += n;
+  }
+
   // Prune the pool
   void free_all_but(size_t n) {
     Chunk* cur = NULL;
@@ -348,6 +361,120 @@ void chunkpool_init() {
   ChunkPool::initialize();
 }
 
+//--------------------------------------------------------------------------------------
+// ChunkPoolCache implementation
+
+static ChunkPool* pool_for_length(size_t length) {
+  switch (length) {
+   case Chunk::size:        return ChunkPool::large_pool();
+   case Chunk::medium_size: return ChunkPool::medium_pool();
+   case Chunk::init_size:   return ChunkPool::small_pool();
+   case Chunk::tiny_size:   return ChunkPool::tiny_pool();
+   default:                 return NULL;
+  }
+}
+
+int ChunkPoolCache::index_for(size_t length) {
+  switch (length) {
+   case Chunk::size:        return 0;
+   case Chunk::medium_size: return 1;
+   case Chunk::init_size:   return 2;
+   case Chunk::tiny_size:   return 3;
+   default:                 return -1;
+  }
+}
+
+void* ChunkPoolCache::get(size_t length) {
+  int index = index_for(length);
+  if (index < 0) return NULL;
+
+  Chunk* c = _first[index];
+  if (c != NULL) {
+    _first[index] = c->next();
+    _count[index]--;
+  }
+  return c;
+}
+
+bool ChunkPoolCache::put(Chunk* chunk) {
+  int index = index_for(chunk->length());
+  if (index < 0) return false;
+
+  if (_count[index] >= _capacity) {
+    // Cache is full: move the incoming chunk plus a batch of cached
+    // ones back to the global pool in one critical section.
+    Chunk* head = chunk;
+    Chunk* tail = chunk;
+    size_t n = 1;
+    for (int i = 0; i < _batch; i++) {
+      Chunk* c = _first[index];
+      _first[index] = c->next();
+      _count[index]--;
+      c->set_next(head);
+      head = c;
+      n++;
+    }
+    pool_for_length(chunk->length())->free_list(head, tail, n);
+    return true;
+  }
+
+  chunk->set_next(_first[index]);
+  _first[index] = chunk;
+  _count[index]++;
+  return true;
+}
+
+void* ChunkPoolCache::get_jumbo(size_t length) {
+  for (int i = 0; i < _jumbo_capacity; i++) {
+    Chunk* c = _jumbo[i];
+    if (c != NULL && c->length() == length) {
+      _jumbo[i] = NULL;
+      return c;
+    }
+  }
+  return NULL;
+}
+
+bool ChunkPoolCache::put_jumbo(Chunk* chunk) {
+  double now = os::elapsedTime();
+  int slot = -1;
+  for (int i = 0; i < _jumbo_capacity; i++) {
+    if (_jumbo[i] == NULL) {
+      if (slot < 0) slot = i;
+    } else if (now - _jumbo_freed_at[i] > (double)_jumbo_keep_secs) {
+      // Not reused in a while; the workload has moved on.
+      os::free(_jumbo[i], mtChunk);
+      _jumbo[i] = NULL;
+      if (slot < 0) slot = i;
+    }
+  }
+  if (slot < 0) return false;
+
+  _jumbo[slot] = chunk;
+  _jumbo_freed_at[slot] = now;
+  return true;
+}
+
+void ChunkPoolCache::flush() {
+  for (int index = 0; index < _num_size_classes; index++) {
+    Chunk* head = _first[index];
+    if (head == NULL) continue;
+
+    Chunk* tail = head;
+    while (tail->next() != NULL) tail = tail->next();
+    pool_for_length(head->length())->free_list(head, tail, (size_t)_count[index]);
+
+    _first[index] = NULL;
+    _count[index] = 0;
+  }
+  for (int i = 0; i < _jumbo_capacity; i++) {
+    if (_jumbo[i] != NULL) {
+      os::free(_jumbo[i], mtChunk);
+      _jumbo[i] = NULL;
+    }
+  }
+}
+
 void
 Chunk::clean_chunk_pool() {
   ChunkPool::clean();
@@ -378,12 +505,22 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
   // expect requested_size but if sizeof(Chunk) doesn't match isn't proper size we must align it.
   assert(ARENA_ALIGN(requested_size) == aligned_overhead_size(), "Bad alignment");
   size_t bytes = ARENA_ALIGN(requested_size) + length;
+  Thread* thread = ThreadLocalStorage::thread();
+  if (thread != NULL) {
+    thread->chunk_cache()->account_alloc(bytes);
+    void* p = thread->chunk_cache()->get(length);
+    if (p != NULL) return p;
+  }
   switch (length) {
    case Chunk::size:        return ChunkPool::large_pool()->allocate(bytes, alloc_failmode);
    case Chunk::medium_size: return ChunkPool::medium_pool()->allocate(bytes, alloc_failmode);
    case Chunk::init_size:   return ChunkPool::small_pool()->allocate(bytes, alloc_failmode);
    case Chunk::tiny_size:   return ChunkPool::tiny_pool()->allocate(bytes, alloc_failmode);
    default: {
+     if (thread != NULL && thread->is_Compiler_thread()) {
+       void* p = thread->chunk_cache()->get_jumbo(length);
+       if (p != NULL) return p;
+     }
      void* p = os::malloc(bytes, mtChunk, CALLER_PC);
      if (p == NULL && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
        vm_exit_out_of_memory(bytes, OOM_MALLOC_ERROR, "Chunk::new");
@@ -395,12 +532,24 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
 
 void Chunk::operator delete(void* p) {
   Chunk* c = (Chunk*)p;
+  Thread* thread = ThreadLocalStorage::thread();
+  if (thread != NULL) {
+    thread->chunk_cache()->account_free(c->length() + aligned_overhead_size());
+    if (thread->chunk_cache()->put(c)) {
+      return;
+    }
+  }
   switch (c->length()) {
    case Chunk::size:        ChunkPool::large_pool()->free(c); break;
    case Chunk::medium_size: ChunkPool::medium_pool()->free(c); break;
    case Chunk::init_size:   ChunkPool::small_pool()->free(c); break;
    case Chunk::tiny_size:   ChunkPool::tiny_pool()->free(c); break;
-   default:                 os::free(c, mtChunk);
+   default:
+     if (thread != NULL && thread->is_Compiler_thread() &&
+         thread->chunk_cache()->put_jumbo(c)) {
+       break;
+     }
+     os::free(c, mtChunk);
   }
 }
 
@@ -362,6 +362,88 @@ class Chunk: CHeapObj<mtChunk> {
   static void clean_chunk_pool();
 };
 
+//------------------------------ChunkPoolCache---------------------------------
+// A small per-thread cache in front of the global chunk pools, one
+// freelist per pooled chunk size. Hits avoid the pools' global critical
+// section entirely, which otherwise serializes arena churn across
+// compiler threads. Overflowing frees move a batch of chunks to the
+// global pool in a single critical section; the cache is flushed when
+// the owning thread is destroyed. Unattached threads fall through to
+// the global pools.
+class ChunkPoolCache VALUE_OBJ_CLASS_SPEC {
+ public:
+  enum {
+    _num_size_classes = 4,  // tiny, small, medium, large
+    _capacity         = 4,  // chunks kept per size class
+    _batch            = 2,  // chunks moved to the pool on overflow
+    _jumbo_capacity   = 4,  // oversized chunks kept (compiler threads only)
+    _jumbo_keep_secs  = 5   // idle time before a jumbo chunk decays
+  };
+
+ private:
+  Chunk* _first[_num_size_classes];
+  int    _count[_num_size_classes];
+
+  // Oversized chunks bypass the global pools, so C2 compilations that
+  // grow huge arenas and release them hammer the OS allocator on every
+  // compile. Compiler threads keep a few recently freed jumbo chunks
+  // for reuse on an exact length match; chunks left idle decay back to
+  // the OS.
+  Chunk* _jumbo[_jumbo_capacity];
+  double _jumbo_freed_at[_jumbo_capacity];
+
+  // Live arena bytes held by this thread, and the high-water mark since
+  // the last reset; lets CompileBroker report peak arena usage per
+  // compilation.
+  size_t _bytes_in_use;
+  size_t _peak_bytes;
+
+  // Map a chunk payload length to a size class index, or -1
+  static int index_for(size_t length);
+
+ public:
+  ChunkPoolCache() {
+    for (int i = 0; i < _num_size_classes; i++) {
+      _first[i] = NULL;
+      _count[i] = 0;
+    }
+    for (int i = 0; i < _jumbo_capacity; i++) {
+      _jumbo[i] = NULL;
+      _jumbo_freed_at[i] = 0.0;
+    }
+    _bytes_in_use = 0;
+    _peak_bytes   = 0;
+  }
+
+  // Take a cached chunk of the given payload length, or NULL
+  void* get(size_t length);
+
+  // Cache a freed chunk. Returns false if the chunk is not pooled here
+  // and should go back to the global pool.
+  bool put(Chunk* chunk);
+
+  // Take a cached jumbo chunk of exactly the given payload length, or NULL
+  void* get_jumbo(size_t length);
+
+  // Cache a freed oversized chunk; also decays idle entries. Returns
+  // false if no slot is free and the chunk should go back to the OS.
+  bool put_jumbo(Chunk* chunk);
+
+  // Return all cached chunks to the global pools resp. the OS
+  void flush();
+
+  // Arena usage accounting, maintained by Chunk's operator new/delete
+  void account_alloc(size_t bytes) {
+    _bytes_in_use += bytes;
+    if (_bytes_in_use > _peak_bytes) _peak_bytes = _bytes_in_use;
+  }
+  void account_free(size_t bytes) {
+    _bytes_in_use -= (bytes > _bytes_in_use) ? _bytes_in_use : bytes;
+  }
+  size_t peak_bytes() const { return _peak_bytes; }
+  void reset_peak()         { _peak_bytes = _bytes_in_use; }
+};
+
 //------------------------------Arena------------------------------------------
 // Fast allocation of memory
 class Arena : public CHeapObj<mtNone> {
@@ -131,14 +131,27 @@ public:
   virtual void read_ref_array(MemRegion mr) = 0;
   virtual void read_prim_array(MemRegion mr) = 0;
 
-  // Below length is the # array elements being written
-  virtual void write_ref_array_pre(oop* dst, int length,
-                                   bool dest_uninitialized = false) {}
-  virtual void write_ref_array_pre(narrowOop* dst, int length,
-                                   bool dest_uninitialized = false) {}
+  // Below length is the # array elements being written.
+  // (Like write_ref_field above, this is specialized for the common
+  // barrier kinds and falls back to the virtual "_work" functions.)
+  template <class T> inline void write_ref_array_pre(T* dst, int length,
+                                                     bool dest_uninitialized = false);
+
+  // Invoked before an array-to-array copy of "length" ref elements.
+  // Collectors that must process the source elements before they are
+  // read (Shenandoah) hook in here; for all other kinds this is a no-op.
+  // Returns true if the entire range has been pre-processed, in which
+  // case the caller may elide per-element pre-barriers for the copy.
+  template <class T> inline bool arraycopy_pre(T* src, T* dst, int length);
+protected:
+  virtual void write_ref_array_pre_work(      oop* dst, int length, bool dest_uninitialized) {}
+  virtual void write_ref_array_pre_work(narrowOop* dst, int length, bool dest_uninitialized) {}
+  virtual bool arraycopy_pre_work(      oop* src,       oop* dst, int length) { return false; }
+  virtual bool arraycopy_pre_work(narrowOop* src, narrowOop* dst, int length) { return false; }
+public:
   // Below count is the # array elements being written, starting
   // at the address "start", which may not necessarily be HeapWord-aligned
-  virtual void write_ref_array(HeapWord* start, size_t count);
+  inline void write_ref_array(HeapWord* start, size_t count);
 
   // Static versions, suitable for calling from generated code;
   // count is # array elements being written, starting with "start",
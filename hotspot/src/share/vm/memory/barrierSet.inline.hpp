@@ -48,6 +48,50 @@ void BarrierSet::write_ref_field(void* field, oop new_val, bool release) {
   }
 }
 
+template <class T> void BarrierSet::write_ref_array_pre(T* dst, int length, bool dest_uninitialized) {
+  if (kind() == CardTableModRef) {
+    // The plain card-table kinds have no pre-barrier.
+  } else {
+    write_ref_array_pre_work(dst, length, dest_uninitialized);
+  }
+}
+
+template <class T> bool BarrierSet::arraycopy_pre(T* src, T* dst, int length) {
+  // Only Shenandoah needs to look at the source elements before they are
+  // copied; let every other kind fall through without a virtual call.
+  if (kind() == BarrierSet::ShenandoahBarrierSet) {
+    return arraycopy_pre_work(src, dst, length);
+  }
+  return false;
+}
+
+// count is number of array elements being written
+void BarrierSet::write_ref_array(HeapWord* start, size_t count) {
+  assert(count <= (size_t)max_intx, "count too large");
+  HeapWord* end = (HeapWord*)((char*)start + (count*heapOopSize));
+  // In the case of compressed oops, start and end may potentially be misaligned;
+  // so we need to conservatively align the first downward (this is not
+  // strictly necessary for current uses, but a case of good hygiene and,
+  // if you will, aesthetics) and the second upward (this is essential for
+  // current uses) to a HeapWord boundary, so we mark all cards overlapping
+  // this write. If this evolves in the future to calling a
+  // logging barrier of narrow oop granularity, like the pre-barrier for G1
+  // (mentioned here merely by way of example), we will need to change this
+  // interface, so it is "exactly precise" (if i may be allowed the adverbial
+  // redundancy for emphasis) and does not include narrow oop slots not
+  // included in the original write interval.
+  HeapWord* aligned_start = (HeapWord*)align_size_down((uintptr_t)start, HeapWordSize);
+  HeapWord* aligned_end   = (HeapWord*)align_size_up  ((uintptr_t)end,   HeapWordSize);
+  // If compressed oops were not being used, these should already be aligned
+  assert(UseCompressedOops || (aligned_start == start && aligned_end == end),
+         "Expected heap word alignment of start and end");
+  if (kind() == CardTableModRef) {
+    ((CardTableModRefBS*)this)->inline_write_ref_array(MemRegion(aligned_start, aligned_end));
+  } else {
+    write_ref_array_work(MemRegion(aligned_start, aligned_end));
+  }
+}
+
 void BarrierSet::write_region(MemRegion mr) {
   if (kind() == CardTableModRef) {
     ((CardTableModRefBS*)this)->inline_write_region(mr);
@@ -31,6 +31,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/os.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/macros.hpp"
 #if INCLUDE_ALL_GCS
 #include "gc_implementation/g1/concurrentMark.hpp"
@@ -214,7 +215,22 @@ void ClearNoncleanCardWrapper::do_MemRegion(MemRegion mr) {
 
       // fast forward through potential continuous whole-word range of clean cards beginning at a word-boundary
       if (is_word_aligned(cur_entry)) {
+        const intx scan_dist = PrefetchScanIntervalInBytes;
         jbyte* cur_row = cur_entry - BytesPerWord;
+        // Examine four words of cards per iteration while there is room.
+        // Clean cards are all-ones, so the conjunction of the rows is
+        // clean_card_row() exactly when every card in them is clean.  The
+        // scan runs right to left, so prefetch behind the cursor.
+        while (cur_row - 3 * BytesPerWord >= limit) {
+          if (scan_dist > 0) {
+            Prefetch::read(cur_row, -scan_dist);
+          }
+          const intptr_t* row = (const intptr_t*)(cur_row - 3 * BytesPerWord);
+          if ((row[0] & row[1] & row[2] & row[3]) != CardTableRS::clean_card_row()) {
+            break;
+          }
+          cur_row -= 4 * BytesPerWord;
+        }
         while (cur_row >= limit && *((intptr_t*)cur_row) ==  CardTableRS::clean_card_row()) {
           cur_row -= BytesPerWord;
         }
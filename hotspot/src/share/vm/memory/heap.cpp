@@ -35,7 +35,9 @@ size_t CodeHeap::header_size() {
 
 // Implementation of Heap
 
-CodeHeap::CodeHeap() {
+CodeHeap::CodeHeap(const char* name, int code_blob_type) {
+  _name                         = name;
+  _code_blob_type               = code_blob_type;
   _number_of_committed_segments = 0;
   _number_of_reserved_segments  = 0;
   _segment_size                 = 0;
@@ -90,11 +92,6 @@ void CodeHeap::on_code_mapping(char* base, size_t size) {
 bool CodeHeap::reserve(size_t reserved_size, size_t committed_size,
                        size_t segment_size) {
   assert(reserved_size >= committed_size, "reserved < committed");
-  assert(segment_size >= sizeof(FreeBlock), "segment size is too small");
-  assert(is_power_of_2(segment_size), "segment_size must be a power of 2");
-
-  _segment_size      = segment_size;
-  _log2_segment_size = exact_log2(segment_size);
 
   // Reserve and initialize space for _memory.
   size_t page_size = os::vm_page_size();
@@ -105,13 +102,28 @@ bool CodeHeap::reserve(size_t reserved_size, size_t committed_size,
   const size_t granularity = os::vm_allocation_granularity();
   const size_t r_align = MAX2(page_size, granularity);
   const size_t r_size = align_size_up(reserved_size, r_align);
-  const size_t c_size = align_size_up(committed_size, page_size);
 
   const size_t rs_align = page_size == (size_t) os::vm_page_size() ? 0 :
     MAX2(page_size, granularity);
   ReservedCodeSpace rs(r_size, rs_align, rs_align > 0);
   os::trace_page_sizes("code heap", committed_size, reserved_size, page_size,
                        rs.base(), rs.size());
+  return reserve(rs, committed_size, segment_size);
+}
+
+
+bool CodeHeap::reserve(ReservedSpace rs, size_t committed_size,
+                       size_t segment_size) {
+  assert(rs.size() >= committed_size, "reserved < committed");
+  assert(segment_size >= sizeof(FreeBlock), "segment size is too small");
+  assert(is_power_of_2(segment_size), "segment_size must be a power of 2");
+
+  _segment_size      = segment_size;
+  _log2_segment_size = exact_log2(segment_size);
+
+  const size_t granularity = os::vm_allocation_granularity();
+  const size_t c_size = align_size_up(committed_size, os::vm_page_size());
+
   if (!_memory.initialize(rs, c_size)) {
     return false;
   }
@@ -25,6 +25,7 @@
 #ifndef SHARE_VM_MEMORY_HEAP_HPP
 #define SHARE_VM_MEMORY_HEAP_HPP
 
+#include "code/codeBlob.hpp"
 #include "memory/allocation.hpp"
 #include "runtime/virtualspace.hpp"
 
@@ -83,6 +84,9 @@ class CodeHeap : public CHeapObj<mtCode> {
   VirtualSpace _memory;                          // the memory holding the blocks
   VirtualSpace _segmap;                          // the memory holding the segment map
 
+  const char*  _name;                            // name of the code heap
+  int          _code_blob_type;                  // CodeBlobType it contains (CodeBlobType::All if unsegmented)
+
   size_t       _number_of_committed_segments;
   size_t       _number_of_reserved_segments;
   size_t       _segment_size;
@@ -122,10 +126,13 @@ class CodeHeap : public CHeapObj<mtCode> {
   void on_code_mapping(char* base, size_t size);
 
  public:
-  CodeHeap();
+  CodeHeap(const char* name = "CodeCache", int code_blob_type = CodeBlobType::All);
 
   // Heap extents
   bool  reserve(size_t reserved_size, size_t committed_size, size_t segment_size);
+  // Like the above, but carves the heap out of a pre-reserved space. Used
+  // by the segmented code cache where all heaps share one reservation.
+  bool  reserve(ReservedSpace rs, size_t committed_size, size_t segment_size);
   void  release();                               // releases all allocated memory
   bool  expand_by(size_t size);                  // expands commited memory by size
   void  shrink_by(size_t size);                  // shrinks commited memory by size
@@ -136,6 +143,9 @@ class CodeHeap : public CHeapObj<mtCode> {
   void  deallocate(void* p);                     // deallocates a block
 
   // Attributes
+  const char* name() const                       { return _name; }
+  int   code_blob_type() const                   { return _code_blob_type; }
+  bool  contains_nmethods() const                { return _code_blob_type != CodeBlobType::NonNMethod; }
   char* low_boundary() const                     { return _memory.low_boundary (); }
   char* high() const                             { return _memory.high(); }
   char* high_boundary() const                    { return _memory.high_boundary(); }
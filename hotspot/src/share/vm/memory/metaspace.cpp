@@ -503,6 +503,10 @@ class VirtualSpaceList : public CHeapObj<mtClass> {
   // Number of virtual spaces
   size_t _virtual_space_count;
 
+  // Nodes that were unlinked by purge() but whose unmapping was deferred
+  // to a concurrent phase. Shared by both lists, guarded by the expand lock.
+  static VirtualSpaceNode* _purged_nodes_list;
+
   ~VirtualSpaceList();
 
   VirtualSpaceNode* virtual_space_list() const { return _virtual_space_list; }
@@ -566,6 +570,9 @@ class VirtualSpaceList : public CHeapObj<mtClass> {
   // Unlink empty VirtualSpaceNodes and free it.
   void purge(ChunkManager* chunk_manager);
 
+  // Delete the nodes whose unmapping purge() deferred.
+  static void delete_purged_nodes();
+
   void print_on(outputStream* st) const;
 
   class VirtualSpaceListIterator : public StackObj {
@@ -1087,6 +1094,8 @@ void ChunkManager::remove_chunk(Metachunk* chunk) {
   dec_free_chunks_total(chunk->word_size());
 }
 
+VirtualSpaceNode* VirtualSpaceList::_purged_nodes_list = NULL;
+
 // Walk the list of VirtualSpaceNodes and delete
 // nodes with a 0 container_count.  Remove Metachunks in
 // the node from their respective freelists.
@@ -1118,7 +1127,16 @@ void VirtualSpaceList::purge(ChunkManager* chunk_manager) {
       dec_committed_words(vsl->committed_words());
       dec_virtual_space_count();
       purged_vsl = vsl;
-      delete vsl;
+      if (UseShenandoahGC) {
+        // Defer the unmapping to the concurrent cleanup phase. The node is
+        // unreachable now: it was unlinked at a safepoint, so no lock-free
+        // contains() walk can find it afterwards, and its next pointer can
+        // be reused to chain the pending list.
+        vsl->set_next(_purged_nodes_list);
+        _purged_nodes_list = vsl;
+      } else {
+        delete vsl;
+      }
     } else {
       prev_vsl = vsl;
     }
@@ -1135,6 +1153,22 @@ void VirtualSpaceList::purge(ChunkManager* chunk_manager) {
 #endif
 }
 
+void VirtualSpaceList::delete_purged_nodes() {
+  VirtualSpaceNode* list;
+  {
+    MutexLockerEx cl(SpaceManager::expand_lock(),
+                     Mutex::_no_safepoint_check_flag);
+    list = _purged_nodes_list;
+    _purged_nodes_list = NULL;
+  }
+  // Unmap outside the expand lock: the nodes were unlinked at a safepoint
+  // and are only reachable through the detached list.
+  while (list != NULL) {
+    VirtualSpaceNode* vsn = list;
+    list = vsn->next();
+    delete vsn;
+  }
+}
 
 // This function looks at the mmap regions in the metaspace without locking.
 // The chunks are added with store ordering and not deleted except for at
@@ -3790,6 +3824,10 @@ void Metaspace::purge() {
   }
 }
 
+void Metaspace::delete_purged_nodes() {
+  VirtualSpaceList::delete_purged_nodes();
+}
+
 void Metaspace::print_on(outputStream* out) const {
   // Print both class virtual space counts and metaspace.
   if (Verbose) {
@@ -252,6 +252,9 @@ class Metaspace : public CHeapObj<mtClass> {
   static void purge(MetadataType mdtype);
   static void purge();
 
+  // Unmap virtualspaces whose release purge() deferred (Shenandoah only)
+  static void delete_purged_nodes();
+
   static void report_metadata_oome(ClassLoaderData* loader_data, size_t word_size,
                                    MetaspaceObj::Type type, MetadataType mdtype, TRAPS);
 
@@ -785,6 +785,30 @@ void MetaspaceShared::preload_and_dump(TRAPS) {
   exit(0);
 }
 
+// Classlist entry for ClusterSharedClasses. The index keeps the sort
+// stable, so the classlist order is preserved within a package.
+struct SharedClassListEntry {
+  const char* _name;
+  int         _index;
+};
+
+static int compare_classlist_entries(SharedClassListEntry* a, SharedClassListEntry* b) {
+  const char* an = a->_name;
+  const char* bn = b->_name;
+  const char* ap = strrchr(an, '/');
+  const char* bp = strrchr(bn, '/');
+  size_t alen = (ap == NULL) ? 0 : (size_t)(ap - an);
+  size_t blen = (bp == NULL) ? 0 : (size_t)(bp - bn);
+  int cmp = strncmp(an, bn, MIN2(alen, blen));
+  if (cmp == 0 && alen != blen) {
+    cmp = (alen < blen) ? -1 : 1;
+  }
+  if (cmp == 0) {
+    cmp = a->_index - b->_index;
+  }
+  return cmp;
+}
+
 int MetaspaceShared::preload_and_dump(const char * class_list_path,
                                       GrowableArray<Klass*>* class_promote_order,
                                       TRAPS) {
@@ -793,6 +817,11 @@ int MetaspaceShared::preload_and_dump(const char * class_list_path,
   int class_count = 0;
 
   if (file != NULL) {
+    // No ResourceMark here: class_promote_order grows in the caller's
+    // resource scope while this function runs.
+    GrowableArray<SharedClassListEntry>* entries =
+            new GrowableArray<SharedClassListEntry>(1024);
+
     while ((fgets(class_name, sizeof class_name, file)) != NULL) {
       if (*class_name == '#') { // comment
         continue;
@@ -803,15 +832,35 @@ int MetaspaceShared::preload_and_dump(const char * class_list_path,
         class_name[name_len-1] = '\0';
       }
 
+      SharedClassListEntry entry;
+      char* copy = NEW_RESOURCE_ARRAY(char, strlen(class_name) + 1);
+      strcpy(copy, class_name);
+      entry._name = copy;
+      entry._index = entries->length();
+      entries->append(entry);
+    }
+    fclose(file);
+
+    if (ClusterSharedClasses) {
+      // Metadata is laid out in load order, so loading same-package classes
+      // back to back puts their Klass, vtable and cpCache allocations on the
+      // same archive pages. Superclasses resolve when their first subclass
+      // loads, which pulls each hierarchy together as well.
+      entries->sort(compare_classlist_entries);
+    }
+
+    for (int i = 0; i < entries->length(); i++) {
+      const char* name = entries->at(i)._name;
+
       // Got a class name - load it.
-      TempNewSymbol class_name_symbol = SymbolTable::new_permanent_symbol(class_name, THREAD);
+      TempNewSymbol class_name_symbol = SymbolTable::new_permanent_symbol(name, THREAD);
       guarantee(!HAS_PENDING_EXCEPTION, "Exception creating a symbol.");
       Klass* klass = SystemDictionary::resolve_or_null(class_name_symbol,
                                                          THREAD);
       CLEAR_PENDING_EXCEPTION;
       if (klass != NULL) {
         if (PrintSharedSpaces && Verbose && WizardMode) {
-          tty->print_cr("Shared spaces preloaded: %s", class_name);
+          tty->print_cr("Shared spaces preloaded: %s", name);
         }
 
         InstanceKlass* ik = InstanceKlass::cast(klass);
@@ -828,10 +877,9 @@ int MetaspaceShared::preload_and_dump(const char * class_list_path,
 
         class_count++;
       } else {
-        //tty->print_cr("Preload failed: %s", class_name);
+        //tty->print_cr("Preload failed: %s", name);
       }
     }
-    fclose(file);
   } else {
     char errmsg[JVM_MAXPATHLEN];
     os::lasterror(errmsg, JVM_MAXPATHLEN);
@@ -903,13 +903,15 @@ ReferenceProcessor::process_discovered_reflist(
   AbstractRefProcTaskExecutor* task_executor)
 {
   bool mt_processing = task_executor != NULL && _processing_is_mt;
-  // If discovery used MT and a dynamic number of GC threads, then
-  // the queues must be balanced for correctness if fewer than the
-  // maximum number of queues were used.  The number of queue used
-  // during discovery may be different than the number to be used
-  // for processing so don't depend of _num_q < _max_num_q as part
-  // of the test.
-  bool must_balance = _discovery_is_mt;
+  // If discovery used MT, the references may sit on any of the
+  // [0, _max_num_q) lists. The serial code below walks all of those
+  // lists, and MT processing covers one list per worker, so balancing
+  // is required for correctness only when processing runs with fewer
+  // active queues than there are discovered lists. Collectors that
+  // process with the full discovery degree skip the serial splicing
+  // of the discovered lists entirely.
+  bool must_balance = _discovery_is_mt &&
+                      mt_processing && (_num_q < _max_num_q);
 
   if ((mt_processing && ParallelRefProcBalancingEnabled) ||
       must_balance) {
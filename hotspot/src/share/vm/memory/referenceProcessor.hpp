@@ -26,6 +26,7 @@
 #define SHARE_VM_MEMORY_REFERENCEPROCESSOR_HPP
 
 #include "gc_implementation/shared/gcTrace.hpp"
+#include "memory/padded.hpp"
 #include "memory/referencePolicy.hpp"
 #include "memory/referenceProcessorStats.hpp"
 #include "memory/referenceType.hpp"
@@ -85,6 +86,11 @@ private:
   oop       _oop_head;
   narrowOop _compressed_head;
   size_t _len;
+  // The lists are sharded per discovery thread and written without
+  // synchronization (see get_discovered_list), but they live in one
+  // contiguous array, so without padding several threads' heads share a
+  // cache line and concurrent discovery degrades into false sharing.
+  DEFINE_PAD_MINUS_SIZE(0, DEFAULT_CACHE_LINE_SIZE, sizeof(oop) + sizeof(narrowOop) + sizeof(size_t));
 };
 
 // Iterator for the list of discovered references.
@@ -282,6 +288,14 @@ class ReferenceProcessor : public CHeapObj<mtGC> {
     return _current_soft_ref_policy;
   }
 
+  // Install a collector-supplied soft reference policy instead of the
+  // command-line default.
+  ReferencePolicy* setup_policy(ReferencePolicy* policy) {
+    _current_soft_ref_policy = policy;
+    _current_soft_ref_policy->setup();   // snapshot the policy threshold
+    return _current_soft_ref_policy;
+  }
+
   // Process references with a certain reachability level.
   size_t process_discovered_reflist(DiscoveredList               refs_lists[],
                                     ReferencePolicy*             policy,
@@ -23,6 +23,8 @@
  */
 
 #include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "memory/genCollectedHeap.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/threadLocalAllocBuffer.inline.hpp"
@@ -150,7 +152,13 @@ void ThreadLocalAllocBuffer::resize_all_tlabs() {
 void ThreadLocalAllocBuffer::resize() {
   // Compute the next tlab size using expected allocation amount
   assert(ResizeTLAB, "Should not call this otherwise");
-  size_t alloc = (size_t)(_allocation_fraction.average() *
+  // With burst sizing, pad the expected allocation fraction by the observed
+  // deviation, so a thread alternating bursty and idle phases gets a TLAB
+  // sized for its bursts rather than for its long-term average.
+  float alloc_frac = TLABBurstSizing ?
+          MIN2(1.0f, _allocation_fraction.padded_average()) :
+          _allocation_fraction.average();
+  size_t alloc = (size_t)(alloc_frac *
                           (Universe::heap()->tlab_capacity(myThread()) / HeapWordSize));
   size_t new_size = alloc / _target_refills;
 
@@ -162,8 +170,19 @@ void ThreadLocalAllocBuffer::resize() {
     gclog_or_tty->print("TLAB new size: thread: " INTPTR_FORMAT " [id: %2d]"
                         " refills %d  alloc: %8.6f desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT "\n",
                         myThread(), myThread()->osthread()->thread_id(),
-                        _target_refills, _allocation_fraction.average(), desired_size(), aligned_new_size);
+                        _target_refills, alloc_frac, desired_size(), aligned_new_size);
   }
+
+  EventTLABResize event;
+  if (event.should_commit()) {
+    event.set_thread(JFR_THREAD_ID(myThread()));
+    event.set_previousSize(desired_size() * HeapWordSize);
+    event.set_newSize(aligned_new_size * HeapWordSize);
+    event.set_allocationFraction(_allocation_fraction.average());
+    event.set_paddedAllocationFraction(_allocation_fraction.padded_average());
+    event.commit();
+  }
+
   set_desired_size(aligned_new_size);
   set_refill_waste_limit(initial_refill_waste_limit());
 }
@@ -56,7 +56,8 @@ private:
   unsigned  _gc_waste;
   unsigned  _slow_allocations;
 
-  AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
+  AdaptivePaddedAverage _allocation_fraction;    // fraction of eden allocated in tlabs,
+                                                 // with a running deviation for burst sizing
 
   bool _gclab;
   bool _initialized;
@@ -98,7 +99,7 @@ private:
   static GlobalTLABStats* global_stats() { return _global_stats; }
 
 public:
-  ThreadLocalAllocBuffer() : _allocation_fraction(TLABAllocationWeight), _allocated_before_last_gc(0), _initialized(false) {
+  ThreadLocalAllocBuffer() : _allocation_fraction(TLABAllocationWeight, TLABBurstPadding), _allocated_before_last_gc(0), _initialized(false) {
     // do nothing.  tlabs must be inited by initialize() calls
   }
 
@@ -148,6 +149,9 @@ public:
   // Otherwise return 0;
   inline size_t compute_size(size_t obj_size);
 
+  // The minimum size of a TLAB that can accommodate obj_size.
+  static inline size_t compute_min_size(size_t obj_size);
+
   // Record slow allocation
   inline void record_slow_allocation(size_t obj_size);
 
@@ -53,6 +53,11 @@ inline HeapWord* ThreadLocalAllocBuffer::allocate(size_t size) {
   return NULL;
 }
 
+inline size_t ThreadLocalAllocBuffer::compute_min_size(size_t obj_size) {
+  const size_t aligned_obj_size = align_object_size(obj_size);
+  return aligned_obj_size + alignment_reserve();
+}
+
 inline size_t ThreadLocalAllocBuffer::compute_size(size_t obj_size) {
   const size_t aligned_obj_size = align_object_size(obj_size);
 
@@ -1280,15 +1280,21 @@ void Universe::flush_evol_dependents_on(instanceKlassHandle ev_k_h) {
   // stopped dring the safepoint so CodeCache will be safe to update without
   // holding the CodeCache_lock.
 
+  // We do not want any GCs to happen while we are in the middle of this VM operation
+  ResourceMark rm;
+
   // Compute the dependent nmethods
-  if (CodeCache::mark_for_evol_deoptimization(ev_k_h) > 0) {
+  Array<Method*>* methods = ev_k_h->methods();
+  GrowableArray<Method*>* old_methods = new GrowableArray<Method*>(methods->length());
+  for (int i = 0; i < methods->length(); i++) {
+    old_methods->append(methods->at(i));
+  }
+  if (CodeCache::mark_for_evol_deoptimization(old_methods) > 0) {
     // At least one nmethod has been marked for deoptimization
 
     // All this already happens inside a VM_Operation, so we'll do all the work here.
     // Stuff copied from VM_Deoptimize and modified slightly.
 
-    // We do not want any GCs to happen while we are in the middle of this VM operation
-    ResourceMark rm;
     DeoptimizationMarker dm;
 
     // Deoptimize all activations depending on marked nmethods
@@ -49,13 +49,21 @@ class CompiledICHolder : public CHeapObj<mtCompiler> {
 
   Metadata* _holder_metadata;
   Klass*    _holder_klass;    // to avoid name conflict with oopDesc::_klass
+  // Receiver prediction for megamorphic interface calls: the receiver
+  // klass and selected method observed at the megamorphic transition.
+  // Written once before the holder is published to the call site, so the
+  // itable stub can read them without synchronization.
+  Klass*    _cached_receiver_klass;
+  Method*   _cached_method;
   CompiledICHolder* _next;
   bool _is_metadata_method;
 
  public:
   // Constructor
   CompiledICHolder(Metadata* metadata, Klass* klass, bool is_method = true)
-      : _holder_metadata(metadata), _holder_klass(klass), _is_metadata_method(is_method) {
+      : _holder_metadata(metadata), _holder_klass(klass),
+        _cached_receiver_klass(NULL), _cached_method(NULL),
+        _is_metadata_method(is_method) {
 #ifdef ASSERT
     Atomic::inc(&_live_count);
     Atomic::inc(&_live_not_claimed_count);
@@ -79,8 +87,19 @@ class CompiledICHolder : public CHeapObj<mtCompiler> {
   void set_holder_metadata(Metadata* m) { _holder_metadata = m; }
   void set_holder_klass(Klass* k)     { _holder_klass = k; }
 
+  Klass*  cached_receiver_klass() const { return _cached_receiver_klass; }
+  Method* cached_method() const         { return _cached_method; }
+
+  // Must only be called before the holder is published to the call site.
+  void set_receiver_prediction(Klass* recv_klass, Method* m) {
+    _cached_receiver_klass = recv_klass;
+    _cached_method = m;
+  }
+
   static int holder_metadata_offset() { return offset_of(CompiledICHolder, _holder_metadata); }
   static int holder_klass_offset()    { return offset_of(CompiledICHolder, _holder_klass); }
+  static int cached_receiver_klass_offset() { return offset_of(CompiledICHolder, _cached_receiver_klass); }
+  static int cached_method_offset()   { return offset_of(CompiledICHolder, _cached_method); }
 
   CompiledICHolder* next()     { return _next; }
   void set_next(CompiledICHolder* n) { _next = n; }
@@ -93,6 +112,10 @@ class CompiledICHolder : public CHeapObj<mtCompiler> {
     if (!_holder_klass->is_loader_alive(is_alive)) {
       return false;
     }
+    if (_cached_receiver_klass != NULL &&
+        !_cached_receiver_klass->is_loader_alive(is_alive)) {
+      return false;
+    }
     return true;
   }
 
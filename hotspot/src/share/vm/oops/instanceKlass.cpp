@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "classfile/javaClasses.hpp"
+#include "classfile/resolutionJournal.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/verifier.hpp"
@@ -430,6 +431,12 @@ void InstanceKlass::deallocate_contents(ClassLoaderData* loader_data) {
   }
   set_secondary_supers(NULL);
 
+  // The hash table over the secondaries is never shared with another array.
+  if (secondary_supers_table() != NULL && !secondary_supers_table()->is_shared()) {
+    MetadataFactory::free_array<Klass*>(loader_data, secondary_supers_table());
+  }
+  set_secondary_supers_table(NULL);
+
   deallocate_interfaces(loader_data, super(), local_interfaces(), transitive_interfaces());
   set_transitive_interfaces(NULL);
   set_local_interfaces(NULL);
@@ -762,6 +769,13 @@ bool InstanceKlass::link_class_impl(
       }
     }
   }
+
+  // Replay the journaled resolutions outside the init lock: resolution loads
+  // other classes, and doing that under this class's init lock could invert
+  // lock order against their initializers.
+  if (UseResolutionJournal) {
+    ResolutionJournal::bulk_resolve(this_oop, THREAD);
+  }
   return true;
 }
 
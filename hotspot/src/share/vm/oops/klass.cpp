@@ -81,6 +81,13 @@ bool Klass::is_subclass_of(const Klass* k) const {
   return false;
 }
 
+// Klasses are aligned in metaspace, so shift out the always-zero low bits
+// before spreading the pointer bits with a multiplicative hash.
+static inline juint secondary_supers_table_hash(const Klass* k) {
+  uintx h = (uintx)k >> LogKlassAlignmentInBytes;
+  return (juint)(h * 2654435761u);
+}
+
 bool Klass::search_secondary_supers(Klass* k) const {
   // Put some extra logic here out-of-line, before the search proper.
   // This cuts down the size of the inline method.
@@ -88,6 +95,23 @@ bool Klass::search_secondary_supers(Klass* k) const {
   // This is necessary, since I am never in my own secondary_super list.
   if (this == k)
     return true;
+  // Probe the hash table, if this klass has enough secondaries to carry one.
+  Array<Klass*>* table = secondary_supers_table();
+  if (table != NULL) {
+    juint mask = (juint)table->length() - 1;
+    juint idx = secondary_supers_table_hash(k) & mask;
+    while (true) {
+      Klass* e = table->at((int)idx);
+      if (e == k) {
+        ((Klass*)this)->set_secondary_super_cache(k);
+        return true;
+      }
+      if (e == NULL) {
+        return false;  // tables are at most half full, so an empty slot ends the probe
+      }
+      idx = (idx + 1) & mask;
+    }
+  }
   // Scan the array-of-objects for a match
   int cnt = secondary_supers()->length();
   for (int i = 0; i < cnt; i++) {
@@ -180,6 +204,7 @@ Klass::Klass() {
     _primary_supers[i] = NULL;
   }
   set_secondary_supers(NULL);
+  set_secondary_supers_table(NULL);
   set_secondary_super_cache(NULL);
   _primary_supers[0] = k;
   set_super_check_offset(in_bytes(primary_supers_offset()));
@@ -311,6 +336,7 @@ void Klass::initialize_supers(Klass* k, TRAPS) {
     GrowableArray<Klass*>* secondaries = compute_secondary_supers(extras);
     if (secondaries == NULL) {
       // secondary_supers set by compute_secondary_supers
+      this_kh->build_secondary_supers_table(CHECK);
       return;
     }
 
@@ -355,7 +381,38 @@ void Klass::initialize_supers(Klass* k, TRAPS) {
   #endif
 
     this_kh->set_secondary_supers(s2);
+    this_kh->build_secondary_supers_table(CHECK);
+  }
+}
+
+// Below this many secondary supers, the linear scan in search_secondary_supers
+// is cheap enough that a hash table is not worth its metaspace footprint.
+static const int secondary_supers_table_min_length = 8;
+
+void Klass::build_secondary_supers_table(TRAPS) {
+  assert(secondary_supers() != NULL, "secondary supers must be set first");
+  int len = secondary_supers()->length();
+  if (len < secondary_supers_table_min_length) {
+    return;
+  }
+  // Size the table to a power of two at most half full, so linear probing
+  // terminates quickly and an empty slot reliably signals a miss.
+  int table_len = 1;
+  while (table_len < len * 2) {
+    table_len *= 2;
+  }
+  Array<Klass*>* table = MetadataFactory::new_array<Klass*>(class_loader_data(),
+                                            table_len, (Klass*)NULL, CHECK);
+  juint mask = (juint)table_len - 1;
+  for (int i = 0; i < len; i++) {
+    Klass* s = secondary_supers()->at(i);
+    juint idx = secondary_supers_table_hash(s) & mask;
+    while (table->at((int)idx) != NULL && table->at((int)idx) != s) {
+      idx = (idx + 1) & mask;
+    }
+    table->at_put((int)idx, s);
   }
+  set_secondary_supers_table(table);
 }
 
 GrowableArray<Klass*>* Klass::compute_secondary_supers(int num_extra_slots) {
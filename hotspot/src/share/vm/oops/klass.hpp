@@ -146,6 +146,10 @@ class Klass : public Metadata {
   Klass*      _secondary_super_cache;
   // Array of all secondary supertypes
   Array<Klass*>* _secondary_supers;
+  // Open-addressed hash table over _secondary_supers, built only for klasses
+  // with many secondary supertypes; NULL otherwise.  Keeps the slow path of
+  // subtype checks O(1) instead of a linear scan.
+  Array<Klass*>* _secondary_supers_table;
   // Ordered list of all primary supertypes
   Klass*      _primary_supers[_primary_super_limit];
   // java/lang/Class instance mirroring this class
@@ -214,6 +218,10 @@ protected:
   // klass-specific helper for initializing _secondary_supers
   virtual GrowableArray<Klass*>* compute_secondary_supers(int num_extra_slots);
 
+  // builds _secondary_supers_table if _secondary_supers is large enough to
+  // warrant one; must be called after _secondary_supers is set
+  void build_secondary_supers_table(TRAPS);
+
   // java_super is the Java-level super type as specified by Class.getSuperClass.
   virtual Klass* java_super() const  { return NULL; }
 
@@ -226,6 +234,9 @@ protected:
   Array<Klass*>* secondary_supers() const { return _secondary_supers; }
   void set_secondary_supers(Array<Klass*>* k) { _secondary_supers = k; }
 
+  Array<Klass*>* secondary_supers_table() const { return _secondary_supers_table; }
+  void set_secondary_supers_table(Array<Klass*>* t) { _secondary_supers_table = t; }
+
   // Return the element of the _super chain of the given depth.
   // If there is no such element, return either NULL or this.
   Klass* primary_super_of_depth(juint i) const {
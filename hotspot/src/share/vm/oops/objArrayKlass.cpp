@@ -56,7 +56,6 @@
 #include "gc_implementation/parallelScavenge/psCompactionManager.hpp"
 #include "gc_implementation/parallelScavenge/psPromotionManager.inline.hpp"
 #include "gc_implementation/parallelScavenge/psScavenge.inline.hpp"
-#include "gc_implementation/shenandoah/shenandoahBarrierSet.inline.hpp"
 #include "gc_implementation/shenandoah/shenandoahOopClosures.inline.hpp"
 #include "oops/oop.pcgc.inline.hpp"
 #endif // INCLUDE_ALL_GCS
@@ -245,11 +244,10 @@ template <class T> void ObjArrayKlass::do_copy(arrayOop s, T* src,
   assert(bs->has_write_ref_array_opt(), "Barrier set must have ref array opt");
   assert(bs->has_write_ref_array_pre_opt(), "For pre-barrier as well.");
 
-#if INCLUDE_ALL_GCS
-  if (UseShenandoahGC) {
-    ShenandoahBarrierSet::barrier_set()->arraycopy_barrier(src, dst, length);
-  }
-#endif
+  // If the collector pre-processed the entire copied range here
+  // (Shenandoah), the per-element pre-barriers in the checked loop
+  // below are redundant and can be skipped.
+  bool range_pre_done = bs->arraycopy_pre(src, dst, length);
 
   if (s == d) {
     // since source and destination are equal we do not need conversion checks.
@@ -278,7 +276,9 @@ template <class T> void ObjArrayKlass::do_copy(arrayOop s, T* src,
                                       : oopDesc::decode_heap_oop_not_null(element);
         if (element_is_null ||
             (new_val->klass())->is_subtype_of(bound)) {
-          bs->write_ref_field_pre(p, new_val);
+          if (!range_pre_done) {
+            bs->write_ref_field_pre(p, new_val);
+          }
           *p = element;
         } else {
           // We must do a barrier to cover the partial copy.
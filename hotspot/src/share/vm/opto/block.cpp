@@ -1594,6 +1594,12 @@ void PhaseBlockLayout::merge_traces(bool fall_thru_only) {
         }
       }
     } else if (e->state() == CFGEdge::open) {
+      // Keep cold traces separate; they stay behind in the trace list
+      // and the frequency sort in reorder_traces() places them at the
+      // end of the method, away from the hot code.
+      if (BlockLayoutSeparateColdTraces && e->infrequent()) {
+        continue;
+      }
       // Append traces, even without a fall-thru connection.
       // But leave root entry at the beginning of the block list.
       if (targ_trace != trace(_cfg.get_root_block())) {
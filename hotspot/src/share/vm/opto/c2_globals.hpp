@@ -211,6 +211,10 @@
   product(bool, UseCountedLoopSafepoints, false,                            \
           "Force counted loops to keep a safepoint")                        \
                                                                             \
+  product(intx, CountedLoopSafepointLimit, 0,                               \
+          "If positive, elide safepoint polls only from counted loops "     \
+          "whose trip count provably does not exceed this limit")           \
+                                                                            \
   product(bool, UseLoopPredicate, true,                                     \
           "Generate a predicate to select fast/slow loop versions")         \
                                                                             \
@@ -369,6 +373,14 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  experimental(bool, UseDominantReceiverInlining, false,                    \
+          "Speculatively devirtualize megamorphic sites against their "     \
+          "dominant receiver, trapping on the minority path")               \
+                                                                            \
+  experimental(intx, TypeProfileDominantReceiverPercent, 95,                \
+          "% of dominant receiver type needed to speculate at a "           \
+          "megamorphic call site")                                          \
+                                                                            \
   product(bool, InsertMemBarAfterArraycopy, true,                           \
           "Insert memory barrier after arraycopy call")                     \
                                                                             \
@@ -531,6 +543,10 @@
   product(bool, BlockLayoutRotateLoops, true,                               \
           "Allow back branches to be fall throughs in the block layour")    \
                                                                             \
+  product(bool, BlockLayoutSeparateColdTraces, true,                        \
+          "Keep traces reached only through infrequent edges out of hot "   \
+          "traces, so they are placed at the end of the method")            \
+                                                                            \
   develop(bool, InlineReflectionGetCallerClass, true,                       \
           "inline sun.reflect.Reflection.getCallerClass(), known to be part "\
           "of base library DLL")                                            \
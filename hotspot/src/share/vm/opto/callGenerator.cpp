@@ -789,6 +789,13 @@ CallGenerator* CallGenerator::for_method_handle_inline(JVMState* jvms, ciMethod*
     {
       // Get MethodHandle receiver:
       Node* receiver = kit.argument(0);
+      if (receiver->Opcode() != Op_ConP) {
+        // The MethodHandle may be hidden behind casts inserted by earlier
+        // inlining rounds (e.g. the CheckCastPP narrowing the selector of a
+        // GuardWithTest); a cast of a constant still is that constant, so
+        // look through them before giving up on folding the call.
+        receiver = receiver->uncast();
+      }
       if (receiver->Opcode() == Op_ConP) {
         input_not_const = false;
         const TypeOopPtr* oop_ptr = receiver->bottom_type()->is_oopptr();
@@ -810,6 +817,10 @@ CallGenerator* CallGenerator::for_method_handle_inline(JVMState* jvms, ciMethod*
     {
       // Get MemberName argument:
       Node* member_name = kit.argument(callee->arg_size() - 1);
+      if (member_name->Opcode() != Op_ConP) {
+        // Look through casts, same as for the invokeBasic receiver above.
+        member_name = member_name->uncast();
+      }
       if (member_name->Opcode() == Op_ConP) {
         input_not_const = false;
         const TypeOopPtr* oop_ptr = member_name->bottom_type()->is_oopptr();
@@ -38,6 +38,8 @@ macro(AllocateArray)
 macro(AndI)
 macro(AndL)
 macro(AryEq)
+macro(AryEqB)
+macro(AryEqI)
 macro(AtanD)
 macro(Binary)
 macro(Bool)
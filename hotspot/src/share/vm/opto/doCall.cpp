@@ -264,6 +264,16 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
             // in case of monomorphic or bimorphic virtual call site.
             miss_cg = CallGenerator::for_uncommon_trap(callee, reason,
                         Deoptimization::Action_maybe_recompile);
+          } else if (UseDominantReceiverInlining && next_hit_cg == NULL &&
+                     (100.*profile.receiver_prob(0) >= (float)TypeProfileDominantReceiverPercent) &&
+                     !too_many_traps(caller, bci, reason)) {
+            // Formally megamorphic site, but one receiver dominates the
+            // profile: speculate on it and trap on the minority path. If the
+            // speculation keeps failing, the per-site trap counters make
+            // too_many_traps() fail the check above on recompilation, and the
+            // site falls back to the virtual call below for good.
+            miss_cg = CallGenerator::for_uncommon_trap(callee, reason,
+                        Deoptimization::Action_maybe_recompile);
           } else {
             // Generate virtual call for class check failure path
             // in case of polymorphic virtual call site.
@@ -327,6 +337,7 @@ bool Compile::should_delay_string_inlining(ciMethod* call_method, JVMState* jvms
       case vmIntrinsics::_StringBuilder_String:
       case vmIntrinsics::_StringBuilder_append_char:
       case vmIntrinsics::_StringBuilder_append_int:
+      case vmIntrinsics::_StringBuilder_append_long:
       case vmIntrinsics::_StringBuilder_append_String:
       case vmIntrinsics::_StringBuilder_toString:
       case vmIntrinsics::_StringBuffer_void:
@@ -334,6 +345,7 @@ bool Compile::should_delay_string_inlining(ciMethod* call_method, JVMState* jvms
       case vmIntrinsics::_StringBuffer_String:
       case vmIntrinsics::_StringBuffer_append_char:
       case vmIntrinsics::_StringBuffer_append_int:
+      case vmIntrinsics::_StringBuffer_append_long:
       case vmIntrinsics::_StringBuffer_append_String:
       case vmIntrinsics::_StringBuffer_toString:
       case vmIntrinsics::_Integer_toString:
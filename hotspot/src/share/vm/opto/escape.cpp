@@ -556,6 +556,8 @@ void ConnectionGraph::add_node_to_connection_graph(Node *n, Unique_Node_List *de
       break;
     }
     case Op_AryEq:
+    case Op_AryEqB:
+    case Op_AryEqI:
     case Op_StrComp:
     case Op_StrEquals:
     case Op_StrIndexOf:
@@ -744,6 +746,8 @@ void ConnectionGraph::add_final_edges(Node *n) {
       ELSE_FAIL("Op_StoreP");
     }
     case Op_AryEq:
+    case Op_AryEqB:
+    case Op_AryEqI:
     case Op_StrComp:
     case Op_StrEquals:
     case Op_StrIndexOf:
@@ -3091,7 +3095,8 @@ void ConnectionGraph::split_unique_types(GrowableArray<Node *>  &alloc_worklist)
         uint op = use->Opcode();
         if (!(op == Op_CmpP || op == Op_Conv2B ||
               op == Op_CastP2X || op == Op_StoreCM ||
-              op == Op_FastLock || op == Op_AryEq || op == Op_StrComp ||
+              op == Op_FastLock || op == Op_AryEq || op == Op_AryEqB ||
+              op == Op_AryEqI || op == Op_StrComp ||
               op == Op_StrEquals || op == Op_StrIndexOf)) {
           n->dump();
           use->dump();
@@ -3192,7 +3197,8 @@ void ConnectionGraph::split_unique_types(GrowableArray<Node *>  &alloc_worklist)
         if (!(op == Op_StoreCM ||
               (op == Op_CallLeaf && use->as_CallLeaf()->_name != NULL &&
                strcmp(use->as_CallLeaf()->_name, "g1_wb_pre") == 0) ||
-              op == Op_AryEq || op == Op_StrComp ||
+              op == Op_AryEq || op == Op_AryEqB || op == Op_AryEqI ||
+              op == Op_StrComp ||
               op == Op_StrEquals || op == Op_StrIndexOf)) {
           n->dump();
           use->dump();
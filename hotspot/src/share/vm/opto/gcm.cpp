@@ -520,7 +520,10 @@ Block* PhaseCFG::insert_anti_dependences(Block* LCA, Node* load, bool verify) {
          "String equals is a 'load' that does not conflict with any stores");
   assert(load_alias_idx || (load->is_Mach() && load->as_Mach()->ideal_Opcode() == Op_StrIndexOf),
          "String indexOf is a 'load' that does not conflict with any stores");
-  assert(load_alias_idx || (load->is_Mach() && load->as_Mach()->ideal_Opcode() == Op_AryEq),
+  assert(load_alias_idx || (load->is_Mach() &&
+                            (load->as_Mach()->ideal_Opcode() == Op_AryEq ||
+                             load->as_Mach()->ideal_Opcode() == Op_AryEqB ||
+                             load->as_Mach()->ideal_Opcode() == Op_AryEqI)),
          "Arrays equals is a 'load' that do not conflict with any stores");
 
   if (!C->alias_type(load_alias_idx)->is_rewritable()) {
@@ -328,6 +328,11 @@ class GraphKit : public Phase {
   Node* RShiftI(Node* l, Node* r)             { return _gvn.transform(new (C) RShiftINode(l, r));    }
   Node* URShiftI(Node* l, Node* r)            { return _gvn.transform(new (C) URShiftINode(l, r));   }
 
+  Node* AddL(Node* l, Node* r)                { return _gvn.transform(new (C) AddLNode(l, r));       }
+  Node* SubL(Node* l, Node* r)                { return _gvn.transform(new (C) SubLNode(l, r));       }
+  Node* DivL(Node* ctl, Node* l, Node* r)     { return _gvn.transform(new (C) DivLNode(ctl, l, r));  }
+  Node* LShiftL(Node* l, Node* r)             { return _gvn.transform(new (C) LShiftLNode(l, r));    }
+
   Node* CmpI(Node* l, Node* r)                { return _gvn.transform(new (C) CmpINode(l, r));       }
   Node* CmpL(Node* l, Node* r)                { return _gvn.transform(new (C) CmpLNode(l, r));       }
   Node* CmpP(Node* l, Node* r)                { return _gvn.transform(new (C) CmpPNode(l, r));       }
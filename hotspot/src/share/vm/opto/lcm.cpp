@@ -207,6 +207,8 @@ void PhaseCFG::implicit_null_check(Block* block, Node *proj, Node *val, int allo
     case Op_StrEquals:
     case Op_StrIndexOf:
     case Op_AryEq:
+    case Op_AryEqB:
+    case Op_AryEqI:
     case Op_EncodeISOArray:
       // Not a legit memory op for implicit null check regardless of
       // embedded loads
@@ -254,7 +254,7 @@ class LibraryCallKit : public GraphKit {
   bool inline_native_newArray();
   bool inline_native_getLength();
   bool inline_array_copyOf(bool is_copyOfRange);
-  bool inline_array_equals();
+  bool inline_array_equals(BasicType elem);
   void copy_to_clone(Node* obj, Node* alloc_obj, Node* obj_size, bool is_array, bool card_mark);
   bool inline_native_clone(bool is_virtual);
   bool inline_native_Reflection_getCallerClass();
@@ -381,6 +381,8 @@ CallGenerator* Compile::make_vm_intrinsic(ciMethod* m, bool is_virtual) {
     case vmIntrinsics::_compareTo:
     case vmIntrinsics::_equals:
     case vmIntrinsics::_equalsC:
+    case vmIntrinsics::_equalsB:
+    case vmIntrinsics::_equalsI:
     case vmIntrinsics::_getAndAddInt:
     case vmIntrinsics::_getAndAddLong:
     case vmIntrinsics::_getAndSetInt:
@@ -416,6 +418,14 @@ CallGenerator* Compile::make_vm_intrinsic(ciMethod* m, bool is_virtual) {
     if (!SpecialArraysEquals)  return NULL;
     if (!Matcher::match_rule_supported(Op_AryEq))  return NULL;
     break;
+  case vmIntrinsics::_equalsB:
+    if (!SpecialArraysEquals)  return NULL;
+    if (!Matcher::match_rule_supported(Op_AryEqB))  return NULL;
+    break;
+  case vmIntrinsics::_equalsI:
+    if (!SpecialArraysEquals)  return NULL;
+    if (!Matcher::match_rule_supported(Op_AryEqI))  return NULL;
+    break;
   case vmIntrinsics::_arraycopy:
     if (!InlineArrayCopy)  return NULL;
     break;
@@ -903,7 +913,9 @@ bool LibraryCallKit::try_to_inline(int predicate) {
   case vmIntrinsics::_getLength:                return inline_native_getLength();
   case vmIntrinsics::_copyOf:                   return inline_array_copyOf(false);
   case vmIntrinsics::_copyOfRange:              return inline_array_copyOf(true);
-  case vmIntrinsics::_equalsC:                  return inline_array_equals();
+  case vmIntrinsics::_equalsC:                  return inline_array_equals(T_CHAR);
+  case vmIntrinsics::_equalsB:                  return inline_array_equals(T_BYTE);
+  case vmIntrinsics::_equalsI:                  return inline_array_equals(T_INT);
   case vmIntrinsics::_clone:                    return inline_native_clone(intrinsic()->is_virtual());
 
   case vmIntrinsics::_isAssignableFrom:         return inline_native_subtype_check();
@@ -1356,10 +1368,25 @@ bool LibraryCallKit::inline_string_equals() {
 }
 
 //------------------------------inline_array_equals----------------------------
-bool LibraryCallKit::inline_array_equals() {
+bool LibraryCallKit::inline_array_equals(BasicType elem) {
   Node* arg1 = argument(0);
   Node* arg2 = argument(1);
-  set_result(_gvn.transform(new (C) AryEqNode(control(), memory(TypeAryPtr::CHARS), arg1, arg2)));
+  Node* result;
+  switch (elem) {
+  case T_CHAR:
+    result = new (C) AryEqNode(control(), memory(TypeAryPtr::CHARS), arg1, arg2);
+    break;
+  case T_BYTE:
+    result = new (C) AryEqBNode(control(), memory(TypeAryPtr::BYTES), arg1, arg2);
+    break;
+  case T_INT:
+    result = new (C) AryEqINode(control(), memory(TypeAryPtr::INTS), arg1, arg2);
+    break;
+  default:
+    ShouldNotReachHere();
+    return false;
+  }
+  set_result(_gvn.transform(result));
   return true;
 }
 
@@ -613,7 +613,9 @@ bool IdealLoopTree::policy_maximally_unroll( PhaseIdealLoop *phase ) const {
       case Op_StrEquals:
       case Op_StrIndexOf:
       case Op_EncodeISOArray:
-      case Op_AryEq: {
+      case Op_AryEq:
+      case Op_AryEqB:
+      case Op_AryEqI: {
         return false;
       }
 #if INCLUDE_RTM_OPT
@@ -725,7 +727,9 @@ bool IdealLoopTree::policy_unroll( PhaseIdealLoop *phase ) const {
       case Op_StrEquals:
       case Op_StrIndexOf:
       case Op_EncodeISOArray:
-      case Op_AryEq: {
+      case Op_AryEq:
+      case Op_AryEqB:
+      case Op_AryEqI: {
         // Do not unroll a loop with String intrinsics code.
         // String intrinsics are large and have loops.
         return false;
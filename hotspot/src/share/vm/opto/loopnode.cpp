@@ -264,6 +264,31 @@ void PhaseIdealLoop::set_subtree_ctrl( Node *n ) {
   set_early_ctrl( n );
 }
 
+//------------------------------poll_elision_allowed---------------------------
+// With CountedLoopSafepointLimit set, safepoint polls may only be elided
+// from counted loops whose trip count provably stays at or below the
+// limit; longer or unknown-trip-count loops keep a poll so that
+// time-to-safepoint stays bounded. Conservative: any missing or non-int
+// bound keeps the poll.
+static bool poll_elision_allowed(PhaseTransform* phase, Node* init_trip,
+                                 Node* limit, int stride_con) {
+  if (CountedLoopSafepointLimit <= 0) {
+    return true;                // policy off -- legacy behavior
+  }
+  if (init_trip == NULL || limit == NULL || stride_con == 0) {
+    return false;
+  }
+  const TypeInt* init_t  = phase->type(init_trip)->isa_int();
+  const TypeInt* limit_t = phase->type(limit)->isa_int();
+  if (init_t == NULL || limit_t == NULL) {
+    return false;
+  }
+  jlong span = (stride_con > 0) ? (jlong)limit_t->_hi - (jlong)init_t->_lo
+                                : (jlong)init_t->_hi  - (jlong)limit_t->_lo;
+  jlong trip = span / (stride_con > 0 ? stride_con : -stride_con) + 1;
+  return trip <= (jlong)CountedLoopSafepointLimit;
+}
+
 //------------------------------is_counted_loop--------------------------------
 bool PhaseIdealLoop::is_counted_loop( Node *x, IdealLoopTree *loop ) {
   PhaseGVN *gvn = &_igvn;
@@ -697,7 +722,8 @@ bool PhaseIdealLoop::is_counted_loop( Node *x, IdealLoopTree *loop ) {
 
   } // LoopLimitCheck
 
-  if (!UseCountedLoopSafepoints) {
+  if (!UseCountedLoopSafepoints &&
+      poll_elision_allowed(gvn, init_trip, limit, stride_con)) {
     // Check for SafePoint on backedge and remove
     Node *sfpt = x->in(LoopNode::LoopBackControl);
     if (sfpt->Opcode() == Op_SafePoint && is_deleteable_safept(sfpt)) {
@@ -795,7 +821,8 @@ bool PhaseIdealLoop::is_counted_loop( Node *x, IdealLoopTree *loop ) {
   lazy_replace( x, l );
   set_idom(l, init_control, dom_depth(x));
 
-  if (!UseCountedLoopSafepoints) {
+  if (!UseCountedLoopSafepoints &&
+      poll_elision_allowed(gvn, init_trip, limit, stride_con)) {
     // Check for immediately preceding SafePoint and remove
     Node *sfpt2 = le->in(0);
     if (sfpt2->Opcode() == Op_SafePoint && is_deleteable_safept(sfpt2)) {
@@ -1879,7 +1906,10 @@ void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
   if (_head->is_CountedLoop() ||
       phase->is_counted_loop(_head, this)) {
 
-    if (!UseCountedLoopSafepoints) {
+    CountedLoopNode* cl = _head->as_CountedLoop();
+    if (!UseCountedLoopSafepoints &&
+        poll_elision_allowed(&phase->_igvn, cl->init_trip(), cl->limit(),
+                             cl->stride_con())) {
       // Indicate we do not need a safepoint here
       _has_sfpt = 1;
     }
@@ -3589,6 +3619,8 @@ void PhaseIdealLoop::build_loop_late_post( Node *n ) {
     case Op_StrEquals:
     case Op_StrIndexOf:
     case Op_AryEq:
+    case Op_AryEqB:
+    case Op_AryEqI:
       pinned = false;
     }
     if (UseShenandoahGC && n->is_CMove()) {
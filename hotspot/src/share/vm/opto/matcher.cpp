@@ -939,6 +939,8 @@ static void match_alias_type(Compile* C, Node* n, Node* m) {
     case Op_StrEquals:
     case Op_StrIndexOf:
     case Op_AryEq:
+    case Op_AryEqB:
+    case Op_AryEqI:
     case Op_MemBarVolatile:
     case Op_MemBarCPUOrder: // %%% these ideals should have narrower adr_type?
     case Op_EncodeISOArray:
@@ -2142,6 +2144,8 @@ void Matcher::find_shared( Node *n ) {
       case Op_StrEquals:
       case Op_StrIndexOf:
       case Op_AryEq:
+      case Op_AryEqB:
+      case Op_AryEqI:
       case Op_EncodeISOArray:
         set_shared(n); // Force result into register (it will be anyways)
         break;
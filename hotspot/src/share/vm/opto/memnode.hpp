@@ -1035,6 +1035,27 @@ public:
   virtual const Type* bottom_type() const { return TypeInt::BOOL; }
 };
 
+//------------------------------AryEqB---------------------------------------
+// Same as AryEq, for byte arrays. A separate opcode so platforms without
+// a matching rule simply decline the intrinsic.
+class AryEqBNode: public StrIntrinsicNode {
+public:
+  AryEqBNode(Node* control, Node* byte_array_mem, Node* s1, Node* s2):
+    StrIntrinsicNode(control, byte_array_mem, s1, s2) {};
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::BOOL; }
+};
+
+//------------------------------AryEqI---------------------------------------
+// Same as AryEq, for int arrays.
+class AryEqINode: public StrIntrinsicNode {
+public:
+  AryEqINode(Node* control, Node* int_array_mem, Node* s1, Node* s2):
+    StrIntrinsicNode(control, int_array_mem, s1, s2) {};
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::BOOL; }
+};
+
 
 //------------------------------EncodeISOArray--------------------------------
 // encode char[] to byte[] in ISO_8859_1
@@ -321,10 +321,11 @@ inline int Node::Init(int req, Compile* C) {
   // and we begin to initialize the new Node.
 
   _cnt = _max = req;
-  _outcnt = _outmax = 0;
+  _outcnt = 0;
+  _outmax = _small_out_size;
   _class_id = Class_Node;
   _flags = 0;
-  _out = NO_OUT_ARRAY;
+  _out = _small_out;
   return idx;
 }
 
@@ -514,11 +515,12 @@ Node *Node::clone() const {
   Copy::conjoint_words_to_lower((HeapWord*)this, (HeapWord*)n, s);
   // Set the new input pointer array
   n->_in = (Node**)(((char*)n)+s);
-  // Cannot share the old output pointer array, so kill it
-  n->_out = NO_OUT_ARRAY;
-  // And reset the counters to 0
+  // Cannot share the old output pointer array; after the bulk copy _out
+  // may still point into the original node, so reset it to the clone's
+  // own inline storage
+  n->_out = n->_small_out;
   n->_outcnt = 0;
-  n->_outmax = 0;
+  n->_outmax = _small_out_size;
   // Unlock this guy, since he is not in any hash table.
   debug_only(n->_hash_lock = 0);
   // Walk the old node's input list to duplicate its edges
@@ -587,7 +589,11 @@ void Node::setup_is_top() {
     _out = NULL;                           // marker value for top
     assert(is_top(), "must be top");
   } else {
-    if (_out == NULL)  _out = NO_OUT_ARRAY;
+    if (_out == NULL) {
+      // This node is no longer top; give it back its inline out array.
+      _out = _small_out;
+      _outmax = _small_out_size;
+    }
     assert(!is_top(), "must not be top");
   }
 }
@@ -620,9 +626,11 @@ void Node::destruct() {
   assert(outcnt() == 0, "deleting a node must not leave a dangling use");
   // See if the input array was allocated just prior to the object
   int edge_size = _max*sizeof(void*);
-  int out_edge_size = _outmax*sizeof(void*);
+  // Edges held in the inline out array are reclaimed with the node itself
+  bool heap_out = (_out != NO_OUT_ARRAY && _out != _small_out);
+  int out_edge_size = heap_out ? _outmax*sizeof(void*) : 0;
   char *edge_end = ((char*)_in) + edge_size;
-  char *out_array = (char*)(_out == NO_OUT_ARRAY? NULL: _out);
+  char *out_array = heap_out ? (char*)_out : NULL;
   char *out_edge_end = out_array + out_edge_size;
   int node_size = size_of();
 
@@ -731,7 +739,16 @@ void Node::out_grow( uint len ) {
   // Previously I was using only powers-of-2 which peaked at 128 edges.
   //if( new_max >= limit ) new_max = limit-1;
   assert(_out != NULL && _out != NO_OUT_ARRAY, "out must have sensible value");
-  _out = (Node**)arena->Arealloc(_out,_outmax*sizeof(Node*),new_max*sizeof(Node*));
+  if (_out == _small_out) {
+    // Out edges lived in the node itself so far; move them to a real array.
+    Node** new_out = (Node**)arena->Amalloc(new_max*sizeof(Node*));
+    for (uint i = 0; i < _outcnt; i++) {
+      new_out[i] = _small_out[i];
+    }
+    _out = new_out;
+  } else {
+    _out = (Node**)arena->Arealloc(_out,_outmax*sizeof(Node*),new_max*sizeof(Node*));
+  }
   //Copy::zero_to_bytes(&_out[_outmax], (new_max-_outmax)*sizeof(Node*)); // NULL all new space
   _outmax = new_max;               // Record new max length
   // This assertion makes sure that Node::_max is wide enough to
@@ -291,6 +291,12 @@ protected:
 
   node_idx_t _outmax;           // Actual length of output array.
 
+  // Inline storage for the first few output edges.  _out initially points
+  // here, so nodes with at most _small_out_size uses (the vast majority in
+  // large graphs) never allocate an out-array from the node arena.
+  enum { _small_out_size = 2 };
+  Node* _small_out[_small_out_size];
+
   // Grow the actual input array to the next larger power-of-2 bigger than len.
   void grow( uint len );
   // Grow the output array to the next larger power-of-2 bigger than len.
@@ -60,6 +60,7 @@ class StringConcat : public ResourceObj {
   enum {
     StringMode,
     IntMode,
+    LongMode,
     CharMode,
     StringNullCheckMode
   };
@@ -124,6 +125,9 @@ class StringConcat : public ResourceObj {
   void push_int(Node* value) {
     push(value, IntMode);
   }
+  void push_long(Node* value) {
+    push(value, LongMode);
+  }
   void push_char(Node* value) {
     push(value, CharMode);
   }
@@ -413,14 +417,17 @@ StringConcat* PhaseStringOpts::build_candidate(CallStaticJavaNode* call) {
   ciMethod* m = call->method();
   ciSymbol* string_sig;
   ciSymbol* int_sig;
+  ciSymbol* long_sig;
   ciSymbol* char_sig;
   if (m->holder() == C->env()->StringBuilder_klass()) {
     string_sig = ciSymbol::String_StringBuilder_signature();
     int_sig = ciSymbol::int_StringBuilder_signature();
+    long_sig = ciSymbol::long_StringBuilder_signature();
     char_sig = ciSymbol::char_StringBuilder_signature();
   } else if (m->holder() == C->env()->StringBuffer_klass()) {
     string_sig = ciSymbol::String_StringBuffer_signature();
     int_sig = ciSymbol::int_StringBuffer_signature();
+    long_sig = ciSymbol::long_StringBuffer_signature();
     char_sig = ciSymbol::char_StringBuffer_signature();
   } else {
     return NULL;
@@ -535,11 +542,14 @@ StringConcat* PhaseStringOpts::build_candidate(CallStaticJavaNode* call) {
                cnode->method()->name() == ciSymbol::append_name() &&
                (cnode->method()->signature()->as_symbol() == string_sig ||
                 cnode->method()->signature()->as_symbol() == char_sig ||
-                cnode->method()->signature()->as_symbol() == int_sig)) {
+                cnode->method()->signature()->as_symbol() == int_sig ||
+                cnode->method()->signature()->as_symbol() == long_sig)) {
       sc->add_control(cnode);
       Node* arg = cnode->in(TypeFunc::Parms + 1);
       if (cnode->method()->signature()->as_symbol() == int_sig) {
         sc->push_int(arg);
+      } else if (cnode->method()->signature()->as_symbol() == long_sig) {
+        sc->push_long(arg);
       } else if (cnode->method()->signature()->as_symbol() == char_sig) {
         sc->push_char(arg);
       } else {
@@ -1373,6 +1383,202 @@ void PhaseStringOpts::int_getChars(GraphKit& kit, Node* arg, Node* char_array, N
 }
 
 
+Node* PhaseStringOpts::long_stringSize(GraphKit& kit, Node* arg) {
+  // Compute the number of characters of the decimal representation of a
+  // long. There is no sizeTable to index as in the int case, so count the
+  // digits by repeated division. Counting is done on non-positive values
+  // so that min_jlong, which has no positive counterpart, needs no
+  // special case.
+
+  // long i = (x < 0) ? x : -x;  int size = (x < 0) ? 1 : 0;
+  RegionNode* r = new (C) RegionNode(3);
+  kit.gvn().set_type(r, Type::CONTROL);
+  Node* i = new (C) PhiNode(r, TypeLong::LONG);
+  kit.gvn().set_type(i, TypeLong::LONG);
+  Node* size = new (C) PhiNode(r, TypeInt::INT);
+  kit.gvn().set_type(size, TypeInt::INT);
+  Node* chk = __ CmpL(arg, __ longcon(0));
+  Node* p = __ Bool(chk, BoolTest::lt);
+  IfNode* iff = kit.create_and_map_if(kit.control(), p, PROB_FAIR, COUNT_UNKNOWN);
+  r->init_req(1, __ IfTrue(iff));
+  i->init_req(1, arg);
+  size->init_req(1, __ intcon(1));
+  r->init_req(2, __ IfFalse(iff));
+  i->init_req(2, __ SubL(__ longcon(0), arg));
+  size->init_req(2, __ intcon(0));
+  kit.set_control(r);
+  C->record_for_igvn(r);
+  C->record_for_igvn(i);
+  C->record_for_igvn(size);
+
+  // do { q = q / 10; size++; } while (q != 0);
+
+  // Add loop predicate first.
+  kit.add_predicate();
+
+  RegionNode* loop = new (C) RegionNode(3);
+  kit.gvn().set_type(loop, Type::CONTROL);
+  Node* q_phi = new (C) PhiNode(loop, TypeLong::LONG);
+  kit.gvn().set_type(q_phi, TypeLong::LONG);
+  Node* size_phi = new (C) PhiNode(loop, TypeInt::INT);
+  kit.gvn().set_type(size_phi, TypeInt::INT);
+  loop->init_req(1, kit.control());
+  q_phi->init_req(1, i);
+  size_phi->init_req(1, size);
+  kit.set_control(loop);
+
+  Node* q = __ DivL(NULL, q_phi, __ longcon(10));
+  Node* next_size = __ AddI(size_phi, __ intcon(1));
+
+  IfNode* iff2 = kit.create_and_map_if(kit.control(),
+                                       __ Bool(__ CmpL(q, __ longcon(0)), BoolTest::ne),
+                                       PROB_FAIR, COUNT_UNKNOWN);
+  loop->init_req(2, __ IfTrue(iff2));
+  q_phi->init_req(2, q);
+  size_phi->init_req(2, next_size);
+
+  kit.set_control(__ IfFalse(iff2));
+  C->record_for_igvn(loop);
+  C->record_for_igvn(q_phi);
+  C->record_for_igvn(size_phi);
+
+  return next_size;
+}
+
+void PhaseStringOpts::long_getChars(GraphKit& kit, Node* arg, Node* char_array, Node* start, Node* end) {
+  // Simplified version of Long.getChars. As in long_stringSize the digit
+  // loop works on non-positive values so that min_jlong, whose negation
+  // overflows, needs no special case.
+
+  // int charPos = index;
+  Node* charPos = end;
+
+  // char sign = 0;
+  //
+  // long i = (x < 0) ? x : -x;
+  // if (x < 0) {
+  //     sign = '-';
+  // }
+  Node* i = arg;
+  Node* sign = __ intcon(0);
+  {
+    IfNode* iff = kit.create_and_map_if(kit.control(),
+                                        __ Bool(__ CmpL(arg, __ longcon(0)), BoolTest::lt),
+                                        PROB_FAIR, COUNT_UNKNOWN);
+
+    RegionNode* merge = new (C) RegionNode(3);
+    kit.gvn().set_type(merge, Type::CONTROL);
+    i = new (C) PhiNode(merge, TypeLong::LONG);
+    kit.gvn().set_type(i, TypeLong::LONG);
+    sign = new (C) PhiNode(merge, TypeInt::INT);
+    kit.gvn().set_type(sign, TypeInt::INT);
+
+    merge->init_req(1, __ IfTrue(iff));
+    i->init_req(1, arg);
+    sign->init_req(1, __ intcon('-'));
+    merge->init_req(2, __ IfFalse(iff));
+    i->init_req(2, __ SubL(__ longcon(0), arg));
+    sign->init_req(2, __ intcon(0));
+
+    kit.set_control(merge);
+
+    C->record_for_igvn(merge);
+    C->record_for_igvn(i);
+    C->record_for_igvn(sign);
+  }
+
+  // for (;;) {
+  //     q = i / 10;
+  //     r = i - ((q << 3) + (q << 1));  // r = i-(q*10), r in (-10, 0] ...
+  //     buf [--charPos] = '0' - r;
+  //     i = q;
+  //     if (i == 0) break;
+  // }
+
+  {
+    // Add loop predicate first.
+    kit.add_predicate();
+
+    RegionNode* head = new (C) RegionNode(3);
+    head->init_req(1, kit.control());
+    kit.gvn().set_type(head, Type::CONTROL);
+    Node* i_phi = new (C) PhiNode(head, TypeLong::LONG);
+    i_phi->init_req(1, i);
+    kit.gvn().set_type(i_phi, TypeLong::LONG);
+    charPos = PhiNode::make(head, charPos);
+    kit.gvn().set_type(charPos, TypeInt::INT);
+    Node* mem = PhiNode::make(head, kit.memory(char_adr_idx), Type::MEMORY, TypeAryPtr::CHARS);
+    kit.gvn().set_type(mem, Type::MEMORY);
+    kit.set_control(head);
+    kit.set_memory(mem, char_adr_idx);
+
+    Node* q = __ DivL(NULL, i_phi, __ longcon(10));
+    Node* r = __ SubL(i_phi, __ AddL(__ LShiftL(q, __ intcon(3)),
+                                     __ LShiftL(q, __ intcon(1))));
+    Node* m1 = __ SubI(charPos, __ intcon(1));
+    Node* ch = __ SubI(__ intcon('0'), kit.ConvL2I(r));
+
+    Node* st = __ store_to_memory(kit.control(), kit.array_element_address(char_array, m1, T_CHAR),
+                                  ch, T_CHAR, char_adr_idx, MemNode::unordered);
+
+    IfNode* iff = kit.create_and_map_if(head, __ Bool(__ CmpL(q, __ longcon(0)), BoolTest::ne),
+                                        PROB_FAIR, COUNT_UNKNOWN);
+    Node* ne = __ IfTrue(iff);
+    Node* eq = __ IfFalse(iff);
+
+    head->init_req(2, ne);
+    mem->init_req(2, st);
+    i_phi->init_req(2, q);
+    charPos->init_req(2, m1);
+
+    charPos = m1;
+
+    kit.set_control(eq);
+    kit.set_memory(st, char_adr_idx);
+
+    C->record_for_igvn(head);
+    C->record_for_igvn(mem);
+    C->record_for_igvn(i_phi);
+    C->record_for_igvn(charPos);
+  }
+
+  {
+    // if (sign != 0) {
+    //     buf [--charPos] = sign;
+    // }
+    RegionNode* final_merge = new (C) RegionNode(3);
+    kit.gvn().set_type(final_merge, Type::CONTROL);
+    Node* final_mem = PhiNode::make(final_merge, kit.memory(char_adr_idx), Type::MEMORY, TypeAryPtr::CHARS);
+    kit.gvn().set_type(final_mem, Type::MEMORY);
+
+    IfNode* iff = kit.create_and_map_if(kit.control(),
+                                        __ Bool(__ CmpI(sign, __ intcon(0)), BoolTest::ne),
+                                        PROB_FAIR, COUNT_UNKNOWN);
+
+    final_merge->init_req(2, __ IfFalse(iff));
+    final_mem->init_req(2, kit.memory(char_adr_idx));
+
+    kit.set_control(__ IfTrue(iff));
+    if (kit.stopped()) {
+      final_merge->init_req(1, C->top());
+      final_mem->init_req(1, C->top());
+    } else {
+      Node* m1 = __ SubI(charPos, __ intcon(1));
+      Node* st = __ store_to_memory(kit.control(), kit.array_element_address(char_array, m1, T_CHAR),
+                                    sign, T_CHAR, char_adr_idx, MemNode::unordered);
+
+      final_merge->init_req(1, kit.control());
+      final_mem->init_req(1, st);
+    }
+
+    kit.set_control(final_merge);
+    kit.set_memory(final_mem, char_adr_idx);
+
+    C->record_for_igvn(final_merge);
+    C->record_for_igvn(final_mem);
+  }
+}
+
 Node* PhaseStringOpts::copy_string(GraphKit& kit, Node* str, Node* char_array, Node* start) {
   Node* string = str;
   Node* offset = kit.load_String_offset(kit.control(), string);
@@ -1487,6 +1693,16 @@ void PhaseStringOpts::replace_string_concat(StringConcat* sc) {
         string_sizes->init_req(argi, string_size);
         break;
       }
+      case StringConcat::LongMode: {
+        Node* string_size = long_stringSize(kit, arg);
+
+        // accumulate total
+        length = __ AddI(length, string_size);
+
+        // Cache this value for the use by long_getChars
+        string_sizes->init_req(argi, string_size);
+        break;
+      }
       case StringConcat::StringNullCheckMode: {
         const Type* type = kit.gvn().type(arg);
         assert(type != TypePtr::NULL_PTR, "missing check");
@@ -1608,6 +1824,13 @@ void PhaseStringOpts::replace_string_concat(StringConcat* sc) {
           start = end;
           break;
         }
+        case StringConcat::LongMode: {
+          Node* end = __ AddI(start, string_sizes->in(argi));
+          // getChars words backwards so pass the ending point as well as the start
+          long_getChars(kit, arg, char_array, start, end);
+          start = end;
+          break;
+        }
         case StringConcat::StringNullCheckMode:
         case StringConcat::StringMode: {
           start = copy_string(kit, arg, char_array, start);
@@ -67,6 +67,12 @@ class PhaseStringOpts : public Phase {
   // Copy the characters representing value into char_array starting at start
   void int_getChars(GraphKit& kit, Node* value, Node* char_array, Node* start, Node* end);
 
+  // Compute the number of characters required to represent the long value
+  Node* long_stringSize(GraphKit& kit, Node* value);
+
+  // Copy the characters representing value into char_array starting at start
+  void long_getChars(GraphKit& kit, Node* value, Node* char_array, Node* start, Node* end);
+
   // Copy of the contents of the String str into char_array starting at index start.
   Node* copy_string(GraphKit& kit, Node* str, Node* char_array, Node* start);
 
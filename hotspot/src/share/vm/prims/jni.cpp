@@ -27,10 +27,12 @@
 #include "ci/ciReplay.hpp"
 #include "classfile/altHashing.hpp"
 #include "classfile/classLoader.hpp"
+#include "classfile/classLoaderData.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "compiler/compileBroker.hpp"
 #include "interpreter/linkResolver.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/support/jfrThreadId.hpp"
@@ -59,6 +61,7 @@
 #include "prims/jniCheck.hpp"
 #include "prims/jniExport.hpp"
 #include "prims/jniFastGetField.hpp"
+#include "prims/jniLookupCache.hpp"
 #include "prims/jvm.h"
 #include "prims/jvm_misc.hpp"
 #include "prims/jvmtiExport.hpp"
@@ -79,6 +82,7 @@
 #include "runtime/vm_operations.hpp"
 #include "services/memTracker.hpp"
 #include "services/runtimeService.hpp"
+#include "services/threadAllocationTable.hpp"
 #include "utilities/defaultStream.hpp"
 #include "utilities/dtrace.hpp"
 #include "utilities/events.hpp"
@@ -479,8 +483,31 @@ JNI_ENTRY(jclass, jni_FindClass(JNIEnv *env, const char *name))
   }
 
   TempNewSymbol sym = SymbolTable::new_symbol(name, CHECK_NULL);
-  result = find_class_from_class_loader(env, sym, true, loader,
-                                        protection_domain, true, thread);
+
+  // Memoize the resolution per loader. The special NativeLibrary context
+  // above carries a protection domain, so it bypasses the cache.
+  ClassLoaderData* loader_data = NULL;
+  if (UseJNILookupCache && JNILookupCache::is_active() &&
+      protection_domain.is_null()) {
+    loader_data = loader.is_null()
+                        ? ClassLoaderData::the_null_class_loader_data()
+                        : java_lang_ClassLoader::loader_data(loader());
+    if (loader_data != NULL) {
+      Klass* cached = JNILookupCache::lookup_class(loader_data, sym);
+      if (cached != NULL) {
+        result = (jclass) JNIHandles::make_local(env, cached->java_mirror());
+      }
+    }
+  }
+
+  if (result == NULL) {
+    result = find_class_from_class_loader(env, sym, true, loader,
+                                          protection_domain, true, thread);
+    if (result != NULL && loader_data != NULL) {
+      JNILookupCache::cache_class(loader_data, sym,
+                java_lang_Class::as_Klass(JNIHandles::resolve_non_null(result)));
+    }
+  }
 
   if (TraceClassResolution && result != NULL) {
     trace_class_resolution(java_lang_Class::as_Klass(JNIHandles::resolve_non_null(result)));
@@ -1598,6 +1625,13 @@ static jmethodID get_method_id(JNIEnv *env, jclass clazz, const char *name_str,
   // Method*s.
   klass()->initialize(CHECK_NULL);
 
+  if (UseJNILookupCache && JNILookupCache::is_active()) {
+    jmethodID cached = JNILookupCache::lookup_method(klass(), name, signature, is_static);
+    if (cached != NULL) {
+      return cached;
+    }
+  }
+
   Method* m;
   if (name == vmSymbols::object_initializer_name() ||
       name == vmSymbols::class_initializer_name()) {
@@ -1616,7 +1650,11 @@ static jmethodID get_method_id(JNIEnv *env, jclass clazz, const char *name_str,
   if (m == NULL || (m->is_static() != is_static)) {
     THROW_MSG_0(vmSymbols::java_lang_NoSuchMethodError(), name_str);
   }
-  return m->jmethod_id();
+  jmethodID id = m->jmethod_id();
+  if (UseJNILookupCache && JNILookupCache::is_active()) {
+    JNILookupCache::cache_method(klass(), name, signature, is_static, id);
+  }
+  return id;
 }
 
 
@@ -5330,6 +5368,13 @@ _JNI_IMPORT_OR_EXPORT_ jint JNICALL JNI_CreateJavaVM(JavaVM **vm, void **penv, v
 
     post_thread_start_event(thread);
 
+    ThreadAllocationTable::thread_started(thread);
+
+    // Pre-seed the compile queues from a profile saved by a previous run.
+    if (CompilationProfileReplayFile != NULL) {
+      CompileBroker::replay_compilation_profile(thread);
+    }
+
 #ifndef PRODUCT
   #ifndef CALL_TEST_FUNC_WITH_WRAPPER_IF_NEEDED
     #define CALL_TEST_FUNC_WITH_WRAPPER_IF_NEEDED(f) f()
@@ -5541,6 +5586,8 @@ static jint attach_current_thread(JavaVM *vm, void **penv, void *_args, bool dae
 
   post_thread_start_event(thread);
 
+  ThreadAllocationTable::thread_started(thread);
+
   *(JNIEnv**)penv = thread->jni_environment();
 
   // Now leaving the VM, so change thread_state. This is normally automatically taken care
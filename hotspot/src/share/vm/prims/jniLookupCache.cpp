@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "oops/symbol.hpp"
+#include "prims/jniLookupCache.hpp"
+#include "runtime/mutex.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.inline.hpp"
+#include "runtime/safepoint.hpp"
+#include "utilities/copy.hpp"
+
+JNILookupCache::ClassEntry* volatile*  JNILookupCache::_class_table  = NULL;
+JNILookupCache::MethodEntry* volatile* JNILookupCache::_method_table = NULL;
+Mutex*                     JNILookupCache::_lock           = NULL;
+JNILookupCache::ClassEntry*  JNILookupCache::_zombie_classes = NULL;
+JNILookupCache::MethodEntry* JNILookupCache::_zombie_methods = NULL;
+
+void JNILookupCache::initialize() {
+  _lock = new Mutex(Mutex::leaf, "JNILookupCache_lock", true);
+  _class_table  = NEW_C_HEAP_ARRAY(ClassEntry* volatile,  _class_table_size,  mtInternal);
+  _method_table = NEW_C_HEAP_ARRAY(MethodEntry* volatile, _method_table_size, mtInternal);
+  Copy::zero_to_bytes((void*)_class_table,  _class_table_size  * sizeof(ClassEntry*));
+  Copy::zero_to_bytes((void*)_method_table, _method_table_size * sizeof(MethodEntry*));
+}
+
+// Pointer keys are aligned, so shift out the zero low bits before mixing.
+static inline uintx mix_ptr(const void* p) {
+  return ((uintx)p >> LogHeapWordSize) * 2654435761u;
+}
+
+juint JNILookupCache::class_slot(ClassLoaderData* loader_data, Symbol* name) {
+  uintx h = mix_ptr(loader_data) ^ mix_ptr(name);
+  return (juint)h & (_class_table_size - 1);
+}
+
+juint JNILookupCache::method_slot(Klass* k, Symbol* name, Symbol* signature, bool is_static) {
+  uintx h = mix_ptr(k) ^ mix_ptr(name) ^ (mix_ptr(signature) + (is_static ? 1 : 0));
+  return (juint)h & (_method_table_size - 1);
+}
+
+Klass* JNILookupCache::lookup_class(ClassLoaderData* loader_data, Symbol* name) {
+  assert(is_active(), "sanity");
+  juint slot = class_slot(loader_data, name);
+  ClassEntry* e = (ClassEntry*)OrderAccess::load_ptr_acquire(&_class_table[slot]);
+  if (e != NULL && e->_loader_data == loader_data && e->_name == name) {
+    return e->_klass;
+  }
+  return NULL;
+}
+
+jmethodID JNILookupCache::lookup_method(Klass* k, Symbol* name, Symbol* signature, bool is_static) {
+  assert(is_active(), "sanity");
+  juint slot = method_slot(k, name, signature, is_static);
+  MethodEntry* e = (MethodEntry*)OrderAccess::load_ptr_acquire(&_method_table[slot]);
+  if (e != NULL && e->_klass == k && e->_name == name &&
+      e->_signature == signature && e->_is_static == is_static) {
+    return e->_id;
+  }
+  return NULL;
+}
+
+void JNILookupCache::cache_class(ClassLoaderData* loader_data, Symbol* name, Klass* k) {
+  assert(is_active(), "sanity");
+  ClassEntry* e = new ClassEntry();
+  e->_loader_data = loader_data;
+  e->_name = name;
+  e->_klass = k;
+  e->_next = NULL;
+  name->increment_refcount();
+
+  juint slot = class_slot(loader_data, name);
+  MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+  ClassEntry* old = _class_table[slot];
+  if (old != NULL) {
+    // A concurrent reader may still hold the old entry; defer the free
+    // to the next safepoint clear().
+    old->_next = _zombie_classes;
+    _zombie_classes = old;
+  }
+  OrderAccess::release_store_ptr(&_class_table[slot], e);
+}
+
+void JNILookupCache::cache_method(Klass* k, Symbol* name, Symbol* signature, bool is_static, jmethodID id) {
+  assert(is_active(), "sanity");
+  MethodEntry* e = new MethodEntry();
+  e->_klass = k;
+  e->_name = name;
+  e->_signature = signature;
+  e->_is_static = is_static;
+  e->_id = id;
+  e->_next = NULL;
+  name->increment_refcount();
+  signature->increment_refcount();
+
+  juint slot = method_slot(k, name, signature, is_static);
+  MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+  MethodEntry* old = _method_table[slot];
+  if (old != NULL) {
+    old->_next = _zombie_methods;
+    _zombie_methods = old;
+  }
+  OrderAccess::release_store_ptr(&_method_table[slot], e);
+}
+
+void JNILookupCache::free_class_entry(ClassEntry* e) {
+  e->_name->decrement_refcount();
+  delete e;
+}
+
+void JNILookupCache::free_method_entry(MethodEntry* e) {
+  e->_name->decrement_refcount();
+  e->_signature->decrement_refcount();
+  delete e;
+}
+
+void JNILookupCache::clear() {
+  if (!is_active()) {
+    return;
+  }
+  // JNI callers probe the tables in the _thread_in_vm state, so at a
+  // safepoint nobody is mid-probe and entries can be freed outright.
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  for (int i = 0; i < _class_table_size; i++) {
+    ClassEntry* e = _class_table[i];
+    if (e != NULL) {
+      free_class_entry(e);
+      _class_table[i] = NULL;
+    }
+  }
+  for (int i = 0; i < _method_table_size; i++) {
+    MethodEntry* e = _method_table[i];
+    if (e != NULL) {
+      free_method_entry(e);
+      _method_table[i] = NULL;
+    }
+  }
+  while (_zombie_classes != NULL) {
+    ClassEntry* e = _zombie_classes;
+    _zombie_classes = e->_next;
+    free_class_entry(e);
+  }
+  while (_zombie_methods != NULL) {
+    MethodEntry* e = _zombie_methods;
+    _zombie_methods = e->_next;
+    free_method_entry(e);
+  }
+}
+
+void jniLookupCache_init() {
+  if (UseJNILookupCache) {
+    JNILookupCache::initialize();
+  }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_PRIMS_JNILOOKUPCACHE_HPP
+#define SHARE_VM_PRIMS_JNILOOKUPCACHE_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class ClassLoaderData;
+class Klass;
+class Mutex;
+class Symbol;
+
+// Memoization tables for jni_FindClass and jni_GetMethodID /
+// jni_GetStaticMethodID, enabled with -XX:+UseJNILookupCache. Native code
+// cannot safely keep jclass/jmethodID values across class redefinition,
+// so native-heavy applications re-resolve the same names through JNI on
+// every call. The cache keeps the results on the VM side, where it can
+// be invalidated wholesale at the redefinition and class unloading
+// safepoints, making repeated lookups a single hash probe.
+//
+// Both tables are direct-mapped: a colliding insert replaces the slot.
+// Entries are immutable once published with a releasing store, so
+// lookups take no lock; inserts serialize on _lock. A replaced entry may
+// still be visible to a concurrent reader, so it is parked on a zombie
+// list and only freed by clear(), which runs at safepoints where no JNI
+// caller can be mid-probe.
+class JNILookupCache : AllStatic {
+private:
+  static const int _class_table_size  = 1024;
+  static const int _method_table_size = 1024;
+
+  struct ClassEntry : public CHeapObj<mtInternal> {
+    ClassLoaderData* _loader_data;
+    Symbol*          _name;
+    Klass*           _klass;
+    ClassEntry*      _next;  // zombie list link
+  };
+
+  struct MethodEntry : public CHeapObj<mtInternal> {
+    Klass*       _klass;
+    Symbol*      _name;
+    Symbol*      _signature;
+    bool         _is_static;
+    jmethodID    _id;
+    MethodEntry* _next;  // zombie list link
+  };
+
+  static ClassEntry* volatile*  _class_table;
+  static MethodEntry* volatile* _method_table;
+  static Mutex*       _lock;
+  static ClassEntry*  _zombie_classes;
+  static MethodEntry* _zombie_methods;
+
+  static juint class_slot(ClassLoaderData* loader_data, Symbol* name);
+  static juint method_slot(Klass* k, Symbol* name, Symbol* signature, bool is_static);
+  static void  free_class_entry(ClassEntry* e);
+  static void  free_method_entry(MethodEntry* e);
+
+public:
+  static void initialize();
+
+  static bool is_active() { return _lock != NULL; }
+
+  // Return the memoized result, or NULL when the key is not cached.
+  static Klass*    lookup_class(ClassLoaderData* loader_data, Symbol* name);
+  static jmethodID lookup_method(Klass* k, Symbol* name, Symbol* signature, bool is_static);
+
+  static void cache_class(ClassLoaderData* loader_data, Symbol* name, Klass* k);
+  static void cache_method(Klass* k, Symbol* name, Symbol* signature, bool is_static, jmethodID id);
+
+  // Drops every entry; called at the class redefinition and class
+  // unloading safepoints.
+  static void clear();
+};
+
+void jniLookupCache_init();
+
+#endif // SHARE_VM_PRIMS_JNILOOKUPCACHE_HPP
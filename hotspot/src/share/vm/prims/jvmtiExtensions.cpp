@@ -25,6 +25,11 @@
 #include "precompiled.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "prims/jvmtiExtensions.hpp"
+#include "utilities/macros.hpp"
+#if INCLUDE_ALL_GCS
+#include "gc_implementation/shenandoah/shenandoahHeap.inline.hpp"
+#include "gc_implementation/shenandoah/shenandoahHeapRegion.inline.hpp"
+#endif
 
 // the list of extension functions
 GrowableArray<jvmtiExtensionFunctionInfo*>* JvmtiExtensions::_ext_functions;
@@ -42,6 +47,49 @@ static jvmtiError JNICALL IsClassUnloadingEnabled(const jvmtiEnv* env, jboolean*
   return JVMTI_ERROR_NONE;
 }
 
+// extension function: snapshot of Shenandoah per-region occupancy for
+// capacity tooling. Fills an allocated array with three jlongs per
+// region: used bytes, live bytes from the last completed mark, and the
+// region state ordinal. The reads are deliberately lock-free; the
+// snapshot can be mildly inconsistent across regions but never blocks
+// mutators or the GC.
+static jvmtiError JNICALL GetShenandoahRegionSnapshot(const jvmtiEnv* env,
+                                                      jint* num_regions_ptr,
+                                                      jlong* region_size_ptr,
+                                                      jlong** region_data_ptr, ...) {
+  if (num_regions_ptr == NULL || region_size_ptr == NULL || region_data_ptr == NULL) {
+    return JVMTI_ERROR_NULL_POINTER;
+  }
+#if INCLUDE_ALL_GCS
+  if (!UseShenandoahGC) {
+    return JVMTI_ERROR_NOT_AVAILABLE;
+  }
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  size_t num_regions = heap->num_regions();
+
+  unsigned char* mem;
+  jvmtiError err = ((jvmtiEnv*)env)->Allocate(num_regions * 3 * sizeof(jlong), &mem);
+  if (err != JVMTI_ERROR_NONE) {
+    return err;
+  }
+  jlong* data = (jlong*)mem;
+
+  for (size_t i = 0; i < num_regions; i++) {
+    ShenandoahHeapRegion* r = heap->get_region(i);
+    data[i * 3 + 0] = (jlong)r->used();
+    data[i * 3 + 1] = (jlong)r->get_live_data_bytes();
+    data[i * 3 + 2] = (jlong)r->state_ordinal();
+  }
+
+  *num_regions_ptr = (jint)num_regions;
+  *region_size_ptr = (jlong)ShenandoahHeapRegion::region_size_bytes();
+  *region_data_ptr = data;
+  return JVMTI_ERROR_NONE;
+#else
+  return JVMTI_ERROR_NOT_AVAILABLE;
+#endif
+}
+
 // register extension functions and events. In this implementation we
 // have a single extension function (to prove the API) that tests if class
 // unloading is enabled or disabled. We also have a single extension event
@@ -67,6 +115,26 @@ void JvmtiExtensions::register_extensions() {
   };
   _ext_functions->append(&ext_func);
 
+  // register the Shenandoah region snapshot function
+  static jvmtiParamInfo region_snapshot_params[] = {
+    { (char*)"NumRegions", JVMTI_KIND_OUT,       JVMTI_TYPE_JINT,  JNI_FALSE },
+    { (char*)"RegionSize", JVMTI_KIND_OUT,       JVMTI_TYPE_JLONG, JNI_FALSE },
+    { (char*)"RegionData", JVMTI_KIND_ALLOC_BUF, JVMTI_TYPE_JLONG, JNI_FALSE }
+  };
+  static jvmtiError region_snapshot_errors[] = {
+    JVMTI_ERROR_NOT_AVAILABLE       // not running with -XX:+UseShenandoahGC
+  };
+  static jvmtiExtensionFunctionInfo region_snapshot_func = {
+    (jvmtiExtensionFunction)GetShenandoahRegionSnapshot,
+    (char*)"com.sun.hotspot.functions.GetShenandoahRegionSnapshot",
+    (char*)"Get a lock-free snapshot of Shenandoah per-region used/live bytes and state",
+    sizeof(region_snapshot_params)/sizeof(region_snapshot_params[0]),
+    region_snapshot_params,
+    sizeof(region_snapshot_errors)/sizeof(region_snapshot_errors[0]),
+    region_snapshot_errors
+  };
+  _ext_functions->append(&region_snapshot_func);
+
   // register our extension event
 
   static jvmtiParamInfo event_params[] = {
@@ -36,6 +36,7 @@
 #include "memory/universe.inline.hpp"
 #include "oops/fieldStreams.hpp"
 #include "oops/klassVtable.hpp"
+#include "prims/jniLookupCache.hpp"
 #include "prims/jvmtiImpl.hpp"
 #include "prims/jvmtiRedefineClasses.hpp"
 #include "prims/methodComparator.hpp"
@@ -65,6 +66,8 @@ VM_RedefineClasses::VM_RedefineClasses(jint class_count,
   _class_defs = class_defs;
   _class_load_kind = class_load_kind;
   _res = JVMTI_ERROR_NONE;
+  _any_dependents_marked = false;
+  _evol_dependee_methods = NULL;
 }
 
 static inline InstanceKlass* get_ik(jclass def) {
@@ -201,6 +204,10 @@ void VM_RedefineClasses::doit() {
     _scratch_classes[i] = NULL;
   }
 
+  // Flush all compiled code that depends on the redefined classes in one
+  // batch, so only a single stack walk is needed per redefine operation.
+  flush_dependent_code();
+
   // Disable any dependent concurrent compilations
   SystemDictionary::notice_modification();
 
@@ -208,6 +215,9 @@ void VM_RedefineClasses::doit() {
   // See jvmtiExport.hpp for detailed explanation.
   JvmtiExport::set_has_redefined_a_class();
 
+  // Redefinition invalidates memoized JNI metadata lookups.
+  JNILookupCache::clear();
+
 // check_class() is optionally called for product bits, but is
 // always called for non-product bits.
 #ifdef PRODUCT
@@ -3789,28 +3799,55 @@ void VM_RedefineClasses::transfer_old_native_function_registrations(instanceKlas
 // subsequent calls to RedefineClasses need only throw away code
 // that depends on the class.
 //
-void VM_RedefineClasses::flush_dependent_code(instanceKlassHandle k_h, TRAPS) {
+void VM_RedefineClasses::mark_dependent_code(instanceKlassHandle k_h) {
   assert_locked_or_safepoint(Compile_lock);
 
   // All dependencies have been recorded from startup or this is a second or
   // subsequent use of RedefineClasses
   if (JvmtiExport::all_dependencies_are_recorded()) {
-    Universe::flush_evol_dependents_on(k_h);
+    // Queue the old method versions for a single evolution-dependence scan
+    // over the code cache in flush_dependent_code(), instead of one scan
+    // per redefined class. The old methods stay valid until class unloading,
+    // so consuming the list after the method arrays are swapped is fine.
+    Array<Method*>* old_methods = k_h->methods();
+    if (_evol_dependee_methods == NULL) {
+      _evol_dependee_methods =
+        new (ResourceObj::C_HEAP, mtClass) GrowableArray<Method*>(old_methods->length(), true);
+    }
+    for (int i = 0; i < old_methods->length(); i++) {
+      _evol_dependee_methods->append(old_methods->at(i));
+    }
   } else {
     CodeCache::mark_all_nmethods_for_deoptimization();
+    _any_dependents_marked = true;
+  }
+}
 
-    ResourceMark rm(THREAD);
+void VM_RedefineClasses::flush_dependent_code() {
+  assert(SafepointSynchronize::is_at_safepoint(), "sanity check");
+
+  if (_evol_dependee_methods != NULL) {
+    if (CodeCache::mark_for_evol_deoptimization(_evol_dependee_methods) > 0) {
+      _any_dependents_marked = true;
+    }
+    delete _evol_dependee_methods;
+    _evol_dependee_methods = NULL;
+  }
+
+  // Deoptimize all activations depending on marked nmethods with a single
+  // stack walk, no matter how many classes were redefined in this operation.
+  if (_any_dependents_marked) {
+    ResourceMark rm;
     DeoptimizationMarker dm;
 
-    // Deoptimize all activations depending on marked nmethods
     Deoptimization::deoptimize_dependents();
 
     // Make the dependent methods not entrant
     CodeCache::make_marked_nmethods_not_entrant();
-
-    // From now on we know that the dependency information is complete
-    JvmtiExport::set_all_dependencies_are_recorded(true);
   }
+
+  // From now on we know that the dependency information is complete
+  JvmtiExport::set_all_dependencies_are_recorded(true);
 }
 
 void VM_RedefineClasses::compute_added_deleted_matching_methods() {
@@ -3909,8 +3946,10 @@ void VM_RedefineClasses::redefine_single_class(jclass the_jclass,
   JvmtiBreakpoints& jvmti_breakpoints = JvmtiCurrentBreakpoints::get_jvmti_breakpoints();
   jvmti_breakpoints.clearall_in_class_at_safepoint(the_class());
 
-  // Deoptimize all compiled code that depends on this class
-  flush_dependent_code(the_class, THREAD);
+  // Queue compiled code that depends on this class for deoptimization.
+  // The code cache scan and the invalidation itself are batched in doit()
+  // for the whole operation.
+  mark_dependent_code(the_class);
 
   _old_methods = the_class->methods();
   _new_methods = scratch_class->methods();
@@ -375,6 +375,15 @@ class VM_RedefineClasses: public VM_Operation {
   Klass**                     _scratch_classes;
   jvmtiError                  _res;
 
+  // Set by mark_dependent_code() when at least one nmethod was marked;
+  // tells flush_dependent_code() whether a deoptimization pass is needed.
+  bool                        _any_dependents_marked;
+
+  // Old method versions of all redefined classes, collected by
+  // mark_dependent_code() and consumed by flush_dependent_code() in a
+  // single evolution-dependence scan over the code cache.
+  GrowableArray<Method*>*     _evol_dependee_methods;
+
   // Performance measurement support. These timers do not cover all
   // the work done for JVM/TI RedefineClasses() but they do cover
   // the heavy lifting.
@@ -488,7 +497,11 @@ class VM_RedefineClasses: public VM_Operation {
          instanceKlassHandle scratch_class,
          constantPoolHandle scratch_cp, int scratch_cp_length, TRAPS);
 
-  void flush_dependent_code(instanceKlassHandle k_h, TRAPS);
+  // Mark compiled code that depends on k_h for deoptimization. The actual
+  // stack walk and invalidation is batched in flush_dependent_code() and
+  // done once per VM operation, after all classes have been redefined.
+  void mark_dependent_code(instanceKlassHandle k_h);
+  void flush_dependent_code();
 
   // lock classes to redefine since constant pool merging isn't thread safe.
   void lock_classes();
@@ -33,11 +33,13 @@
 #include "memory/allocation.inline.hpp"
 #include "prims/jni.h"
 #include "prims/jvm.h"
+#include "prims/unsafeMemoryPool.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/interfaceSupport.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "runtime/orderAccess.inline.hpp"
 #include "runtime/reflection.hpp"
+#include "runtime/stubRoutines.hpp"
 #include "runtime/synchronizer.hpp"
 #include "services/threadService.hpp"
 #include "utilities/copy.hpp"
@@ -631,7 +633,10 @@ UNSAFE_ENTRY(jlong, Unsafe_AllocateMemory(JNIEnv *env, jobject unsafe, jlong siz
     return 0;
   }
   sz = round_to(sz, HeapWordSize);
-  void* x = os::malloc(sz, mtInternal);
+  void* x = UseUnsafeMemoryPool ? UnsafeMemoryPool::allocate(sz) : NULL;
+  if (x == NULL) {
+    x = os::malloc(sz, mtInternal);
+  }
   if (x == NULL) {
     THROW_0(vmSymbols::java_lang_OutOfMemoryError());
   }
@@ -647,10 +652,32 @@ UNSAFE_ENTRY(jlong, Unsafe_ReallocateMemory(JNIEnv *env, jobject unsafe, jlong a
     THROW_0(vmSymbols::java_lang_IllegalArgumentException());
   }
   if (sz == 0) {
-    os::free(p);
+    if (!UseUnsafeMemoryPool || !UnsafeMemoryPool::free_if_pooled(p)) {
+      os::free(p);
+    }
     return 0;
   }
   sz = round_to(sz, HeapWordSize);
+  if (UseUnsafeMemoryPool && p != NULL) {
+    size_t old_size = UnsafeMemoryPool::block_size(p);
+    if (old_size != 0) {
+      // Pooled blocks cannot be handed to os::realloc. Shrinking stays in
+      // the block; growing moves the contents to a new allocation.
+      if (sz <= old_size) {
+        return addr_to_java(p);
+      }
+      void* x = UnsafeMemoryPool::allocate(sz);
+      if (x == NULL) {
+        x = os::malloc(sz, mtInternal);
+      }
+      if (x == NULL) {
+        THROW_0(vmSymbols::java_lang_OutOfMemoryError());
+      }
+      memcpy(x, p, old_size);
+      UnsafeMemoryPool::free_if_pooled(p);
+      return addr_to_java(x);
+    }
+  }
   void* x = (p == NULL) ? os::malloc(sz, mtInternal) : os::realloc(p, sz, mtInternal);
   if (x == NULL) {
     THROW_0(vmSymbols::java_lang_OutOfMemoryError());
@@ -664,6 +691,9 @@ UNSAFE_ENTRY(void, Unsafe_FreeMemory(JNIEnv *env, jobject unsafe, jlong addr))
   if (p == NULL) {
     return;
   }
+  if (UseUnsafeMemoryPool && UnsafeMemoryPool::free_if_pooled(p)) {
+    return;
+  }
   os::free(p);
 UNSAFE_END
 
@@ -688,6 +718,20 @@ UNSAFE_ENTRY(void, Unsafe_SetMemory2(JNIEnv *env, jobject unsafe, jobject obj, j
   Copy::fill_to_memory_atomic(p, sz, value);
 UNSAFE_END
 
+// Copy through the generated unsafe_arraycopy stub when available: it
+// dispatches on the alignment bits to the widest SSE/AVX copy loop the
+// CPU supports while keeping the same per-unit atomicity guarantee as
+// Copy::conjoint_memory_atomic. This is the same code C2's copyMemory
+// intrinsic calls, so the JNI path no longer lags compiled code.
+static void unsafe_copy_memory(void* src, void* dst, size_t sz) {
+  StubRoutines::UnsafeArrayCopyStub stub = StubRoutines::UnsafeArrayCopy_stub();
+  if (stub != NULL) {
+    stub(src, dst, sz);
+  } else {
+    Copy::conjoint_memory_atomic(src, dst, sz);
+  }
+}
+
 UNSAFE_ENTRY(void, Unsafe_CopyMemory(JNIEnv *env, jobject unsafe, jlong srcAddr, jlong dstAddr, jlong size))
   UnsafeWrapper("Unsafe_CopyMemory");
   if (size == 0) {
@@ -699,7 +743,7 @@ UNSAFE_ENTRY(void, Unsafe_CopyMemory(JNIEnv *env, jobject unsafe, jlong srcAddr,
   }
   void* src = addr_from_java(srcAddr);
   void* dst = addr_from_java(dstAddr);
-  Copy::conjoint_memory_atomic(src, dst, sz);
+  unsafe_copy_memory(src, dst, sz);
 UNSAFE_END
 
 UNSAFE_ENTRY(void, Unsafe_CopyMemory2(JNIEnv *env, jobject unsafe, jobject srcObj, jlong srcOffset, jobject dstObj, jlong dstOffset, jlong size))
@@ -721,7 +765,7 @@ UNSAFE_ENTRY(void, Unsafe_CopyMemory2(JNIEnv *env, jobject unsafe, jobject srcOb
   }
   void* src = index_oop_from_field_offset_long(srcp, srcOffset);
   void* dst = index_oop_from_field_offset_long(dstp, dstOffset);
-  Copy::conjoint_memory_atomic(src, dst, sz);
+  unsafe_copy_memory(src, dst, sz);
 UNSAFE_END
 
 
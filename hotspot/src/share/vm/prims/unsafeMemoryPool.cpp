@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "prims/unsafeMemoryPool.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutex.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.inline.hpp"
+#include "runtime/os.hpp"
+#include "services/memTracker.hpp"
+#include "utilities/copy.hpp"
+#include "utilities/ostream.hpp"
+
+UnsafeMemoryPool::SizeClass   UnsafeMemoryPool::_classes[UnsafeMemoryPool::_num_classes];
+UnsafeMemoryPool::SlabEntry*  UnsafeMemoryPool::_slab_table = NULL;
+volatile intptr_t             UnsafeMemoryPool::_fallback_allocs = 0;
+
+// Total slabs across all classes, so insertion can keep the table sparse.
+static volatile intptr_t _unsafe_pool_slab_count = 0;
+
+void UnsafeMemoryPool::initialize() {
+  assert(_slab_table == NULL, "initialize only once");
+  for (int i = 0; i < _num_classes; i++) {
+    _classes[i]._lock = new Mutex(Mutex::leaf, "UnsafeMemoryPool_lock", true);
+    _classes[i]._free_list    = NULL;
+    _classes[i]._slab_count   = 0;
+    _classes[i]._total_blocks = 0;
+    _classes[i]._free_blocks  = 0;
+  }
+  SlabEntry* table = NEW_C_HEAP_ARRAY(SlabEntry, _slab_table_size, mtInternal);
+  Copy::zero_to_bytes(table, _slab_table_size * sizeof(SlabEntry));
+  _slab_table = table;
+}
+
+int UnsafeMemoryPool::class_index_for(size_t size) {
+  if (size > ((size_t) 1 << _max_block_log)) {
+    return -1;
+  }
+  size_t block = (size_t) 1 << _min_block_log;
+  int index = 0;
+  while (block < size) {
+    block <<= 1;
+    index++;
+  }
+  return index;
+}
+
+int UnsafeMemoryPool::slab_hash(char* base) {
+  // Slab bases are _slab_size aligned; drop the always-zero low bits
+  // before scrambling, or every base would hash to the same slot.
+  uintptr_t h = (uintptr_t) base / _slab_size;
+  h *= 2654435761u;
+  return (int) (h & (_slab_table_size - 1));
+}
+
+// Claimed-but-not-published slots hold this marker in _base: it is never a
+// valid slab base, so concurrent lookups just probe past it.
+static char* const _slab_claimed = (char*) 1;
+
+void UnsafeMemoryPool::insert_slab(char* base, int index) {
+  int i = slab_hash(base);
+  while (true) {
+    SlabEntry* entry = &_slab_table[i];
+    if (entry->_base == NULL &&
+        Atomic::cmpxchg_ptr(_slab_claimed, &entry->_base, (char*) NULL) == NULL) {
+      entry->_class_index = index;
+      // Publish the base only after the class index is visible.
+      OrderAccess::release_store_ptr((volatile intptr_t*) &entry->_base, (intptr_t) base);
+      return;
+    }
+    i = (i + 1) & (_slab_table_size - 1);
+  }
+}
+
+int UnsafeMemoryPool::lookup_slab(void* p) {
+  if (_slab_table == NULL) {
+    return -1;
+  }
+  char* base = (char*) align_ptr_down(p, _slab_size);
+  int i = slab_hash(base);
+  while (true) {
+    SlabEntry* entry = &_slab_table[i];
+    char* b = (char*) OrderAccess::load_ptr_acquire((volatile void*) &entry->_base);
+    if (b == NULL) {
+      return -1;
+    }
+    if (b == base) {
+      return entry->_class_index;
+    }
+    i = (i + 1) & (_slab_table_size - 1);
+  }
+}
+
+// Called with the class lock held.
+bool UnsafeMemoryPool::add_slab(int index) {
+  // Keep the slab table at most half full, so probe chains stay short.
+  if (_unsafe_pool_slab_count >= _slab_table_size / 2) {
+    return false;
+  }
+  char* base = os::reserve_memory_aligned(_slab_size, _slab_size);
+  if (base == NULL) {
+    return false;
+  }
+  if (!os::commit_memory(base, _slab_size, false)) {
+    os::release_memory(base, _slab_size);
+    return false;
+  }
+  MemTracker::record_virtual_memory_type((address) base, mtInternal);
+
+  size_t block = (size_t) 1 << (_min_block_log + index);
+  SizeClass* sc = &_classes[index];
+  for (char* p = base; p < base + _slab_size; p += block) {
+    *(void**) p = sc->_free_list;
+    sc->_free_list = p;
+  }
+  sc->_slab_count++;
+  sc->_total_blocks += _slab_size / block;
+  sc->_free_blocks  += _slab_size / block;
+
+  insert_slab(base, index);
+  Atomic::add_ptr(1, &_unsafe_pool_slab_count);
+  return true;
+}
+
+void* UnsafeMemoryPool::allocate(size_t size) {
+  int index = class_index_for(size);
+  if (index < 0) {
+    Atomic::add_ptr(1, &_fallback_allocs);
+    return NULL;
+  }
+  SizeClass* sc = &_classes[index];
+  MutexLockerEx ml(sc->_lock, Mutex::_no_safepoint_check_flag);
+  if (sc->_free_list == NULL && !add_slab(index)) {
+    Atomic::add_ptr(1, &_fallback_allocs);
+    return NULL;
+  }
+  void* p = sc->_free_list;
+  sc->_free_list = *(void**) p;
+  sc->_free_blocks--;
+  return p;
+}
+
+bool UnsafeMemoryPool::free_if_pooled(void* p) {
+  int index = lookup_slab(p);
+  if (index < 0) {
+    return false;
+  }
+  assert(((uintptr_t) p & (((uintptr_t) 1 << (_min_block_log + index)) - 1)) == 0,
+         "pooled pointer must be block aligned");
+  SizeClass* sc = &_classes[index];
+  MutexLockerEx ml(sc->_lock, Mutex::_no_safepoint_check_flag);
+  *(void**) p = sc->_free_list;
+  sc->_free_list = p;
+  sc->_free_blocks++;
+  return true;
+}
+
+size_t UnsafeMemoryPool::block_size(void* p) {
+  int index = lookup_slab(p);
+  return (index < 0) ? 0 : ((size_t) 1 << (_min_block_log + index));
+}
+
+void UnsafeMemoryPool::print_on(outputStream* st) {
+  st->print_cr("Unsafe memory pool (slab size " SIZE_FORMAT "K):", _slab_size / K);
+  st->print_cr("%12s %8s %12s %12s %14s", "block bytes", "slabs", "blocks", "free", "used bytes");
+  size_t total_used = 0;
+  size_t total_committed = 0;
+  for (int i = 0; i < _num_classes; i++) {
+    size_t block = (size_t) 1 << (_min_block_log + i);
+    SizeClass* sc = &_classes[i];
+    MutexLockerEx ml(sc->_lock, Mutex::_no_safepoint_check_flag);
+    size_t used = (sc->_total_blocks - sc->_free_blocks) * block;
+    st->print_cr(SIZE_FORMAT_W(12) " " SIZE_FORMAT_W(8) " " SIZE_FORMAT_W(12) " " SIZE_FORMAT_W(12) " " SIZE_FORMAT_W(14),
+                 block, sc->_slab_count, sc->_total_blocks, sc->_free_blocks, used);
+    total_used += used;
+    total_committed += sc->_slab_count * _slab_size;
+  }
+  st->print_cr("Committed: " SIZE_FORMAT "K, used: " SIZE_FORMAT "K, fallback allocations: " INTPTR_FORMAT,
+               total_committed / K, total_used / K, _fallback_allocs);
+}
+
+void unsafeMemoryPool_init() {
+  if (UseUnsafeMemoryPool) {
+    UnsafeMemoryPool::initialize();
+  }
+}
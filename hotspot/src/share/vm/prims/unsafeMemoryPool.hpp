@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_PRIMS_UNSAFEMEMORYPOOL_HPP
+#define SHARE_VM_PRIMS_UNSAFEMEMORYPOOL_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class Mutex;
+class outputStream;
+
+// Size-classed pool for Unsafe.allocateMemory/freeMemory, enabled with
+// -XX:+UseUnsafeMemoryPool. Direct ByteBuffers are allocated and freed
+// through Unsafe at high rates by NIO-heavy applications, and routing
+// them through the C heap makes the application fight the malloc arenas.
+// The pool carves mmap-backed slabs (NMT-tagged as mtInternal) into
+// power-of-two blocks and recycles them on per-size-class free lists, so
+// a steady-state allocate/free workload never reaches malloc.
+//
+// Slabs are aligned to their own size and never unmapped; freed blocks
+// are found by aligning the pointer down to the slab boundary and looking
+// the slab up in an insert-only hash table, so pointers that did not come
+// from the pool fall through to os::free() untouched. Requests larger
+// than the largest size class always go to os::malloc().
+class UnsafeMemoryPool : AllStatic {
+private:
+  // Power-of-two size classes, 256 bytes to 1M, carved from 4M slabs.
+  static const int    _min_block_log = 8;
+  static const int    _max_block_log = 20;
+  static const int    _num_classes   = _max_block_log - _min_block_log + 1;
+  static const size_t _slab_size     = 4 * M;
+
+  // Insert-only, open-addressed table of slab bases, sized so it stays
+  // sparse at the maximum pooled footprint. Readers probe it without
+  // locking; inserts happen under the class lock with a releasing store.
+  static const int _slab_table_size = 8192;
+
+  struct SlabEntry {
+    char* volatile _base;
+    int            _class_index;
+  };
+
+  // Per-size-class state, all guarded by _lock. Blocks carry no header;
+  // a free block stores the next-pointer of the free list in its first
+  // word.
+  struct SizeClass {
+    Mutex* _lock;
+    void*  _free_list;
+    size_t _slab_count;
+    size_t _total_blocks;
+    size_t _free_blocks;
+  };
+
+  static SizeClass  _classes[_num_classes];
+  static SlabEntry* _slab_table;
+  static volatile intptr_t _fallback_allocs;
+
+  static int  class_index_for(size_t size);
+  static int  slab_hash(char* base);
+  static bool add_slab(int index);
+  static int  lookup_slab(void* p);
+  static void insert_slab(char* base, int index);
+
+public:
+  static void initialize();
+
+  // Returns NULL when the request does not fit a size class or a slab
+  // cannot be reserved; the caller falls back to os::malloc().
+  static void* allocate(size_t size);
+
+  // Returns false when p was not allocated from the pool.
+  static bool free_if_pooled(void* p);
+
+  // Usable size of a pooled block, or 0 when p is not from the pool.
+  static size_t block_size(void* p);
+
+  static void print_on(outputStream* st);
+};
+
+void unsafeMemoryPool_init();
+
+#endif // SHARE_VM_PRIMS_UNSAFEMEMORYPOOL_HPP
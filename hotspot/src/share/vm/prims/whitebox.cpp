@@ -51,6 +51,8 @@
 #include "gc_implementation/g1/concurrentMarkThread.hpp"
 #include "gc_implementation/g1/g1CollectedHeap.inline.hpp"
 #include "gc_implementation/g1/heapRegionRemSet.hpp"
+#include "gc_implementation/shenandoah/shenandoahHeap.hpp"
+#include "gc_implementation/shenandoah/heuristics/shenandoahHeuristics.hpp"
 #endif // INCLUDE_ALL_GCS
 
 #if INCLUDE_NMT
@@ -354,6 +356,17 @@ WB_ENTRY(jobject, WB_G1AuxiliaryMemoryUsage(JNIEnv* env))
   Handle h = MemoryService::create_MemoryUsage_obj(usage, CHECK_NULL);
   return JNIHandles::make_local(env, h());
 WB_END
+
+WB_ENTRY(void, WB_ShenandoahScheduleGC(JNIEnv* env, jobject o, jboolean start, jlong defer_ms))
+  assert(UseShenandoahGC, "Only with Shenandoah");
+  ShenandoahHeuristics* heuristics = ShenandoahHeap::heap()->heuristics();
+  if (defer_ms > 0) {
+    heuristics->record_schedule_defer_hint(defer_ms);
+  }
+  if (start) {
+    heuristics->record_schedule_start_hint();
+  }
+WB_END
 #endif // INCLUDE_ALL_GCS
 
 #if INCLUDE_NMT
@@ -1246,6 +1259,7 @@ static JNINativeMethod methods[] = {
   {CC"g1StartConcMarkCycle",       CC"()Z",           (void*)&WB_G1StartMarkCycle  },
   {CC"g1AuxiliaryMemoryUsage", CC"()Ljava/lang/management/MemoryUsage;",
                                                       (void*)&WB_G1AuxiliaryMemoryUsage  },
+  {CC"shenandoahScheduleGC", CC"(ZJ)V",               (void*)&WB_ShenandoahScheduleGC },
 #endif // INCLUDE_ALL_GCS
 #if INCLUDE_NMT
   {CC"NMTMalloc",           CC"(J)J",                 (void*)&WB_NMTMalloc          },
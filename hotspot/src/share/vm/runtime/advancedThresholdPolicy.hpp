@@ -159,8 +159,6 @@ class CompileQueue;
 
 
 class AdvancedThresholdPolicy : public SimpleThresholdPolicy {
-  jlong _start_time;
-
   // Call and loop predicates determine whether a transition to a higher compilation
   // level should be performed (pointers to predicate functions are passed to common().
   // Predicates also take compiler load into account.
@@ -176,20 +174,9 @@ class AdvancedThresholdPolicy : public SimpleThresholdPolicy {
   // loop_event checks if a method should be OSR compiled at a different
   // level.
   CompLevel loop_event(Method* method, CompLevel cur_level);
-  // Has a method been long around?
-  // We don't remove old methods from the compile queue even if they have
-  // very low activity (see select_task()).
-  inline bool is_old(Method* method);
-  // Was a given method inactive for a given number of milliseconds.
-  // If it is, we would remove it from the queue (see select_task()).
-  inline bool is_stale(jlong t, jlong timeout, Method* m);
-  // Compute the weight of the method for the compilation scheduling
-  inline double weight(Method* method);
-  // Apply heuristics and return true if x should be compiled before y
-  inline bool compare_methods(Method* x, Method* y);
-  // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
-  // per millisecond.
-  inline void update_rate(jlong t, Method* m);
+  // is_old/is_stale/weight/compare_methods/update_rate moved to
+  // SimpleThresholdPolicy so that both tiered policies schedule the
+  // compile queues by event rate.
   // Compute threshold scaling coefficient
   inline double threshold_scale(CompLevel level, int feedback_k);
   // If a method is old enough and is still in the interpreter we would want to
@@ -207,8 +194,6 @@ protected:
   void print_specific(EventType type, methodHandle mh, methodHandle imh, int bci, CompLevel level);
 
   void set_increase_threshold_at_ratio() { _increase_threshold_at_ratio = 100 / (100 - (double)IncreaseFirstTierCompileThresholdAt); }
-  void set_start_time(jlong t) { _start_time = t;    }
-  jlong start_time() const     { return _start_time; }
 
   // Submit a given method for compilation (and update the rate).
   virtual void submit_compile(methodHandle mh, int bci, CompLevel level, JavaThread* thread);
@@ -218,7 +203,7 @@ protected:
   virtual void method_back_branch_event(methodHandle method, methodHandle inlinee,
                                         int bci, CompLevel level, nmethod* nm, JavaThread* thread);
 public:
-  AdvancedThresholdPolicy() : _start_time(0) { }
+  AdvancedThresholdPolicy() { }
   // Select task is called by CompileBroker. We should return a task or NULL.
   virtual CompileTask* select_task(CompileQueue* compile_queue);
   virtual void initialize();
@@ -1843,6 +1843,14 @@ void Arguments::set_shenandoah_gc_flags() {
     FLAG_SET_DEFAULT(ParallelRefProcEnabled, true);
   }
 
+  // Shenandoah discovers references with as many queues as there are workers,
+  // and work stealing during the transitive closure evens out the load. The
+  // optional pre-balancing of the discovered lists is a serial step in the
+  // pause, and is not worth it here.
+  if (FLAG_IS_DEFAULT(ParallelRefProcBalancingEnabled)) {
+    FLAG_SET_DEFAULT(ParallelRefProcBalancingEnabled, false);
+  }
+
 #if INCLUDE_ALL_GCS
   if (ShenandoahRegionSampling && FLAG_IS_DEFAULT(PerfDataMemorySize)) {
     // When sampling is enabled, max out the PerfData memory to get more
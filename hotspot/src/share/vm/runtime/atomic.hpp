@@ -95,6 +95,29 @@ class Atomic : AllStatic {
 
   inline static intptr_t cmpxchg_ptr(intptr_t exchange_value, volatile intptr_t* dest, intptr_t compare_value);
   inline static void*    cmpxchg_ptr(void*    exchange_value, volatile void*     dest, void*    compare_value);
+
+  // Weak compare-and-exchange: returns true if *dest was atomically changed from
+  // compare_value to exchange_value. May fail spuriously, i.e. return false even
+  // though *dest == compare_value, so callers must either retry in a loop or be
+  // prepared to treat the failure like a lost race. On LL/SC machines the weak
+  // form avoids the internal retry loop that the strong cmpxchg above needs.
+  //
+  // The unsuffixed variant keeps the conservative two-way barrier of the strong
+  // cmpxchg. The _acq_rel variant gives acquire+release semantics on success and
+  // no more than acquire on failure; the _relaxed variant imposes no ordering at
+  // all. Ports that cannot do better simply fall back to the fully-fenced strong
+  // cmpxchg (see atomic.inline.hpp), which is always correct.
+  inline static bool cmpxchg_weak        (jint     exchange_value, volatile jint*     dest, jint     compare_value);
+  inline static bool cmpxchg_weak_acq_rel(jint     exchange_value, volatile jint*     dest, jint     compare_value);
+  inline static bool cmpxchg_weak_acq_rel(jbyte    exchange_value, volatile jbyte*    dest, jbyte    compare_value);
+  inline static bool cmpxchg_weak_relaxed(jint     exchange_value, volatile jint*     dest, jint     compare_value);
+
+  inline static bool cmpxchg_ptr_weak        (intptr_t exchange_value, volatile intptr_t* dest, intptr_t compare_value);
+  inline static bool cmpxchg_ptr_weak_acq_rel(intptr_t exchange_value, volatile intptr_t* dest, intptr_t compare_value);
+
+  // Atomically add to a location with no ordering guarantees, return updated
+  // value. For counters that are read only under some stronger synchronization.
+  inline static jint add_relaxed(jint add_value, volatile jint* dest);
 };
 
 // To use Atomic::inc(jshort* dest) and Atomic::dec(jshort* dest), the address must be specially
@@ -73,4 +73,41 @@
 # include "atomic_bsd_zero.inline.hpp"
 #endif
 
+// Conservative fallbacks for the explicitly-ordered operations: delegate to the
+// fully-fenced strong forms, which subsume every weaker ordering. Ports that can
+// do better (see atomic_linux_aarch64.inline.hpp) define ATOMIC_HAVE_ORDERED_OPS
+// and provide their own definitions. Note that the fallbacks never fail
+// spuriously, which is an allowed implementation of the weak contract.
+#ifndef ATOMIC_HAVE_ORDERED_OPS
+
+inline bool Atomic::cmpxchg_weak(jint exchange_value, volatile jint* dest, jint compare_value) {
+  return cmpxchg(exchange_value, dest, compare_value) == compare_value;
+}
+
+inline bool Atomic::cmpxchg_weak_acq_rel(jint exchange_value, volatile jint* dest, jint compare_value) {
+  return cmpxchg(exchange_value, dest, compare_value) == compare_value;
+}
+
+inline bool Atomic::cmpxchg_weak_acq_rel(jbyte exchange_value, volatile jbyte* dest, jbyte compare_value) {
+  return cmpxchg(exchange_value, dest, compare_value) == compare_value;
+}
+
+inline bool Atomic::cmpxchg_weak_relaxed(jint exchange_value, volatile jint* dest, jint compare_value) {
+  return cmpxchg(exchange_value, dest, compare_value) == compare_value;
+}
+
+inline bool Atomic::cmpxchg_ptr_weak(intptr_t exchange_value, volatile intptr_t* dest, intptr_t compare_value) {
+  return cmpxchg_ptr(exchange_value, dest, compare_value) == compare_value;
+}
+
+inline bool Atomic::cmpxchg_ptr_weak_acq_rel(intptr_t exchange_value, volatile intptr_t* dest, intptr_t compare_value) {
+  return cmpxchg_ptr(exchange_value, dest, compare_value) == compare_value;
+}
+
+inline jint Atomic::add_relaxed(jint add_value, volatile jint* dest) {
+  return add(add_value, dest);
+}
+
+#endif // !ATOMIC_HAVE_ORDERED_OPS
+
 #endif // SHARE_VM_RUNTIME_ATOMIC_INLINE_HPP
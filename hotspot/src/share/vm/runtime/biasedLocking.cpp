@@ -27,6 +27,7 @@
 #include "oops/markOop.hpp"
 #include "runtime/basicLock.hpp"
 #include "runtime/biasedLocking.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/task.hpp"
 #include "runtime/vframe.hpp"
 #include "runtime/vmThread.hpp"
@@ -644,6 +645,39 @@ BiasedLocking::Condition BiasedLocking::revoke_and_rebias(Handle obj, bool attem
       }
       return cond;
     } else {
+      // If the thread toward which the object is biased has exited, the
+      // object cannot be locked by it and the bias can be revoked with a
+      // CAS under the Threads_lock, sparing the VM_RevokeBias safepoint.
+      // Holding the Threads_lock keeps the owner from being removed and
+      // a starting thread from reusing its storage while we examine the
+      // thread list; on any race we simply fall through to the VM
+      // operation, which re-examines everything at a safepoint.
+      bool revoked_dead_owner = false;
+      {
+        MutexLocker ml(Threads_lock);
+        markOop cur_mark = obj->mark();
+        if (cur_mark->has_bias_pattern() && !cur_mark->is_biased_anonymously()) {
+          JavaThread* owner = cur_mark->biased_locker();
+          if (owner != THREAD && !Threads::includes(owner)) {
+            markOop unbiased_prototype = markOopDesc::prototype()->set_age(cur_mark->age());
+            markOop res_mark = (markOop) Atomic::cmpxchg_ptr(unbiased_prototype, obj->mark_addr(), cur_mark);
+            revoked_dead_owner = (res_mark == cur_mark);
+          }
+        }
+      }
+      if (revoked_dead_owner) {
+        if (TraceBiasedLocking) {
+          ResourceMark rm;
+          tty->print_cr("Revoking bias of object biased toward dead thread without safepoint");
+        }
+        EventBiasedLockRevocation event;
+        if (event.should_commit()) {
+          event.set_lockClass(k);
+          event.commit();
+        }
+        return BIAS_REVOKED;
+      }
+
       EventBiasedLockRevocation event;
       VM_RevokeBias revoke(&obj, (JavaThread*) THREAD);
       VMThread::execute(&revoke);
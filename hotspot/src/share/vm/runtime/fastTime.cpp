@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "runtime/fastTime.hpp"
+#include "runtime/orderAccess.inline.hpp"
+#include "runtime/os.hpp"
+#include "runtime/task.hpp"
+#if defined(X86) && !defined(ZERO)
+#include "rdtsc_x86.hpp"
+#endif
+
+// The fast path is only wired up where we have both an invariant TSC and a
+// raw monotonic clock to calibrate against.
+#if defined(X86) && !defined(ZERO) && defined(TARGET_OS_FAMILY_linux)
+#define FAST_TIME_SUPPORTED 1
+#endif
+
+volatile jint FastTime::_calibration_seq = 0;
+jlong         FastTime::_tsc_base = 0;
+jlong         FastTime::_nanos_base = 0;
+double        FastTime::_nanos_per_tick = .0;
+bool          FastTime::_enabled = false;
+jlong         FastTime::_last_os_nanos = 0;
+jlong         FastTime::_last_tsc = 0;
+
+class FastTimeCalibrationTask : public PeriodicTask {
+ public:
+  FastTimeCalibrationTask(size_t interval_time) : PeriodicTask(interval_time) {}
+  void task() { FastTime::calibrate(); }
+};
+
+// Reads the OS monotonic clock directly; os::javaTimeNanos() cannot be used
+// here because it routes back to FastTime::now() once enabled.
+jlong FastTime::os_monotonic_nanos() {
+#ifdef FAST_TIME_SUPPORTED
+  struct timespec tp;
+  int status = os::Linux::clock_gettime(CLOCK_MONOTONIC, &tp);
+  assert(status == 0, "gettime error");
+  return jlong(tp.tv_sec) * NANOSECS_PER_SEC + jlong(tp.tv_nsec);
+#else
+  ShouldNotReachHere();
+  return 0;
+#endif
+}
+
+void FastTime::calibrate() {
+#ifdef FAST_TIME_SUPPORTED
+  // Single writer: the thread running engage(), then only the WatcherThread.
+  const jlong os_now = os_monotonic_nanos();
+  const jlong tsc_now = Rdtsc::raw();
+
+  const jlong os_delta = os_now - _last_os_nanos;
+  const jlong tsc_delta = tsc_now - _last_tsc;
+  if (_enabled && (os_delta <= 0 || tsc_delta <= 0)) {
+    // implausible readings; keep the current parameters and try again at
+    // the next interval
+    return;
+  }
+
+  double nanos_per_tick = _nanos_per_tick;
+  jlong nanos_base = os_now;
+  if (_enabled) {
+    // Refine the tick period from the drift observed over the whole
+    // calibration interval, and rebase so the fast clock stays monotonic:
+    // the new base is never below the value the outgoing parameters would
+    // extrapolate for tsc_now.
+    nanos_per_tick = (double)os_delta / (double)tsc_delta;
+    const jlong extrapolated = _nanos_base +
+            (jlong)((double)(tsc_now - _tsc_base) * _nanos_per_tick);
+    nanos_base = MAX2(os_now, extrapolated);
+  }
+
+  const jint seq = _calibration_seq;
+  assert((seq & 1) == 0, "calibration already in flight");
+  OrderAccess::release_store(&_calibration_seq, seq + 1);
+  OrderAccess::storestore();
+  _tsc_base = tsc_now;
+  _nanos_base = nanos_base;
+  _nanos_per_tick = nanos_per_tick;
+  OrderAccess::release_store(&_calibration_seq, seq + 2);
+
+  _last_os_nanos = os_now;
+  _last_tsc = tsc_now;
+#endif
+}
+
+jlong FastTime::now() {
+#ifdef FAST_TIME_SUPPORTED
+  assert(_enabled, "fast time source not engaged");
+  while (true) {
+    const jint seq = OrderAccess::load_acquire(&_calibration_seq);
+    if ((seq & 1) == 0) {
+      const jlong tsc_base = _tsc_base;
+      const jlong nanos_base = _nanos_base;
+      const double nanos_per_tick = _nanos_per_tick;
+      OrderAccess::loadload();
+      if (_calibration_seq == seq) {
+        return nanos_base + (jlong)((double)(Rdtsc::raw() - tsc_base) * nanos_per_tick);
+      }
+    }
+    // the WatcherThread is mid-publication; retry
+    SpinPause();
+  }
+#else
+  ShouldNotReachHere();
+  return 0;
+#endif
+}
+
+void FastTime::engage() {
+  if (!UseFastJavaTimeNanos) {
+    return;
+  }
+#ifdef FAST_TIME_SUPPORTED
+  if (!os::Linux::supports_monotonic_clock()) {
+    warning("Ignoring UseFastJavaTimeNanos; no monotonic clock to calibrate against");
+    return;
+  }
+  if (!Rdtsc::is_supported()) {
+    warning("Ignoring UseFastJavaTimeNanos; hardware does not support invariant tsc");
+    return;
+  }
+  if (!Rdtsc::initialize() || Rdtsc::frequency() == 0) {
+    warning("Ignoring UseFastJavaTimeNanos; tsc frequency could not be determined");
+    return;
+  }
+
+  // seed the scale from the measured tsc frequency; the periodic task
+  // refines it against the OS clock from here on
+  _nanos_per_tick = (double)NANOSECS_PER_SEC / (double)Rdtsc::frequency();
+  calibrate();
+  _enabled = true;
+
+  FastTimeCalibrationTask* task = new FastTimeCalibrationTask((size_t)FastTimeCalibrationInterval);
+  task->enroll();
+#else
+  warning("Ignoring UseFastJavaTimeNanos; not supported on this platform");
+#endif
+}
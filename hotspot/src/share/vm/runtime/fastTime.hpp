@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_RUNTIME_FASTTIME_HPP
+#define SHARE_VM_RUNTIME_FASTTIME_HPP
+
+#include "memory/allocation.hpp"
+
+// TSC-backed time source for os::javaTimeNanos(), enabled with
+// -XX:+UseFastJavaTimeNanos on hardware with an invariant TSC. The TSC is
+// read directly in now() and converted to nanoseconds with a scale that the
+// WatcherThread recalibrates against the OS monotonic clock at
+// FastTimeCalibrationInterval; this keeps the fast clock within a small
+// bounded drift of CLOCK_MONOTONIC while avoiding the vDSO call on every
+// read. Calibration parameters are published seqlock-style, so readers
+// never block and never observe a half-written update. Like
+// UseFastUnorderedTimeStamps, this relies on the invariant TSC being
+// synchronized across sockets (checked via VM_Version at startup).
+
+class FastTime : AllStatic {
+  friend class FastTimeCalibrationTask;
+ private:
+  static volatile jint _calibration_seq;   // odd while an update is in flight
+  static jlong         _tsc_base;
+  static jlong         _nanos_base;
+  static double        _nanos_per_tick;
+  static bool          _enabled;
+
+  // raw readings from the previous calibration; only the WatcherThread
+  // touches these
+  static jlong         _last_os_nanos;
+  static jlong         _last_tsc;
+
+  static jlong os_monotonic_nanos();
+  static void calibrate();
+
+ public:
+  // checks hardware support, performs the initial calibration and enrolls
+  // the periodic recalibration task; called once from Threads::create_vm
+  static void engage();
+
+  static bool enabled() { return _enabled; }
+  static jlong now();
+};
+
+#endif // SHARE_VM_RUNTIME_FASTTIME_HPP
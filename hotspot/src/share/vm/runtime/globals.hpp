@@ -654,6 +654,18 @@ class CommandLineFlags {
           "A thread requesting compilation is not blocked during "          \
           "compilation")                                                    \
                                                                             \
+  product(bool, UseCompilationBudget, false,                                \
+          "Defer background compilations while the system load exceeds "   \
+          "the CPU budget available to the process")                        \
+                                                                            \
+  product(uintx, CompilationBudgetLoadPercent, 90,                          \
+          "System load, in percent of the processors available to the "    \
+          "process, above which background compilations are deferred")     \
+                                                                            \
+  product(uintx, CompilationBudgetDelay, 100,                               \
+          "Milliseconds a background compilation is deferred when the "    \
+          "CPU budget is exhausted")                                        \
+                                                                            \
   product(bool, PrintVMQWaitTime, false,                                    \
           "Print out the waiting time in VM operation queue")               \
                                                                             \
@@ -692,6 +704,11 @@ class CommandLineFlags {
   product(bool, UseInlineCaches, true,                                      \
           "Use Inline Caches for virtual calls ")                           \
                                                                             \
+  product(bool, MegamorphicReceiverPrediction, false,                       \
+          "Predict the receiver class at megamorphic interface call "      \
+          "sites to skip the itable scan on repeat receivers "             \
+          "(AMD64 only)")                                                   \
+                                                                            \
   develop(bool, InlineArrayCopy, true,                                      \
           "Inline arraycopy native that is known to be part of "            \
           "base library DLL")                                               \
@@ -816,6 +833,17 @@ class CommandLineFlags {
   diagnostic(uintx, LogEventsBufferEntries, 10,                             \
           "Number of ring buffer event logs")                               \
                                                                             \
+  product(bool, EnableVMTelemetry, false,                                   \
+          "Periodically sample VM internals (safepoints, compile queues, "  \
+          "code cache, heap) into an in-memory ring buffer that can be "    \
+          "exported with the VM.telemetry diagnostic command")              \
+                                                                            \
+  product(uintx, VMTelemetryInterval, 1000,                                 \
+          "Interval in milliseconds between VM telemetry samples")          \
+                                                                            \
+  product(uintx, VMTelemetryBufferEntries, 600,                             \
+          "Number of samples retained in the VM telemetry ring buffer")     \
+                                                                            \
   product(bool, BytecodeVerificationRemote, true,                           \
           "Enable the Java bytecode verifier for remote classes")           \
                                                                             \
@@ -945,6 +973,10 @@ class CommandLineFlags {
           "directory) of the dump file (defaults to java_pid<pid>.hprof "   \
           "in the working directory)")                                      \
                                                                             \
+  product(bool, HeapDumpAsyncIO, true,                                      \
+          "Overlap heap dump file writes with the heap walk using a "       \
+          "background writer thread")                                       \
+                                                                            \
   develop(uintx, SegmentedHeapDumpThreshold, 2*G,                           \
           "Generate a segmented heap dump (JAVA PROFILE 1.0.2 format) "     \
           "when the heap usage is larger than this")                        \
@@ -1046,6 +1078,12 @@ class CommandLineFlags {
   product(bool, OmitStackTraceInFastThrow, true,                            \
           "Omit backtraces for some 'hot' exceptions in optimized code")    \
                                                                             \
+  product(intx, FastThrowThreshold, 32,                                     \
+          "Number of times an implicit exception must be thrown from the "  \
+          "same site before interpreted and C1 code raises it as a "        \
+          "preallocated stackless exception "                               \
+          "(requires -XX:+OmitStackTraceInFastThrow)")                      \
+                                                                            \
   product(bool, ProfilerPrintByteCodeStatistics, false,                     \
           "Print bytecode statistics when dumping profiler output")         \
                                                                             \
@@ -1121,6 +1159,14 @@ class CommandLineFlags {
           "loadClass() even for class loaders registering "                 \
           "as parallel capable")                                            \
                                                                             \
+  product(bool, UseResolutionJournal, false,                                \
+          "Journal resolved constant pool class entries at VM exit and "    \
+          "re-resolve them at class link time on the next run")             \
+                                                                            \
+  product(ccstr, ResolutionJournalFile, NULL,                               \
+          "File holding the resolution journal "                            \
+          "(default: hs_resolution.journal)")                               \
+                                                                            \
   product(bool, AllowParallelDefineClass, false,                            \
           "Allow parallel defineClass requests for class loaders "          \
           "registering as parallel capable")                                \
@@ -1165,6 +1211,16 @@ class CommandLineFlags {
                                                                             \
   product(bool, MonitorInUseLists, false, "Track Monitors for Deflation")   \
                                                                             \
+  experimental(bool, ParallelMonitorDeflation, false,                       \
+          "Deflate the per-thread in-use monitor lists in parallel "        \
+          "using the GC worker threads (requires MonitorInUseLists)")       \
+                                                                            \
+  experimental(bool, UseXchgMonitorEnqueue, false,                          \
+          "Enqueue contending threads on an ObjectMonitor with an "         \
+          "unconditional atomic exchange instead of a CAS retry loop, "     \
+          "avoiding CAS failure storms on the queue head under heavy "      \
+          "contention")                                                     \
+                                                                            \
   product(intx, SyncFlags, 0, "(Unsafe, Unstable) Experimental Sync flags") \
                                                                             \
   product(intx, SyncVerbose, 0, "(Unstable)")                               \
@@ -1188,6 +1244,10 @@ class CommandLineFlags {
                                                                             \
   experimental(intx, NativeMonitorSpinLimit, 20, "(Unstable)")              \
                                                                             \
+  diagnostic(bool, ProfileMutexContention, false,                           \
+          "Collect contention statistics for VM internal mutexes, "         \
+          "printed by the VM.mutex_contention diagnostic command")          \
+                                                                            \
   develop(bool, UsePthreads, false,                                         \
           "Use pthread-based instead of libthread-based synchronization "   \
           "(SPARC only)")                                                   \
@@ -1239,6 +1299,10 @@ class CommandLineFlags {
   product(bool, UseFastJNIAccessors, true,                                  \
           "Use optimized versions of Get<Primitive>Field")                  \
                                                                             \
+  experimental(bool, UseJNILookupCache, false,                              \
+          "Cache JNI FindClass and Get(Static)MethodID lookups, "           \
+          "invalidated on class redefinition and unloading")                \
+                                                                            \
   product(intx, MaxJNILocalCapacity, 65536,                                 \
           "Maximum allowable local JNI handle capacity to "                 \
           "EnsureLocalCapacity() and PushLocalFrame(), "                    \
@@ -1269,6 +1333,10 @@ class CommandLineFlags {
   product(bool, CompactFields, true,                                        \
           "Allocate nonstatic fields in gaps between previous fields")      \
                                                                             \
+  product(bool, CompactInheritedGaps, false,                                \
+          "Allocate nonstatic fields in the alignment gap at the "          \
+          "superclass boundary")                                            \
+                                                                            \
   notproduct(bool, PrintFieldLayout, false,                                 \
           "Print field layout for each class")                              \
                                                                             \
@@ -2930,6 +2998,15 @@ class CommandLineFlags {
           "number of method invocations/branches (expressed as % of "       \
           "CompileThreshold) before using the method's profile")            \
                                                                             \
+  product(bool, SampleProfileUpdates, false,                                \
+          "Sample interpreter branch profile counter updates instead of "   \
+          "counting every event, reducing MethodData write traffic in "     \
+          "hot interpreted loops (AMD64 only)")                             \
+                                                                            \
+  product(uintx, ProfileSampleInterval, 16,                                 \
+          "Number of profiling events between samples when "                \
+          "SampleProfileUpdates is enabled")                                \
+                                                                            \
   develop(bool, PrintMethodData, false,                                     \
           "Print the results of +ProfileInterpreter at end of run")         \
                                                                             \
@@ -3238,6 +3315,15 @@ class CommandLineFlags {
   product(uintx, TLABAllocationWeight, 35,                                  \
           "Allocation averaging weight")                                    \
                                                                             \
+  product(bool, TLABBurstSizing, false,                                     \
+          "Size TLABs for the padded (average plus deviation) per-thread "  \
+          "allocation fraction instead of the plain average, so threads "   \
+          "with bursty allocation phases refill less often")                \
+                                                                            \
+  product(uintx, TLABBurstPadding, 2,                                       \
+          "Number of deviations by which TLABBurstSizing pads the "         \
+          "per-thread allocation fraction")                                 \
+                                                                            \
   product(uintx, TLABWasteTargetPercent, 1,                                 \
           "Percentage of Eden that can be wasted")                          \
                                                                             \
@@ -3358,6 +3444,10 @@ class CommandLineFlags {
                                                                             \
   product(intx, SafepointSpinBeforeYield, 2000, "(Unstable)")               \
                                                                             \
+  experimental(bool, UseCooperativeSampling, false,                         \
+          "Let threads record their own stack samples when they reach a "   \
+          "safepoint poll or VM transition, instead of being signalled")    \
+                                                                            \
   product(bool, PSChunkLargeArrays, true,                                   \
           "Process large arrays in chunks")                                 \
                                                                             \
@@ -3414,6 +3504,22 @@ class CommandLineFlags {
   product_pd(uintx, ReservedCodeCacheSize,                                  \
           "Reserved code cache size (in bytes) - maximum code cache size")  \
                                                                             \
+  product(bool, SegmentedCodeCache, false,                                  \
+          "Use a segmented code cache with separate heaps for "             \
+          "non-nmethods, profiled and non-profiled nmethods")               \
+                                                                            \
+  product(uintx, NonNMethodCodeHeapSize, 0,                                 \
+          "Size of code heap with non-nmethods (in bytes), "                \
+          "0 means ergonomically sized")                                    \
+                                                                            \
+  product(uintx, ProfiledCodeHeapSize, 0,                                   \
+          "Size of code heap with profiled methods (in bytes), "            \
+          "0 means ergonomically sized")                                    \
+                                                                            \
+  product(uintx, NonProfiledCodeHeapSize, 0,                                \
+          "Size of code heap with non-profiled methods (in bytes), "        \
+          "0 means ergonomically sized")                                    \
+                                                                            \
   product(uintx, CodeCacheMinimumFreeSpace, 500*K,                          \
           "When less than X space left, we stop compiling")                 \
                                                                             \
@@ -3423,6 +3529,10 @@ class CommandLineFlags {
   develop_pd(uintx, CodeCacheMinBlockLength,                                \
           "Minimum number of segments in a code cache block")               \
                                                                             \
+  product(uintx, InlineCacheBufferSize, 10*K,                               \
+          "Size (in bytes) of the buffer holding inline cache transition "  \
+          "stubs between safepoints")                                       \
+                                                                            \
   notproduct(bool, ExitOnFullCodeCache, false,                              \
           "Exit the VM if we fill the code cache")                          \
                                                                             \
@@ -3470,6 +3580,15 @@ class CommandLineFlags {
   product(ccstrlist, CompileCommand, "",                                    \
           "Prepend to .hotspot_compiler; e.g. log,java/lang/String.<init>") \
                                                                             \
+  product(ccstr, CompilationProfileDumpFile, NULL,                          \
+          "If set, write the list of compiled methods to this file at VM " \
+          "exit so that a later run can replay the compilations")           \
+                                                                            \
+  product(ccstr, CompilationProfileReplayFile, NULL,                        \
+          "If set, read a compilation profile written by "                  \
+          "CompilationProfileDumpFile at startup and queue the recorded "   \
+          "compilations to shorten warmup")                                 \
+                                                                            \
   develop(bool, ReplayCompiles, false,                                      \
           "Enable replay of compilations from ReplayDataFile")              \
                                                                             \
@@ -3775,6 +3894,11 @@ class CommandLineFlags {
   product(uintx, MaxDirectMemorySize, 0,                                    \
           "Maximum total size of NIO direct-buffer allocations")            \
                                                                             \
+  experimental(bool, UseUnsafeMemoryPool, false,                            \
+          "Serve Unsafe.allocateMemory from a VM-managed size-classed "     \
+          "pool of mmap-backed slabs instead of the C heap, avoiding "      \
+          "malloc arena contention for direct-buffer-heavy workloads")      \
+                                                                            \
   /* temporary developer defined flags  */                                  \
                                                                             \
   diagnostic(bool, UseNewCode, false,                                       \
@@ -3792,6 +3916,14 @@ class CommandLineFlags {
           "Flag to disable jvmstat instrumentation for performance testing "\
           "and problem isolation purposes")                                 \
                                                                             \
+  experimental(bool, UseThreadAllocationTable, false,                      \
+          "Export per-thread allocated bytes in a native table whose "      \
+          "geometry is published via the sun.threads.allocatedBytesTable "  \
+          "jvmstat constants")                                              \
+                                                                            \
+  experimental(intx, ThreadAllocationTableSize, 1024,                       \
+          "Maximum number of threads exported by UseThreadAllocationTable") \
+                                                                            \
   product(bool, PerfDataSaveToFile, false,                                  \
           "Save PerfData memory to hsperfdata_<pid> file on exit")          \
                                                                             \
@@ -4008,6 +4140,10 @@ class CommandLineFlags {
   product(ccstr, ExtraSharedClassListFile, NULL,                            \
           "Extra classlist for building the CDS archive file")              \
                                                                             \
+  diagnostic(bool, ClusterSharedClasses, false,                             \
+          "At CDS dump time, load classes from the same package "           \
+          "adjacently so their metadata shares pages in the archive")       \
+                                                                            \
   experimental(uintx, ArrayAllocatorMallocLimit,                            \
           SOLARIS_ONLY(64*K) NOT_SOLARIS(max_uintx),                        \
           "Allocation less than this value will be allocated "              \
@@ -4037,9 +4173,21 @@ class CommandLineFlags {
   JFR_ONLY(product(bool, UnlockCommercialFeatures, false,                   \
           "This flag is ignored. Left for compatibility"))                  \
                                                                             \
+  JFR_ONLY(experimental(uintx, ObjectAllocationSampleInterval, 512*K,       \
+          "Average number of allocated bytes between two JFR "              \
+          "ObjectAllocationSample events on the same thread"))              \
+                                                                            \
   experimental(bool, UseFastUnorderedTimeStamps, false,                     \
           "Use platform unstable time where supported for timestamps only") \
                                                                             \
+  experimental(bool, UseFastJavaTimeNanos, false,                           \
+          "Source System.nanoTime() from the invariant TSC, calibrated "    \
+          "periodically against the OS monotonic clock")                    \
+                                                                            \
+  experimental(intx, FastTimeCalibrationInterval, 1000,                     \
+          "Interval (in milliseconds) at which the TSC time source is "     \
+          "recalibrated against the OS monotonic clock")                    \
+                                                                            \
   JFR_ONLY(product(bool, LogJFR, false,                                     \
           "Enable JFR logging (consider +Verbose)"))                        \
 
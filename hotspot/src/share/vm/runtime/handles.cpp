@@ -106,6 +106,24 @@ void HandleArea::oops_do(OopClosure* f) {
   if (_prev != NULL) _prev->oops_do(f);
 }
 
+void HandleArea::recycle_chunks(Chunk* last) {
+  // Detach the chunks allocated past the popped mark. Up to the learned
+  // demand they stay on the thread-local spare list; the remainder goes
+  // back to the shared chunk pool.
+  Chunk* extra = last->next();
+  last->set_next(NULL);
+  while (extra != NULL && _spare_count < _spare_limit) {
+    Chunk* k = extra;
+    extra = extra->next();
+    k->set_next(_spare);
+    _spare = k;
+    _spare_count++;
+  }
+  if (extra != NULL) {
+    extra->chop();
+  }
+}
+
 void HandleMark::initialize(Thread* thread) {
   _thread = thread;
   // Save area
@@ -162,7 +180,7 @@ HandleMark::~HandleMark() {
     // arena size could exceed total chunk size
     assert(area->size_in_bytes() > size_in_bytes(), "Sanity check");
     area->set_size_in_bytes(size_in_bytes());
-    _chunk->next_chop();
+    area->recycle_chunks(_chunk);
   } else {
     assert(area->size_in_bytes() == size_in_bytes(), "Sanity check");
   }
@@ -225,21 +225,72 @@ class HandleArea: public Arena {
   int _no_handle_mark_nesting;
 #endif
   HandleArea* _prev;          // link to outer (older) area
+
+  // Spare chunks recycled from popped HandleMark scopes. JNI-heavy threads
+  // repeatedly grow and shrink the handle area on native transitions, and
+  // without the spares every round trip goes through the shared chunk pool
+  // and its lock. The limit learns the thread's demand: it grows each time
+  // the area runs dry with no spare at hand.
+  Chunk* _spare;
+  int    _spare_count;
+  int    _spare_limit;
+
+  static const int spare_limit_max = 16;
  public:
   // Constructor
   HandleArea(HandleArea* prev) : Arena(mtThread, Chunk::tiny_size) {
     debug_only(_handle_mark_nesting    = 0);
     debug_only(_no_handle_mark_nesting = 0);
     _prev = prev;
+    _spare = NULL;
+    _spare_count = 0;
+    _spare_limit = 0;
+  }
+
+  ~HandleArea() {
+    if (_spare != NULL) {
+      _spare->chop();
+    }
   }
 
   // Handle allocation
  private:
+  // Make a spare chunk current, the same way Arena::grow() appends a
+  // fresh one.
+  void install_spare_chunk() {
+    Chunk* k = _spare;
+    _spare = k->next();
+    _spare_count--;
+    k->set_next(NULL);
+    _chunk->set_next(k);
+    _chunk = k;
+    _hwm = k->bottom();
+    _max = k->top();
+    set_size_in_bytes(size_in_bytes() + k->length());
+  }
+
+  // Amalloc_4 with recycling in front: when the current chunk is full,
+  // prefer a thread-local spare over growing through the shared chunk pool.
+  void* handle_alloc() {
+    if (_hwm + oopSize > _max) {
+      if (_spare != NULL) {
+        install_spare_chunk();
+      } else if (_spare_limit < spare_limit_max) {
+        _spare_limit++;
+      }
+    }
+    return Amalloc_4(oopSize);
+  }
+
+  // Called when a HandleMark pops chunks allocated inside its scope;
+  // keeps up to _spare_limit of them, the rest go back to the pool.
+  void recycle_chunks(Chunk* last);
+
   oop* real_allocate_handle(oop obj) {
 #ifdef ASSERT
-    oop* handle = (oop*) (UseMallocOnly ? internal_malloc_4(oopSize) : Amalloc_4(oopSize));
+    oop* handle = (oop*) (UseMallocOnly ? internal_malloc_4(oopSize) : handle_alloc());
 #else
-    oop* handle = (oop*) Amalloc_4(oopSize);
+    oop* handle = (oop*) handle_alloc();
 #endif
     *handle = obj;
     return handle;
@@ -63,6 +63,9 @@ void InterfaceSupport_init();
 void universe2_init();  // dependent on codeCache_init and stubRoutines_init, loads primordial classes
 void referenceProcessor_init();
 void jni_handles_init();
+void unsafeMemoryPool_init(); // depends on mutex_init
+void jniLookupCache_init();   // depends on mutex_init
+void selfSampler_init();      // depends on mutex_init
 void vmStructs_init();
 
 void vtableStubs_init();
@@ -116,6 +119,9 @@ jint init_globals() {
   universe2_init();  // dependent on codeCache_init and stubRoutines_init1
   referenceProcessor_init();
   jni_handles_init();
+  unsafeMemoryPool_init();
+  jniLookupCache_init();
+  selfSampler_init();
 #if INCLUDE_VM_STRUCTS
   vmStructs_init();
 #endif // INCLUDE_VM_STRUCTS
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "classfile/classLoader.hpp"
+#include "classfile/resolutionJournal.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
@@ -59,8 +60,10 @@
 #include "runtime/task.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/timer.hpp"
+#include "runtime/vmThread.hpp"
 #include "runtime/vm_operations.hpp"
 #include "services/memTracker.hpp"
+#include "services/vmTelemetry.hpp"
 #include "utilities/dtrace.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/histogram.hpp"
@@ -508,6 +511,12 @@ void before_exit(JavaThread * thread) {
   StatSampler::disengage();
   StatSampler::destroy();
 
+  // shut down the telemetry sampler
+  VMTelemetry::disengage();
+
+  // Write the resolution journal while the dictionary is still intact
+  ResolutionJournal::dump();
+
   // Stop concurrent GC threads
   Universe::heap()->stop();
 
@@ -524,6 +533,11 @@ void before_exit(JavaThread * thread) {
     BytecodeHistogram::print();
   }
 
+  // Record the set of compiled methods so a later run can warm up faster.
+  if (CompilationProfileDumpFile != NULL) {
+    CompileBroker::dump_compilation_profile();
+  }
+
   if (JvmtiExport::should_post_thread_life()) {
     JvmtiExport::post_thread_end(thread);
   }
@@ -555,15 +569,13 @@ void before_exit(JavaThread * thread) {
   }
 
   if (VerifyStringTableAtExit) {
-    int fail_cnt = 0;
-    {
-      MutexLocker ml(StringTable_lock);
-      fail_cnt = StringTable::verify_and_compare_entries();
-    }
+    // Run at a safepoint; intern no longer serializes on a single lock.
+    VM_StringTableVerify op;
+    VMThread::execute(&op);
 
-    if (fail_cnt != 0) {
-      tty->print_cr("ERROR: fail_cnt=%d", fail_cnt);
-      guarantee(fail_cnt == 0, "unexpected StringTable verification failures");
+    if (op.fail_cnt() != 0) {
+      tty->print_cr("ERROR: fail_cnt=%d", op.fail_cnt());
+      guarantee(op.fail_cnt() == 0, "unexpected StringTable verification failures");
     }
   }
 
@@ -27,6 +27,7 @@
 #include "memory/iterator.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/thread.inline.hpp"
@@ -36,10 +37,22 @@
 
 PRAGMA_FORMAT_MUTE_WARNINGS_FOR_GCC
 
-JNIHandleBlock* JNIHandles::_global_handles       = NULL;
-JNIHandleBlock* JNIHandles::_weak_global_handles  = NULL;
+JNIHandleBlock* JNIHandles::_global_handles[JNIHandles::_stripe_count];
+JNIHandleBlock* JNIHandles::_weak_global_handles[JNIHandles::_stripe_count];
+Mutex*          JNIHandles::_global_handle_locks[JNIHandles::_stripe_count];
 oop             JNIHandles::_deleted_handle       = NULL;
 
+volatile jint   JNIHandles::_strong_claimed_stripe = 0;
+volatile jint   JNIHandles::_weak_claimed_stripe   = 0;
+volatile jint   JNIHandles::_weak_scan_serial      = 0;
+
+int JNIHandles::current_stripe() {
+  // Spread threads over the stripes; drop the low bits, which are zero for
+  // all Thread pointers due to allocation alignment.
+  uintptr_t hash = (uintptr_t) Thread::current();
+  return (int) ((hash >> 9) & (_stripe_count - 1));
+}
+
 
 jobject JNIHandles::make_local(oop obj) {
   if (obj == NULL) {
@@ -80,9 +93,10 @@ jobject JNIHandles::make_global(Handle obj) {
   jobject res = NULL;
   if (!obj.is_null()) {
     // ignore null handles
-    MutexLocker ml(JNIGlobalHandle_lock);
+    int stripe = current_stripe();
+    MutexLocker ml(_global_handle_locks[stripe]);
     assert(Universe::heap()->is_in_reserved(obj()), "sanity check");
-    res = _global_handles->allocate_handle(obj());
+    res = _global_handles[stripe]->allocate_handle(obj());
   } else {
     CHECK_UNHANDLED_OOPS_ONLY(Thread::current()->clear_unhandled_oops());
   }
@@ -96,9 +110,10 @@ jobject JNIHandles::make_weak_global(Handle obj) {
   if (!obj.is_null()) {
     // ignore null handles
     {
-      MutexLocker ml(JNIGlobalHandle_lock);
+      int stripe = current_stripe();
+      MutexLocker ml(_global_handle_locks[stripe]);
       assert(Universe::heap()->is_in_reserved(obj()), "sanity check");
-      res = _weak_global_handles->allocate_handle(obj());
+      res = _weak_global_handles[stripe]->allocate_handle(obj());
     }
     // Add weak tag.
     assert(is_ptr_aligned(res, weak_tag_alignment), "invariant");
@@ -142,12 +157,58 @@ void JNIHandles::destroy_weak_global(jobject handle) {
 
 void JNIHandles::oops_do(OopClosure* f) {
   f->do_oop(&_deleted_handle);
-  _global_handles->oops_do(f);
+  for (int i = 0; i < _stripe_count; i++) {
+    _global_handles[i]->oops_do(f);
+  }
 }
 
 
 void JNIHandles::weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f) {
-  _weak_global_handles->weak_oops_do(is_alive, f);
+  for (int i = 0; i < _stripe_count; i++) {
+    _weak_global_handles[i]->weak_oops_do(is_alive, f);
+  }
+
+  /*
+   * JVMTI data structures may also contain weak oops.  The iteration of them
+   * is placed here so that we don't need to add it to each of the collectors.
+   */
+  JvmtiExport::weak_oops_do(is_alive, f);
+}
+
+
+void JNIHandles::possibly_parallel_oops_do(OopClosure* f) {
+  for (;;) {
+    jint stripe = Atomic::add(1, &_strong_claimed_stripe) - 1;
+    if (stripe >= (jint)_stripe_count) {
+      break;
+    }
+    if (stripe == 0) {
+      // The shared sentinel goes with the first stripe.
+      f->do_oop(&_deleted_handle);
+    }
+    _global_handles[stripe]->oops_do(f);
+  }
+}
+
+
+void JNIHandles::possibly_parallel_weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f) {
+  // Claim individual blocks rather than whole stripes: JNI-cache-heavy
+  // applications grow chains of many thousands of blocks, and stripe-sized
+  // chunks would leave most workers idle behind the longest chain.  Blocks
+  // are claimed by stamping them with the round serial, so there is no
+  // per-block claim state to reset between rounds.
+  jint serial = _weak_scan_serial;
+  jint ticket = Atomic::add(1, &_weak_claimed_stripe) - 1;
+  if (ticket == 0) {
+    // The JVMTI weak oops go with the first claimant, see weak_oops_do().
+    JvmtiExport::weak_oops_do(is_alive, f);
+  }
+  // Start the workers on different stripes, so they do not all contend on
+  // the same chain prefix before spreading out.
+  for (int i = 0; i < _stripe_count; i++) {
+    int stripe = (int)((ticket + i) & (_stripe_count - 1));
+    _weak_global_handles[stripe]->parallel_weak_oops_do(serial, is_alive, f);
+  }
 }
 
 
@@ -158,8 +219,13 @@ void JNIHandles::weak_oops_do(OopClosure* f) {
 
 
 void JNIHandles::initialize() {
-  _global_handles      = JNIHandleBlock::allocate_block();
-  _weak_global_handles = JNIHandleBlock::allocate_block();
+  for (int i = 0; i < _stripe_count; i++) {
+    _global_handles[i]      = JNIHandleBlock::allocate_block();
+    _weak_global_handles[i] = JNIHandleBlock::allocate_block();
+    // Same rank as the former JNIGlobalHandle_lock: allocate_handle takes
+    // JNIHandleBlockFreeList_lock underneath.
+    _global_handle_locks[i] = new Mutex(Mutex::nonleaf, "JNIGlobalHandleStripe_lock", true);
+  }
   EXCEPTION_MARK;
   // We will never reach the CATCH below since Exceptions::_throw will cause
   // the VM to exit if an exception is thrown during initialization
@@ -197,20 +263,38 @@ bool JNIHandles::is_frame_handle(JavaThread* thr, jobject obj) {
 
 
 bool JNIHandles::is_global_handle(jobject handle) {
-  return _global_handles->chain_contains(handle);
+  for (int i = 0; i < _stripe_count; i++) {
+    if (_global_handles[i]->chain_contains(handle)) {
+      return true;
+    }
+  }
+  return false;
 }
 
 
 bool JNIHandles::is_weak_global_handle(jobject handle) {
-  return _weak_global_handles->chain_contains(handle);
+  for (int i = 0; i < _stripe_count; i++) {
+    if (_weak_global_handles[i]->chain_contains(handle)) {
+      return true;
+    }
+  }
+  return false;
 }
 
 long JNIHandles::global_handle_memory_usage() {
-  return _global_handles->memory_usage();
+  long usage = 0;
+  for (int i = 0; i < _stripe_count; i++) {
+    usage += _global_handles[i]->memory_usage();
+  }
+  return usage;
 }
 
 long JNIHandles::weak_global_handle_memory_usage() {
-  return _weak_global_handles->memory_usage();
+  long usage = 0;
+  for (int i = 0; i < _stripe_count; i++) {
+    usage += _weak_global_handles[i]->memory_usage();
+  }
+  return usage;
 }
 
 
@@ -231,7 +315,7 @@ public:
 // We assume this is called at a safepoint: no lock is needed.
 void JNIHandles::print_on(outputStream* st) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
-  assert(_global_handles != NULL && _weak_global_handles != NULL,
+  assert(_global_handles[0] != NULL && _weak_global_handles[0] != NULL,
          "JNIHandles not initialized");
 
   CountHandleClosure global_handle_count;
@@ -318,6 +402,7 @@ JNIHandleBlock* JNIHandleBlock::allocate_block(Thread* thread)  {
   }
   block->_top  = 0;
   block->_next = NULL;
+  block->_scan_serial = 0;
   block->_pop_frame_link = NULL;
   block->_planned_capacity = block_size_in_oops;
   // _last, _free_list & _allocate_before_rebuild initialized in allocate_handle
@@ -401,39 +486,63 @@ void JNIHandleBlock::oops_do(OopClosure* f) {
 }
 
 
+void JNIHandleBlock::weak_oops_do_block(BoolObjectClosure* is_alive,
+                                        OopClosure* f) {
+  for (int index = 0; index < _top; index++) {
+    oop* root = &(_handles)[index];
+    oop value = *root;
+    // traverse heap pointers only, not deleted handles or free list pointers
+    if (value != NULL && Universe::heap()->is_in_reserved(value)) {
+      if (is_alive->do_object_b(value)) {
+        // The weakly referenced object is alive, update pointer
+        f->do_oop(root);
+      } else {
+        // The weakly referenced object is not alive, clear the reference by storing NULL
+        if (TraceReferenceGC) {
+          tty->print_cr("Clearing JNI weak reference (" INTPTR_FORMAT ")", root);
+        }
+        *root = NULL;
+      }
+    }
+  }
+}
+
+
 void JNIHandleBlock::weak_oops_do(BoolObjectClosure* is_alive,
                                   OopClosure* f) {
   for (JNIHandleBlock* current = this; current != NULL; current = current->_next) {
     assert(current->pop_frame_link() == NULL,
       "blocks holding weak global JNI handles should not have pop frame link set");
-    for (int index = 0; index < current->_top; index++) {
-      oop* root = &(current->_handles)[index];
-      oop value = *root;
-      // traverse heap pointers only, not deleted handles or free list pointers
-      if (value != NULL && Universe::heap()->is_in_reserved(value)) {
-        if (is_alive->do_object_b(value)) {
-          // The weakly referenced object is alive, update pointer
-          f->do_oop(root);
-        } else {
-          // The weakly referenced object is not alive, clear the reference by storing NULL
-          if (TraceReferenceGC) {
-            tty->print_cr("Clearing JNI weak reference (" INTPTR_FORMAT ")", root);
-          }
-          *root = NULL;
-        }
-      }
-    }
+    current->weak_oops_do_block(is_alive, f);
     // the next handle block is valid only if current block is full
     if (current->_top < block_size_in_oops) {
       break;
     }
   }
+}
 
-  /*
-   * JVMTI data structures may also contain weak oops.  The iteration of them
-   * is placed here so that we don't need to add it to each of the collectors.
-   */
-  JvmtiExport::weak_oops_do(is_alive, f);
+
+bool JNIHandleBlock::try_claim_scan(jint serial) {
+  jint prev = _scan_serial;
+  return prev != serial &&
+         Atomic::cmpxchg(serial, &_scan_serial, prev) == prev;
+}
+
+
+void JNIHandleBlock::parallel_weak_oops_do(jint serial,
+                                           BoolObjectClosure* is_alive,
+                                           OopClosure* f) {
+  for (JNIHandleBlock* current = this; current != NULL; current = current->_next) {
+    assert(current->pop_frame_link() == NULL,
+      "blocks holding weak global JNI handles should not have pop frame link set");
+    if (current->try_claim_scan(serial)) {
+      current->weak_oops_do_block(is_alive, f);
+    }
+    // the next handle block is valid only if current block is full
+    if (current->_top < block_size_in_oops) {
+      break;
+    }
+  }
 }
 
 
@@ -29,6 +29,7 @@
 #include "utilities/top.hpp"
 
 class JNIHandleBlock;
+class Mutex;
 
 
 // Interface for creating and resolving local/global JNI handles
@@ -36,10 +37,26 @@ class JNIHandleBlock;
 class JNIHandles : AllStatic {
   friend class VMStructs;
  private:
-  static JNIHandleBlock* _global_handles;             // First global handle block
-  static JNIHandleBlock* _weak_global_handles;        // First weak global handle block
+  // Global handles are striped over several independent block chains, each
+  // guarded by its own lock, so JNI-heavy threads creating global refs do
+  // not serialize on a single mutex.  The stripes also give GC workers
+  // natural parallelism when scanning these roots.
+  enum { _stripe_count = 8 };                         // Power of two.
+  static JNIHandleBlock* _global_handles[_stripe_count];      // First global handle block per stripe
+  static JNIHandleBlock* _weak_global_handles[_stripe_count]; // First weak global handle block per stripe
+  static Mutex*          _global_handle_locks[_stripe_count]; // One allocation lock per stripe
   static oop _deleted_handle;                         // Sentinel marking deleted handles
 
+  // Claimed stripe high water marks for parallel chunked scanning. For the
+  // weak chains the counter only hands out starting offsets; the actual
+  // claims are per-block, stamped with _weak_scan_serial.
+  static volatile jint _strong_claimed_stripe;
+  static volatile jint _weak_claimed_stripe;
+  static volatile jint _weak_scan_serial;
+
+  // Stripe for allocations by the current thread
+  static int current_stripe();
+
   inline static bool is_jweak(jobject handle);
   inline static oop& jobject_ref(jobject handle); // NOT jweak!
   inline static oop& jweak_ref(jobject handle);
@@ -109,6 +126,19 @@ class JNIHandles : AllStatic {
   static void weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f);
   // Traversal of weak global handles.
   static void weak_oops_do(OopClosure* f);
+
+  // Possibly parallel versions of the above: callers from all workers claim
+  // work until the table is exhausted.  The strong scan claims whole stripes;
+  // the weak scan claims individual blocks, so long chains do not serialize
+  // behind a single worker.  The claim marks must be cleared
+  // (single-threaded) before each round of scanning.
+  static void possibly_parallel_oops_do(OopClosure* f);
+  static void possibly_parallel_weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f);
+  static void clear_parallel_claimed_stripes() {
+    _strong_claimed_stripe = 0;
+    _weak_claimed_stripe = 0;
+    _weak_scan_serial++;
+  }
 };
 
 
@@ -127,6 +157,7 @@ class JNIHandleBlock : public CHeapObj<mtInternal> {
   oop             _handles[block_size_in_oops]; // The handles
   int             _top;                         // Index of next unused handle
   JNIHandleBlock* _next;                        // Link to next block
+  volatile jint   _scan_serial;                 // Round stamp of the last parallel weak scan that claimed this block
 
   // The following instance variables are only used by the first block in a chain.
   // Having two types of blocks complicates the code and the space overhead in negligble.
@@ -157,6 +188,13 @@ class JNIHandleBlock : public CHeapObj<mtInternal> {
   // Free list computation
   void rebuild_free_list();
 
+  // Traversal of the weak handles in this block only
+  void weak_oops_do_block(BoolObjectClosure* is_alive, OopClosure* f);
+
+  // Stamp this block with the given round serial; returns true for exactly
+  // one caller per round
+  bool try_claim_scan(jint serial);
+
  public:
   // Handle allocation
   jobject allocate_handle(oop obj);
@@ -177,6 +215,9 @@ class JNIHandleBlock : public CHeapObj<mtInternal> {
   void oops_do(OopClosure* f);
   // Traversal of weak handles. Unreachable oops are cleared.
   void weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f);
+  // Parallel form: workers walk the whole chain, racing to claim individual
+  // blocks with the given round stamp; each block is scanned exactly once.
+  void parallel_weak_oops_do(jint serial, BoolObjectClosure* is_alive, OopClosure* f);
 
   // Checked JNI support
   void set_planned_capacity(size_t planned_capacity) { _planned_capacity = planned_capacity; }
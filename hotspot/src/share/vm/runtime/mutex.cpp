@@ -440,18 +440,36 @@ inline int Monitor::AcquireOrPush (ParkEvent * ESelf) {
 // synchronization functions.  The callers of IWait and ILock must have
 // performed any needed state transitions beforehand.
 // IWait and ILock may directly call park() without any concern for thread state.
-// Note that ILock and IWait do *not* access _owner.
+// Note that ILock and IWait do *not* access _owner, except for the racy
+// diagnostic-only owner sample taken when ProfileMutexContention is on.
 // _owner is a higher-level logical concept.
 
 void Monitor::ILock (Thread * Self) {
   assert (_OnDeck != Self->_MutexEvent, "invariant") ;
 
   if (TryFast()) {
- Exeunt:
     assert (ILocked(), "invariant") ;
     return ;
   }
 
+  if (ProfileMutexContention) {
+    // Sample the owner seen when contention was first noticed. The load is
+    // racy - _owner is a higher-level concept not maintained by the ILock
+    // subsystem - so the value is only ever reported as a hint.
+    Thread * owner = _owner ;
+    if (owner != NULL && owner != Self) {
+      _contended_owner = owner ;
+    }
+    jlong start = os::javaTimeNanos() ;
+    ILockSlow (Self) ;
+    record_contended_acquire (os::javaTimeNanos() - start) ;
+  } else {
+    ILockSlow (Self) ;
+  }
+  assert (ILocked(), "invariant") ;
+}
+
+void Monitor::ILockSlow (Thread * Self) {
   ParkEvent * const ESelf = Self->_MutexEvent ;
   assert (_OnDeck != ESelf, "invariant") ;
 
@@ -512,7 +530,22 @@ void Monitor::ILock (Thread * Self) {
   //    effective length of the critical section.
   // Note that (A) and (B) are tantamount to succession by direct handoff for
   // the inner lock.
-  goto Exeunt ;
+
+ Exeunt:
+  assert (ILocked(), "invariant") ;
+  return ;
+}
+
+void Monitor::record_contended_acquire (jlong elapsed_ns) {
+  Atomic::inc_ptr (&_contended_acquires) ;
+  jlong us = elapsed_ns / 1000 ;
+  if (us < 0) us = 0 ;     // be paranoid about non-monotonic clocks
+  Atomic::add_ptr ((intptr_t) us, &_contended_total_us) ;
+  int bucket = 0 ;
+  while (bucket < _contention_hist_size - 1 && us >= ((jlong) 1 << bucket)) {
+    bucket++ ;
+  }
+  Atomic::inc_ptr (&_contended_hist[bucket]) ;
 }
 
 void Monitor::IUnlock (bool RelaxAssert) {
@@ -1155,6 +1188,7 @@ void Monitor::ClearMonitor (Monitor * m, const char *name) {
   m->_OnDeck            = NULL ;
   m->_WaitSet           = NULL ;
   m->_WaitLock[0]       = 0 ;
+  m->reset_contention_stats() ;
 }
 
 Monitor::Monitor() { ClearMonitor(this); }
@@ -1191,6 +1225,32 @@ void Monitor::print_on_error(outputStream* st) const {
   st->print(" - owner thread: " PTR_FORMAT, _owner);
 }
 
+void Monitor::print_contention_on(outputStream* st) const {
+  st->print("%-30s " INTX_FORMAT " contended, " INTX_FORMAT " us blocked;",
+            _name, _contended_acquires, _contended_total_us);
+  for (int bucket = 0; bucket < _contention_hist_size; bucket++) {
+    intptr_t n = _contended_hist[bucket];
+    if (n != 0) {
+      if (bucket < _contention_hist_size - 1) {
+        st->print(" <%dus: " INTX_FORMAT, 1 << bucket, n);
+      } else {
+        st->print(" >=%dus: " INTX_FORMAT, 1 << (bucket - 1), n);
+      }
+    }
+  }
+}
+
+void Monitor::reset_contention_stats() {
+  // Plain stores; updates racing with a concurrent reset may survive it,
+  // which is acceptable for a diagnostic facility.
+  _contended_acquires = 0;
+  _contended_total_us = 0;
+  for (int bucket = 0; bucket < _contention_hist_size; bucket++) {
+    _contended_hist[bucket] = 0;
+  }
+  _contended_owner = NULL;
+}
+
 
 
 
@@ -131,6 +131,15 @@ class Monitor : public CHeapObj<mtInternal> {
   int NotifyCount ;                      // diagnostic assist
   char _name[MONITOR_NAME_LEN];          // Name of mutex
 
+  // Optional contention statistics, see ProfileMutexContention. Updated
+  // with atomics on the contended slow path only, read with plain loads
+  // at dump time, so the numbers are approximate by design.
+  enum { _contention_hist_size = 16 };
+  volatile intptr_t _contended_acquires; // acquisitions that took the slow path
+  volatile intptr_t _contended_total_us; // total time spent blocked acquiring
+  volatile intptr_t _contended_hist[_contention_hist_size]; // log2(usecs) buckets
+  Thread * volatile _contended_owner;    // owner sampled at last contention
+
   // Debugging fields for naming, deadlock detection, etc. (some only used in debug mode)
 #ifndef PRODUCT
   bool      _allow_vm_block;
@@ -167,8 +176,10 @@ class Monitor : public CHeapObj<mtInternal> {
    int  AcquireOrPush (ParkEvent * ev) ;
    void IUnlock (bool RelaxAssert) ;
    void ILock (Thread * Self) ;
+   void ILockSlow (Thread * Self) ;
    int  IWait (Thread * Self, jlong timo);
    int  ILocked () ;
+   void record_contended_acquire (jlong elapsed_ns) ;
 
  protected:
    static void ClearMonitor (Monitor * m, const char* name = NULL) ;
@@ -214,6 +225,12 @@ class Monitor : public CHeapObj<mtInternal> {
 
   void print_on_error(outputStream* st) const;
 
+  // Contention statistics support, see ProfileMutexContention.
+  bool has_contention_stats() const         { return _contended_acquires != 0; }
+  Thread* contended_owner() const           { return _contended_owner; }
+  void print_contention_on(outputStream* st) const;
+  void reset_contention_stats();
+
   #ifndef PRODUCT
     void print_on(outputStream* st) const;
     void print() const                      { print_on(tty); }
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "memory/resourceArea.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.inline.hpp"
@@ -43,7 +44,6 @@ Mutex*   PackageTable_lock            = NULL;
 Mutex*   CompiledIC_lock              = NULL;
 Mutex*   InlineCacheBuffer_lock       = NULL;
 Mutex*   VMStatistic_lock             = NULL;
-Mutex*   JNIGlobalHandle_lock         = NULL;
 Mutex*   JNIHandleBlockFreeList_lock  = NULL;
 Mutex*   MemberNameTable_lock         = NULL;
 Mutex*   JmethodIdCreation_lock       = NULL;
@@ -260,7 +260,6 @@ void mutex_init() {
   def(Terminator_lock              , Monitor, nonleaf,     true );
   def(VtableStubs_lock             , Mutex  , nonleaf,     true );
   def(Notify_lock                  , Monitor, nonleaf,     true );
-  def(JNIGlobalHandle_lock         , Mutex  , nonleaf,     true ); // locks JNIHandleBlockFreeList_lock
   def(JNICritical_lock             , Monitor, nonleaf,     true ); // used for JNI critical regions
   def(AdapterHandlerLibrary_lock   , Mutex  , nonleaf,     true);
   if (UseConcMarkSweepGC) {
@@ -337,3 +336,48 @@ void print_owned_locks_on_error(outputStream* st) {
   }
   if (none) st->print_cr("None");
 }
+
+// Print contention statistics for all globally registered mutexes/monitors;
+// called by the VM.mutex_contention diagnostic command.
+void print_mutex_contention(outputStream* st, bool reset) {
+  if (!ProfileMutexContention) {
+    st->print_cr("Mutex contention profiling is disabled, use -XX:+ProfileMutexContention to enable it.");
+    return;
+  }
+  bool none = true;
+  for (int i = 0; i < _num_mutex; i++) {
+    Monitor* m = _mutex_array[i];
+    if (m->has_contention_stats()) {
+      if (none) {
+        st->print_cr("Contended VM mutexes/monitors:");
+        none = false;
+      }
+      m->print_contention_on(st);
+      Thread* owner = m->contended_owner();
+      if (owner != NULL) {
+        st->print(" last owner: " PTR_FORMAT, owner);
+        // Resolve the sampled owner to a name if that thread is still around.
+        // The sample may be stale, so this is a hint, not an indictment.
+        MutexLocker ml(Threads_lock);
+        if (owner == (Thread*)VMThread::vm_thread()) {
+          st->print(" (VM Thread)");
+        } else {
+          ResourceMark rm;
+          for (JavaThread* t = Threads::first(); t != NULL; t = t->next()) {
+            if (owner == (Thread*)t) {
+              st->print(" (\"%s\")", t->get_thread_name());
+              break;
+            }
+          }
+        }
+      }
+      st->cr();
+    }
+    if (reset) {
+      m->reset_contention_stats();
+    }
+  }
+  if (none) {
+    st->print_cr("No contended VM mutexes/monitors.");
+  }
+}
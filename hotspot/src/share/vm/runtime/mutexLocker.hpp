@@ -51,7 +51,6 @@ extern Mutex*   PackageTable_lock;               // a lock on the class loader p
 extern Mutex*   CompiledIC_lock;                 // a lock used to guard compiled IC patching and access
 extern Mutex*   InlineCacheBuffer_lock;          // a lock used to guard the InlineCacheBuffer
 extern Mutex*   VMStatistic_lock;                // a lock used to guard statistics count increment
-extern Mutex*   JNIGlobalHandle_lock;            // a lock on creating JNI global handles
 extern Mutex*   JNIHandleBlockFreeList_lock;     // a lock on the JNI handle block free list
 extern Mutex*   MemberNameTable_lock;            // a lock on the MemberNameTable updates
 extern Mutex*   JmethodIdCreation_lock;          // a lock on creating JNI method identifiers
@@ -65,7 +64,7 @@ extern Mutex*   AdapterHandlerLibrary_lock;      // a lock on the AdapterHandler
 extern Mutex*   SignatureHandlerLibrary_lock;    // a lock on the SignatureHandlerLibrary
 extern Mutex*   VtableStubs_lock;                // a lock on the VtableStubs
 extern Mutex*   SymbolTable_lock;                // a lock on the symbol table
-extern Mutex*   StringTable_lock;                // a lock on the interned string table
+extern Mutex*   StringTable_lock;                // a lock on the interned string table's entry allocator; bucket chains are guarded by StringTable's stripe locks
 extern Monitor* StringDedupQueue_lock;           // a lock on the string deduplication queue
 extern Mutex*   StringDedupTable_lock;           // a lock on the string deduplication table
 extern Mutex*   CodeCache_lock;                  // a lock on the CodeCache, rank is special, use MutexLockerEx
@@ -178,6 +177,11 @@ extern Mutex*   UnsafeJlong_lock;                // provides Unsafe atomic updat
 // by fatal error handler.
 void print_owned_locks_on_error(outputStream* st);
 
+// Print contention statistics for all globally registered mutexes/monitors
+// (see ProfileMutexContention), optionally resetting the counters; called
+// by the VM.mutex_contention diagnostic command.
+void print_mutex_contention(outputStream* st, bool reset);
+
 char *lock_name(Mutex *mutex);
 
 class MutexLocker: StackObj {
@@ -505,6 +505,27 @@ int ObjectMonitor::TryLock (Thread * Self) {
    }
 }
 
+// With -XX:+UseXchgMonitorEnqueue contending threads push themselves onto
+// _cxq with an unconditional fetch-and-store of the list head instead of a
+// CAS retry loop.  When many threads arrive at once the CAS loop degenerates
+// into a failure storm on the head cacheline, while the exchange always
+// succeeds in one round trip.  The price is an MCS/CLH-style publication
+// protocol: a node becomes visible at the head of the list before its _next
+// link is set, so traversals must spin -- on the node's own cacheline, not
+// the contended head -- until the enqueueing thread publishes the link.
+// PendingNext marks a not-yet-published link.
+
+static ObjectWaiter * const PendingNext = (ObjectWaiter *) intptr_t(0x2BAD) ;
+
+static inline ObjectWaiter * NextWait (ObjectWaiter * node) {
+  ObjectWaiter * nxt = (ObjectWaiter *) OrderAccess::load_ptr_acquire((volatile void *) &node->_next) ;
+  while (nxt == PendingNext) {
+     SpinPause() ;
+     nxt = (ObjectWaiter *) OrderAccess::load_ptr_acquire((volatile void *) &node->_next) ;
+  }
+  return nxt ;
+}
+
 void ATTR ObjectMonitor::EnterI (TRAPS) {
     Thread * Self = THREAD ;
     assert (Self->is_Java_thread(), "invariant") ;
@@ -559,7 +580,15 @@ void ATTR ObjectMonitor::EnterI (TRAPS) {
     // Note that spinning tends to reduce the rate at which threads
     // enqueue and dequeue on EntryList|cxq.
     ObjectWaiter * nxt ;
-    for (;;) {
+    if (UseXchgMonitorEnqueue) {
+        // Unconditional fetch-and-store enqueue: cannot fail, so there is
+        // no retry storm on the head cacheline.  The successor link is
+        // published after the exchange; see PendingNext above.
+        node._next = PendingNext ;
+        nxt = (ObjectWaiter *) Atomic::xchg_ptr (&node, &_cxq) ;
+        OrderAccess::release_store_ptr (&node._next, nxt) ;
+    } else {
+      for (;;) {
         node._next = nxt = _cxq ;
         if (Atomic::cmpxchg_ptr (&node, &_cxq, nxt) == nxt) break ;
 
@@ -571,6 +600,7 @@ void ATTR ObjectMonitor::EnterI (TRAPS) {
             assert (_Responsible != Self  , "invariant") ;
             return ;
         }
+      }
     }
 
     // Check for cxq|EntryList edge transition to non-null.  This indicates
@@ -888,7 +918,7 @@ void ObjectMonitor::UnlinkAfterAcquire (Thread * Self, ObjectWaiter * SelfNode)
             }
             ObjectWaiter * p ;
             ObjectWaiter * q = NULL ;
-            for (p = v ; p != NULL && p != SelfNode; p = p->_next) {
+            for (p = v ; p != NULL && p != SelfNode; p = NextWait(p)) {
                 q = p ;
                 assert (p->TState == ObjectWaiter::TS_CXQ, "invariant") ;
             }
@@ -1134,7 +1164,7 @@ void ATTR ObjectMonitor::exit(bool not_suspended, TRAPS) {
 
           ObjectWaiter * q = NULL ;
           ObjectWaiter * p ;
-          for (p = w ; p != NULL ; p = p->_next) {
+          for (p = w ; p != NULL ; p = NextWait(p)) {
               guarantee (p->TState == ObjectWaiter::TS_CXQ, "Invariant") ;
               p->TState = ObjectWaiter::TS_ENTER ;
               p->_prev = q ;
@@ -1173,7 +1203,7 @@ void ATTR ObjectMonitor::exit(bool not_suspended, TRAPS) {
 
           ObjectWaiter * q = NULL ;
           ObjectWaiter * p ;
-          for (p = w ; p != NULL ; p = p->_next) {
+          for (p = w ; p != NULL ; p = NextWait(p)) {
               guarantee (p->TState == ObjectWaiter::TS_CXQ, "Invariant") ;
               p->TState = ObjectWaiter::TS_ENTER ;
               p->_prev = q ;
@@ -1245,7 +1275,7 @@ void ATTR ObjectMonitor::exit(bool not_suspended, TRAPS) {
          while (t != NULL) {
              guarantee (t->TState == ObjectWaiter::TS_CXQ, "invariant") ;
              t->TState = ObjectWaiter::TS_ENTER ;
-             u = t->_next ;
+             u = NextWait(t) ;
              t->_prev = u ;
              t->_next = s ;
              s = t;
@@ -1258,7 +1288,7 @@ void ATTR ObjectMonitor::exit(bool not_suspended, TRAPS) {
          _EntryList = w ;
          ObjectWaiter * q = NULL ;
          ObjectWaiter * p ;
-         for (p = w ; p != NULL ; p = p->_next) {
+         for (p = w ; p != NULL ; p = NextWait(p)) {
              guarantee (p->TState == ObjectWaiter::TS_CXQ, "Invariant") ;
              p->TState = ObjectWaiter::TS_ENTER ;
              p->_prev = q ;
@@ -1787,7 +1817,7 @@ void ObjectMonitor::notify(TRAPS) {
                    break ;
                 }
             } else {
-                while (Tail->_next != NULL) Tail = Tail->_next ;
+                while (NextWait(Tail) != NULL) Tail = NextWait(Tail) ;
                 Tail->_next = iterator ;
                 iterator->_prev = Tail ;
                 iterator->_next = NULL ;
@@ -1911,7 +1941,7 @@ void ObjectMonitor::notifyAll(TRAPS) {
                    break ;
                 }
             } else {
-                while (Tail->_next != NULL) Tail = Tail->_next ;
+                while (NextWait(Tail) != NULL) Tail = NextWait(Tail) ;
                 Tail->_next = iterator ;
                 iterator->_prev = Tail ;
                 iterator->_next = NULL ;
@@ -2083,6 +2113,7 @@ int ObjectMonitor::TrySpin_VaryDuration (Thread * Self) {
     // CONSIDER: use Prefetch::write() to avoid RTS->RTO upgrades
     // when preparing to LD...CAS _owner, etc and the CAS is likely
     // to succeed.
+    _SpinAttempts ++ ;          // racy, like _SpinDuration -- see above
     int hits    = 0 ;
     int msk     = 0 ;
     int caspty  = Knob_CASPenalty ;
@@ -2178,6 +2209,7 @@ int ObjectMonitor::TrySpin_VaryDuration (Thread * Self) {
                 if (x < Knob_Poverty) x = Knob_Poverty ;
                 _SpinDuration = x + Knob_Bonus ;
             }
+            _SpinSuccesses ++ ;
             return 1 ;
          }
 
@@ -2238,7 +2270,10 @@ int ObjectMonitor::TrySpin_VaryDuration (Thread * Self) {
       // in the normal usage of TrySpin(), but it's safest
       // to make TrySpin() as foolproof as possible.
       OrderAccess::fence() ;
-      if (TryLock(Self) > 0) return 1 ;
+      if (TryLock(Self) > 0) {
+         _SpinSuccesses ++ ;
+         return 1 ;
+      }
    }
    return 0 ;
 }
@@ -129,6 +129,11 @@ class ObjectMonitor {
   intptr_t  contentions() const ;
   intptr_t  recursions() const                                         { return _recursions; }
 
+  // Adaptive spin statistics, exported via jcmd VM.monitor_spin_statistics
+  int spin_attempts() const                                            { return _SpinAttempts; }
+  int spin_successes() const                                           { return _SpinSuccesses; }
+  int spin_duration() const                                            { return _SpinDuration; }
+
   // JVM/DI GetMonitorInfo() needs this
   ObjectWaiter* first_waiter()                                         { return _WaitSet; }
   ObjectWaiter* next_waiter(ObjectWaiter* o)                           { return o->_next; }
@@ -152,6 +157,8 @@ class ObjectMonitor {
     _EntryList    = NULL ;
     _SpinFreq     = 0 ;
     _SpinClock    = 0 ;
+    _SpinAttempts = 0 ;
+    _SpinSuccesses = 0 ;
     OwnerIsThread = 0 ;
     _previous_owner_tid = 0;
   }
@@ -176,6 +183,8 @@ private:
     _recursions    = 0 ;
     _SpinFreq      = 0 ;
     _SpinClock     = 0 ;
+    _SpinAttempts  = 0 ;
+    _SpinSuccesses = 0 ;
     OwnerIsThread  = 0 ;
   }
 
@@ -261,6 +270,9 @@ public:
   volatile int _SpinFreq ;          // Spin 1-out-of-N attempts: success rate
   volatile int _SpinClock ;
   volatile int _SpinDuration ;
+  volatile int _SpinAttempts ;      // Admitted adaptive spin episodes; like
+  volatile int _SpinSuccesses ;     // _SpinDuration, updated racily -- the
+                                    // counts are diagnostics, not invariants.
   volatile intptr_t _SpinState ;    // MCS/CLH list of spinners
 
   // TODO-FIXME: _count, _waiters and _recursions should be of
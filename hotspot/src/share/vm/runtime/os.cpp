@@ -1541,12 +1541,16 @@ bool os::release_memory(char* addr, size_t bytes) {
   return res;
 }
 
-void os::pretouch_memory(char* start, char* end) {
-  for (volatile char *p = start; p < end; p += os::vm_page_size()) {
+void os::pretouch_memory(char* start, char* end, size_t page_size) {
+  for (volatile char *p = start; p < end; p += page_size) {
     *p = 0;
   }
 }
 
+void os::pretouch_memory(char* start, char* end) {
+  pretouch_memory(start, end, (size_t) os::vm_page_size());
+}
+
 char* os::map_memory(int fd, const char* file_name, size_t file_offset,
                            char *addr, size_t bytes, bool read_only,
                            bool allow_exec) {
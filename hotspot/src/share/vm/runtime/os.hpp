@@ -336,8 +336,11 @@ class os: AllStatic {
 
   // Touch memory pages that cover the memory range from start to end (exclusive)
   // to make the OS back the memory range with actual memory.
-  // Current implementation may not touch the last page if unaligned addresses
-  // are passed.
+  // The range is touched at page_size stride; pass the actual backing page
+  // size to avoid touching every small page when the range sits on explicit
+  // large pages. Current implementation may not touch the last page if
+  // unaligned addresses are passed.
+  static void   pretouch_memory(char* start, char* end, size_t page_size);
   static void   pretouch_memory(char* start, char* end);
 
   enum ProtType { MEM_PROT_NONE, MEM_PROT_READ, MEM_PROT_RW, MEM_PROT_RWX };
@@ -369,6 +372,9 @@ class os: AllStatic {
   static size_t numa_get_leaf_groups(int *ids, size_t size);
   static bool   numa_topology_changed();
   static int    numa_get_group_id();
+  // Restrict the calling thread to the processors of the given node.
+  // Best effort: returns false when the platform cannot bind.
+  static bool   numa_bind_thread_to_node(int node);
 
   // Page manipulation
   struct page_info {
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutex.hpp"
@@ -228,6 +229,53 @@ void PerfLongVariant::sample() {
   }
 }
 
+PerfLongHistogram::PerfLongHistogram(CounterNS ns, const char* namep, Units u,
+                                     jint num_buckets)
+                                    : PerfData(ns, namep, u, V_Monotonic),
+                                      _num_buckets(num_buckets) {
+
+  create_entry(T_LONG, sizeof(jlong), (size_t)_num_buckets);
+
+  if (is_valid()) {
+    for (jint i = 0; i < _num_buckets; i++) {
+      ((jlong*)_valuep)[i] = 0;
+    }
+  }
+}
+
+void PerfLongHistogram::record(jlong value) {
+
+  if (!is_valid()) return;
+
+  // index of the highest set bit, clamped to the last bucket
+  jint index = 0;
+  while (value > 1 && index < _num_buckets - 1) {
+    value >>= 1;
+    index++;
+  }
+
+  volatile jlong* bucket = &((volatile jlong*)_valuep)[index];
+#ifdef _LP64
+  Atomic::add_ptr((intptr_t)1, (volatile intptr_t*)bucket);
+#else
+  // no 64-bit atomic add on 32-bit platforms; cas loop instead
+  jlong old;
+  do {
+    old = Atomic::load(bucket);
+  } while (Atomic::cmpxchg(old + 1, bucket, old) != old);
+#endif
+}
+
+int PerfLongHistogram::format(char* buffer, int length) {
+
+  // format as the total number of recorded values
+  jlong total = 0;
+  for (jint i = 0; i < _num_buckets; i++) {
+    total += ((jlong*)_valuep)[i];
+  }
+  return jio_snprintf(buffer, length, JLONG_FORMAT, total);
+}
+
 PerfByteArray::PerfByteArray(CounterNS ns, const char* namep, Units u,
                              Variability v, jint length)
                             : PerfData(ns, namep, u, v), _length(length) {
@@ -566,6 +614,27 @@ PerfLongCounter* PerfDataManager::create_long_counter(CounterNS ns,
   return p;
 }
 
+PerfLongHistogram* PerfDataManager::create_long_histogram(CounterNS ns,
+                                                          const char* name,
+                                                          PerfData::Units u,
+                                                          jint num_buckets,
+                                                          TRAPS) {
+
+  assert(num_buckets > 0, "PerfLongHistogram with no buckets");
+
+  PerfLongHistogram* p = new PerfLongHistogram(ns, name, u, num_buckets);
+
+  if (!p->is_valid()) {
+    // allocation of native resources failed.
+    delete p;
+    THROW_0(vmSymbols::java_lang_OutOfMemoryError());
+  }
+
+  add_item(p, false);
+
+  return p;
+}
+
 PerfDataList::PerfDataList(int length) {
 
   _set = new(ResourceObj::C_HEAP, mtInternal) PerfDataArray(length, true);
@@ -489,6 +489,41 @@ class PerfLongVariable : public PerfLongVariant {
 
 typedef PerfLongVariable PerfVariable;
 
+/*
+ * The PerfLongHistogram class implements a PerfData subtype that holds
+ * a vector of jlong bucket counts forming a log2-scaled histogram of
+ * recorded values. Bucket i counts values in [2^i, 2^(i+1)) of the
+ * declared unit, with bucket 0 also absorbing zero and the last bucket
+ * absorbing overflow. Each recorded value bumps exactly one bucket with
+ * a single atomic add, so distributions can be maintained from
+ * performance sensitive paths at the cost of a scalar counter. External
+ * samplers derive counts and percentiles from the bucket vector without
+ * attaching to the VM.
+ */
+class PerfLongHistogram : public PerfData {
+
+  friend class PerfDataManager; // for access to protected constructor
+
+  private:
+    jint _num_buckets;
+
+    // hide sample() - buckets are updated at record() time
+    void sample() { }
+
+  protected:
+
+    PerfLongHistogram(CounterNS ns, const char* namep, Units u,
+                      jint num_buckets);
+
+  public:
+    int format(char* buffer, int length);
+
+    // atomically count value into its log2-scaled bucket
+    void record(jlong value);
+
+    jint num_buckets() { return _num_buckets; }
+};
+
 /*
  * The PerfByteArray provides a PerfData subtype that allows the creation
  * of a contiguous region of the PerfData memory region for storing a vector
@@ -818,6 +853,13 @@ class PerfDataManager : AllStatic {
                                                 TRAPS);
 
 
+    // Histogram Types
+    static PerfLongHistogram* create_long_histogram(CounterNS ns,
+                                                    const char* name,
+                                                    PerfData::Units u,
+                                                    jint num_buckets, TRAPS);
+
+
     // these creation methods are provided for ease of use. These allow
     // Long performance data types to be created with a shorthand syntax.
 
@@ -89,6 +89,15 @@ oop Reflection::box(jvalue* value, BasicType type, TRAPS) {
     // regular objects are not boxed
     return (oop) value->l;
   }
+  if (type == T_BOOLEAN) {
+    // Use the canonical Boolean.TRUE/FALSE instance, matching the
+    // Boolean.valueOf() call in the generated bytecode accessors,
+    // instead of allocating a fresh box on every reflective call.
+    oop canonical = java_lang_boxing_object::canonical_boolean(value->z, CHECK_NULL);
+    if (canonical != NULL) {
+      return canonical;
+    }
+  }
   oop result = java_lang_boxing_object::create(type, value, CHECK_NULL);
   if (result == NULL) {
     THROW_(vmSymbols::java_lang_IllegalArgumentException(), result);
@@ -51,6 +51,7 @@
 #include "runtime/sweeper.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
+#include "runtime/vframe.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
@@ -173,8 +174,13 @@ void SafepointSynchronize::begin() {
   Thread* myThread = Thread::current();
   assert(myThread->is_VM_thread(), "Only VM thread may execute a safepoint");
 
+  // The begin time and straggler are always maintained; they feed the
+  // per-VM operation cost attribution behind VM.safepoint_statistics.
+  _safepoint_begin_time = os::javaTimeNanos();
+  _straggler = NULL;
+  _straggler_arrival = 0;
+
   if (PrintSafepointStatistics || PrintSafepointStatisticsTimeout > 0) {
-    _safepoint_begin_time = os::javaTimeNanos();
     _ts_of_current_safepoint = tty->time_stamp().seconds();
   }
 
@@ -481,6 +487,7 @@ void SafepointSynchronize::begin() {
   }
 
   RuntimeService::record_safepoint_synchronized();
+  record_sync_end();
   if (PrintSafepointStatistics) {
     update_statistics_on_sync_end(os::javaTimeNanos());
   }
@@ -494,6 +501,9 @@ void SafepointSynchronize::begin() {
     }
   }
 
+  // The interval from here to SafepointSynchronize::end() is attributed
+  // to the VM operation itself.
+  record_cleanup_end(os::javaTimeNanos());
   if (PrintSafepointStatistics) {
     // Record how much time spend on the above cleanup tasks
     update_statistics_on_cleanup_end(os::javaTimeNanos());
@@ -518,6 +528,7 @@ void SafepointSynchronize::end() {
   DEBUG_ONLY(Thread* myThread = Thread::current();)
   assert(myThread->is_VM_thread(), "Only VM thread can execute a safepoint");
 
+  record_vmop_end();
   if (PrintSafepointStatistics) {
     end_statistics(os::javaTimeNanos());
   }
@@ -782,6 +793,7 @@ void SafepointSynchronize::block(JavaThread *thread) {
         // Decrement the number of threads to wait for and signal vm thread
         assert(_waiting_to_block > 0, "sanity check");
         _waiting_to_block--;
+        record_arrival(thread);
         thread->safepoint_state()->set_has_called_back(true);
 
         DEBUG_ONLY(thread->set_visited_for_critical_count(true));
@@ -1024,7 +1036,7 @@ void ThreadSafepointState::roll_forward(suspend_type type) {
 
   switch(_type) {
     case _at_safepoint:
-      SafepointSynchronize::signal_thread_at_safepoint();
+      SafepointSynchronize::signal_thread_at_safepoint(_thread);
       DEBUG_ONLY(_thread->set_visited_for_critical_count(true));
       if (_thread->in_critical()) {
         // Notice that this thread is in a critical section
@@ -1190,6 +1202,14 @@ jlong  SafepointSynchronize::_max_sync_time = 0;
 jlong  SafepointSynchronize::_max_vmop_time = 0;
 float  SafepointSynchronize::_ts_of_current_safepoint = 0.0f;
 
+jlong  SafepointSynchronize::_vmop_sync_time[VM_Operation::VMOp_Terminating];
+jlong  SafepointSynchronize::_vmop_sync_max[VM_Operation::VMOp_Terminating];
+jlong  SafepointSynchronize::_vmop_exec_time[VM_Operation::VMOp_Terminating];
+jlong  SafepointSynchronize::_vmop_exec_max[VM_Operation::VMOp_Terminating];
+
+JavaThread* SafepointSynchronize::_straggler = NULL;
+jlong  SafepointSynchronize::_straggler_arrival = 0;
+
 static jlong  cleanup_end_time = 0;
 static bool   need_to_track_page_armed_status = false;
 static bool   init_done = false;
@@ -1245,9 +1265,6 @@ void SafepointSynchronize::begin_statistics(int nof_threads, int nof_running) {
 
   VM_Operation *op = VMThread::vm_operation();
   spstat->_vmop_type = (op != NULL ? op->type() : -1);
-  if (op != NULL) {
-    _safepoint_reasons[spstat->_vmop_type]++;
-  }
 
   spstat->_nof_total_threads = nof_threads;
   spstat->_nof_initial_running_threads = nof_running;
@@ -1297,9 +1314,6 @@ void SafepointSynchronize::update_statistics_on_sync_end(jlong end_time) {
   // vm operation time. Again, the real time spending in syncing will be deducted
   // from the start of the sync time later when end_statistics is called.
   spstat->_time_to_sync = end_time - _safepoint_begin_time;
-  if (spstat->_time_to_sync > _max_sync_time) {
-    _max_sync_time = spstat->_time_to_sync;
-  }
 
   spstat->_time_to_do_cleanups = end_time;
 }
@@ -1313,14 +1327,108 @@ void SafepointSynchronize::update_statistics_on_cleanup_end(jlong end_time) {
   cleanup_end_time = end_time;
 }
 
+void SafepointSynchronize::record_arrival(JavaThread* thread) {
+  assert_locked_or_safepoint(Safepoint_lock);
+  _straggler = thread;
+  _straggler_arrival = os::javaTimeNanos() - _safepoint_begin_time;
+}
+
+void SafepointSynchronize::record_sync_end() {
+  jlong sync_time = os::javaTimeNanos() - _safepoint_begin_time;
+
+  VM_Operation *op = VMThread::vm_operation();
+  if (op != NULL) {
+    int type = op->type();
+    _safepoint_reasons[type]++;
+    _vmop_sync_time[type] += sync_time;
+    if (sync_time > _vmop_sync_max[type]) {
+      _vmop_sync_max[type] = sync_time;
+    }
+  }
+  if (sync_time > _max_sync_time) {
+    _max_sync_time = sync_time;
+  }
+
+  // Report time-to-safepoint outliers while the straggler is still
+  // stopped, so its last Java frame can be examined safely.
+  if (PrintSafepointStatisticsTimeout > 0 &&
+      sync_time > PrintSafepointStatisticsTimeout * MICROUNITS) {
+    print_straggler_on(tty, sync_time);
+  }
+}
+
+void SafepointSynchronize::record_cleanup_end(jlong end_time) {
+  cleanup_end_time = end_time;
+}
+
+void SafepointSynchronize::record_vmop_end() {
+  jlong exec_time = os::javaTimeNanos() - cleanup_end_time;
+
+  VM_Operation *op = VMThread::vm_operation();
+  if (op != NULL) {
+    int type = op->type();
+    _vmop_exec_time[type] += exec_time;
+    if (exec_time > _vmop_exec_max[type]) {
+      _vmop_exec_max[type] = exec_time;
+    }
+  }
+  if (exec_time > _max_vmop_time) {
+    _max_vmop_time = exec_time;
+  }
+}
+
+void SafepointSynchronize::print_straggler_on(outputStream* st, jlong sync_time) {
+  JavaThread* thread = _straggler;
+  if (thread == NULL) return;
+
+  VM_Operation *op = VMThread::vm_operation();
+  st->print_cr("# SafepointSynchronize: " INT64_FORMAT " ms to reach a safepoint for %s",
+               sync_time / MICROUNITS,
+               op != NULL ? op->name() : "no vm operation");
+  st->print("# SafepointSynchronize: last thread to arrive (after " INT64_FORMAT " ms): ",
+            _straggler_arrival / MICROUNITS);
+  thread->print_on(st);
+  if (thread->has_last_Java_frame()) {
+    ResourceMark rm;
+    RegisterMap reg_map(thread);
+    javaVFrame* jvf = thread->last_java_vframe(&reg_map);
+    if (jvf != NULL) {
+      st->print_cr("# SafepointSynchronize: its last Java frame: %s @ bci %d",
+                   jvf->method()->name_and_sig_as_C_string(), jvf->bci());
+    }
+  }
+}
+
+void SafepointSynchronize::print_vmop_histogram_on(outputStream* st) {
+  st->print_cr("Per-VM operation safepoint costs (times in ms):");
+  st->print_cr("%-28s %10s %12s %10s %12s %10s", "vmop", "count",
+               "total_sync", "max_sync", "total_vmop", "max_vmop");
+  for (int index = 0; index < VM_Operation::VMOp_Terminating; index++) {
+    if (_safepoint_reasons[index] == 0) continue;
+    st->print_cr("%-28s " UINT64_FORMAT_W(10) " " INT64_FORMAT_W(12) " "
+                 INT64_FORMAT_W(10) " " INT64_FORMAT_W(12) " " INT64_FORMAT_W(10),
+                 VM_Operation::name(index),
+                 _safepoint_reasons[index],
+                 _vmop_sync_time[index] / MICROUNITS,
+                 _vmop_sync_max[index] / MICROUNITS,
+                 _vmop_exec_time[index] / MICROUNITS,
+                 _vmop_exec_max[index] / MICROUNITS);
+  }
+  st->cr();
+  st->print_cr(UINT64_FORMAT_W(5) " VM operations coalesced during safepoint",
+               _coalesced_vmop_count);
+  st->print_cr("Maximum sync time  " INT64_FORMAT_W(5) " ms",
+               _max_sync_time / MICROUNITS);
+  st->print_cr("Maximum vm operation time (except for Exit VM operation)  "
+               INT64_FORMAT_W(5) " ms",
+               _max_vmop_time / MICROUNITS);
+}
+
 void SafepointSynchronize::end_statistics(jlong vmop_end_time) {
   SafepointStats *spstat = &_safepoint_stats[_cur_stat_index];
 
   // Update the vm operation time.
   spstat->_time_to_exec_vmop = vmop_end_time -  cleanup_end_time;
-  if (spstat->_time_to_exec_vmop > _max_vmop_time) {
-    _max_vmop_time = spstat->_time_to_exec_vmop;
-  }
   // Only the sync time longer than the specified
   // PrintSafepointStatisticsTimeout will be printed out right away.
   // By default, it is -1 meaning all samples will be put into the list.
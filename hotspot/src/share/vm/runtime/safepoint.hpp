@@ -116,12 +116,31 @@ private:
   static jlong            _max_vmop_time;            // maximum vm operation time in nanos
   static float            _ts_of_current_safepoint;  // time stamp of current safepoint in seconds
 
+  // Per-VM operation cost attribution. Unlike the SafepointStats ring
+  // buffer above, these aggregates are collected at every safepoint
+  // regardless of PrintSafepointStatistics, so that they can be dumped
+  // on demand via the VM.safepoint_statistics diagnostic command.
+  static jlong            _vmop_sync_time[];         // total time-to-sync in nanos per VM op
+  static jlong            _vmop_sync_max[];          // maximum time-to-sync in nanos per VM op
+  static jlong            _vmop_exec_time[];         // total vm operation time in nanos per VM op
+  static jlong            _vmop_exec_max[];          // maximum vm operation time in nanos per VM op
+
+  // The straggler is the last thread to reach the current safepoint; it is
+  // updated under Safepoint_lock both by the VM thread observing threads
+  // that are already safepoint safe and by threads blocking themselves.
+  static JavaThread*      _straggler;
+  static jlong            _straggler_arrival;        // its arrival latency in nanos
+
   static void begin_statistics(int nof_threads, int nof_running);
   static void update_statistics_on_spin_end();
   static void update_statistics_on_sync_end(jlong end_time);
   static void update_statistics_on_cleanup_end(jlong end_time);
   static void end_statistics(jlong end_time);
   static void print_statistics();
+  static void record_sync_end();
+  static void record_cleanup_end(jlong end_time);
+  static void record_vmop_end();
+  static void print_straggler_on(outputStream* st, jlong sync_time);
   inline static void inc_page_trap_count() {
     Atomic::inc(&_safepoint_stats[_cur_stat_index]._nof_threads_hit_page_trap);
   }
@@ -158,7 +177,14 @@ public:
 
   // Called when a thread volantary blocks
   static void   block(JavaThread *thread);
-  static void   signal_thread_at_safepoint()              { _waiting_to_block--; }
+  static void   signal_thread_at_safepoint(JavaThread *thread) {
+    _waiting_to_block--;
+    record_arrival(thread);
+  }
+
+  // Record that "thread" has reached the current safepoint; the last
+  // recorded thread is the straggler. Caller must hold Safepoint_lock.
+  static void   record_arrival(JavaThread *thread);
 
   // Exception handling for page polling
   static void handle_polling_page_exception(JavaThread *thread);
@@ -179,6 +205,7 @@ public:
 
   static void deferred_initialize_stat();
   static void print_stat_on_exit();
+  static void print_vmop_histogram_on(outputStream* st);
   inline static void inc_vmop_coalesced_count() { _coalesced_vmop_count++; }
 
   static void set_is_at_safepoint()                        { _state = _synchronized; }
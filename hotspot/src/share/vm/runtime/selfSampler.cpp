@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "prims/jvm.h"
+#include "runtime/interfaceSupport.hpp"
+#include "runtime/mutex.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/osThread.hpp"
+#include "runtime/selfSampler.hpp"
+#include "runtime/thread.hpp"
+#include "runtime/vframe.hpp"
+#include "utilities/copy.hpp"
+#include "utilities/ostream.hpp"
+
+SelfSampler::Sample* SelfSampler::_ring   = NULL;
+Mutex*               SelfSampler::_lock   = NULL;
+int                  SelfSampler::_cursor = 0;
+jlong                SelfSampler::_total  = 0;
+
+bool                                    SelfSampler::_dump_active  = false;
+GrowableArray<SelfSampler::DumpEntry*>* SelfSampler::_dump_entries = NULL;
+
+void SelfSampler::initialize() {
+  // The lock is always needed: concurrent dumps work without the flag.
+  _lock = new Mutex(Mutex::leaf, "SelfSampler_lock", true);
+  if (UseCooperativeSampling) {
+    _ring = NEW_C_HEAP_ARRAY(Sample, _ring_size, mtInternal);
+    Copy::zero_to_bytes((void*)_ring, _ring_size * sizeof(Sample));
+  }
+}
+
+void SelfSampler::request(JavaThread* thread) {
+  assert(is_active(), "sanity");
+  thread->set_self_sample_requested();
+}
+
+void SelfSampler::request_all() {
+  assert(is_active(), "sanity");
+  MutexLocker ml(Threads_lock);
+  for (JavaThread* t = Threads::first(); t != NULL; t = t->next()) {
+    if (t->is_Compiler_thread() || t->is_hidden_from_external_view()) {
+      continue;
+    }
+    t->set_self_sample_requested();
+  }
+}
+
+void SelfSampler::record_sample(JavaThread* thread) {
+  assert(thread == JavaThread::current(), "threads only sample themselves");
+  thread->clear_self_sample_requested();
+  if (!is_active() && !_dump_active) {
+    return;
+  }
+
+  // If a dump is being assembled, capture our name up front; the entry is
+  // filled in under the lock below. get_thread_name_string copies into the
+  // caller's buffer, no resource allocation. Racy read of _dump_active is
+  // fine: the authoritative check happens under the lock.
+  char name_buf[64];
+  const char* name = NULL;
+  if (_dump_active) {
+    name = thread->get_thread_name_string(name_buf, sizeof(name_buf));
+  }
+
+  // Format the stack into a local buffer first, without the lock. The
+  // thread is safepoint-unsafe here, so methods cannot be unloaded while
+  // we read their names.
+  char text[_text_size];
+  text[0] = '\0';
+  size_t pos = 0;
+  int depth = 0;
+  bool truncated = false;
+
+  if (thread->has_last_Java_frame()) {
+    thread->frame_anchor()->make_walkable(thread);
+    ResourceMark rm(thread);
+    for (vframeStream vfst(thread); !vfst.at_end(); vfst.next()) {
+      if (depth >= _max_depth) {
+        truncated = true;
+        break;
+      }
+      int written = jio_snprintf(&text[pos], sizeof(text) - pos, "  %s @ bci=%d\n",
+                                 vfst.method()->name_and_sig_as_C_string(), vfst.bci());
+      if (written < 0) {
+        truncated = true;
+        break;
+      }
+      pos += written;
+      depth++;
+    }
+  }
+
+  MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+  if (_dump_active) {
+    // A dump wants a response from every thread, even with no Java frames.
+    DumpEntry* e = new DumpEntry();
+    e->_timestamp = os::javaTimeNanos();
+    e->_thread_id = (intx)thread->osthread()->thread_id();
+    strncpy(e->_name, name != NULL ? name : thread->name(), sizeof(e->_name));
+    e->_name[sizeof(e->_name) - 1] = '\0';
+    e->_depth     = depth;
+    e->_truncated = truncated;
+    strncpy(e->_text, text, sizeof(e->_text));
+    e->_text[sizeof(e->_text) - 1] = '\0';
+    _dump_entries->append(e);
+    return;
+  }
+
+  if (!is_active() || depth == 0) {
+    // Nothing walkable (e.g. thread still attaching), or the dump we were
+    // poked for has already finished; drop the request.
+    return;
+  }
+
+  Sample* s = &_ring[_cursor];
+  _cursor = (_cursor + 1) & (_ring_size - 1);
+  _total++;
+  s->_timestamp = os::javaTimeNanos();
+  s->_thread_id = (intx)thread->osthread()->thread_id();
+  s->_depth     = depth;
+  s->_truncated = truncated;
+  strncpy(s->_text, text, sizeof(s->_text));
+  s->_text[sizeof(s->_text) - 1] = '\0';
+}
+
+void SelfSampler::collect_dump(outputStream* st, jlong timeout_ms) {
+  JavaThread* self = JavaThread::current();
+
+  {
+    MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+    if (_dump_active) {
+      st->print_cr("Another concurrent thread dump is already in progress");
+      return;
+    }
+    if (_dump_entries == NULL) {
+      _dump_entries = new (ResourceObj::C_HEAP, mtInternal)
+                          GrowableArray<DumpEntry*>(128, true);
+    }
+    _dump_active = true;
+  }
+
+  // Poke every other Java thread. Setting the suspend flag is a full
+  // fence, so a responder is guaranteed to observe _dump_active.
+  int expected = 0;
+  {
+    MutexLocker ml(Threads_lock);
+    for (JavaThread* t = Threads::first(); t != NULL; t = t->next()) {
+      if (t == self || t->is_Compiler_thread() || t->is_hidden_from_external_view()) {
+        continue;
+      }
+      t->set_self_sample_requested();
+      expected++;
+    }
+  }
+
+  // Contribute our own stack directly; we do not poll while waiting.
+  record_sample(self);
+  expected++;
+
+  // Wait for the responses. Block in native state while sleeping so an
+  // unrelated safepoint is never held up by the collector itself.
+  const jlong deadline = os::javaTimeMillis() + timeout_ms;
+  while (os::javaTimeMillis() < deadline) {
+    {
+      MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+      if (_dump_entries->length() >= expected) {
+        break;
+      }
+    }
+    ThreadBlockInVM tbivm(self);
+    os::naked_short_sleep(2);
+  }
+
+  {
+    MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+    st->print_cr("Concurrent thread dump: %d of %d threads responded within "
+                 JLONG_FORMAT " ms", _dump_entries->length(), expected, timeout_ms);
+    st->cr();
+    for (int i = 0; i < _dump_entries->length(); i++) {
+      DumpEntry* e = _dump_entries->at(i);
+      st->print_cr("\"%s\" tid=" INTX_FORMAT " sampled at " JLONG_FORMAT " ns, %d frames%s:",
+                   e->_name, e->_thread_id, e->_timestamp, e->_depth,
+                   e->_truncated ? " (truncated)" : "");
+      if (e->_depth == 0) {
+        st->print_cr("   <no Java frames>");
+      } else {
+        st->print_raw(e->_text);
+      }
+      st->cr();
+      delete e;
+    }
+    _dump_entries->clear();
+    // Late responders that were still blocked on the lock go back to the
+    // ring (or are dropped) once this is cleared.
+    _dump_active = false;
+  }
+
+  // Threads still carrying the request flag were blocked in native or
+  // parked the whole time; their next poll clears the stale flag.
+  {
+    ResourceMark rm;
+    MutexLocker ml(Threads_lock);
+    for (JavaThread* t = Threads::first(); t != NULL; t = t->next()) {
+      if (t->is_self_sample_requested() &&
+          !t->is_Compiler_thread() && !t->is_hidden_from_external_view()) {
+        st->print_cr("\"%s\" did not reach a poll, no stack captured",
+                     t->get_thread_name());
+      }
+    }
+  }
+}
+
+void SelfSampler::print_on(outputStream* st) {
+  if (!is_active()) {
+    return;
+  }
+  MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+  st->print_cr("Cooperative samples: " JLONG_FORMAT " recorded, last %d retained",
+               _total, _ring_size);
+  // Walk from the next overwrite victim so samples print oldest first.
+  for (int i = 0; i < _ring_size; i++) {
+    Sample* s = &_ring[(_cursor + i) & (_ring_size - 1)];
+    if (s->_timestamp == 0) {
+      continue;  // never written
+    }
+    st->print_cr("Thread " INTX_FORMAT " at " JLONG_FORMAT " ns, %d frames%s:",
+                 s->_thread_id, s->_timestamp, s->_depth,
+                 s->_truncated ? " (truncated)" : "");
+    st->print_raw(s->_text);
+  }
+}
+
+void selfSampler_init() {
+  SelfSampler::initialize();
+}
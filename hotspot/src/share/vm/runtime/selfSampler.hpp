@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_RUNTIME_SELFSAMPLER_HPP
+#define SHARE_VM_RUNTIME_SELFSAMPLER_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/growableArray.hpp"
+
+class JavaThread;
+class Mutex;
+class outputStream;
+
+// Cooperative, signal-free stack sampling, enabled with
+// -XX:+UseCooperativeSampling. A sample request only sets the
+// _self_sample suspend flag on the target thread; the thread notices it
+// on its next safepoint poll or VM state transition and records its own
+// stack into a shared ring buffer from
+// JavaThread::handle_special_runtime_exit_condition(). No signal is
+// delivered, so sampled threads never see interrupted syscalls, and a
+// thread parked outside Java code simply contributes no sample.
+//
+// Frames are formatted by the sampled thread itself while it is
+// safepoint-unsafe, so metadata cannot move under it; the ring slot is
+// claimed and filled under a leaf lock, which also serializes printing.
+//
+// The same mechanism also backs collect_dump(): a whole-process thread
+// dump assembled without a safepoint. Every thread is poked once, the
+// responses are gathered into a one-shot list instead of the ring, and
+// threads that never reach a poll before the timeout are listed by name.
+class SelfSampler : AllStatic {
+private:
+  static const int _ring_size = 256;  // power of two
+  static const int _max_depth = 32;
+  static const int _text_size = 2048;
+
+  struct Sample {
+    jlong _timestamp;  // os::javaTimeNanos() at the time of the sample
+    intx  _thread_id;
+    int   _depth;
+    bool  _truncated;
+    char  _text[_text_size];  // one formatted line per frame
+  };
+
+  struct DumpEntry : public CHeapObj<mtInternal> {
+    jlong _timestamp;
+    intx  _thread_id;
+    char  _name[64];
+    int   _depth;
+    bool  _truncated;
+    char  _text[_text_size];
+  };
+
+  static Sample* _ring;
+  static Mutex*  _lock;
+  static int     _cursor;  // next slot to overwrite, guarded by _lock
+  static jlong   _total;   // samples recorded since startup
+
+  // One-shot concurrent dump state, guarded by _lock. While a dump is
+  // active, responses go to _dump_entries instead of the ring.
+  static bool                       _dump_active;
+  static GrowableArray<DumpEntry*>* _dump_entries;
+
+public:
+  static void initialize();
+
+  static bool is_active() { return _ring != NULL; }
+
+  // Ask a single thread, or every Java thread, to sample itself at its
+  // next poll or transition.
+  static void request(JavaThread* thread);
+  static void request_all();
+
+  // Called by the sampled thread on itself; clears the request flag.
+  static void record_sample(JavaThread* thread);
+
+  // Assemble a thread dump without a safepoint: poke all Java threads,
+  // wait up to timeout_ms for them to reach a poll, and print whatever
+  // arrived. Works independently of UseCooperativeSampling.
+  static void collect_dump(outputStream* st, jlong timeout_ms);
+
+  static void print_on(outputStream* st);
+};
+
+void selfSampler_init();
+
+#endif // SHARE_VM_RUNTIME_SELFSAMPLER_HPP
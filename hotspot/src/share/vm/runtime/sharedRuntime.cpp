@@ -610,10 +610,78 @@ void SharedRuntime::throw_and_post_jvmti_exception(JavaThread *thread, Handle h_
 }
 
 void SharedRuntime::throw_and_post_jvmti_exception(JavaThread *thread, Symbol* name, const char *message) {
+  oop fast_exception = fast_throw_exception(thread, name);
+  if (fast_exception != NULL) {
+    // Hot throw site; raise the preallocated stackless instance without
+    // constructing a new exception or filling in a stack trace. JVMTI
+    // posting was already ruled out by fast_throw_exception.
+    Handle h_exception(thread, fast_exception);
+    Exceptions::_throw(thread, __FILE__, __LINE__, h_exception);
+    return;
+  }
   Handle h_exception = Exceptions::new_exception(thread, name, message);
   throw_and_post_jvmti_exception(thread, h_exception);
 }
 
+// OmitStackTraceInFastThrow support for the interpreter and C1 tiers.
+// C2 compiles hot implicit throw sites to raise the preallocated instances
+// directly (see GraphKit::builtin_throw); code in the lower tiers arrives
+// in the runtime instead, paying for exception construction and
+// fill_in_stack_trace on every throw. Count throws per (method, bci) site
+// in a small direct-mapped table and, once a site is hot, hand out the
+// matching preallocated instance. Races on the table merely perturb the
+// counts; the Method* is used as a key only and never dereferenced, so
+// stale entries for unloaded methods are harmless.
+static const int fast_throw_table_size = 512;   // must be a power of two
+struct FastThrowSite {
+  Method* _method;
+  int     _bci;
+  int     _count;
+};
+static FastThrowSite _fast_throw_sites[fast_throw_table_size];
+
+oop SharedRuntime::fast_throw_exception(JavaThread* thread, Symbol* exception_name) {
+  assert(thread == Thread::current(), "invariant");
+  if (!OmitStackTraceInFastThrow) {
+    return NULL;
+  }
+  if (JvmtiExport::can_post_on_exceptions()) {
+    // agents expect to see the real exception object and throw location
+    return NULL;
+  }
+  oop preallocated = NULL;
+  if (exception_name == vmSymbols::java_lang_NullPointerException()) {
+    preallocated = Universe::null_ptr_exception_instance();
+  } else if (exception_name == vmSymbols::java_lang_ArithmeticException()) {
+    preallocated = Universe::arithmetic_exception_instance();
+  } else {
+    // no preallocated instance for this exception type
+    return NULL;
+  }
+  if (preallocated == NULL) {
+    // universe not fully initialized yet
+    return NULL;
+  }
+  vframeStream vfst(thread, true);
+  if (vfst.at_end()) {
+    return NULL;
+  }
+  Method* const method = vfst.method();
+  const int bci = vfst.bci();
+  const int ix = (int)((((uintptr_t)method >> 3) ^ (uintptr_t)bci) & (fast_throw_table_size - 1));
+  FastThrowSite* const site = &_fast_throw_sites[ix];
+  if (site->_method != method || site->_bci != bci) {
+    // new or colliding site; restart the count
+    site->_method = method;
+    site->_bci = bci;
+    site->_count = 0;
+  }
+  if (++site->_count < FastThrowThreshold) {
+    return NULL;
+  }
+  return preallocated;
+}
+
 // The interpreter code to call this tracing function is only
 // called/generated when TraceRedefineClasses has the right bits
 // set. Since obsolete methods are never compiled, we don't have
@@ -1553,7 +1621,8 @@ methodHandle SharedRuntime::handle_ic_miss_helper(JavaThread *thread, TRAPS) {
         inline_cache->set_to_monomorphic(info);
       } else if (!inline_cache->is_megamorphic() && !inline_cache->is_clean()) {
         // Potential change to megamorphic
-        bool successful = inline_cache->set_to_megamorphic(&call_info, bc, CHECK_(methodHandle()));
+        KlassHandle receiver_klass(THREAD, receiver()->klass());
+        bool successful = inline_cache->set_to_megamorphic(&call_info, bc, receiver_klass, CHECK_(methodHandle()));
         if (!successful) {
           inline_cache->set_to_clean();
         }
@@ -2281,6 +2350,7 @@ class AdapterHandlerTable : public BasicHashtable<mtCode> {
           if (fp.is_compact()) _compact++;
           _hits++;
 #endif
+          e->increment_reuse_count();
           return e;
         }
       }
@@ -2309,6 +2379,30 @@ class AdapterHandlerTable : public BasicHashtable<mtCode> {
                   empty, longest, total, total / (double)nonempty);
     tty->print_cr("AdapterHandlerTable: lookups %d buckets %d equals %d hits %d compact %d",
                   _lookups, _buckets, _equals, _hits, _compact);
+
+    // Print the most reused signature shapes.
+    const int max_shapes = 10;
+    AdapterHandlerEntry* top[max_shapes];
+    int found = 0;
+    for (int index = 0; index < table_size(); index++) {
+      for (AdapterHandlerEntry* e = bucket(index); e != NULL; e = e->next()) {
+        int pos = found < max_shapes ? found : max_shapes - 1;
+        if (found < max_shapes || e->reuse_count() > top[pos]->reuse_count()) {
+          top[pos] = e;
+          if (found < max_shapes) found++;
+          while (pos > 0 && top[pos]->reuse_count() > top[pos-1]->reuse_count()) {
+            AdapterHandlerEntry* tmp = top[pos-1];
+            top[pos-1] = top[pos];
+            top[pos] = tmp;
+            pos--;
+          }
+        }
+      }
+    }
+    tty->print_cr("AdapterHandlerTable: most reused signature shapes:");
+    for (int i = 0; i < found; i++) {
+      tty->print_cr("  %8d  %s", top[i]->reuse_count(), top[i]->fingerprint()->as_string());
+    }
   }
 #endif
 };
@@ -2973,9 +3067,19 @@ JRT_LEAF(intptr_t*, SharedRuntime::OSR_migration_begin( JavaThread *thread) )
 
   Method* moop = fr.interpreter_frame_method();
   int max_locals = moop->max_locals();
-  // Allocate temp buffer, 1 word per local & 2 per active monitor
+  // Need a temp buffer, 1 word per local & 2 per active monitor.
+  // Reuse the thread's buffer when it is big enough: OSR recurs in the
+  // same hot loops, and a malloc/free pair per entry is a measurable
+  // part of the migration stall.
   int buf_size_words = max_locals + active_monitor_count*2;
-  intptr_t *buf = NEW_C_HEAP_ARRAY(intptr_t,buf_size_words, mtCode);
+  intptr_t *buf = thread->osr_migration_buffer();
+  if (buf == NULL || thread->osr_migration_buffer_words() < buf_size_words) {
+    if (buf != NULL) {
+      FREE_C_HEAP_ARRAY(intptr_t, buf, mtCode);
+    }
+    buf = NEW_C_HEAP_ARRAY(intptr_t, buf_size_words, mtCode);
+    thread->set_osr_migration_buffer(buf, buf_size_words);
+  }
 
   // Copy the locals.  Order is preserved so that loading of longs works.
   // Since there's no GC I can copy the oops blindly.
@@ -3005,7 +3109,12 @@ JRT_LEAF(intptr_t*, SharedRuntime::OSR_migration_begin( JavaThread *thread) )
 JRT_END
 
 JRT_LEAF(void, SharedRuntime::OSR_migration_end( intptr_t* buf) )
-  FREE_C_HEAP_ARRAY(intptr_t,buf, mtCode);
+  // The buffer normally stays cached in the thread for the next OSR
+  // entry; only free it if it is not the cached one.
+  JavaThread* thread = JavaThread::current();
+  if (buf != thread->osr_migration_buffer()) {
+    FREE_C_HEAP_ARRAY(intptr_t,buf, mtCode);
+  }
 JRT_END
 
 bool AdapterHandlerLibrary::contains(CodeBlob* b) {
@@ -3031,8 +3140,8 @@ void AdapterHandlerLibrary::print_handler_on(outputStream* st, CodeBlob* b) {
 }
 
 void AdapterHandlerEntry::print_adapter_on(outputStream* st) const {
-  st->print_cr("AHE@" INTPTR_FORMAT ": %s i2c: " INTPTR_FORMAT " c2i: " INTPTR_FORMAT " c2iUV: " INTPTR_FORMAT,
-               (intptr_t) this, fingerprint()->as_string(),
+  st->print_cr("AHE@" INTPTR_FORMAT ": %s reuse %d i2c: " INTPTR_FORMAT " c2i: " INTPTR_FORMAT " c2iUV: " INTPTR_FORMAT,
+               (intptr_t) this, fingerprint()->as_string(), reuse_count(),
                get_i2c_entry(), get_c2i_entry(), get_c2i_unverified_entry());
 
 }
@@ -249,6 +249,12 @@ class SharedRuntime: AllStatic {
   static void throw_and_post_jvmti_exception(JavaThread *thread, Handle h_exception);
   static void throw_and_post_jvmti_exception(JavaThread *thread, Symbol* name, const char *message = NULL);
 
+  // OmitStackTraceInFastThrow support outside C2-compiled code: returns a
+  // preallocated, stackless exception instance once the throw site on top
+  // of the thread's stack has thrown exception_name FastThrowThreshold
+  // times, or NULL if the exception should be constructed normally.
+  static oop fast_throw_exception(JavaThread* thread, Symbol* exception_name);
+
   // RedefineClasses() tracing support for obsolete method entry
   static int rc_trace_method_entry(JavaThread* thread, Method* m);
 
@@ -636,6 +642,11 @@ class AdapterHandlerEntry : public BasicHashtableEntry<mtCode> {
   address _c2i_entry;
   address _c2i_unverified_entry;
 
+  // Number of times this adapter was found by a later method with the same
+  // fingerprint. Identifies the hot signature shapes; updated under
+  // AdapterHandlerLibrary_lock.
+  int _reuse_count;
+
 #ifdef ASSERT
   // Captures code and signature used to generate this adapter when
   // verifing adapter equivalence.
@@ -648,6 +659,7 @@ class AdapterHandlerEntry : public BasicHashtableEntry<mtCode> {
     _i2c_entry = i2c_entry;
     _c2i_entry = c2i_entry;
     _c2i_unverified_entry = c2i_unverified_entry;
+    _reuse_count = 0;
 #ifdef ASSERT
     _saved_code = NULL;
     _saved_code_length = 0;
@@ -668,6 +680,9 @@ class AdapterHandlerEntry : public BasicHashtableEntry<mtCode> {
 
   AdapterFingerPrint* fingerprint() const { return _fingerprint; }
 
+  int  reuse_count() const     { return _reuse_count; }
+  void increment_reuse_count() { _reuse_count++; }
+
   AdapterHandlerEntry* next() {
     return (AdapterHandlerEntry*)BasicHashtableEntry<mtCode>::next();
   }
@@ -35,6 +35,7 @@ class CompileQueue;
 
 class SimpleThresholdPolicy : public CompilationPolicy {
   int _c1_count, _c2_count;
+  jlong _start_time;
 
   // Check if the counter is big enough and set carry (effectively infinity).
   inline void set_carry_if_necessary(InvocationCounter *counter);
@@ -61,6 +62,25 @@ protected:
   int c2_count() const     { return _c2_count; }
   void set_c1_count(int x) { _c1_count = x;    }
   void set_c2_count(int x) { _c2_count = x;    }
+  void set_start_time(jlong t) { _start_time = t;    }
+  jlong start_time() const     { return _start_time; }
+
+  // Scheduling heuristics used by select_task() to pick the most
+  // profitable method from the compile queue.
+  // Has a method been long around?
+  // We don't remove old methods from the compile queue even if they have
+  // very low activity (see select_task()).
+  bool is_old(Method* method);
+  // Was a given method inactive for a given number of milliseconds.
+  // If it is, we would remove it from the queue (see select_task()).
+  bool is_stale(jlong t, jlong timeout, Method* m);
+  // Compute the weight of the method for the compilation scheduling
+  double weight(Method* method);
+  // Apply heuristics and return true if x should be compiled before y
+  bool compare_methods(Method* x, Method* y);
+  // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
+  // per millisecond.
+  void update_rate(jlong t, Method* m);
 
   enum EventType { CALL, LOOP, COMPILE, REMOVE_FROM_QUEUE, UPDATE_IN_QUEUE, REPROFILE, MAKE_NOT_ENTRANT };
   void print_event(EventType type, methodHandle mh, methodHandle imh, int bci, CompLevel level);
@@ -92,7 +112,7 @@ protected:
   virtual void method_back_branch_event(methodHandle method, methodHandle inlinee,
                                         int bci, CompLevel level, nmethod* nm, JavaThread* thread);
 public:
-  SimpleThresholdPolicy() : _c1_count(0), _c2_count(0) { }
+  SimpleThresholdPolicy() : _c1_count(0), _c2_count(0), _start_time(0) { }
   virtual int compiler_count(CompLevel comp_level) {
     if (is_c1_compile(comp_level)) return c1_count();
     if (is_c2_compile(comp_level)) return c2_count();
@@ -352,6 +352,12 @@ class StubRoutines: AllStatic {
     return dest_uninitialized ? _checkcast_arraycopy_uninit : _checkcast_arraycopy;
   }
   static address unsafe_arraycopy()        { return _unsafe_arraycopy; }
+
+  typedef void (*UnsafeArrayCopyStub)(const void* src, void* dst, size_t count);
+  static UnsafeArrayCopyStub UnsafeArrayCopy_stub() {
+    return CAST_TO_FN_PTR(UnsafeArrayCopyStub, _unsafe_arraycopy);
+  }
+
   static address generic_arraycopy()       { return _generic_arraycopy; }
 
   static address jbyte_fill()          { return _jbyte_fill; }
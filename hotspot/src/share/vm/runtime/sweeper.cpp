@@ -142,6 +142,7 @@ int      NMethodSweeper::_zombified_count              = 0;    // Nof. nmethods
 int      NMethodSweeper::_marked_for_reclamation_count = 0;    // Nof. nmethods marked for reclaim in current sweep
 
 volatile bool NMethodSweeper::_should_sweep            = true; // Indicates if we should invoke the sweeper
+volatile bool NMethodSweeper::_stack_scan_requested    = false;// Set by the sweeper when the next safepoint should scan stacks
 volatile int  NMethodSweeper::_sweep_fractions_left    = 0;    // Nof. invocations left until we are completed with this pass
 volatile int  NMethodSweeper::_sweep_started           = 0;    // Flag to control conc sweeper
 volatile int  NMethodSweeper::_bytes_changed           = 0;    // Counts the total nmethod size if the nmethod changed from:
@@ -175,18 +176,6 @@ public:
 };
 static MarkActivationClosure mark_activation_closure;
 
-class SetHotnessClosure: public CodeBlobClosure {
-public:
-  virtual void do_code_blob(CodeBlob* cb) {
-    if (cb->is_nmethod()) {
-      nmethod* nm = (nmethod*)cb;
-      nm->set_hotness_counter(NMethodSweeper::hotness_counter_reset_val());
-    }
-  }
-};
-static SetHotnessClosure set_hotness_closure;
-
-
 int NMethodSweeper::hotness_counter_reset_val() {
   if (_hotness_counter_reset_val == 0) {
     _hotness_counter_reset_val = (ReservedCodeCacheSize < M) ? 1 : (ReservedCodeCacheSize / M) * 2;
@@ -199,7 +188,9 @@ bool NMethodSweeper::sweep_in_progress() {
 
 // Scans the stacks of all Java threads and marks activations of not-entrant methods.
 // No need to synchronize access, since 'mark_active_nmethods' is always executed at a
-// safepoint.
+// safepoint. The scan only runs if the sweeper has requested it; at all other
+// safepoints this is merely a counter increment, so sweeping never elongates
+// pauses on its own.
 void NMethodSweeper::mark_active_nmethods() {
   assert(SafepointSynchronize::is_at_safepoint(), "must be executed at a safepoint");
   // If we do not want to reclaim not-entrant or zombie methods there is no need
@@ -211,6 +202,11 @@ void NMethodSweeper::mark_active_nmethods() {
   // Increase time so that we can estimate when to invoke the sweeper again.
   _time_counter++;
 
+  if (!_stack_scan_requested) {
+    return;
+  }
+  _stack_scan_requested = false;
+
   // Check for restart
   assert(CodeCache::find_blob_unsafe(_current) == _current, "Sweeper nmethod cached state invalid");
   if (!sweep_in_progress()) {
@@ -224,10 +220,6 @@ void NMethodSweeper::mark_active_nmethods() {
       tty->print_cr("### Sweep: stack traversal %d", _traversals);
     }
     Threads::nmethods_do(&mark_activation_closure);
-
-  } else {
-    // Only set hotness counter
-    Threads::nmethods_do(&set_hotness_closure);
   }
 
   OrderAccess::storestore();
@@ -241,7 +233,7 @@ void NMethodSweeper::mark_active_nmethods() {
 void NMethodSweeper::possibly_sweep() {
   assert(JavaThread::current()->thread_state() == _thread_in_vm, "must run in vm mode");
   // Only compiler threads are allowed to sweep
-  if (!MethodFlushing || !sweep_in_progress() || !Thread::current()->is_Compiler_thread()) {
+  if (!MethodFlushing || !Thread::current()->is_Compiler_thread()) {
     return;
   }
 
@@ -279,6 +271,14 @@ void NMethodSweeper::possibly_sweep() {
     }
   }
 
+  if (_should_sweep && !sweep_in_progress()) {
+    // A new sweep pass has to start with a stack scan. Request one from the
+    // next safepoint instead of scanning stacks at every safepoint; the
+    // periodic safepoint (GuaranteedSafepointInterval) bounds the wait.
+    _stack_scan_requested = true;
+    return;
+  }
+
   if (_should_sweep && _sweep_fractions_left > 0) {
     // Only one thread at a time will sweep
     jint old = Atomic::cmpxchg( 1, &_sweep_started, 0 );
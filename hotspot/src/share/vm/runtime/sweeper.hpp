@@ -33,6 +33,12 @@
 //  1) mark active nmethods
 //     Is done in 'mark_active_nmethods()'. This function is called at a
 //     safepoint and marks all nmethods that are active on a thread's stack.
+//     Stack scanning is demand-driven: it only runs if the sweeper has
+//     requested it because a new sweep pass is about to start. At all other
+//     safepoints 'mark_active_nmethods()' merely ticks the sweeper's virtual
+//     time, so an idle or in-progress sweep adds no stack walking to pause
+//     time. A pending request is served by the next safepoint, at the latest
+//     the periodic one (GuaranteedSafepointInterval).
 //  2) sweep nmethods
 //     Is done in sweep_code_cache(). This function is the only place in the
 //     sweeper where memory is reclaimed. Note that sweep_code_cache() is not
@@ -67,6 +73,7 @@ class NMethodSweeper : public AllStatic {
   static volatile int  _sweep_fractions_left;       // Nof. invocations left until we are completed with this pass
   static volatile int  _sweep_started;              // Flag to control conc sweeper
   static volatile bool _should_sweep;               // Indicates if we should invoke the sweeper
+  static volatile bool _stack_scan_requested;       // Set by the sweeper when the next safepoint should scan stacks
   static volatile int  _bytes_changed;              // Counts the total nmethod size if the nmethod changed from:
                                                     //   1) alive       -> not_entrant
                                                     //   2) not_entrant -> zombie
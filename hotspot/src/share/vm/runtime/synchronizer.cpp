@@ -26,8 +26,10 @@
 #include "classfile/vmSymbols.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/sharedHeap.hpp"
 #include "oops/markOop.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/biasedLocking.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/interfaceSupport.hpp"
@@ -41,6 +43,7 @@
 #include "utilities/dtrace.hpp"
 #include "utilities/events.hpp"
 #include "utilities/preserveException.hpp"
+#include "utilities/workgroup.hpp"
 #ifdef TARGET_OS_FAMILY_linux
 # include "os_linux.inline.hpp"
 #endif
@@ -154,7 +157,7 @@ ObjectMonitor * volatile ObjectSynchronizer::gBlockList = NULL;
 ObjectMonitor * volatile ObjectSynchronizer::gFreeList  = NULL ;
 ObjectMonitor * volatile ObjectSynchronizer::gOmInUseList  = NULL ;
 int ObjectSynchronizer::gOmInUseCount = 0;
-static volatile intptr_t ListLock = 0 ;      // protects global monitor free-list cache
+static volatile intptr_t ListLock = 0 ;      // protects gOmInUseList; gFreeList is lock-free
 static volatile int MonitorFreeCount  = 0 ;      // # on gFreeList
 static volatile int MonitorPopulation = 0 ;      // # Extant -- in circulation
 #define CHAINMARKER (cast_to_oop<intptr_t>(-1))
@@ -633,6 +636,23 @@ intptr_t ObjectSynchronizer::FastHashCode (Thread * Self, oop obj) {
     // added check of the bias pattern is to avoid useless calls to
     // thread-local storage.
     if (obj->mark()->has_bias_pattern()) {
+      // Most objects that reach here have never actually been locked --
+      // they merely carry the anonymous bias pattern they were allocated
+      // with. For those we can install the hash and drop the bias with a
+      // single CAS instead of going through the revocation machinery,
+      // which may otherwise trigger a STW safepoint just to hash.
+      markOop biased_mark = obj->mark() ;
+      if (biased_mark->is_biased_anonymously()) {
+        intptr_t h = get_next_hash (Self, obj) ;
+        markOop unbiased_mark = markOopDesc::prototype()->set_age(biased_mark->age())->copy_set_hash(h) ;
+        markOop v = (markOop) Atomic::cmpxchg_ptr (unbiased_mark, obj->mark_addr(), biased_mark) ;
+        if (v == biased_mark) {
+          TEVENT (hashCode: anonymous bias CAS) ;
+          return h ;
+        }
+        // Lost the race -- somebody locked or revoked concurrently.
+        // Fall through to the full revocation path.
+      }
       // Box and unbox the raw reference just in case we cause a STW safepoint.
       Handle hobj (Self, obj) ;
       // Relaxing assertion for bug 6320749.
@@ -865,6 +885,71 @@ void ObjectSynchronizer::monitors_iterate(MonitorClosure* closure) {
   }
 }
 
+// One row of the per-class spin statistics table built by
+// print_spin_statistics_on(), below.
+struct SpinStatsRow {
+  Klass * _klass ;
+  int     _monitors ;
+  jlong   _attempts ;
+  jlong   _successes ;
+  jlong   _duration_sum ;
+};
+
+// Aggregate the adaptive-spin counters of all in-use monitors, keyed by
+// the lock object's class. Called from jcmd, outside a safepoint; the
+// counters are updated racily by spinning threads, so the numbers are
+// approximate -- good enough for tuning SyncKnobs.
+void ObjectSynchronizer::print_spin_statistics_on(outputStream * st) {
+  ResourceMark rm ;              // for Klass::external_name()
+  const int table_size = 256 ;   // power of two; collisions fold into "(other)"
+  SpinStatsRow * table = NEW_C_HEAP_ARRAY(SpinStatsRow, table_size + 1, mtInternal) ;
+  memset (table, 0, (table_size + 1) * sizeof(SpinStatsRow)) ;
+  SpinStatsRow * overflow = &table[table_size] ;
+
+  ObjectMonitor* block =
+    (ObjectMonitor*)OrderAccess::load_ptr_acquire(&gBlockList);
+  while (block != NULL) {
+    assert(block->object() == CHAINMARKER, "must be a block header");
+    for (int i = _BLOCKSIZE - 1; i > 0; i--) {
+      ObjectMonitor* mid = (ObjectMonitor *)(block + i);
+      oop object = (oop)mid->object();
+      if (object == NULL) continue ;
+      if (mid->spin_attempts() == 0) continue ;
+      Klass * k = object->klass() ;
+      SpinStatsRow * row = overflow ;
+      int idx = (int)((uintptr_t) k >> 3) & (table_size - 1) ;
+      for (int probe = 0; probe < 8; probe++) {
+        SpinStatsRow * c = &table[(idx + probe) & (table_size - 1)] ;
+        if (c->_klass == k || c->_klass == NULL) {
+          c->_klass = k ;
+          row = c ;
+          break ;
+        }
+      }
+      row->_monitors ++ ;
+      row->_attempts += mid->spin_attempts() ;
+      row->_successes += mid->spin_successes() ;
+      row->_duration_sum += mid->spin_duration() ;
+    }
+    block = (ObjectMonitor*)block->FreeNext;
+  }
+
+  st->print_cr("Adaptive spin statistics for in-use monitors, by lock class:");
+  st->print_cr("%-60s %9s %12s %12s %8s",
+               "Class", "Monitors", "Attempts", "Successes", "AvgSpin");
+  for (int i = 0; i <= table_size; i++) {
+    SpinStatsRow * row = &table[i] ;
+    if (row->_monitors == 0) continue ;
+    const char * name = (row == overflow) ? "(other)"
+                                          : row->_klass->external_name() ;
+    st->print_cr("%-60s %9d " INT64_FORMAT_W(12) " " INT64_FORMAT_W(12) " %8d",
+                 name, row->_monitors, row->_attempts, row->_successes,
+                 (int) (row->_duration_sum / row->_monitors)) ;
+  }
+
+  FREE_C_HEAP_ARRAY(SpinStatsRow, table, mtInternal) ;
+}
+
 // Get the next block in the block list.
 static inline ObjectMonitor* next(ObjectMonitor* block) {
   assert(block->object() == CHAINMARKER, "must be a block header");
@@ -898,8 +983,12 @@ void ObjectSynchronizer::oops_do(OopClosure* f) {
 // STW-time -- disassociates idle monitors from objects.  Such
 // scavenged monitors are returned to the gFreeList.
 //
-// The global list is protected by ListLock.  All the critical sections
-// are short and operate in constant-time.
+// The global free list is lock-free: chains of monitors are pushed with a
+// CAS-based prepend and the list is only ever consumed by detaching it
+// whole with an atomic exchange, never by popping individual nodes, so
+// the usual ABA hazard of a Treiber stack over type-stable memory does
+// not arise.  ListLock now guards only gOmInUseList, which the scavenge
+// operator unlinks in place while moribund threads splice onto it.
 //
 // ObjectMonitors reside in type-stable memory (TSM) and are immortal.
 //
@@ -968,6 +1057,15 @@ void ObjectSynchronizer::verifyInUse (Thread *Self) {
    assert(freetally == Self->omFreeCount, "free count off");
 }
 */
+void ObjectSynchronizer::prepend_to_gFreeList (ObjectMonitor * head, ObjectMonitor * tail) {
+    assert (head != NULL && tail != NULL, "invariant") ;
+    for (;;) {
+        ObjectMonitor * cur = gFreeList ;
+        tail->FreeNext = cur ;
+        if ((ObjectMonitor *) Atomic::cmpxchg_ptr (head, &gFreeList, cur) == cur) break ;
+    }
+}
+
 ObjectMonitor * ATTR ObjectSynchronizer::omAlloc (Thread * Self) {
     // A large MAXPRIVATE value reduces both list lock contention
     // and list coherency traffic, but also tends to increase the
@@ -1002,37 +1100,69 @@ ObjectMonitor * ATTR ObjectSynchronizer::omAlloc (Thread * Self) {
         }
 
         // 2: try to allocate from the global gFreeList
-        // CONSIDER: use muxTry() instead of muxAcquire().
-        // If the muxTry() fails then drop immediately into case 3.
         // If we're using thread-local free lists then try
         // to reprovision the caller's free list.
         if (gFreeList != NULL) {
-            // Reprovision the thread's omFreeList.
-            // Use bulk transfers to reduce the allocation rate and heat
-            // on various locks.
-            Thread::muxAcquire (&ListLock, "omAlloc") ;
-            for (int i = Self->omFreeProvision; --i >= 0 && gFreeList != NULL; ) {
-                MonitorFreeCount --;
-                ObjectMonitor * take = gFreeList ;
-                gFreeList = take->FreeNext ;
-                guarantee (take->object() == NULL, "invariant") ;
-                guarantee (!take->is_busy(), "invariant") ;
-                take->Recycle() ;
-                omRelease (Self, take, false) ;
-            }
-            Thread::muxRelease (&ListLock) ;
-            Self->omFreeProvision += 1 + (Self->omFreeProvision/2) ;
-            if (Self->omFreeProvision > MAXPRIVATE ) Self->omFreeProvision = MAXPRIVATE ;
-            TEVENT (omFirst - reprovision) ;
-
-            const int mx = MonitorBound ;
-            if (mx > 0 && (MonitorPopulation-MonitorFreeCount) > mx) {
-              // We can't safely induce a STW safepoint from omAlloc() as our thread
-              // state may not be appropriate for such activities and callers may hold
-              // naked oops, so instead we defer the action.
-              InduceScavenge (Self, "omAlloc") ;
+            // Reprovision the thread's omFreeList with a bulk transfer.
+            // Detach the entire global list with a single atomic exchange,
+            // carve off the caller's provision, and immediately republish
+            // the remainder with a CAS-based prepend.  Both operations are
+            // immune to ABA as the list is never popped one node at a time,
+            // so no lock is needed.  A thread arriving inside the carve
+            // window sees an empty gFreeList and may allocate a fresh
+            // block; the window is only the short walk below, so that is
+            // rare and merely grows the population slightly.
+            ObjectMonitor * list = (ObjectMonitor *) Atomic::xchg_ptr (NULL, (volatile void *) &gFreeList) ;
+            if (list != NULL) {
+                ObjectMonitor * tail = list ;
+                int taken = 1 ;
+                for (int i = Self->omFreeProvision; --i > 0 && tail->FreeNext != NULL; ) {
+                    tail = tail->FreeNext ;
+                    taken ++ ;
+                }
+                ObjectMonitor * remainder = tail->FreeNext ;
+                tail->FreeNext = NULL ;
+                if (remainder != NULL) {
+                    // Republish the remainder.  It is already null-terminated,
+                    // so the common case is a single CAS from NULL.  If other
+                    // threads pushed chains while we held the list, detach and
+                    // walk just those chains to splice them in front; the cost
+                    // is bounded by the concurrent pushes, not by the length
+                    // of the remainder.
+                    while ((ObjectMonitor *) Atomic::cmpxchg_ptr (remainder, &gFreeList, NULL) != NULL) {
+                        ObjectMonitor * fresh = (ObjectMonitor *) Atomic::xchg_ptr (NULL, (volatile void *) &gFreeList) ;
+                        if (fresh != NULL) {
+                            ObjectMonitor * ftail = fresh ;
+                            while (ftail->FreeNext != NULL) ftail = ftail->FreeNext ;
+                            ftail->FreeNext = remainder ;
+                            remainder = fresh ;
+                        }
+                    }
+                }
+                Atomic::add (-taken, &MonitorFreeCount) ;
+                for (ObjectMonitor * take = list ; take != NULL ; ) {
+                    ObjectMonitor * next = take->FreeNext ;
+                    guarantee (take->object() == NULL, "invariant") ;
+                    guarantee (!take->is_busy(), "invariant") ;
+                    take->Recycle() ;
+                    omRelease (Self, take, false) ;
+                    take = next ;
+                }
+                Self->omFreeProvision += 1 + (Self->omFreeProvision/2) ;
+                if (Self->omFreeProvision > MAXPRIVATE ) Self->omFreeProvision = MAXPRIVATE ;
+                TEVENT (omFirst - reprovision) ;
+
+                const int mx = MonitorBound ;
+                if (mx > 0 && (MonitorPopulation-MonitorFreeCount) > mx) {
+                  // We can't safely induce a STW safepoint from omAlloc() as our thread
+                  // state may not be appropriate for such activities and callers may hold
+                  // naked oops, so instead we defer the action.
+                  InduceScavenge (Self, "omAlloc") ;
+                }
+                continue;
             }
-            continue;
+            // Raced with another thread over the detached list --
+            // fall through and allocate a new block.
         }
 
         // 3: allocate a block of new ObjectMonitors
@@ -1071,24 +1201,24 @@ ObjectMonitor * ATTR ObjectSynchronizer::omAlloc (Thread * Self) {
         // block in hand.  This avoids some lock traffic and redundant
         // list activity.
 
-        // Acquire the ListLock to manipulate BlockList and FreeList.
-        // An Oyama-Taura-Yonezawa scheme might be more efficient.
-        Thread::muxAcquire (&ListLock, "omAlloc [2]") ;
-        MonitorPopulation += _BLOCKSIZE-1;
-        MonitorFreeCount += _BLOCKSIZE-1;
+        Atomic::add (_BLOCKSIZE-1, &MonitorPopulation) ;
+        Atomic::add (_BLOCKSIZE-1, &MonitorFreeCount) ;
 
         // Add the new block to the list of extant blocks (gBlockList).
         // The very first objectMonitor in a block is reserved and dedicated.
         // It serves as blocklist "next" linkage.
-        temp[0].FreeNext = gBlockList;
-        // There are lock-free uses of gBlockList so make sure that
-        // the previous stores happen before we update gBlockList.
-        OrderAccess::release_store_ptr(&gBlockList, temp);
+        // gBlockList is only ever prepended to, so a CAS loop suffices.
+        // There are lock-free uses of gBlockList; the full fence implied
+        // by the CAS makes sure the previous stores happen before the
+        // block is published.
+        for (;;) {
+            ObjectMonitor * head = gBlockList ;
+            temp[0].FreeNext = head ;
+            if ((ObjectMonitor *) Atomic::cmpxchg_ptr (temp, &gBlockList, head) == head) break ;
+        }
 
         // Add the new string of objectMonitors to the global free list
-        temp[_BLOCKSIZE - 1].FreeNext = gFreeList ;
-        gFreeList = temp + 1;
-        Thread::muxRelease (&ListLock) ;
+        prepend_to_gFreeList (temp + 1, &temp[_BLOCKSIZE - 1]) ;
         TEVENT (Allocate block of monitors) ;
     }
 }
@@ -1185,20 +1315,24 @@ void ObjectSynchronizer::omFlush (Thread * Self) {
       guarantee (InUseTail != NULL && InUseList != NULL, "invariant");
     }
 
-    Thread::muxAcquire (&ListLock, "omFlush") ;
+    // The free list push is lock-free; omFlush() can run concurrently
+    // with the scavenge operator, which now splices onto gFreeList with
+    // a CAS as well.
     if (Tail != NULL) {
-      Tail->FreeNext = gFreeList ;
-      gFreeList = List ;
-      MonitorFreeCount += Tally;
+      prepend_to_gFreeList (List, Tail) ;
+      Atomic::add (Tally, &MonitorFreeCount) ;
     }
 
     if (InUseTail != NULL) {
+      // gOmInUseList is still guarded by ListLock -- the scavenge
+      // operator walks and unlinks it in place.
+      Thread::muxAcquire (&ListLock, "omFlush") ;
       InUseTail->FreeNext = gOmInUseList;
       gOmInUseList = InUseList;
       gOmInUseCount += InUseTally;
+      Thread::muxRelease (&ListLock) ;
     }
 
-    Thread::muxRelease (&ListLock) ;
     TEVENT (omFlush) ;
 }
 
@@ -1562,6 +1696,73 @@ int ObjectSynchronizer::walk_monitor_list(ObjectMonitor** listheadp,
   return deflatedcount;
 }
 
+// Deflate the per-thread in-use lists in parallel.  Workers claim
+// JavaThreads with an atomic ticket, walk the claimed thread's in-use
+// list into a worker-local chain of scavenged monitors, and prepend that
+// chain onto gFreeList with a CAS.  The CAS is sufficient here: all Java
+// threads are stopped at the safepoint, so besides the workers only a
+// moribund thread's omFlush() can push onto gFreeList, and pushes are
+// ABA-safe against each other.
+class ParDeflateInUseListsTask : public AbstractGangTask {
+ private:
+  volatile jint _claim_ticket;     // next JavaThread position to hand out
+  volatile jint _gomclaim;         // one-shot claim on gOmInUseList
+  volatile jint _nInCirculation;
+  volatile jint _nInuse;
+  volatile jint _nScavenged;
+
+ public:
+  ParDeflateInUseListsTask() :
+    AbstractGangTask("par deflate idle monitors"),
+    _claim_ticket(0), _gomclaim(0),
+    _nInCirculation(0), _nInuse(0), _nScavenged(0) { }
+
+  int in_circulation() const { return _nInCirculation; }
+  int in_use()         const { return _nInuse; }
+  int scavenged()      const { return _nScavenged; }
+
+  void work(uint worker_id) {
+    ObjectMonitor * FreeHead = NULL ;  // Local SLL of scavenged monitors
+    ObjectMonitor * FreeTail = NULL ;
+    int nInCirculation = 0;
+    int nInuse = 0;
+    int nScavenged = 0;
+
+    int ticket = Atomic::add(1, &_claim_ticket) - 1;
+    int pos = 0;
+    for (JavaThread* cur = Threads::first(); cur != NULL; cur = cur->next(), pos++) {
+      if (pos != ticket) continue;
+      nInCirculation += cur->omInUseCount;
+      int deflatedcount = ObjectSynchronizer::walk_monitor_list(cur->omInUseList_addr(), &FreeHead, &FreeTail);
+      cur->omInUseCount -= deflatedcount;
+      nScavenged += deflatedcount;
+      nInuse += cur->omInUseCount;
+      ticket = Atomic::add(1, &_claim_ticket) - 1;
+    }
+
+    // For moribund threads, scan gOmInUseList; claimed by one worker only
+    if (ObjectSynchronizer::gOmInUseList != NULL &&
+        Atomic::cmpxchg(1, &_gomclaim, 0) == 0) {
+      nInCirculation += ObjectSynchronizer::gOmInUseCount;
+      int deflatedcount = ObjectSynchronizer::walk_monitor_list((ObjectMonitor **)&ObjectSynchronizer::gOmInUseList, &FreeHead, &FreeTail);
+      ObjectSynchronizer::gOmInUseCount -= deflatedcount;
+      nScavenged += deflatedcount;
+      nInuse += ObjectSynchronizer::gOmInUseCount;
+    }
+
+    // Prepend the worker-local chain of scavenged monitors to gFreeList.
+    if (FreeHead != NULL) {
+      guarantee (FreeTail != NULL && nScavenged > 0, "invariant") ;
+      assert (FreeTail->FreeNext == NULL, "invariant") ;
+      ObjectSynchronizer::prepend_to_gFreeList(FreeHead, FreeTail);
+    }
+
+    Atomic::add(nInCirculation, &_nInCirculation);
+    Atomic::add(nInuse, &_nInuse);
+    Atomic::add(nScavenged, &_nScavenged);
+  }
+};
+
 void ObjectSynchronizer::deflate_idle_monitors() {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
   int nInuse = 0 ;              // currently associated with objects
@@ -1579,23 +1780,41 @@ void ObjectSynchronizer::deflate_idle_monitors() {
   Thread::muxAcquire (&ListLock, "scavenge - return") ;
 
   if (MonitorInUseLists) {
-    int inUse = 0;
-    for (JavaThread* cur = Threads::first(); cur != NULL; cur = cur->next()) {
-      nInCirculation+= cur->omInUseCount;
-      int deflatedcount = walk_monitor_list(cur->omInUseList_addr(), &FreeHead, &FreeTail);
-      cur->omInUseCount-= deflatedcount;
-      // verifyInUse(cur);
-      nScavenged += deflatedcount;
-      nInuse += cur->omInUseCount;
-     }
+    // The per-thread in-use lists are mutually independent, so with a
+    // large monitor population they can be deflated in parallel by the
+    // GC worker gang.  ParallelScavenge has no shared gang; it falls
+    // back to the serial walk below.
+    FlexibleWorkGang* workers = NULL;
+    if (ParallelMonitorDeflation &&
+        CollectedHeap::use_parallel_gc_threads() &&
+        SharedHeap::heap() != NULL) {
+      workers = SharedHeap::heap()->workers();
+    }
+    if (workers != NULL && workers->total_workers() > 1) {
+      ParDeflateInUseListsTask tsk;
+      workers->run_task(&tsk);
+      nInCirculation = tsk.in_circulation();
+      nInuse = tsk.in_use();
+      nScavenged = tsk.scavenged();
+    } else {
+      int inUse = 0;
+      for (JavaThread* cur = Threads::first(); cur != NULL; cur = cur->next()) {
+        nInCirculation+= cur->omInUseCount;
+        int deflatedcount = walk_monitor_list(cur->omInUseList_addr(), &FreeHead, &FreeTail);
+        cur->omInUseCount-= deflatedcount;
+        // verifyInUse(cur);
+        nScavenged += deflatedcount;
+        nInuse += cur->omInUseCount;
+      }
 
-   // For moribund threads, scan gOmInUseList
-   if (gOmInUseList) {
-     nInCirculation += gOmInUseCount;
-     int deflatedcount = walk_monitor_list((ObjectMonitor **)&gOmInUseList, &FreeHead, &FreeTail);
-     gOmInUseCount-= deflatedcount;
-     nScavenged += deflatedcount;
-     nInuse += gOmInUseCount;
+      // For moribund threads, scan gOmInUseList
+      if (gOmInUseList) {
+        nInCirculation += gOmInUseCount;
+        int deflatedcount = walk_monitor_list((ObjectMonitor **)&gOmInUseList, &FreeHead, &FreeTail);
+        gOmInUseCount-= deflatedcount;
+        nScavenged += deflatedcount;
+        nInuse += gOmInUseCount;
+      }
     }
 
   } else {
@@ -1629,7 +1848,7 @@ void ObjectSynchronizer::deflate_idle_monitors() {
     }
   }
 
-  MonitorFreeCount += nScavenged;
+  Atomic::add (nScavenged, &MonitorFreeCount) ;
 
   // Consider: audit gFreeList to ensure that MonitorFreeCount and list agree.
 
@@ -1646,9 +1865,9 @@ void ObjectSynchronizer::deflate_idle_monitors() {
   if (FreeHead != NULL) {
      guarantee (FreeTail != NULL && nScavenged > 0, "invariant") ;
      assert (FreeTail->FreeNext == NULL, "invariant") ;
-     // constant-time list splice - prepend scavenged segment to gFreeList
-     FreeTail->FreeNext = gFreeList ;
-     gFreeList = FreeHead ;
+     // constant-time list splice - prepend scavenged segment to gFreeList.
+     // CAS-based as a moribund thread's omFlush() may push concurrently.
+     prepend_to_gFreeList (FreeHead, FreeTail) ;
   }
   Thread::muxRelease (&ListLock) ;
 
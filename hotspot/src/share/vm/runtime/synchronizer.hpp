@@ -36,6 +36,7 @@ class ObjectMonitor;
 
 class ObjectSynchronizer : AllStatic {
   friend class VMStructs;
+  friend class ParDeflateInUseListsTask;
 #if INCLUDE_ALL_GCS
   friend class ShenandoahSynchronizerIterator;
 #endif
@@ -126,6 +127,10 @@ public:
   static void release_monitors_owned_by_thread(TRAPS);
   static void monitors_iterate(MonitorClosure* m);
 
+  // Diagnostics: adaptive spin statistics aggregated by lock class,
+  // exported via jcmd VM.monitor_spin_statistics
+  static void print_spin_statistics_on(outputStream* st);
+
   // GC: we current use aggressive monitor deflation policy
   // Basically we deflate all monitors that are not busy.
   // An adaptive profile-based deflation policy could be used if needed
@@ -148,6 +153,13 @@ public:
 
  private:
   enum { _BLOCKSIZE = 128 };
+
+  // Prepend the null-terminated chain [head, tail] onto gFreeList.
+  // gFreeList is only ever pushed with a CAS or detached whole with an
+  // atomic exchange, never popped one node at a time, so both operations
+  // are immune to ABA despite monitors being type-stable memory.
+  static void prepend_to_gFreeList(ObjectMonitor* head, ObjectMonitor* tail);
+
   static ObjectMonitor * volatile gBlockList;
   static ObjectMonitor * volatile gFreeList;
   static ObjectMonitor * volatile gOmInUseList; // for moribund thread, so monitors they inflated still get scanned
@@ -43,6 +43,7 @@
 
 int PeriodicTask::_num_tasks = 0;
 PeriodicTask* PeriodicTask::_tasks[PeriodicTask::max_tasks];
+jlong PeriodicTask::_last_tick = 0;
 #ifndef PRODUCT
 elapsedTimer PeriodicTask::_timer;
 int PeriodicTask::_intervalHistogram[PeriodicTask::max_interval];
@@ -54,10 +55,46 @@ void PeriodicTask::print_intervals() {
       int n = _intervalHistogram[i];
       if (n > 0) tty->print_cr("%3d: %5d (%4.1f%%)", i, n, 100.0 * n / _ticks);
     }
+    tty->print_cr("PeriodicTask execution times:");
+    for (int i = 0; i < _num_tasks; i++) {
+      PeriodicTask* t = _tasks[i];
+      if (t->_executions > 0) {
+        tty->print_cr("  interval %5dms: %8d runs, %6d overruns, avg %8.3fms, max %8.3fms",
+                      t->_interval, t->_executions, t->_overruns,
+                      (t->_exec_time / 1000000.0) / t->_executions,
+                      t->_max_exec_time / 1000000.0);
+      }
+    }
   }
 }
 #endif
 
+void PeriodicTask::execute_if_pending(int delay_time) {
+  // make sure we don't overflow
+  jlong tmp = (jlong) _counter + (jlong) delay_time;
+
+  if (tmp >= (jlong) _interval) {
+    _counter = 0;
+#ifndef PRODUCT
+    jlong start = os::javaTimeNanos();
+    task();
+    jlong elapsed = os::javaTimeNanos() - start;
+    _executions++;
+    _exec_time += elapsed;
+    if (elapsed > _max_exec_time) {
+      _max_exec_time = elapsed;
+    }
+    if (elapsed >= (jlong) _interval * 1000000) {
+      _overruns++;
+    }
+#else
+    task();
+#endif
+  } else {
+    _counter += delay_time;
+  }
+}
+
 void PeriodicTask::real_time_tick(int delay_time) {
 #ifndef PRODUCT
   if (ProfilerCheckIntervals) {
@@ -73,6 +110,19 @@ void PeriodicTask::real_time_tick(int delay_time) {
 
   {
     MutexLockerEx ml(PeriodicTask_lock, Mutex::_no_safepoint_check_flag);
+
+    // Charge tasks with the real time elapsed since the previous tick, which
+    // includes the time that tick spent executing tasks. Otherwise a slow
+    // task pushes every other task's deadline out by its own execution time.
+    jlong now = os::javaTimeNanos();
+    if (delay_time == 0 || _last_tick == 0) {
+      // First tick, or woken up without any enrolled tasks: re-baseline.
+      _last_tick = now;
+    } else {
+      delay_time = (int) MIN2<jlong>((now - _last_tick) / 1000000, (jlong) max_interval);
+      _last_tick = now;
+    }
+
     int orig_num_tasks = _num_tasks;
 
     for(int index = 0; index < _num_tasks; index++) {
@@ -103,6 +153,12 @@ int PeriodicTask::time_to_wait() {
 
 PeriodicTask::PeriodicTask(size_t interval_time) :
   _counter(0), _interval((int) interval_time) {
+#ifndef PRODUCT
+  _executions = 0;
+  _overruns = 0;
+  _exec_time = 0;
+  _max_exec_time = 0;
+#endif
   // Sanity check the interval time
   assert(_interval >= PeriodicTask::min_interval &&
          _interval %  PeriodicTask::interval_gran == 0,
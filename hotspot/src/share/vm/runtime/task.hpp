@@ -42,8 +42,8 @@ class PeriodicTask: public CHeapObj<mtInternal> {
   // is appropriate;  it must be between min_interval and max_interval,
   // and have a granularity of interval_gran (all in millis).
   enum { max_tasks     = 10,       // Max number of periodic tasks in system
-         interval_gran = 10,
-         min_interval  = 10,
+         interval_gran = 1,
+         min_interval  = 1,
          max_interval  = 10000 };
 
   static int num_tasks()   { return _num_tasks; }
@@ -52,8 +52,20 @@ class PeriodicTask: public CHeapObj<mtInternal> {
   int _counter;
   const int _interval;
 
+#ifndef PRODUCT
+  // Per-task execution accounting, so that a task that overruns its own
+  // interval (and thereby delays every other enrolled task) can be found.
+  int   _executions;     // number of times task() has run
+  int   _overruns;       // executions that took longer than _interval
+  jlong _exec_time;      // total time spent in task(), in nanoseconds
+  jlong _max_exec_time;  // longest single execution, in nanoseconds
+#endif
+
   static int _num_tasks;
   static PeriodicTask* _tasks[PeriodicTask::max_tasks];
+  // Time of the previous tick, used to charge tasks with the real elapsed
+  // time rather than just the time the WatcherThread spent sleeping.
+  static jlong _last_tick;
   static void real_time_tick(int delay_time);
 
 #ifndef PRODUCT
@@ -77,17 +89,7 @@ class PeriodicTask: public CHeapObj<mtInternal> {
   // Make the task deactive
   void disenroll();
 
-  void execute_if_pending(int delay_time) {
-    // make sure we don't overflow
-    jlong tmp = (jlong) _counter + (jlong) delay_time;
-
-    if (tmp >= (jlong) _interval) {
-      _counter = 0;
-      task();
-    } else {
-      _counter += delay_time;
-    }
-  }
+  void execute_if_pending(int delay_time);
 
   // Returns how long (time in milliseconds) before the next time we should
   // execute this task.
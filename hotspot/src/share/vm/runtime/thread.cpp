@@ -25,8 +25,10 @@
 #include "precompiled.hpp"
 #include "classfile/classLoader.hpp"
 #include "classfile/javaClasses.hpp"
+#include "classfile/resolutionJournal.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "code/codeCache.hpp"
 #include "code/scopeDesc.hpp"
 #include "compiler/compileBroker.hpp"
 #include "interpreter/interpreter.hpp"
@@ -50,6 +52,7 @@
 #include "runtime/biasedLocking.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/fprofiler.hpp"
+#include "runtime/fastTime.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/init.hpp"
 #include "runtime/interfaceSupport.hpp"
@@ -62,6 +65,7 @@
 #include "runtime/orderAccess.inline.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/safepoint.hpp"
+#include "runtime/selfSampler.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/statSampler.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -77,7 +81,9 @@
 #include "services/attachListener.hpp"
 #include "services/management.hpp"
 #include "services/memTracker.hpp"
+#include "services/threadAllocationTable.hpp"
 #include "services/threadService.hpp"
+#include "services/vmTelemetry.hpp"
 #include "utilities/defaultStream.hpp"
 #include "utilities/dtrace.hpp"
 #include "utilities/events.hpp"
@@ -230,6 +236,7 @@ Thread::Thread() {
   DEBUG_ONLY(_current_resource_mark = NULL;)
   set_handle_area(new (mtThread) HandleArea(NULL));
   set_metadata_handles(new (ResourceObj::C_HEAP, mtClass) GrowableArray<Metadata*>(30, true));
+  _codeblob_lookup_cache = new CodeBlobLookupCache();
   set_active_handles(NULL);
   set_free_handle_block(NULL);
   set_last_handle_mark(NULL);
@@ -248,6 +255,7 @@ Thread::Thread() {
   NOT_PRODUCT(_allow_safepoint_count = 0;)
   NOT_PRODUCT(_skip_gcalot = false;)
   _jvmti_env_iteration_count = 0;
+  _published_allocated_bytes = NULL;
   set_allocated_bytes(0);
   _vm_operation_started_count = 0;
   _vm_operation_completed_count = 0;
@@ -410,6 +418,12 @@ Thread::~Thread() {
 
   delete handle_area();
   delete metadata_handles();
+  delete _codeblob_lookup_cache;
+  _codeblob_lookup_cache = NULL;
+
+  // Return cached arena chunks to the global chunk pools. Safe from any
+  // thread, since nobody can allocate into this cache anymore.
+  _chunk_cache.flush();
 
   // osthread() can be NULL, if creation of thread failed.
   if (osthread() != NULL) os::free_thread(osthread());
@@ -1482,6 +1496,7 @@ void JavaThread::initialize() {
   clear_must_deopt_id();
   set_monitor_chunks(NULL);
   set_next(NULL);
+  set_threads_array_index(-1);
   set_thread_state(_thread_new);
   _terminated = _not_terminated;
   _privileged_stack_top = NULL;
@@ -1498,6 +1513,7 @@ void JavaThread::initialize() {
   _should_post_on_exceptions_flag = JNI_FALSE;
   _jvmti_get_loaded_classes_closure = NULL;
   _interp_only_mode    = 0;
+  _profile_sample_countdown = 0;
   _special_runtime_exit_condition = _no_async_condition;
   _pending_async_exception = NULL;
   _thread_stat = NULL;
@@ -1537,6 +1553,10 @@ void JavaThread::initialize() {
   _popframe_preserved_args_size = 0;
   _frames_to_pop_failed_realloc = 0;
 
+  // OSR migration buffer recycling
+  _osr_migration_buffer = NULL;
+  _osr_migration_buffer_words = 0;
+
   pd_initialize();
 }
 
@@ -1666,6 +1686,11 @@ JavaThread::~JavaThread() {
     delete deferred;
   }
 
+  if (_osr_migration_buffer != NULL) {
+    FREE_C_HEAP_ARRAY(intptr_t, _osr_migration_buffer, mtCode);
+    _osr_migration_buffer = NULL;
+  }
+
   // All Java related clean up happens in exit
   ThreadSafepointState::destroy(this);
   if (_thread_profiler != NULL) delete _thread_profiler;
@@ -1710,6 +1735,8 @@ void JavaThread::run() {
 
   JFR_ONLY(Jfr::on_thread_start(this);)
 
+  ThreadAllocationTable::thread_started(this);
+
   // We call another function to do the rest so we are sure that the stack addresses used
   // from there will be lower than the stack base just computed
   thread_main_inner();
@@ -1914,6 +1941,8 @@ void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
   assert(_privileged_stack_top == NULL, "must be NULL when we get here");
   JFR_ONLY(Jfr::on_thread_exit(this);)
 
+  ThreadAllocationTable::thread_exiting(this);
+
   if (active_handles() != NULL) {
     JNIHandleBlock* block = active_handles();
     set_active_handles(NULL);
@@ -2236,6 +2265,10 @@ void JavaThread::handle_special_runtime_exit_condition(bool check_asyncs) {
     // so check for other async requests.
   }
 
+  if (is_self_sample_requested()) {
+    SelfSampler::record_sample(this);
+  }
+
   if (check_asyncs) {
     check_and_handle_async_exceptions();
   }
@@ -3336,6 +3369,8 @@ void CompilerThread::oops_do(OopClosure* f, CLDClosure* cld_f, CodeBlobClosure*
 // and going away unexpectedly (e.g., safepoint synchronization)
 
 JavaThread* Threads::_thread_list = NULL;
+JavaThread** Threads::_thread_array = NULL;
+int         Threads::_thread_array_capacity = 0;
 int         Threads::_number_of_threads = 0;
 int         Threads::_number_of_non_daemon_threads = 0;
 int         Threads::_return_code = 0;
@@ -3656,6 +3691,9 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   Management::record_vm_init_completed();
 #endif // INCLUDE_MANAGEMENT
 
+  // Load the resolution journal before any application class links.
+  ResolutionJournal::initialize();
+
   // Compute system loader. Note that this has to occur after set_init_completed, since
   // valid exceptions may be thrown in the process.
   // Note that we do not use CHECK_0 here since we are inside an EXCEPTION_MARK and
@@ -3744,6 +3782,8 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   if (Arguments::has_profile())       FlatProfiler::engage(main_thread, true);
   if (MemProfiling)                   MemProfiler::engage();
   StatSampler::engage();
+  FastTime::engage();
+  if (EnableVMTelemetry)              VMTelemetry::engage();
   if (CheckJNICalls)                  JniPeriodicChecker::engage();
 
   BiasedLocking::init();
@@ -4168,6 +4208,20 @@ void Threads::add(JavaThread* p, bool force_daemon) {
   p->initialize_queues();
   p->set_next(_thread_list);
   _thread_list = p;
+  // Mirror the linked list in the flat array so GC root scanning can walk
+  // a contiguous block of pointers instead of chasing _next links.
+  if (_number_of_threads == _thread_array_capacity) {
+    int new_capacity = MAX2(_thread_array_capacity * 2, 64);
+    JavaThread** new_array = NEW_C_HEAP_ARRAY(JavaThread*, new_capacity, mtThread);
+    if (_thread_array != NULL) {
+      memcpy(new_array, _thread_array, _number_of_threads * sizeof(JavaThread*));
+      FREE_C_HEAP_ARRAY(JavaThread*, _thread_array, mtThread);
+    }
+    _thread_array = new_array;
+    _thread_array_capacity = new_capacity;
+  }
+  _thread_array[_number_of_threads] = p;
+  p->set_threads_array_index(_number_of_threads);
   _number_of_threads++;
   oop threadObj = p->threadObj();
   bool daemon = true;
@@ -4204,6 +4258,14 @@ void Threads::remove(JavaThread* p) {
     } else {
       _thread_list = p->next();
     }
+    // O(1) removal from the flat array: move the last entry into the hole.
+    int index = p->threads_array_index();
+    assert(index >= 0 && index < _number_of_threads && _thread_array[index] == p,
+           "thread array out of sync with thread list");
+    JavaThread* last = _thread_array[_number_of_threads - 1];
+    _thread_array[index] = last;
+    last->set_threads_array_index(index);
+    p->set_threads_array_index(-1);
     _number_of_threads--;
     oop threadObj = p->threadObj();
     bool daemon = true;
@@ -4232,8 +4294,10 @@ void Threads::remove(JavaThread* p) {
 // Threads_lock must be held when this is called (or must be called during a safepoint)
 bool Threads::includes(JavaThread* p) {
   assert(Threads_lock->is_locked(), "sanity check");
-  ALL_JAVA_THREADS(q) {
-    if (q == p ) {
+  // Scan the flat array rather than the linked list; p may already have
+  // exited and the scan must not dereference it.
+  for (int i = 0; i < _number_of_threads; i++) {
+    if (_thread_array[i] == p) {
       return true;
     }
   }
@@ -4270,7 +4334,12 @@ void Threads::possibly_parallel_oops_do(OopClosure* f, CLDClosure* cld_f, CodeBl
           SharedHeap::heap()->workers()->active_workers()
 	  || UseShenandoahGC), "Mismatch");
   int cp = SharedHeap::heap()->strong_roots_parity();
-  ALL_JAVA_THREADS(p) {
+  // Walk the flat thread array rather than the linked list: with many
+  // threads the contiguous scan avoids a dependent load per thread, and
+  // the claim protocol below still hands each thread to exactly one
+  // worker. The array is stable here since all mutators are stopped.
+  for (int i = 0; i < _number_of_threads; i++) {
+    JavaThread* p = _thread_array[i];
     if (p->claim_oops_do(is_par, cp)) {
       p->oops_do(f, cld_f, cf);
     }
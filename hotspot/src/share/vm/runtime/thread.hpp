@@ -87,6 +87,7 @@ typedef ChunkedList<Metadata*, mtInternal> MetadataOnStackBuffer;
 
 DEBUG_ONLY(class ResourceMark;)
 
+class CodeBlobLookupCache;
 class WorkerThread;
 
 // Class hierarchy
@@ -207,6 +208,7 @@ protected:
 
     _has_async_exception    = 0x00000001U, // there is a pending async exception
     _critical_native_unlock = 0x00000002U, // Must call back to unlock JNI critical lock
+    _self_sample            = 0x00000008U, // thread should record its own stack sample
 
     JFR_ONLY(_trace_flag    = 0x00000004U)  // call jfr tracing
   };
@@ -276,6 +278,8 @@ protected:
                                                 // the Java heap
   jlong _allocated_bytes_gclab;                 // Cumulative number of bytes allocated on
                                                 // the Java heap, in GCLABs
+  volatile jlong* _published_allocated_bytes;   // Slot in the ThreadAllocationTable that
+                                                // mirrors _allocated_bytes, or NULL
 
   // Thread-local buffer used by MetadataOnStackMark.
   MetadataOnStackBuffer* _metadata_on_stack_buffer;
@@ -406,6 +410,16 @@ protected:
     clear_suspend_flag(_critical_native_unlock);
   }
 
+  // Cooperative sampling support, see SelfSampler.
+  bool is_self_sample_requested() const { return (_suspend_flags & _self_sample) != 0; }
+
+  void set_self_sample_requested() {
+    set_suspend_flag(_self_sample);
+  }
+  void clear_self_sample_requested() {
+    clear_suspend_flag(_self_sample);
+  }
+
   bool is_oom_during_evac() const;
   void set_oom_during_evac(bool oom);
 
@@ -443,6 +457,9 @@ protected:
   ResourceArea* resource_area() const            { return _resource_area; }
   void set_resource_area(ResourceArea* area)     { _resource_area = area; }
 
+  // Thread-local cache of free arena chunks
+  ChunkPoolCache* chunk_cache()                  { return &_chunk_cache; }
+
   OSThread* osthread() const                     { return _osthread;   }
   void set_osthread(OSThread* thread)            { _osthread = thread; }
 
@@ -459,6 +476,9 @@ protected:
   GrowableArray<Metadata*>* metadata_handles() const          { return _metadata_handles; }
   void set_metadata_handles(GrowableArray<Metadata*>* handles){ _metadata_handles = handles; }
 
+  // Thread local cache of pc -> CodeBlob resolutions for stack walking
+  CodeBlobLookupCache* codeblob_lookup_cache() const { return _codeblob_lookup_cache; }
+
   // Thread-Local Allocation Buffer (TLAB) support
   ThreadLocalAllocBuffer& tlab()                 { return _tlab; }
   void initialize_tlab() {
@@ -490,9 +510,17 @@ protected:
 
   jlong allocated_bytes()               { return _allocated_bytes; }
   void set_allocated_bytes(jlong value) { _allocated_bytes = value; }
-  void incr_allocated_bytes(jlong size) { _allocated_bytes += size; }
+  void incr_allocated_bytes(jlong size) {
+    _allocated_bytes += size;
+    if (_published_allocated_bytes != NULL) {
+      *_published_allocated_bytes = _allocated_bytes;
+    }
+  }
   inline jlong cooked_allocated_bytes();
 
+  volatile jlong* published_allocated_bytes() const     { return _published_allocated_bytes; }
+  void set_published_allocated_bytes(volatile jlong* p) { _published_allocated_bytes = p; }
+
   jlong allocated_bytes_gclab()                { return _allocated_bytes_gclab; }
   void set_allocated_bytes_gclab(jlong value)  { _allocated_bytes_gclab = value; }
   void incr_allocated_bytes_gclab(jlong size)  { _allocated_bytes_gclab += size; }
@@ -588,12 +616,19 @@ protected:
   // Thread local resource area for temporary allocation within the VM
   ResourceArea* _resource_area;
 
+  // Thread local cache of free arena chunks, flushed to the global
+  // chunk pools when the thread is destroyed
+  ChunkPoolCache _chunk_cache;
+
   DEBUG_ONLY(ResourceMark* _current_resource_mark;)
 
   // Thread local handle area for allocation of handles within the VM
   HandleArea* _handle_area;
   GrowableArray<Metadata*>* _metadata_handles;
 
+  // Thread local cache of pc -> CodeBlob resolutions, see CodeCache::find_blob
+  CodeBlobLookupCache* _codeblob_lookup_cache;
+
   // Support for stack overflow handling, get_thread, etc.
   address          _stack_base;
   size_t           _stack_size;
@@ -837,6 +872,7 @@ class JavaThread: public Thread {
   friend class VMStructs;
  private:
   JavaThread*    _next;                          // The next thread in the Threads list
+  int            _threads_array_index;           // This thread's slot in Threads::_thread_array, or -1
   oop            _threadObj;                     // The Java level thread object
 
 #ifdef ASSERT
@@ -1072,6 +1108,10 @@ class JavaThread: public Thread {
   JavaThread* next() const                       { return _next; }
   void set_next(JavaThread* p)                   { _next = p; }
 
+  // Slot in Threads::_thread_array; maintained under the Threads_lock
+  int threads_array_index() const                { return _threads_array_index; }
+  void set_threads_array_index(int index)        { _threads_array_index = index; }
+
   // Thread oop. threadObj() can be NULL for initial JavaThread
   // (or for threads attached via JNI)
   oop threadObj() const                          { return _threadObj; }
@@ -1275,7 +1315,8 @@ class JavaThread: public Thread {
     // we have checked is_external_suspend(), we will recheck its value
     // under SR_lock in java_suspend_self().
     return (_special_runtime_exit_condition != _no_async_condition) ||
-            is_external_suspend() || is_deopt_suspend();
+            is_external_suspend() || is_deopt_suspend() ||
+            is_self_sample_requested();
   }
 
   void set_pending_unsafe_access_error()          { _special_runtime_exit_condition = _async_unsafe_access_error; }
@@ -1434,6 +1475,9 @@ class JavaThread: public Thread {
   static ByteSize should_post_on_exceptions_flag_offset() {
     return byte_offset_of(JavaThread, _should_post_on_exceptions_flag);
   }
+  static ByteSize profile_sample_countdown_offset() {
+    return byte_offset_of(JavaThread, _profile_sample_countdown);
+  }
 
 #if INCLUDE_ALL_GCS
   static ByteSize satb_mark_queue_offset()       { return byte_offset_of(JavaThread, _satb_mark_queue); }
@@ -1670,6 +1714,19 @@ public:
   void*    _popframe_preserved_args;
   int      _popframe_preserved_args_size;
 
+  // Recycled buffer for OSR migration, grown to the largest migration
+  // seen by this thread; avoids a malloc/free pair per OSR entry.
+  intptr_t* _osr_migration_buffer;
+  int       _osr_migration_buffer_words;
+
+ public:
+  intptr_t* osr_migration_buffer() const       { return _osr_migration_buffer; }
+  int osr_migration_buffer_words() const       { return _osr_migration_buffer_words; }
+  void set_osr_migration_buffer(intptr_t* buf, int words) {
+    _osr_migration_buffer = buf;
+    _osr_migration_buffer_words = words;
+  }
+
  public:
   void  popframe_preserve_args(ByteSize size_in_bytes, void* start);
   void* popframe_preserved_args();
@@ -1707,6 +1764,12 @@ public:
   int   should_post_on_exceptions_flag()  { return _should_post_on_exceptions_flag; }
   void  set_should_post_on_exceptions_flag(int val)  { _should_post_on_exceptions_flag = val; }
 
+  // countdown to the next interpreter profile sample when SampleProfileUpdates
+  // is enabled; only touched by generated interpreter code, see
+  // InterpreterMacroAssembler::profile_sample_check
+ private:
+  jint   _profile_sample_countdown;
+
  private:
   ThreadStatistics *_thread_stat;
 
@@ -1973,6 +2036,12 @@ class Threads: AllStatic {
   friend class VMStructs;
  private:
   static JavaThread* _thread_list;
+  // Flat mirror of _thread_list, maintained by add()/remove() under the
+  // Threads_lock. The first _number_of_threads slots are valid. GC root
+  // scanning walks this array instead of chasing _next pointers; removal
+  // is O(1) by moving the last entry into the vacated slot.
+  static JavaThread** _thread_array;
+  static int          _thread_array_capacity;
   static int         _number_of_threads;
   static int         _number_of_non_daemon_threads;
   static int         _return_code;
@@ -96,6 +96,18 @@ void VMOperationQueue::queue_add_back(int prio, VM_Operation *op) {
   insert(_queue[prio]->prev(), op);
 }
 
+void VMOperationQueue::queue_add_ordered(int prio, VM_Operation *op) {
+  // Keep the queue sorted by latency class, FIFO within a class: insert
+  // before the first queued op of a strictly higher (slower) class, so
+  // that short interactive ops do not wait behind long batch work.
+  VM_Operation* cur = _queue[prio]->next();
+  while (cur != _queue[prio] && cur->latency_class() <= op->latency_class()) {
+    cur = cur->next();
+  }
+  _queue_length[prio]++;
+  insert(cur->prev(), op);
+}
+
 
 void VMOperationQueue::unlink(VM_Operation* q) {
   assert(q->next()->prev() == q && q->prev()->next() == q, "sanity check");
@@ -166,14 +178,17 @@ bool VMOperationQueue::add(VM_Operation *op) {
                    op->evaluation_mode());
 #endif /* USDT2 */
 
+  op->set_enqueue_ticks(os::elapsed_counter());
+
   // Encapsulates VM queue policy. Currently, that
-  // only involves putting them on the right list
+  // only involves putting them on the right list,
+  // ordered by latency class within the list
   if (op->evaluate_at_safepoint()) {
-    queue_add_back(SafepointPriority, op);
+    queue_add_ordered(SafepointPriority, op);
     return true;
   }
 
-  queue_add_back(MediumPriority, op);
+  queue_add_ordered(MediumPriority, op);
   return true;
 }
 
@@ -217,6 +232,10 @@ VMThread*         VMThread::_vm_thread          = NULL;
 VM_Operation*     VMThread::_cur_vm_operation   = NULL;
 VMOperationQueue* VMThread::_vm_queue           = NULL;
 PerfCounter*      VMThread::_perf_accumulated_vm_operation_time = NULL;
+PerfCounter*      VMThread::_perf_accumulated_vm_operation_queue_time = NULL;
+PerfCounter*      VMThread::_perf_vm_operations_queued = NULL;
+PerfVariable*     VMThread::_perf_max_vm_operation_queue_time = NULL;
+jlong             VMThread::_max_vm_operation_queue_time = 0;
 
 
 void VMThread::create() {
@@ -235,6 +254,15 @@ void VMThread::create() {
     _perf_accumulated_vm_operation_time =
                  PerfDataManager::create_counter(SUN_THREADS, "vmOperationTime",
                                                  PerfData::U_Ticks, CHECK);
+    _perf_accumulated_vm_operation_queue_time =
+                 PerfDataManager::create_counter(SUN_THREADS, "vmOperationQueueTime",
+                                                 PerfData::U_Ticks, CHECK);
+    _perf_vm_operations_queued =
+                 PerfDataManager::create_counter(SUN_THREADS, "vmOperationsQueued",
+                                                 PerfData::U_Events, CHECK);
+    _perf_max_vm_operation_queue_time =
+                 PerfDataManager::create_long_variable(SUN_THREADS, "vmOperationMaxQueueTime",
+                                                 PerfData::U_Ticks, CHECK);
   }
 }
 
@@ -378,9 +406,31 @@ static void post_vm_operation_event(EventExecuteVMOperation* event, VM_Operation
   event->commit();
 }
 
+void VMThread::update_queue_delay(VM_Operation* op) {
+  jlong queued = op->enqueue_ticks();
+  if (queued == 0) {
+    // Evaluated directly, never sat in the queue
+    return;
+  }
+  jlong delay = os::elapsed_counter() - queued;
+  if (delay <= 0) {
+    return;
+  }
+  _perf_accumulated_vm_operation_queue_time->inc(delay);
+  _perf_vm_operations_queued->inc();
+  if (delay > _max_vm_operation_queue_time) {
+    _max_vm_operation_queue_time = delay;
+    _perf_max_vm_operation_queue_time->set_value(delay);
+  }
+}
+
 void VMThread::evaluate_operation(VM_Operation* op) {
   ResourceMark rm;
 
+  if (UsePerfData) {
+    update_queue_delay(op);
+  }
+
   {
     PerfTraceTime vm_op_timer(perf_accumulated_vm_operation_time());
 #ifndef USDT2
@@ -447,6 +497,17 @@ void VMThread::loop() {
           tty->print_cr("%s stall: %Ld",  _cur_vm_operation->name(), stall);
       }
 
+      // If the op was immediately available and requires a safepoint,
+      // drain the queued safepoint ops while we still hold the queue
+      // lock so that the whole train is executed within one safepoint.
+      // Previously only the timed-wait path below did this, leaving the
+      // common direct-dequeue path to pick up followers with an extra
+      // lock round-trip in the middle of the safepoint.
+      if (_cur_vm_operation != NULL &&
+          _cur_vm_operation->evaluate_at_safepoint()) {
+        safepoint_ops = _vm_queue->drain_at_safepoint_priority();
+      }
+
       while (!should_terminate() && _cur_vm_operation == NULL) {
         // wait with a timeout to guarantee safepoints at regular intervals
         bool timedout =
@@ -523,9 +584,7 @@ void VMThread::loop() {
               _vm_queue->set_drain_list(next);
               evaluate_operation(_cur_vm_operation);
               _cur_vm_operation = next;
-              if (PrintSafepointStatistics) {
-                SafepointSynchronize::inc_vmop_coalesced_count();
-              }
+              SafepointSynchronize::inc_vmop_coalesced_count();
             } while (_cur_vm_operation != NULL);
           }
           // There is a chance that a thread enqueued a safepoint op
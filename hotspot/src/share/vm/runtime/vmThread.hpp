@@ -59,6 +59,7 @@ class VMOperationQueue : public CHeapObj<mtInternal> {
   bool queue_empty                (int prio);
   void queue_add_front            (int prio, VM_Operation *op);
   void queue_add_back             (int prio, VM_Operation *op);
+  void queue_add_ordered          (int prio, VM_Operation *op);
   VM_Operation* queue_remove_front(int prio);
   void queue_oops_do(int queue, OopClosure* f);
   void drain_list_oops_do(OopClosure* f);
@@ -99,8 +100,16 @@ class VMThread: public NamedThread {
   static bool _gclog_reentry;
   static Monitor * _terminate_lock;
   static PerfCounter* _perf_accumulated_vm_operation_time;
+  // Queue-delay accounting: total time ops spent queued, number of queued
+  // ops evaluated, and the largest single delay seen (with a C++ shadow of
+  // the max so we never read back from perf memory).
+  static PerfCounter*  _perf_accumulated_vm_operation_queue_time;
+  static PerfCounter*  _perf_vm_operations_queued;
+  static PerfVariable* _perf_max_vm_operation_queue_time;
+  static jlong         _max_vm_operation_queue_time;
 
   void evaluate_operation(VM_Operation* op);
+  void update_queue_delay(VM_Operation* op);
  public:
   // Constructor
   VMThread();
@@ -179,6 +179,10 @@ void VM_Verify::doit() {
   Universe::verify(_silent);
 }
 
+void VM_StringTableVerify::doit() {
+  _fail_cnt = StringTable::verify_and_compare_entries();
+}
+
 bool VM_PrintThreads::doit_prologue() {
   assert(Thread::current()->is_Java_thread(), "just checking");
 
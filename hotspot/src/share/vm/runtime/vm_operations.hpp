@@ -52,6 +52,7 @@
   template(ZombieAll)                             \
   template(UnlinkSymbols)                         \
   template(Verify)                                \
+  template(StringTableVerify)                     \
   template(PrintJNI)                              \
   template(HeapDumper)                            \
   template(DeoptimizeTheWorld)                    \
@@ -120,10 +121,21 @@ class VM_Operation: public CHeapObj<mtInternal> {
     VMOp_Terminating
   };
 
+  // Scheduling hint for the VMOperationQueue: within a queue priority,
+  // operations of a lower latency class are dequeued first, FIFO within a
+  // class. This keeps small operator-facing ops from waiting behind long
+  // batch work such as GC.
+  enum LatencyClass {
+    _latency_immediate   = 0,  // must not wait behind anything, e.g. VM exit
+    _latency_interactive = 1,  // default: short diagnostic and service ops
+    _latency_batch       = 2   // long operations: GC, heap walks
+  };
+
  private:
   Thread*         _calling_thread;
   ThreadPriority  _priority;
   long            _timestamp;
+  jlong           _enqueue_ticks;
   VM_Operation*   _next;
   VM_Operation*   _prev;
 
@@ -131,7 +143,7 @@ class VM_Operation: public CHeapObj<mtInternal> {
   static const char* _names[];
 
  public:
-  VM_Operation()  { _calling_thread = NULL; _next = NULL; _prev = NULL; }
+  VM_Operation()  { _calling_thread = NULL; _enqueue_ticks = 0; _next = NULL; _prev = NULL; }
   virtual ~VM_Operation() {}
 
   // VM operation support (used by VM thread)
@@ -142,6 +154,11 @@ class VM_Operation: public CHeapObj<mtInternal> {
   long timestamp() const              { return _timestamp; }
   void set_timestamp(long timestamp)  { _timestamp = timestamp; }
 
+  // Tick stamp taken when the op is enqueued; zero for ops that are
+  // evaluated directly without going through the queue.
+  jlong enqueue_ticks() const             { return _enqueue_ticks; }
+  void set_enqueue_ticks(jlong ticks)     { _enqueue_ticks = ticks; }
+
   // Called by VM thread - does in turn invoke doit(). Do not override this
   void evaluate();
 
@@ -168,6 +185,7 @@ class VM_Operation: public CHeapObj<mtInternal> {
   // Configuration. Override these appropriatly in subclasses.
   virtual VMOp_Type type() const = 0;
   virtual Mode evaluation_mode() const            { return _safepoint; }
+  virtual LatencyClass latency_class() const      { return _latency_interactive; }
   virtual bool allow_nested_vm_operations() const { return false; }
   virtual bool is_cheap_allocated() const         { return false; }
   virtual void oops_do(OopClosure* f)              { /* do nothing */ };
@@ -309,6 +327,18 @@ class VM_Verify: public VM_Operation {
   void doit();
 };
 
+// Exhaustive StringTable verification must run at a safepoint: interns
+// are striped across several locks, so no single lock excludes them all.
+class VM_StringTableVerify: public VM_Operation {
+ private:
+  int _fail_cnt;
+ public:
+  VM_StringTableVerify() : _fail_cnt(0) {}
+  VMOp_Type type() const { return VMOp_StringTableVerify; }
+  void doit();
+  int fail_cnt() const { return _fail_cnt; }
+};
+
 
 class VM_PrintThreads: public VM_Operation {
  private:
@@ -405,6 +435,7 @@ class VM_Exit: public VM_Operation {
     }
   }
   VMOp_Type type() const { return VMOp_Exit; }
+  LatencyClass latency_class() const { return _latency_immediate; }
   void doit();
 };
 
@@ -24,16 +24,38 @@
 
 #include "precompiled.hpp"
 #include "classfile/classLoaderStats.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "code/codeCache.hpp"
+#include "code/nmethod.hpp"
+#include "compiler/compileBroker.hpp"
 #include "gc_implementation/shared/vmGCOperations.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
+#include "prims/unsafeMemoryPool.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/selfSampler.hpp"
+#include "runtime/sweeper.hpp"
+#include "runtime/synchronizer.hpp"
 #include "services/diagnosticArgument.hpp"
 #include "services/diagnosticCommand.hpp"
 #include "services/diagnosticFramework.hpp"
 #include "services/heapDumper.hpp"
 #include "services/management.hpp"
+#include "services/vmTelemetry.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
 #include "oops/objArrayOop.hpp"
+#if INCLUDE_ALL_GCS
+#include "gc_implementation/shenandoah/shenandoahAllocTracker.hpp"
+#include "gc_implementation/shenandoah/shenandoahControlThread.hpp"
+#include "gc_implementation/shenandoah/shenandoahEvacTracker.hpp"
+#include "gc_implementation/shenandoah/shenandoahHeap.hpp"
+#include "gc_implementation/shenandoah/shenandoahHeapRegionCounters.hpp"
+#include "gc_implementation/shenandoah/shenandoahMonitoringSupport.hpp"
+#include "gc_implementation/shenandoah/heuristics/shenandoahHeuristics.hpp"
+#endif // INCLUDE_ALL_GCS
 
 PRAGMA_FORMAT_MUTE_WARNINGS_FOR_GCC
 
@@ -50,9 +72,23 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<PrintSystemPropertiesDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<PrintVMFlagsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMDynamicLibrariesDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<UnsafePoolDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SelfSampleDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMUptimeDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SafepointStatisticsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<MonitorSpinStatisticsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMTelemetryDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SystemGCDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RunFinalizationDCmd>(full_export, true, false));
+#if INCLUDE_ALL_GCS
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ShenandoahScheduleGCDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ShenandoahAllocSitesDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ShenandoahClassHistogramDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ShenandoahEvacStatsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ShenandoahErgonomicsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ShenandoahUncommitDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ShenandoahRegionHistoryDCmd>(full_export, true, false));
+#endif // INCLUDE_ALL_GCS
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapInfoDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<FinalizerInfoDCmd>(full_export, true, false));
 #if INCLUDE_SERVICES // Heap dumping/inspection supported
@@ -61,7 +97,11 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassStatsDCmd>(full_export, true, false));
 #endif // INCLUDE_SERVICES
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ThreadDumpDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ConcurrentThreadDumpDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<MutexContentionDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RotateGCLogDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerSaveStateDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerReplayStateDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassLoaderStatsDCmd>(full_export, true, false));
 
   // Enhanced JMX Agent Support
@@ -262,6 +302,49 @@ int VMUptimeDCmd::num_arguments() {
   }
 }
 
+void SafepointStatisticsDCmd::execute(DCmdSource source, TRAPS) {
+  // The aggregates are updated by the VM thread without synchronization;
+  // a concurrent dump may observe a safepoint in flight, which is
+  // acceptable for diagnostic output.
+  SafepointSynchronize::print_vmop_histogram_on(output());
+}
+
+void MonitorSpinStatisticsDCmd::execute(DCmdSource source, TRAPS) {
+  // Runs in VM state, so monitors cannot be deflated underneath the walk;
+  // the spin counters themselves are racy, which is fine for diagnostics.
+  ObjectSynchronizer::print_spin_statistics_on(output());
+}
+
+VMTelemetryDCmd::VMTelemetryDCmd(outputStream* output, bool heap) :
+                                 DCmdWithParser(output, heap),
+  _filename("filename", "Name of the telemetry dump file", "STRING", true) {
+  _dcmdparser.add_dcmd_argument(&_filename);
+}
+
+void VMTelemetryDCmd::execute(DCmdSource source, TRAPS) {
+  if (!VMTelemetry::is_active()) {
+    output()->print_cr("VM telemetry is not enabled; run with -XX:+EnableVMTelemetry");
+    return;
+  }
+  int records = VMTelemetry::export_binary(_filename.value());
+  if (records >= 0) {
+    output()->print_cr("Telemetry dump written: %d samples", records);
+  } else {
+    output()->print_cr("Unable to open dump file: %s", _filename.value());
+  }
+}
+
+int VMTelemetryDCmd::num_arguments() {
+  ResourceMark rm;
+  VMTelemetryDCmd* dcmd = new VMTelemetryDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
 void SystemGCDCmd::execute(DCmdSource source, TRAPS) {
   if (!DisableExplicitGC) {
     Universe::heap()->collect(GCCause::_java_lang_system_gc);
@@ -280,6 +363,132 @@ void RunFinalizationDCmd::execute(DCmdSource source, TRAPS) {
                          vmSymbols::void_method_signature(), CHECK);
 }
 
+#if INCLUDE_ALL_GCS
+ShenandoahScheduleGCDCmd::ShenandoahScheduleGCDCmd(outputStream* output, bool heap) :
+                          DCmdWithParser(output, heap),
+  _start("-start", "Start a concurrent cycle at the next control thread poll",
+         "BOOLEAN", false, "false"),
+  _defer_ms("-defer", "Mute discretionary GC triggers for this many milliseconds",
+         "JLONG", false, "0") {
+  _dcmdparser.add_dcmd_option(&_start);
+  _dcmdparser.add_dcmd_option(&_defer_ms);
+}
+
+int ShenandoahScheduleGCDCmd::num_arguments() {
+  ResourceMark rm;
+  ShenandoahScheduleGCDCmd* dcmd = new ShenandoahScheduleGCDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
+void ShenandoahScheduleGCDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseShenandoahGC) {
+    output()->print_cr("GC.shenandoah_schedule command requires -XX:+UseShenandoahGC");
+    return;
+  }
+
+  ShenandoahHeuristics* heuristics = ShenandoahHeap::heap()->heuristics();
+  if (_defer_ms.value() > 0) {
+    heuristics->record_schedule_defer_hint(_defer_ms.value());
+    output()->print_cr("Discretionary GC triggers muted for " JLONG_FORMAT " ms", _defer_ms.value());
+  }
+  if (_start.value()) {
+    heuristics->record_schedule_start_hint();
+    output()->print_cr("Concurrent GC cycle will start at the next opportunity");
+  }
+}
+
+void ShenandoahAllocSitesDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseShenandoahGC) {
+    output()->print_cr("GC.shenandoah_alloc_sites command requires -XX:+UseShenandoahGC");
+    return;
+  }
+
+  ShenandoahAllocTracker* tracker = ShenandoahHeap::heap()->alloc_tracker();
+  if (tracker == NULL) {
+    output()->print_cr("Allocation site sampling is off, run with -XX:+ShenandoahAllocSiteSampling");
+    return;
+  }
+  tracker->print_on(output());
+}
+
+void ShenandoahClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseShenandoahGC) {
+    output()->print_cr("GC.shenandoah_class_histogram command requires -XX:+UseShenandoahGC");
+    return;
+  }
+
+  ShenandoahHeap::heap()->control_thread()->run_class_histogram(output());
+}
+
+void ShenandoahEvacStatsDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseShenandoahGC) {
+    output()->print_cr("GC.shenandoah_evac_stats command requires -XX:+UseShenandoahGC");
+    return;
+  }
+
+  ShenandoahEvacTracker* tracker = ShenandoahHeap::heap()->evac_tracker();
+  if (tracker == NULL) {
+    output()->print_cr("Evacuation tracking is off, run with -XX:+ShenandoahEvacTracking");
+    return;
+  }
+  tracker->print_on(output());
+}
+
+void ShenandoahErgonomicsDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseShenandoahGC) {
+    output()->print_cr("GC.shenandoah_ergonomics command requires -XX:+UseShenandoahGC");
+    return;
+  }
+
+  ShenandoahHeap::heap()->monitoring_support()->print_ergonomics_on(output());
+}
+
+void ShenandoahUncommitDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseShenandoahGC) {
+    output()->print_cr("GC.shenandoah_uncommit command requires -XX:+UseShenandoahGC");
+    return;
+  }
+  if (!ShenandoahUncommit) {
+    output()->print_cr("Uncommit is disabled, run with -XX:+ShenandoahUncommit");
+    return;
+  }
+
+  ShenandoahHeap::heap()->control_thread()->request_uncommit();
+  output()->print_cr("Uncommit of empty heap regions requested");
+}
+
+ShenandoahRegionHistoryDCmd::ShenandoahRegionHistoryDCmd(outputStream* output, bool heap) :
+                             DCmdWithParser(output, heap),
+  _filename("filename", "Name of the dump file", "STRING", true) {
+  _dcmdparser.add_dcmd_argument(&_filename);
+}
+
+int ShenandoahRegionHistoryDCmd::num_arguments() {
+  ResourceMark rm;
+  ShenandoahRegionHistoryDCmd* dcmd = new ShenandoahRegionHistoryDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
+void ShenandoahRegionHistoryDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseShenandoahGC) {
+    output()->print_cr("GC.shenandoah_region_history command requires -XX:+UseShenandoahGC");
+    return;
+  }
+
+  ShenandoahHeapRegionCounters::write_region_history(_filename.value(), output());
+}
+#endif // INCLUDE_ALL_GCS
+
 void HeapInfoDCmd::execute(DCmdSource source, TRAPS) {
   Universe::heap()->print_on(output());
 }
@@ -488,6 +697,50 @@ int ThreadDumpDCmd::num_arguments() {
   }
 }
 
+ConcurrentThreadDumpDCmd::ConcurrentThreadDumpDCmd(outputStream* output, bool heap) :
+                                                   DCmdWithParser(output, heap),
+  _timeout("-timeout", "Milliseconds to wait for threads to reach a poll",
+           "JLONG", false, "200") {
+  _dcmdparser.add_dcmd_option(&_timeout);
+}
+
+void ConcurrentThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
+  SelfSampler::collect_dump(output(), MAX2((jlong)1, _timeout.value()));
+}
+
+int ConcurrentThreadDumpDCmd::num_arguments() {
+  ResourceMark rm;
+  ConcurrentThreadDumpDCmd* dcmd = new ConcurrentThreadDumpDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
+MutexContentionDCmd::MutexContentionDCmd(outputStream* output, bool heap) :
+                                         DCmdWithParser(output, heap),
+  _reset("-reset", "Reset the contention counters after printing",
+         "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_reset);
+}
+
+void MutexContentionDCmd::execute(DCmdSource source, TRAPS) {
+  print_mutex_contention(output(), _reset.value());
+}
+
+int MutexContentionDCmd::num_arguments() {
+  ResourceMark rm;
+  MutexContentionDCmd* dcmd = new MutexContentionDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
 // Enhanced JMX Agent support
 
 JMXStartRemoteDCmd::JMXStartRemoteDCmd(outputStream *output, bool heap_allocated) :
@@ -736,3 +989,209 @@ void RotateGCLogDCmd::execute(DCmdSource source, TRAPS) {
     output()->print_cr("Target VM does not support GC log file rotation.");
   }
 }
+
+void UnsafePoolDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseUnsafeMemoryPool) {
+    output()->print_cr("Unsafe memory pool is off, run with -XX:+UseUnsafeMemoryPool");
+    return;
+  }
+  UnsafeMemoryPool::print_on(output());
+}
+
+void SelfSampleDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseCooperativeSampling) {
+    output()->print_cr("Cooperative sampling is off, run with -XX:+UseCooperativeSampling");
+    return;
+  }
+  // Threads record themselves at their next poll or transition, so the
+  // samples requested here show up in a later invocation.
+  SelfSampler::request_all();
+  SelfSampler::print_on(output());
+}
+
+CompilerSaveStateDCmd::CompilerSaveStateDCmd(outputStream* output, bool heap) :
+                       DCmdWithParser(output, heap),
+  _filename("filename", "Name of the compiler state file", "STRING", true) {
+  _dcmdparser.add_dcmd_argument(&_filename);
+}
+
+// One manifest entry per replayable nmethod, sorted by warmth before the
+// manifest is written. Warmth is the sweeper's hotness counter: it is reset
+// when the method is seen on a stack and decays on every sweep, so a higher
+// value means more recent activity.
+struct CompilerStateEntry {
+  nmethod* _nm;
+  int      _warmth;
+};
+
+static GrowableArray<CompilerStateEntry>* _compiler_state_entries = NULL;
+
+static void collect_compiled_method(nmethod* nm) {
+  // Only regular, in-use compilations are worth replaying: OSR code is
+  // reached through the interpreter anyway, and not-entrant code is about
+  // to be replaced.
+  if (!nm->is_in_use() || nm->is_osr_method() || nm->is_native_method()) {
+    return;
+  }
+  if (nm->method() == NULL) {
+    return;
+  }
+  CompilerStateEntry entry;
+  entry._nm = nm;
+  entry._warmth = nm->hotness_counter();
+  _compiler_state_entries->append(entry);
+}
+
+static int warmth_compare(CompilerStateEntry* a, CompilerStateEntry* b) {
+  if (a->_warmth != b->_warmth) {
+    return b->_warmth - a->_warmth; // warmest first
+  }
+  // Tie-break on code address to keep the manifest deterministic.
+  return a->_nm < b->_nm ? -1 : (a->_nm == b->_nm ? 0 : 1);
+}
+
+void CompilerSaveStateDCmd::execute(DCmdSource source, TRAPS) {
+  fileStream file(_filename.value());
+  if (!file.is_open()) {
+    output()->print_cr("Unable to open %s for writing", _filename.value());
+    return;
+  }
+  ResourceMark rm;
+  GrowableArray<CompilerStateEntry>* entries = new GrowableArray<CompilerStateEntry>(1024);
+  int saved = 0;
+  {
+    MutexLockerEx mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    _compiler_state_entries = entries;
+    CodeCache::nmethods_do(collect_compiled_method);
+    _compiler_state_entries = NULL;
+
+    // Warmest methods first: replay requests compilations in manifest
+    // order, and the mostly-linear CodeHeap allocator then places the hot
+    // path adjacently on a fresh JVM, which is kinder to the I-TLB.
+    entries->sort(warmth_compare);
+
+    for (int i = 0; i < entries->length(); i++) {
+      nmethod* nm = entries->at(i)._nm;
+      Method* m = nm->method();
+      file.print_cr("%s %s %s %d %d",
+                    m->method_holder()->name()->as_C_string(),
+                    m->name()->as_C_string(),
+                    m->signature()->as_C_string(),
+                    nm->comp_level(),
+                    entries->at(i)._warmth);
+      saved++;
+    }
+  }
+  output()->print_cr("Saved %d compiled methods to %s, warmest first (hotness reset value %d)",
+                     saved, _filename.value(), NMethodSweeper::hotness_counter_reset_val());
+}
+
+int CompilerSaveStateDCmd::num_arguments() {
+  ResourceMark rm;
+  CompilerSaveStateDCmd* dcmd = new CompilerSaveStateDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
+
+CompilerReplayStateDCmd::CompilerReplayStateDCmd(outputStream* output, bool heap) :
+                         DCmdWithParser(output, heap),
+  _filename("filename", "Name of the compiler state file", "STRING", true) {
+  _dcmdparser.add_dcmd_argument(&_filename);
+}
+
+void CompilerReplayStateDCmd::execute(DCmdSource source, TRAPS) {
+  FILE* file = fopen(_filename.value(), "rt");
+  if (file == NULL) {
+    output()->print_cr("Unable to open %s for reading", _filename.value());
+    return;
+  }
+
+  int requested = 0;
+  int skipped   = 0;
+  ResourceMark rm(THREAD);
+  char* line        = NEW_RESOURCE_ARRAY(char, 16384);
+  char* klass_name  = NEW_RESOURCE_ARRAY(char, 4096);
+  char* method_name = NEW_RESOURCE_ARRAY(char, 4096);
+  char* signature   = NEW_RESOURCE_ARRAY(char, 4096);
+  int comp_level;
+  int warmth;
+
+  while (fgets(line, 16384, file) != NULL) {
+    // The trailing warmth column is informational: it ordered the manifest
+    // at save time, and the compile queues preserve that order here.
+    int fields = sscanf(line, "%4095s %4095s %4095s %d %d",
+                        klass_name, method_name, signature, &comp_level, &warmth);
+    if (fields < 4) {
+      continue;
+    }
+    HandleMark hm(THREAD);
+
+    // Levels must make sense for this compiler configuration.
+    if (!TieredCompilation) {
+      comp_level = CompLevel_highest_tier;
+    }
+    if (comp_level < CompLevel_simple || comp_level > CompLevel_highest_tier) {
+      skipped++;
+      continue;
+    }
+
+    TempNewSymbol klass_sym = SymbolTable::new_symbol(klass_name, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      skipped++;
+      continue;
+    }
+    Klass* k = SystemDictionary::resolve_or_null(klass_sym,
+                 Handle(THREAD, SystemDictionary::java_system_loader()),
+                 Handle(), THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      k = NULL;
+    }
+    // Replay must not run class initializers, so only methods of classes
+    // the application already initialized are compiled; issue the command
+    // after application startup.
+    if (k == NULL || !k->oop_is_instance() ||
+        !InstanceKlass::cast(k)->is_initialized()) {
+      skipped++;
+      continue;
+    }
+
+    TempNewSymbol name_sym = SymbolTable::probe(method_name, (int) strlen(method_name));
+    TempNewSymbol sig_sym  = SymbolTable::probe(signature, (int) strlen(signature));
+    Method* m = (name_sym == NULL || sig_sym == NULL) ? NULL :
+      InstanceKlass::cast(k)->find_method(name_sym, sig_sym);
+    if (m == NULL || m->is_abstract() || m->is_native()) {
+      skipped++;
+      continue;
+    }
+
+    methodHandle mh(THREAD, m);
+    CompileBroker::compile_method(mh, InvocationEntryBci, comp_level,
+                                  methodHandle(), 0, "replayed by jcmd", THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      CLEAR_PENDING_EXCEPTION;
+      skipped++;
+      continue;
+    }
+    requested++;
+  }
+  fclose(file);
+
+  output()->print_cr("Requested %d compilations, skipped %d", requested, skipped);
+}
+
+int CompilerReplayStateDCmd::num_arguments() {
+  ResourceMark rm;
+  CompilerReplayStateDCmd* dcmd = new CompilerReplayStateDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
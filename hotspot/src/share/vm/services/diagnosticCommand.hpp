@@ -155,6 +155,48 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+// Occupancy of the -XX:+UseUnsafeMemoryPool native buffer pool, per size
+// class.
+class UnsafePoolDCmd : public DCmd {
+public:
+  UnsafePoolDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.unsafe_pool"; }
+  static const char* description() {
+    return "Print occupancy of the Unsafe native memory pool.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+// Requests a cooperative stack sample from every Java thread and prints
+// the samples collected so far; see -XX:+UseCooperativeSampling.
+class SelfSampleDCmd : public DCmd {
+public:
+  SelfSampleDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.self_sample"; }
+  static const char* description() {
+    return "Request cooperative stack samples and print the sample buffer.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class VMUptimeDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _date;
@@ -171,6 +213,53 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class SafepointStatisticsDCmd : public DCmd {
+public:
+  SafepointStatisticsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+    static const char* name() { return "VM.safepoint_statistics"; }
+    static const char* description() {
+      return "Print per-VM operation safepoint cost histograms.";
+    }
+    static const char* impact() {
+      return "Low";
+    }
+    static int num_arguments() { return 0; }
+    virtual void execute(DCmdSource source, TRAPS);
+};
+
+class MonitorSpinStatisticsDCmd : public DCmd {
+public:
+  MonitorSpinStatisticsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+    static const char* name() { return "VM.monitor_spin_statistics"; }
+    static const char* description() {
+      return "Print adaptive spin statistics for inflated monitors, by lock class.";
+    }
+    static const char* impact() {
+      return "Low";
+    }
+    static int num_arguments() { return 0; }
+    virtual void execute(DCmdSource source, TRAPS);
+};
+
+class VMTelemetryDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<char*> _filename;
+public:
+  VMTelemetryDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "VM.telemetry";
+  }
+  static const char* description() {
+    return "Dump the VM telemetry ring buffer (enabled with "
+           "-XX:+EnableVMTelemetry) to a binary file.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class SystemGCDCmd : public DCmd {
 public:
   SystemGCDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -199,6 +288,126 @@ public:
     virtual void execute(DCmdSource source, TRAPS);
 };
 
+#if INCLUDE_ALL_GCS
+// Feed cycle scheduling hints into the Shenandoah heuristics, so that
+// applications with known idle windows can align concurrent cycles with
+// their load instead of fighting the adaptive triggers.
+class ShenandoahScheduleGCDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<bool>  _start;
+  DCmdArgument<jlong> _defer_ms;
+public:
+  ShenandoahScheduleGCDCmd(outputStream* output, bool heap);
+  static const char* name() { return "GC.shenandoah_schedule"; }
+  static const char* description() {
+    return "Feed cycle scheduling hints to the Shenandoah heuristics.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class ShenandoahAllocSitesDCmd : public DCmd {
+public:
+  ShenandoahAllocSitesDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "GC.shenandoah_alloc_sites"; }
+  static const char* description() {
+    return "Dump sampled allocation sites and their per-region attribution.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class ShenandoahClassHistogramDCmd : public DCmd {
+public:
+  ShenandoahClassHistogramDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "GC.shenandoah_class_histogram"; }
+  static const char* description() {
+    return "Print a class histogram from the most recent complete marking "
+           "bitmap, without stopping the application. Counts live objects as "
+           "of the last completed GC cycle; objects allocated since are not "
+           "included.";
+  }
+  static const char* impact() {
+    return "Medium: concurrent heap walk on the GC control thread.";
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class ShenandoahEvacStatsDCmd : public DCmd {
+public:
+  ShenandoahEvacStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "GC.shenandoah_evac_stats"; }
+  static const char* description() {
+    return "Dump per-region and per-worker evacuation throughput statistics.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+// Exposes the heuristics trigger model (allocation rate, headroom, predicted
+// time to free space exhaustion) in a machine-readable key-value form, so
+// external autoscalers can act on the same signals the collector does.
+class ShenandoahErgonomicsDCmd : public DCmd {
+public:
+  ShenandoahErgonomicsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "GC.shenandoah_ergonomics"; }
+  static const char* description() {
+    return "Print the current state of the Shenandoah heuristics model.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+// Lets external orchestrators reclaim memory from idle JVMs on demand:
+// uncommits empty heap regions right away instead of waiting out
+// ShenandoahUncommitDelay.
+class ShenandoahUncommitDCmd : public DCmd {
+public:
+  ShenandoahUncommitDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "GC.shenandoah_uncommit"; }
+  static const char* description() {
+    return "Uncommit empty heap regions immediately, ignoring the uncommit delay.";
+  }
+  static const char* impact() {
+    return "Medium: Subsequent allocations pay the commit cost again.";
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+// Dumps the cumulative per-region history (collection set selections, bytes
+// evacuated out, age since last reset) in a compact binary form, feeding the
+// offline fragmentation dashboards used for heap sizing.
+class ShenandoahRegionHistoryDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<char*> _filename;
+public:
+  ShenandoahRegionHistoryDCmd(outputStream* output, bool heap);
+  static const char* name() { return "GC.shenandoah_region_history"; }
+  static const char* description() {
+    return "Write a compact binary dump of per-region cumulative statistics.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+#endif // INCLUDE_ALL_GCS
+
 class HeapInfoDCmd : public DCmd {
 public:
   HeapInfoDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -334,6 +543,50 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class ConcurrentThreadDumpDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _timeout;
+public:
+  ConcurrentThreadDumpDCmd(outputStream* output, bool heap);
+  static const char* name() { return "Thread.print_concurrent"; }
+  static const char* description() {
+    return "Print stacks captured by each thread at its next safepoint poll, "
+           "without stopping the world.";
+  }
+  static const char* impact() {
+    return "Low: No safepoint; threads sample themselves at their next poll.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class MutexContentionDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<bool> _reset;
+public:
+  MutexContentionDCmd(outputStream* output, bool heap);
+  static const char* name() { return "VM.mutex_contention"; }
+  static const char* description() {
+    return "Print contention statistics for VM internal mutexes "
+           "(requires -XX:+ProfileMutexContention).";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 // Enhanced JMX Agent support
 
 class JMXStartRemoteDCmd : public DCmdWithParser {
@@ -441,4 +694,57 @@ public:
   }
 };
 
+// Dump the currently compiled method set with compilation levels, so a
+// fresh JVM can be warmed up deterministically with Compiler.replay_state.
+// The manifest is ordered by the sweeper's hotness counters, warmest
+// first: replaying in that order lets the CodeHeap place the hot path
+// adjacently on a fresh JVM.
+class CompilerSaveStateDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<char*> _filename;
+public:
+  CompilerSaveStateDCmd(outputStream* output, bool heap);
+  static const char* name() { return "Compiler.save_state"; }
+  static const char* description() {
+    return "Save the set of compiled methods and their compilation levels "
+           "to a file, for replay with Compiler.replay_state.";
+  }
+  static const char* impact() {
+    return "Medium: Holds the code cache lock while walking it.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "control", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+// Eagerly request the compilations recorded by Compiler.save_state.
+// Methods whose holder is not loaded and initialized yet are skipped:
+// replay must not run class initializers, so it is meant to be issued
+// once the application has started, before it takes hot traffic.
+class CompilerReplayStateDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<char*> _filename;
+public:
+  CompilerReplayStateDCmd(outputStream* output, bool heap);
+  static const char* name() { return "Compiler.replay_state"; }
+  static const char* description() {
+    return "Request compilation of the methods recorded by Compiler.save_state.";
+  }
+  static const char* impact() {
+    return "High: Enqueues many compilations; compiler threads stay busy "
+           "until the backlog drains.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "control", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 #endif // SHARE_VM_SERVICES_DIAGNOSTICCOMMAND_HPP
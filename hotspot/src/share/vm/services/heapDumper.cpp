@@ -33,7 +33,9 @@
 #include "oops/objArrayKlass.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/reflectionUtils.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/vframe.hpp"
 #include "runtime/vmThread.hpp"
 #include "runtime/vm_operations.hpp"
@@ -366,6 +368,137 @@ enum {
   INITIAL_CLASS_COUNT = 200
 };
 
+// Writes handed-off I/O buffers to the dump file in the background, so that
+// the thread walking the heap can keep filling one buffer while the previous
+// one is on its way to disk. The thread is created lazily by the first dump
+// (from inside the dump VM operation, so creation is serialized) and parks
+// between dumps.
+
+class DumpWriterFlusher : public NamedThread {
+ private:
+  static DumpWriterFlusher* _instance;
+
+  Monitor* _lock;
+  int      _fd;        // file descriptor of the posted buffer
+  char*    _buf;       // posted buffer, NULL if none
+  size_t   _len;
+  bool     _writing;   // posted buffer was taken and is being written
+  char*    _error;     // first write error, surfaced at the next hand-off or drain
+
+  DumpWriterFlusher() :
+    _lock(new Monitor(Mutex::leaf, "DumpWriterFlusher monitor", true /* allow_vm_block */)),
+    _fd(-1), _buf(NULL), _len(0), _writing(false), _error(NULL) {
+    set_name("Heap Dump Flusher Thread");
+  }
+
+ public:
+  // returns the singleton flusher, starting it on first use, or NULL if
+  // the thread could not be created
+  static DumpWriterFlusher* instance();
+
+  virtual void run();
+
+  // posts a full buffer; blocks while a previously posted buffer is still
+  // in flight. If an earlier write failed, returns the error message
+  // without posting; the caller owns the returned string.
+  char* hand_off(int fd, char* buf, size_t len);
+
+  // waits until no buffer is posted or being written; returns and clears
+  // a pending write error, if any. The caller owns the returned string.
+  char* drain();
+};
+
+DumpWriterFlusher* DumpWriterFlusher::_instance = NULL;
+
+DumpWriterFlusher* DumpWriterFlusher::instance() {
+  if (_instance == NULL) {
+    // Only reached from inside the dump VM operation, so creation is
+    // single-threaded, see DumpWriter::start_async_flushing().
+    DumpWriterFlusher* t = new DumpWriterFlusher();
+    if (os::create_thread(t, os::os_thread)) {
+      os::start_thread(t);
+      _instance = t;
+    } else {
+      delete t;
+    }
+  }
+  return _instance;
+}
+
+void DumpWriterFlusher::run() {
+  initialize_thread_local_storage();
+  record_stack_base_and_size();
+  for (;;) {
+    int fd;
+    char* buf;
+    size_t len;
+    {
+      MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+      while (_buf == NULL) {
+        _lock->wait(Mutex::_no_safepoint_check_flag);
+      }
+      fd = _fd;
+      buf = _buf;
+      len = _len;
+      _buf = NULL;
+      _writing = true;
+    }
+
+    char* error = NULL;
+    const char* pos = buf;
+    while (len > 0) {
+      uint tmp = (uint)MIN2(len, (size_t)UINT_MAX);
+      ssize_t n = ::write(fd, pos, tmp);
+      if (n < 0) {
+        error = (char*)os::strdup(strerror(errno));
+        break;
+      }
+      pos += n;
+      len -= n;
+    }
+
+    {
+      MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+      _writing = false;
+      if (error != NULL) {
+        if (_error == NULL) {
+          _error = error;
+        } else {
+          os::free(error);
+        }
+      }
+      _lock->notify_all();
+    }
+  }
+}
+
+char* DumpWriterFlusher::hand_off(int fd, char* buf, size_t len) {
+  MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+  while (_buf != NULL || _writing) {
+    _lock->wait(Mutex::_no_safepoint_check_flag);
+  }
+  if (_error != NULL) {
+    char* error = _error;
+    _error = NULL;
+    return error;
+  }
+  _fd = fd;
+  _buf = buf;
+  _len = len;
+  _lock->notify_all();
+  return NULL;
+}
+
+char* DumpWriterFlusher::drain() {
+  MutexLockerEx ml(_lock, Mutex::_no_safepoint_check_flag);
+  while (_buf != NULL || _writing) {
+    _lock->wait(Mutex::_no_safepoint_check_flag);
+  }
+  char* error = _error;
+  _error = NULL;
+  return error;
+}
+
 // Supports I/O operations on a dump file
 
 class DumpWriter : public StackObj {
@@ -381,6 +514,9 @@ class DumpWriter : public StackObj {
   size_t _size;
   size_t _pos;
 
+  char* _other_buffer;          // second buffer when flushing asynchronously
+  DumpWriterFlusher* _flusher;  // background flusher, NULL when synchronous
+
   jlong _dump_start;
 
   char* _error;   // error message when I/O fails
@@ -395,7 +531,14 @@ class DumpWriter : public StackObj {
 
   void set_error(const char* error)             { _error = (char*)os::strdup(error); }
 
-  // all I/O go through this function
+  bool is_async() const                         { return _flusher != NULL; }
+  // record a flusher error and give up on the dump file
+  void handle_flusher_error(char* error);
+  // wait out any in-flight background write; all I/O that bypasses the
+  // buffer swap (seeks, oversized writes, closing) must be ordered after it
+  void drain_flusher();
+
+  // all synchronous I/O go through this function
   void write_internal(void* s, size_t len);
 
  public:
@@ -406,6 +549,9 @@ class DumpWriter : public StackObj {
   bool is_open() const                  { return file_descriptor() >= 0; }
   void flush();
 
+  // engage background flushing, called from inside the dump VM operation
+  void start_async_flushing();
+
   jlong dump_start() const                      { return _dump_start; }
   void set_dump_start(jlong pos);
   julong current_record_length();
@@ -449,6 +595,8 @@ DumpWriter::DumpWriter(const char* path) {
   } while (_buffer == NULL && _size > 0);
   assert((_size > 0 && _buffer != NULL) || (_size == 0 && _buffer == NULL), "sanity check");
   _pos = 0;
+  _other_buffer = NULL;
+  _flusher = NULL;
   _error = NULL;
   _bytes_written = 0L;
   _dump_start = (jlong)-1;
@@ -466,6 +614,7 @@ DumpWriter::~DumpWriter() {
     close();
   }
   if (_buffer != NULL) os::free(_buffer);
+  if (_other_buffer != NULL) os::free(_other_buffer);
   if (_error != NULL) os::free(_error);
 }
 
@@ -474,11 +623,45 @@ void DumpWriter::close() {
   // flush and close dump file
   if (is_open()) {
     flush();
+    drain_flusher();
+  }
+  if (is_open()) {
     ::close(file_descriptor());
     set_file_descriptor(-1);
   }
 }
 
+void DumpWriter::start_async_flushing() {
+  assert(SafepointSynchronize::is_at_safepoint(), "flusher creation must be serialized");
+  if (!HeapDumpAsyncIO || !is_open() || _buffer == NULL) {
+    return;
+  }
+  DumpWriterFlusher* flusher = DumpWriterFlusher::instance();
+  if (flusher == NULL) {
+    return;  // could not start the flusher thread, stay synchronous
+  }
+  _other_buffer = (char*)os::malloc(_size, mtInternal);
+  if (_other_buffer != NULL) {
+    _flusher = flusher;
+  }
+}
+
+void DumpWriter::handle_flusher_error(char* error) {
+  set_error(error);
+  os::free(error);
+  ::close(file_descriptor());
+  set_file_descriptor(-1);
+}
+
+void DumpWriter::drain_flusher() {
+  if (is_async() && is_open()) {
+    char* error = _flusher->drain();
+    if (error != NULL) {
+      handle_flusher_error(error);
+    }
+  }
+}
+
 // sets the dump starting position
 void DumpWriter::set_dump_start(jlong pos) {
   _dump_start = pos;
@@ -497,6 +680,7 @@ julong DumpWriter::current_record_length() {
 
 // write directly to the file
 void DumpWriter::write_internal(void* s, size_t len) {
+  drain_flusher();
   if (is_open()) {
     const char* pos = (char*)s;
     ssize_t n = 0;
@@ -540,12 +724,28 @@ void DumpWriter::write_raw(void* s, size_t len) {
 // flush any buffered bytes to the file
 void DumpWriter::flush() {
   if (is_open() && position() > 0) {
-    write_internal(buffer(), position());
-    set_position(0);
+    if (is_async()) {
+      // Post the full buffer and keep going in the other one; the hand-off
+      // blocks only while the previously posted buffer is still in flight.
+      char* error = _flusher->hand_off(file_descriptor(), buffer(), position());
+      if (error != NULL) {
+        handle_flusher_error(error);
+        return;
+      }
+      _bytes_written += position();
+      char* tmp = _buffer;
+      _buffer = _other_buffer;
+      _other_buffer = tmp;
+      set_position(0);
+    } else {
+      write_internal(buffer(), position());
+      set_position(0);
+    }
   }
 }
 
 jlong DumpWriter::current_offset() {
+  drain_flusher();
   if (is_open()) {
     // the offset is the file offset plus whatever we have buffered
     jlong offset = os::current_file_offset(file_descriptor());
@@ -559,8 +759,9 @@ jlong DumpWriter::current_offset() {
 void DumpWriter::seek_to_offset(jlong off) {
   assert(off >= 0, "bad offset");
 
-  // need to flush before seeking
+  // need to flush (and wait out any background write) before seeking
   flush();
+  drain_flusher();
 
   // may be closed due to I/O error
   if (is_open()) {
@@ -1806,6 +2007,9 @@ void VM_HeapDumper::doit() {
   set_global_dumper();
   set_global_writer();
 
+  // Overlap dump file writes with the heap walk from here on.
+  writer()->start_async_flushing();
+
   // Write the file header - we always use 1.0.2
   size_t used = ch->used();
   const char* header = "JAVA PROFILE 1.0.2";
@@ -25,6 +25,7 @@
 
 #include "runtime/atomic.hpp"
 #include "runtime/atomic.inline.hpp"
+#include "runtime/os.hpp"
 #include "services/mallocSiteTable.hpp"
 #include "services/mallocTracker.hpp"
 #include "services/mallocTracker.inline.hpp"
@@ -32,6 +33,50 @@
 
 size_t MallocMemorySummary::_snapshot[CALC_OBJ_SIZE_IN_TYPE(MallocMemorySnapshot, size_t)];
 
+MallocCounterStripes::Stripe MallocCounterStripes::_stripes[MallocCounterStripes::stripe_count];
+
+// Thread ids are pointer-like values on most platforms and have many
+// zero low bits, so fold higher bits in before masking.
+int MallocCounterStripes::current_stripe() {
+  uintx id = (uintx)os::current_thread_id();
+  return (int)((id ^ (id >> 8) ^ (id >> 16)) & (stripe_count - 1));
+}
+
+size_t MallocCounterStripes::header_size() {
+  MemoryCounterType size = 0;
+  for (int i = 0; i < stripe_count; i ++) {
+    size += _stripes[i]._header._size;
+  }
+  // Reads race with concurrent updates; clamp a transiently negative sum
+  // instead of wrapping it around.
+  return (size > 0) ? (size_t)size : 0;
+}
+
+void MallocCounterStripes::fold_into(MallocMemorySnapshot* s) {
+  for (int index = 0; index < mt_number_of_types; index ++) {
+    MemoryCounterType count = 0;
+    MemoryCounterType size  = 0;
+    for (int i = 0; i < stripe_count; i ++) {
+      count += _stripes[i]._malloc[index]._count;
+      size  += _stripes[i]._malloc[index]._size;
+    }
+    // A free can be observed on an already-summed stripe after its malloc
+    // landed on a stripe not yet read; clamp transiently negative sums.
+    MemoryCounter* c = &s->_malloc[index]._malloc;
+    c->_count += (count > 0) ? (size_t)count : 0;
+    c->_size  += (size  > 0) ? (size_t)size  : 0;
+  }
+
+  MemoryCounterType hcount = 0;
+  MemoryCounterType hsize  = 0;
+  for (int i = 0; i < stripe_count; i ++) {
+    hcount += _stripes[i]._header._count;
+    hsize  += _stripes[i]._header._size;
+  }
+  s->_tracking_header._count += (hcount > 0) ? (size_t)hcount : 0;
+  s->_tracking_header._size  += (hsize  > 0) ? (size_t)hsize  : 0;
+}
+
 // Total malloc'd memory amount
 size_t MallocMemorySnapshot::total() const {
   size_t amount = 0;
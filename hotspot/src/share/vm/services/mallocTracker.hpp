@@ -32,12 +32,15 @@
 #include "services/nmtCommon.hpp"
 #include "utilities/nativeCallStack.hpp"
 
+class MallocCounterStripes;
+
 /*
  * This counter class counts memory allocation and deallocation,
  * records total memory allocation size and number of allocations.
  * The counters are updated atomically.
  */
 class MemoryCounter VALUE_OBJ_CLASS_SPEC {
+  friend class MallocCounterStripes;
  private:
   size_t   _count;
   size_t   _size;
@@ -90,6 +93,7 @@ class MemoryCounter VALUE_OBJ_CLASS_SPEC {
  * call and arena's backing memory.
  */
 class MallocMemory VALUE_OBJ_CLASS_SPEC {
+  friend class MallocCounterStripes;
  private:
   MemoryCounter _malloc;
   MemoryCounter _arena;
@@ -132,6 +136,7 @@ class MallocMemorySummary;
 // usage by types and memory used by tracking itself.
 class MallocMemorySnapshot : public ResourceObj {
   friend class MallocMemorySummary;
+  friend class MallocCounterStripes;
 
  private:
   MallocMemory      _malloc[mt_number_of_types];
@@ -176,6 +181,79 @@ class MallocMemorySnapshot : public ResourceObj {
   void make_adjustment();
 };
 
+/*
+ * Striped counters for the malloc/free hot path.
+ *
+ * Funneling every os::malloc() and os::free() through a single set of
+ * atomic counters causes heavy cache line ping-pong on malloc-intensive
+ * multi-threaded workloads. Instead, per-allocation updates are spread
+ * over a small set of stripes selected by a hash of the current thread.
+ * A stripe accumulates signed deltas and may go negative on its own when
+ * memory is freed by a different thread than allocated it; only the sum
+ * over all stripes is meaningful. The deltas are folded into a
+ * MallocMemorySnapshot when one is taken, so the aggregation cost is paid
+ * by the read side (jcmd VM.native_memory), not by the allocation path.
+ *
+ * Arena accounting stays on the shared counters, since arena chunk
+ * operations are far less frequent than raw mallocs.
+ */
+class MallocCounterStripes : AllStatic {
+ private:
+  enum { stripe_count = 16 };
+
+  struct TypeDelta {
+    volatile MemoryCounterType _count;
+    volatile MemoryCounterType _size;
+  };
+
+  struct Stripe {
+    TypeDelta _malloc[mt_number_of_types];
+    TypeDelta _header;
+    // Keep neighboring stripes on distinct cache lines.
+    char      _pad[DEFAULT_CACHE_LINE_SIZE];
+  };
+
+  static Stripe _stripes[stripe_count];
+
+  // Map the current thread onto a stripe.
+  static int current_stripe();
+
+ public:
+  static inline void record_malloc(size_t sz, MEMFLAGS flags) {
+    TypeDelta* d = &_stripes[current_stripe()]._malloc[NMTUtil::flag_to_index(flags)];
+    Atomic::add(1, &d->_count);
+    if (sz > 0) {
+      Atomic::add((MemoryCounterType)sz, &d->_size);
+    }
+  }
+
+  static inline void record_free(size_t sz, MEMFLAGS flags) {
+    TypeDelta* d = &_stripes[current_stripe()]._malloc[NMTUtil::flag_to_index(flags)];
+    Atomic::add(-1, &d->_count);
+    if (sz > 0) {
+      Atomic::add(-(MemoryCounterType)sz, &d->_size);
+    }
+  }
+
+  static inline void record_new_header(size_t sz) {
+    TypeDelta* d = &_stripes[current_stripe()]._header;
+    Atomic::add(1, &d->_count);
+    Atomic::add((MemoryCounterType)sz, &d->_size);
+  }
+
+  static inline void record_free_header(size_t sz) {
+    TypeDelta* d = &_stripes[current_stripe()]._header;
+    Atomic::add(-1, &d->_count);
+    Atomic::add(-(MemoryCounterType)sz, &d->_size);
+  }
+
+  // Memory used by malloc tracking headers, summed across stripes.
+  static size_t header_size();
+
+  // Add the accumulated deltas into a snapshot copy.
+  static void fold_into(MallocMemorySnapshot* s);
+};
+
 /*
  * This class is for collecting malloc statistics at summary level
  */
@@ -188,11 +266,11 @@ class MallocMemorySummary : AllStatic {
    static void initialize();
 
    static inline void record_malloc(size_t size, MEMFLAGS flag) {
-     as_snapshot()->by_type(flag)->record_malloc(size);
+     MallocCounterStripes::record_malloc(size, flag);
    }
 
    static inline void record_free(size_t size, MEMFLAGS flag) {
-     as_snapshot()->by_type(flag)->record_free(size);
+     MallocCounterStripes::record_free(size, flag);
    }
 
    static inline void record_new_arena(MEMFLAGS flag) {
@@ -209,21 +287,24 @@ class MallocMemorySummary : AllStatic {
 
    static void snapshot(MallocMemorySnapshot* s) {
      as_snapshot()->copy_to(s);
+     // Striped deltas must be folded in before the arena adjustment,
+     // which rewrites the mtChunk malloc counter.
+     MallocCounterStripes::fold_into(s);
      s->make_adjustment();
    }
 
    // Record memory used by malloc tracking header
    static inline void record_new_malloc_header(size_t sz) {
-     as_snapshot()->malloc_overhead()->allocate(sz);
+     MallocCounterStripes::record_new_header(sz);
    }
 
    static inline void record_free_malloc_header(size_t sz) {
-     as_snapshot()->malloc_overhead()->deallocate(sz);
+     MallocCounterStripes::record_free_header(sz);
    }
 
    // The memory used by malloc tracking headers
    static inline size_t tracking_overhead() {
-     return as_snapshot()->malloc_overhead()->size();
+     return MallocCounterStripes::header_size();
    }
 
   static MallocMemorySnapshot* as_snapshot() {
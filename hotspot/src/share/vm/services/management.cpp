@@ -53,6 +53,7 @@
 #include "services/memoryPool.hpp"
 #include "services/memoryService.hpp"
 #include "services/runtimeService.hpp"
+#include "services/threadAllocationTable.hpp"
 #include "services/threadService.hpp"
 #include "utilities/macros.hpp"
 
@@ -82,6 +83,7 @@ void management_init() {
 #if INCLUDE_MANAGEMENT
   Management::init();
   ThreadService::init();
+  ThreadAllocationTable::init();
   RuntimeService::init();
   ClassLoadingService::init();
 #else
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/javaClasses.hpp"
+#include "runtime/atomic.inline.hpp"
+#include "runtime/orderAccess.inline.hpp"
+#include "runtime/perfData.hpp"
+#include "runtime/thread.inline.hpp"
+#include "services/threadAllocationTable.hpp"
+
+ThreadAllocationTable::Slot* ThreadAllocationTable::_table = NULL;
+int ThreadAllocationTable::_capacity = 0;
+
+void ThreadAllocationTable::init() {
+  if (!UseThreadAllocationTable) {
+    return;
+  }
+  EXCEPTION_MARK;
+
+  _capacity = (int)ThreadAllocationTableSize;
+  _table = NEW_C_HEAP_ARRAY(Slot, _capacity, mtInternal);
+  memset((void*)_table, 0, _capacity * sizeof(Slot));
+
+  // publish the table geometry for out-of-band readers
+  PerfDataManager::create_long_constant(SUN_THREADS,
+                                        "allocatedBytesTable.address",
+                                        PerfData::U_None,
+                                        (jlong)(uintptr_t)_table, CHECK);
+  PerfDataManager::create_long_constant(SUN_THREADS,
+                                        "allocatedBytesTable.slots",
+                                        PerfData::U_None,
+                                        (jlong)_capacity, CHECK);
+  PerfDataManager::create_long_constant(SUN_THREADS,
+                                        "allocatedBytesTable.slotSize",
+                                        PerfData::U_Bytes,
+                                        (jlong)sizeof(Slot), CHECK);
+}
+
+void ThreadAllocationTable::thread_started(JavaThread* thread) {
+  if (!is_enabled()) {
+    return;
+  }
+  oop thread_obj = thread->threadObj();
+  assert(thread_obj != NULL, "must have a java.lang.Thread");
+  const jlong tid = java_lang_Thread::thread_id(thread_obj);
+  assert(tid != 0, "invalid thread id");
+
+  for (int i = 0; i < _capacity; i++) {
+    Slot* slot = &_table[i];
+    if (slot->_thread_id == 0 &&
+        Atomic::cmpxchg(tid, &slot->_thread_id, (jlong)0) == 0) {
+      slot->_allocated_bytes = thread->allocated_bytes();
+      thread->set_published_allocated_bytes(&slot->_allocated_bytes);
+      return;
+    }
+  }
+  // table full; this thread is not exported
+}
+
+void ThreadAllocationTable::thread_exiting(JavaThread* thread) {
+  volatile jlong* published = thread->published_allocated_bytes();
+  if (published == NULL) {
+    return;
+  }
+  thread->set_published_allocated_bytes(NULL);
+  Slot* slot = (Slot*)((address)published - offset_of(Slot, _allocated_bytes));
+  *published = thread->allocated_bytes();
+  // the release keeps the final tally ahead of the slot becoming claimable
+  OrderAccess::release_store(&slot->_thread_id, (jlong)0);
+}
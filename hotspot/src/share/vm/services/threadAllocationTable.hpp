@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_SERVICES_THREADALLOCATIONTABLE_HPP
+#define SHARE_VM_SERVICES_THREADALLOCATIONTABLE_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class JavaThread;
+
+// Lock-free export of per-thread allocated bytes, enabled with
+// -XX:+UseThreadAllocationTable. Each JavaThread claims a slot keyed by its
+// java.lang.Thread id and pushes its cumulative allocated bytes into the
+// slot from Thread::incr_allocated_bytes, i.e. at TLAB-retirement
+// granularity. This gives in-process samplers the same figure as
+// ThreadMXBean.getThreadAllocatedBytes without taking the Threads_lock or
+// going through the JMX stack.
+//
+// The table address, slot count and slot size are published as the
+// jvmstat constants sun.threads.allocatedBytesTable.{address,slots,
+// slotSize}, so a reader can wrap the table in a direct ByteBuffer (or
+// read it with Unsafe) and scan for its thread id. Slots are cache-line
+// sized to keep writers from false sharing. A slot holds a zero thread id
+// while free; values are plain jlong stores, so 32-bit readers can
+// observe torn values, the same caveat as for jvmstat counters.
+
+class ThreadAllocationTable : AllStatic {
+ private:
+  struct Slot {
+    volatile jlong _thread_id;        // java.lang.Thread id, 0 when free
+    volatile jlong _allocated_bytes;
+    char           _pad[DEFAULT_CACHE_LINE_SIZE - 2 * sizeof(jlong)];
+  };
+
+  static Slot* _table;
+  static int   _capacity;
+
+ public:
+  static void init();
+  static bool is_enabled() { return _table != NULL; }
+
+  // claims a slot for the thread and starts publishing into it; the thread
+  // is simply not exported when the table is full
+  static void thread_started(JavaThread* thread);
+
+  // publishes the final tally and recycles the slot
+  static void thread_exiting(JavaThread* thread);
+};
+
+#endif // SHARE_VM_SERVICES_THREADALLOCATIONTABLE_HPP
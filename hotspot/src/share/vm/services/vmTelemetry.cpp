@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "code/codeCache.hpp"
+#include "compiler/compileBroker.hpp"
+#include "memory/universe.hpp"
+#include "runtime/orderAccess.inline.hpp"
+#include "runtime/os.hpp"
+#include "runtime/task.hpp"
+#include "services/runtimeService.hpp"
+#include "services/vmTelemetry.hpp"
+#include "utilities/ostream.hpp"
+
+VMTelemetryTask*   VMTelemetry::_task    = NULL;
+VMTelemetrySample* VMTelemetry::_samples = NULL;
+jint               VMTelemetry::_length  = 0;
+volatile jint      VMTelemetry::_count   = 0;
+
+class VMTelemetryTask : public PeriodicTask {
+ public:
+  VMTelemetryTask(int interval_time) : PeriodicTask(interval_time) {}
+  void task() { VMTelemetry::collect_sample(); }
+};
+
+/*
+ * The sampled values are all cheap, approximate reads of counters that
+ * their owners update concurrently; no locks are taken and no safepoint
+ * is requested, so sampling does not perturb the VM it is observing.
+ */
+void VMTelemetry::collect_sample() {
+  jint count = _count;
+  VMTelemetrySample* s = &_samples[count % _length];
+
+  s->_timestamp_ms           = (jlong)(os::elapsedTime() * 1000.0);
+  s->_safepoint_count        = RuntimeService::safepoint_count();
+  s->_safepoint_sync_time_ms = RuntimeService::safepoint_sync_time_ms();
+  s->_heap_used              = (jlong)Universe::heap()->used();
+  s->_heap_capacity          = (jlong)Universe::heap()->capacity();
+  s->_gc_count               = (jlong)Universe::heap()->total_collections();
+  s->_code_cache_capacity    = (jlong)CodeCache::capacity();
+  s->_code_cache_used        = (jlong)(CodeCache::capacity() - CodeCache::unallocated_capacity());
+  s->_c1_compile_queue_size  = (jint)CompileBroker::queue_size(CompLevel_simple);
+  s->_c2_compile_queue_size  = (jint)CompileBroker::queue_size(CompLevel_full_optimization);
+
+  // Publish the filled slot before advancing the count, so a concurrent
+  // exporter never reads an unwritten record.
+  OrderAccess::release_store(&_count, count + 1);
+}
+
+void VMTelemetry::engage() {
+  assert(!is_active(), "VM telemetry already engaged");
+
+  _length  = (jint)MAX2(VMTelemetryBufferEntries, (uintx)1);
+  _samples = NEW_C_HEAP_ARRAY(VMTelemetrySample, _length, mtInternal);
+  memset((void*)_samples, 0, _length * sizeof(VMTelemetrySample));
+
+  _task = new VMTelemetryTask((int)VMTelemetryInterval);
+  _task->enroll();
+}
+
+void VMTelemetry::disengage() {
+  if (!is_active()) return;
+
+  _task->disenroll();
+  delete _task;
+  _task = NULL;
+}
+
+// Export format (native endianness):
+//   u4 magic ('V' 'M' 'T' 'L' as 0x564d544c)
+//   u4 version (currently 1)
+//   u4 size of one record in bytes
+//   u4 number of records
+// followed by the records, oldest first. Readers should use the record
+// size from the header rather than their own notion of the layout, so
+// fields can be appended without breaking old tooling.
+int VMTelemetry::export_binary(const char* path) {
+  assert(is_active(), "VM telemetry not engaged");
+
+  fileStream fs(path, "wb");
+  if (!fs.is_open()) {
+    return -1;
+  }
+
+  jint count = OrderAccess::load_acquire(&_count);
+  jint records = MIN2(count, _length);
+  jint start = (count >= _length) ? (count % _length) : 0;
+
+  juint header[4];
+  header[0] = 0x564d544c;  // 'VMTL'
+  header[1] = 1;
+  header[2] = (juint)sizeof(VMTelemetrySample);
+  header[3] = (juint)records;
+  fs.write((const char*)header, sizeof(header));
+
+  // The sampler keeps running while we copy: a sample taken during the
+  // export overwrites the slot holding the oldest record, so that one
+  // record may be torn. Tolerable for incident analysis; everything
+  // newer is stable because only slots at _count and beyond are reused.
+  for (jint i = 0; i < records; i++) {
+    VMTelemetrySample* s = &_samples[(start + i) % _length];
+    fs.write((const char*)s, sizeof(VMTelemetrySample));
+  }
+  fs.flush();
+  return (int)records;
+}
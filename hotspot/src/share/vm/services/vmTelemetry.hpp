@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_SERVICES_VMTELEMETRY_HPP
+#define SHARE_VM_SERVICES_VMTELEMETRY_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class VMTelemetryTask;
+
+// One periodic sample of VM internals. All fields are fixed-width so the
+// ring buffer can be exported verbatim as a stream of binary records
+// (native endianness; the header written by export_binary() carries the
+// record size so readers can skip fields they do not know).
+struct VMTelemetrySample VALUE_OBJ_CLASS_SPEC {
+  jlong _timestamp_ms;            // milliseconds since VM start
+  jlong _safepoint_count;         // cumulative number of safepoints
+  jlong _safepoint_sync_time_ms;  // cumulative time-to-safepoint
+  jlong _heap_used;               // bytes
+  jlong _heap_capacity;           // bytes
+  jlong _gc_count;                // cumulative collections
+  jlong _code_cache_used;         // bytes
+  jlong _code_cache_capacity;     // bytes
+  jint  _c1_compile_queue_size;
+  jint  _c2_compile_queue_size;
+};
+
+/*
+ * VMTelemetry retains the last VMTelemetryBufferEntries samples of VM
+ * internals, taken every VMTelemetryInterval milliseconds by a
+ * PeriodicTask on the WatcherThread. The ring has a single writer and is
+ * read without locking: the writer publishes the sample count with a
+ * releasing store after filling a slot, so an exporter racing with the
+ * sampler can at worst observe a torn copy of the oldest record.
+ *
+ * The ring exists to answer "what was the VM doing for the last N
+ * seconds" after an incident, without the cost and gaps of scraping
+ * PerfData from outside. It is exported with jcmd VM.telemetry.
+ */
+class VMTelemetry : AllStatic {
+  friend class VMTelemetryTask;
+
+ private:
+  static VMTelemetryTask*   _task;
+  static VMTelemetrySample* _samples;
+  static jint               _length;
+  static volatile jint      _count;    // samples taken since engage()
+
+  static void collect_sample();
+
+ public:
+  // Start/stop the sampler
+  static void engage();
+  static void disengage();
+
+  static bool is_active() { return _task != NULL; }
+
+  // Write the ring contents, oldest sample first, as a binary file:
+  // a fixed-size header followed by raw VMTelemetrySample records.
+  // Returns the number of records written, or -1 if the file could
+  // not be opened.
+  static int export_binary(const char* path);
+};
+
+#endif // SHARE_VM_SERVICES_VMTELEMETRY_HPP
@@ -484,53 +484,46 @@ bool BitMap::iterate(BitMapClosure* blk, idx_t leftOffset, idx_t rightOffset) {
   return true;
 }
 
-BitMap::idx_t* BitMap::_pop_count_table = NULL;
-
-void BitMap::init_pop_count_table() {
-  if (_pop_count_table == NULL) {
-    BitMap::idx_t *table = NEW_C_HEAP_ARRAY(idx_t, 256, mtInternal);
-    for (uint i = 0; i < 256; i++) {
-      table[i] = num_set_bits(i);
-    }
-
-    intptr_t res = Atomic::cmpxchg_ptr((intptr_t)  table,
-                                       (intptr_t*) &_pop_count_table,
-                                       (intptr_t)  NULL_WORD);
-    if (res != NULL_WORD) {
-      guarantee( _pop_count_table == (void*) res, "invariant" );
-      FREE_C_HEAP_ARRAY(bm_word_t, table, mtInternal);
-    }
-  }
+BitMap::idx_t BitMap::pop_count(bm_word_t w) {
+  // Parallel bit count (Hacker's Delight, figure 5-2). The constants keep
+  // their pattern when truncated, so this is correct for 32 bit words too.
+  const bm_word_t m1  = (bm_word_t)UCONST64(0x5555555555555555);
+  const bm_word_t m2  = (bm_word_t)UCONST64(0x3333333333333333);
+  const bm_word_t m4  = (bm_word_t)UCONST64(0x0f0f0f0f0f0f0f0f);
+  const bm_word_t h01 = (bm_word_t)UCONST64(0x0101010101010101);
+  w -= (w >> 1) & m1;
+  w = (w & m2) + ((w >> 2) & m2);
+  w = (w + (w >> 4)) & m4;
+  return (idx_t)((w * h01) >> (BitsPerWord - 8));
 }
 
-BitMap::idx_t BitMap::num_set_bits(bm_word_t w) {
-  idx_t bits = 0;
-
-  while (w != 0) {
-    while ((w & 1) == 0) {
-      w >>= 1;
-    }
-    bits++;
-    w >>= 1;
+BitMap::idx_t BitMap::count_one_bits() const {
+  idx_t sum = 0;
+  for (idx_t i = 0; i < size_in_words(); i++) {
+    sum += pop_count(map()[i]);
   }
-  return bits;
-}
-
-BitMap::idx_t BitMap::num_set_bits_from_table(unsigned char c) {
-  assert(_pop_count_table != NULL, "precondition");
-  return _pop_count_table[c];
+  return sum;
 }
 
-BitMap::idx_t BitMap::count_one_bits() const {
-  init_pop_count_table(); // If necessary.
+BitMap::idx_t BitMap::count_one_bits(idx_t beg, idx_t end) const {
+  verify_range(beg, end);
+  if (beg == end) {
+    return 0;
+  }
+  const idx_t beg_word = word_index(beg);
+  const idx_t end_word = word_index(end - 1);
   idx_t sum = 0;
-  typedef unsigned char uchar;
-  for (idx_t i = 0; i < size_in_words(); i++) {
-    bm_word_t w = map()[i];
-    for (size_t j = 0; j < sizeof(bm_word_t); j++) {
-      sum += num_set_bits_from_table(uchar(w & 255));
-      w >>= 8;
+  for (idx_t i = beg_word; i <= end_word; i++) {
+    bm_word_t w = map(i);
+    if (i == beg_word) {
+      // drop the bits below beg; a no-op when beg is word aligned
+      w &= ~(bit_mask(beg) - 1);
+    }
+    if (i == end_word && bit_in_word(end) != 0) {
+      // drop the bits at and above end
+      w &= bit_mask(end) - 1;
     }
+    sum += pop_count(w);
   }
   return sum;
 }
@@ -112,10 +112,10 @@ class BitMap VALUE_OBJ_CLASS_SPEC {
     NOT_DEBUG_RETURN;
 
   // Statistics.
-  static idx_t* _pop_count_table;
-  static void init_pop_count_table();
-  static idx_t num_set_bits(bm_word_t w);
-  static idx_t num_set_bits_from_table(unsigned char c);
+  // Branch-free parallel-bits population count of a whole word; the plain
+  // loop over words in count_one_bits is auto-vectorizable, unlike the
+  // table-driven per-byte counting this replaced.
+  static idx_t pop_count(bm_word_t w);
 
  public:
 
@@ -237,6 +237,10 @@ class BitMap VALUE_OBJ_CLASS_SPEC {
   // Returns the number of bits set in the bitmap.
   idx_t count_one_bits() const;
 
+  // Returns the number of bits set in [beg, end), so that parallel
+  // audits can claim disjoint ranges and sum the partial counts.
+  idx_t count_one_bits(idx_t beg, idx_t end) const;
+
   // Set operations.
   void set_union(BitMap bits);
   void set_difference(BitMap bits);
@@ -239,6 +239,11 @@ public:
 
   void add_entry(int index, BasicHashtableEntry<F>* entry);
 
+  // As above, but for adders that are serialized per bucket (e.g. by
+  // striped locks) rather than by one table-wide lock: the shared entry
+  // counter is updated atomically.
+  void add_entry_par(int index, BasicHashtableEntry<F>* entry);
+
   void free_entry(BasicHashtableEntry<F>* entry);
 
   int number_of_entries() { return _number_of_entries; }
@@ -26,6 +26,7 @@
 #define SHARE_VM_UTILITIES_HASHTABLE_INLINE_HPP
 
 #include "memory/allocation.inline.hpp"
+#include "runtime/atomic.inline.hpp"
 #include "runtime/orderAccess.inline.hpp"
 #include "utilities/hashtable.hpp"
 #include "utilities/dtrace.hpp"
@@ -106,6 +107,12 @@ template <MEMFLAGS F> inline void BasicHashtable<F>::add_entry(int index, BasicH
   ++_number_of_entries;
 }
 
+template <MEMFLAGS F> inline void BasicHashtable<F>::add_entry_par(int index, BasicHashtableEntry<F>* entry) {
+  entry->set_next(bucket(index));
+  _buckets[index].set_entry(entry);
+  Atomic::inc(&_number_of_entries);
+}
+
 template <MEMFLAGS F> inline void BasicHashtable<F>::free_entry(BasicHashtableEntry<F>* entry) {
   entry->set_next(_free_list);
   _free_list = entry;
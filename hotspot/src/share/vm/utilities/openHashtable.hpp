@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_VM_UTILITIES_OPENHASHTABLE_HPP
+#define SHARE_VM_UTILITIES_OPENHASHTABLE_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// An open-addressing hashtable with Robin Hood probing and inline entry
+// storage, as an alternative to the chained Hashtable for small,
+// high-traffic VM tables. Entries live inside one contiguous C-heap
+// array, so a lookup touches consecutive cache lines instead of chasing
+// a per-entry allocation per probe. Robin Hood insertion keeps the
+// maximum probe distance short by displacing entries that sit closer to
+// their ideal slot, and removal uses backward-shift compaction, so the
+// table never accumulates tombstones.
+//
+// Keys are compared with operator== and hashed by the caller (pass the
+// same hash to find/add/remove for a given key). The table is not
+// synchronized; callers lock, exactly as with the chained Hashtable.
+// CAUTION: entries move on insertion and removal. A V* returned by
+// find() is invalidated by any subsequent modification of the table, so
+// it must not be cached across operations. Tables whose clients hold
+// entry pointers across lock release (e.g. placeholders) cannot use
+// this representation.
+template <typename K, typename V, MEMFLAGS F> class OpenHashtable : public CHeapObj<F> {
+ private:
+  struct Slot {
+    unsigned int _hash;
+    bool         _occupied;
+    K            _key;
+    V            _value;
+  };
+
+  Slot* _slots;
+  int   _capacity;    // always a power of two
+  int   _count;
+
+  int index_for(unsigned int hash) const {
+    return (int)(hash & (unsigned int)(_capacity - 1));
+  }
+
+  // Distance of the entry in slot_index from its ideal slot, in probes.
+  int probe_distance(unsigned int hash, int slot_index) const {
+    return (slot_index - index_for(hash) + _capacity) & (_capacity - 1);
+  }
+
+  static Slot* allocate_slots(int capacity) {
+    Slot* slots = NEW_C_HEAP_ARRAY(Slot, capacity, F);
+    for (int i = 0; i < capacity; i++) {
+      slots[i]._occupied = false;
+    }
+    return slots;
+  }
+
+  void insert_slot(unsigned int hash, const K& key, const V& value) {
+    unsigned int cur_hash = hash;
+    K cur_key = key;
+    V cur_value = value;
+    int ix = index_for(hash);
+    int dist = 0;
+    while (true) {
+      Slot* s = &_slots[ix];
+      if (!s->_occupied) {
+        s->_hash = cur_hash;
+        s->_key = cur_key;
+        s->_value = cur_value;
+        s->_occupied = true;
+        return;
+      }
+      const int resident_dist = probe_distance(s->_hash, ix);
+      if (resident_dist < dist) {
+        // Robin Hood: displace the resident that sits closer to its
+        // ideal slot and continue inserting the displaced entry.
+        unsigned int tmp_hash = s->_hash; s->_hash = cur_hash; cur_hash = tmp_hash;
+        K tmp_key = s->_key; s->_key = cur_key; cur_key = tmp_key;
+        V tmp_value = s->_value; s->_value = cur_value; cur_value = tmp_value;
+        dist = resident_dist;
+      }
+      ix = (ix + 1) & (_capacity - 1);
+      dist++;
+    }
+  }
+
+  void grow() {
+    Slot* const old_slots = _slots;
+    const int old_capacity = _capacity;
+    _capacity = old_capacity * 2;
+    _slots = allocate_slots(_capacity);
+    for (int i = 0; i < old_capacity; i++) {
+      if (old_slots[i]._occupied) {
+        insert_slot(old_slots[i]._hash, old_slots[i]._key, old_slots[i]._value);
+      }
+    }
+    FREE_C_HEAP_ARRAY(Slot, old_slots, F);
+  }
+
+ public:
+  OpenHashtable(int initial_size) : _count(0) {
+    // round the requested size up to a power of two
+    _capacity = 8;
+    while (_capacity < initial_size) {
+      _capacity *= 2;
+    }
+    _slots = allocate_slots(_capacity);
+  }
+
+  ~OpenHashtable() {
+    FREE_C_HEAP_ARRAY(Slot, _slots, F);
+  }
+
+  int number_of_entries() const { return _count; }
+
+  // Returns the value for key, or NULL if not present. The pointer is
+  // only valid until the next modification of the table.
+  V* find(unsigned int hash, const K& key) {
+    int ix = index_for(hash);
+    int dist = 0;
+    while (true) {
+      Slot* s = &_slots[ix];
+      if (!s->_occupied) {
+        return NULL;
+      }
+      if (probe_distance(s->_hash, ix) < dist) {
+        // the key would have displaced this richer resident
+        return NULL;
+      }
+      if (s->_hash == hash && s->_key == key) {
+        return &s->_value;
+      }
+      ix = (ix + 1) & (_capacity - 1);
+      dist++;
+    }
+  }
+
+  // Adds an entry; the key must not already be present.
+  void add(unsigned int hash, const K& key, const V& value) {
+    assert(find(hash, key) == NULL, "duplicate key");
+    if (_count * 4 >= _capacity * 3) {  // resize at 3/4 load
+      grow();
+    }
+    insert_slot(hash, key, value);
+    _count++;
+  }
+
+  // Removes the entry for key, if present. Returns whether an entry was
+  // removed. The vacated slot is compacted by shifting the displaced
+  // run back, leaving no tombstone behind.
+  bool remove(unsigned int hash, const K& key) {
+    int ix = index_for(hash);
+    int dist = 0;
+    while (true) {
+      Slot* s = &_slots[ix];
+      if (!s->_occupied || probe_distance(s->_hash, ix) < dist) {
+        return false;
+      }
+      if (s->_hash == hash && s->_key == key) {
+        break;
+      }
+      ix = (ix + 1) & (_capacity - 1);
+      dist++;
+    }
+    int next = (ix + 1) & (_capacity - 1);
+    while (_slots[next]._occupied && probe_distance(_slots[next]._hash, next) > 0) {
+      _slots[ix] = _slots[next];
+      ix = next;
+      next = (next + 1) & (_capacity - 1);
+    }
+    _slots[ix]._occupied = false;
+    _count--;
+    return true;
+  }
+
+  // Closure for unlink(); do_entry returns true if the entry is to be
+  // removed. Release any resources owned by the entry before returning
+  // true - the table only forgets the slot.
+  class UnlinkClosure : public StackObj {
+   public:
+    virtual bool do_entry(const K& key, V& value) = 0;
+  };
+
+  // Removes all entries the closure asks to remove. The survivors are
+  // reinserted into a fresh slot array, which also compacts the probe
+  // sequences; this is a bulk operation for safepoint-time purging.
+  void unlink(UnlinkClosure* cl) {
+    Slot* const old_slots = _slots;
+    const int old_capacity = _capacity;
+    _slots = allocate_slots(_capacity);
+    _count = 0;
+    for (int i = 0; i < old_capacity; i++) {
+      Slot* s = &old_slots[i];
+      if (s->_occupied && !cl->do_entry(s->_key, s->_value)) {
+        insert_slot(s->_hash, s->_key, s->_value);
+        _count++;
+      }
+    }
+    FREE_C_HEAP_ARRAY(Slot, old_slots, F);
+  }
+};
+
+#endif // SHARE_VM_UTILITIES_OPENHASHTABLE_HPP
@@ -186,6 +186,47 @@ private:
   void clear(bool clear_cache = false);
 };
 
+// Stack whose segments are carved out of pre-committed slabs owned by the
+// stack, instead of being malloc'ed one by one. Freed segments go onto a
+// local free list and are handed back out on later growth, so steady-state
+// traffic never reaches the C heap allocator, and slabs are kept until the
+// stack is destroyed. Intended for GC overflow stacks, where many workers
+// can hit the overflow path at once and contend on malloc.
+template <class E, MEMFLAGS F>
+class SlabStack: public Stack<E, F>
+{
+public:
+  // Segments per slab; with the default ~4K segment this pre-commits
+  // 256K per stack, enough for most marking bursts.
+  static const size_t _default_slab_segments = 64;
+
+  // The first slab is allocated eagerly, so the first overflow during a GC
+  // does not take an allocation hit.
+  inline SlabStack(size_t segment_size = Stack<E, F>::_default_segment_size,
+                   size_t slab_segments = _default_slab_segments);
+
+  // Segments on the free list live inside the slabs; release everything
+  // here, before the parent dtor hands them to Stack::free().
+  inline ~SlabStack();
+
+protected:
+  virtual E*   alloc(size_t bytes);
+  virtual void free(E* addr, size_t bytes);
+
+private:
+  // Slab header; the segment storage follows it.
+  struct Slab {
+    Slab* _next;
+  };
+
+  inline void add_slab();
+
+  const size_t _slab_segments; // Segments per slab.
+  Slab*        _slabs;         // All slabs, most recent first.
+  E*           _free_segs;     // Recycled segments, linked by the first word.
+  size_t       _next_unused;   // First never-used segment in the head slab.
+};
+
 template <class E, MEMFLAGS F>
 class StackIterator: public StackObj
 {
@@ -244,6 +244,74 @@ void ResourceStack<E, F>::free(E* addr, size_t bytes)
   resource_free_bytes((char*) addr, bytes);
 }
 
+template <class E, MEMFLAGS F>
+SlabStack<E, F>::SlabStack(size_t segment_size, size_t slab_segments):
+  // Pass max_cache_size == 0; recycling is done by the free list below, so
+  // the parent's segment cache would only add a second copy of the same
+  // mechanism.
+  Stack<E, F>(segment_size, 0),
+  _slab_segments(slab_segments),
+  _slabs(NULL),
+  _free_segs(NULL),
+  _next_unused(0)
+{
+  assert(_slab_segments > 0, "need at least one segment per slab");
+  add_slab();
+}
+
+template <class E, MEMFLAGS F>
+SlabStack<E, F>::~SlabStack()
+{
+  // Drop any remaining segments onto the free list now; once this dtor
+  // returns, the parent dtor's clear() would dispatch to Stack::free() and
+  // try to give slab memory back to the C heap.
+  this->clear(true);
+  Slab* slab = _slabs;
+  while (slab != NULL) {
+    Slab* const next = slab->_next;
+    FREE_C_HEAP_ARRAY(char, (char*) slab, F);
+    slab = next;
+  }
+  _slabs = NULL;
+  _free_segs = NULL;
+}
+
+template <class E, MEMFLAGS F>
+void SlabStack<E, F>::add_slab()
+{
+  const size_t bytes = sizeof(Slab) + _slab_segments * this->segment_bytes();
+  Slab* const slab = (Slab*) NEW_C_HEAP_ARRAY(char, bytes, F);
+  slab->_next = _slabs;
+  _slabs = slab;
+  _next_unused = 0;
+}
+
+template <class E, MEMFLAGS F>
+E* SlabStack<E, F>::alloc(size_t bytes)
+{
+  assert(bytes == this->segment_bytes(), "only segments are allocated here");
+  if (_free_segs != NULL) {
+    E* const seg = _free_segs;
+    _free_segs = *(E**) seg;
+    return seg;
+  }
+  if (_next_unused == _slab_segments) {
+    add_slab();
+  }
+  char* const base = (char*) _slabs + sizeof(Slab);
+  return (E*) (base + _next_unused++ * this->segment_bytes());
+}
+
+template <class E, MEMFLAGS F>
+void SlabStack<E, F>::free(E* addr, size_t bytes)
+{
+  assert(bytes == this->segment_bytes(), "only segments are freed here");
+  // Link through the first word of the segment; the memory is kept in the
+  // slab and reused by the next alloc().
+  *(E**) addr = _free_segs;
+  _free_segs = addr;
+}
+
 template <class E, MEMFLAGS F>
 void StackIterator<E, F>::sync()
 {
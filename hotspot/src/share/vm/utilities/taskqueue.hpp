@@ -139,6 +139,14 @@ protected:
                                           (intptr_t)old_age._data);
     }
 
+    // May fail spuriously: only usable where failure is already treated as
+    // losing the race, like pop_global. Same ordering as cmpxchg above.
+    bool cmpxchg_weak(const Age new_age, const Age old_age) volatile {
+      return Atomic::cmpxchg_ptr_weak((intptr_t)new_age._data,
+                                      (volatile intptr_t *)&_data,
+                                      (intptr_t)old_age._data);
+    }
+
     bool operator ==(const Age& other) const { return _data == other._data; }
 
   private:
@@ -421,12 +429,15 @@ bool GenericTaskQueue<E, F, N>::pop_global(volatile E& t) {
   (void) const_cast<E&>(t = _elems[oldAge.top()]);
   Age newAge(oldAge);
   newAge.increment();
-  Age resAge = _age.cmpxchg(newAge, oldAge);
+  // The weak form may fail spuriously, which is indistinguishable from
+  // another thread claiming the element first, and stealers already retry
+  // elsewhere on failure.
+  bool res = _age.cmpxchg_weak(newAge, oldAge);
 
   // Note that using "_bottom" here might fail, since a pop_local might
   // have decremented it.
   assert(dirty_size(localBot, newAge.top()) != N - 1, "sanity");
-  return resAge == oldAge;
+  return res;
 }
 
 template<class E, MEMFLAGS F, unsigned int N>
@@ -443,11 +454,15 @@ GenericTaskQueue<E, F, N>::~GenericTaskQueue() {}
 // Note that size() is not hidden--it returns the number of elements in the
 // TaskQueue, and does not include the size of the overflow stack.  This
 // simplifies replacement of GenericTaskQueues with OverflowTaskQueues.
-template<class E, MEMFLAGS F, unsigned int N = TASKQUEUE_SIZE>
+// The overflow stack type defaults to the malloc-backed Stack; queues on hot
+// GC paths pass SlabStack instead so overflow segments come from recycled
+// pre-committed slabs and workers do not contend on malloc.
+template<class E, MEMFLAGS F, unsigned int N = TASKQUEUE_SIZE,
+         class ST = Stack<E, F> >
 class OverflowTaskQueue: public GenericTaskQueue<E, F, N>
 {
 public:
-  typedef Stack<E, F>               overflow_t;
+  typedef ST                        overflow_t;
   typedef GenericTaskQueue<E, F, N> taskqueue_t;
 
   TASKQUEUE_STATS_ONLY(using taskqueue_t::stats;)
@@ -473,8 +488,8 @@ private:
   overflow_t _overflow_stack;
 };
 
-template <class E, MEMFLAGS F, unsigned int N>
-bool OverflowTaskQueue<E, F, N>::push(E t)
+template <class E, MEMFLAGS F, unsigned int N, class ST>
+bool OverflowTaskQueue<E, F, N, ST>::push(E t)
 {
   if (!taskqueue_t::push(t)) {
     overflow_stack()->push(t);
@@ -483,16 +498,16 @@ bool OverflowTaskQueue<E, F, N>::push(E t)
   return true;
 }
 
-template <class E, MEMFLAGS F, unsigned int N>
-bool OverflowTaskQueue<E, F, N>::pop_overflow(E& t)
+template <class E, MEMFLAGS F, unsigned int N, class ST>
+bool OverflowTaskQueue<E, F, N, ST>::pop_overflow(E& t)
 {
   if (overflow_empty()) return false;
   t = overflow_stack()->pop();
   return true;
 }
 
-template <class E, MEMFLAGS F, unsigned int N>
-bool OverflowTaskQueue<E, F, N>::try_push_to_taskqueue(E t) {
+template <class E, MEMFLAGS F, unsigned int N, class ST>
+bool OverflowTaskQueue<E, F, N, ST>::try_push_to_taskqueue(E t) {
   return taskqueue_t::push(t);
 }
 class TaskQueueSetSuper {
@@ -818,7 +833,10 @@ private:
 #pragma warning(pop)
 #endif
 
-typedef OverflowTaskQueue<StarTask, mtClass>           OopStarTaskQueue;
+// PSPromotionManager is the only client; its overflow stacks see the GC
+// worker storms, so back them with slab-allocated segments.
+typedef OverflowTaskQueue<StarTask, mtClass, TASKQUEUE_SIZE,
+                          SlabStack<StarTask, mtClass> > OopStarTaskQueue;
 typedef GenericTaskQueueSet<OopStarTaskQueue, mtClass> OopStarTaskQueueSet;
 
 typedef OverflowTaskQueue<size_t, mtInternal>             RegionTaskQueue;
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2018, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test BenchAllocReplay
+ * @summary Benchmark: replay an allocation-site mix as a synthetic mutator
+ * @key gc
+ *
+ * @run main/othervm/timeout=120 -Xmx1g -Xms1g -XX:+PrintGC
+ *      -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions
+ *      -XX:+UseShenandoahGC
+ *      BenchAllocReplay
+ */
+
+import java.io.BufferedReader;
+import java.io.FileReader;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Random;
+import java.util.concurrent.atomic.AtomicLong;
+
+public class BenchAllocReplay {
+
+    static class Site {
+        final int size;
+        final int weight;
+        final double survival;
+        Site(int size, int weight, double survival) {
+            this.size = size;
+            this.weight = weight;
+            this.survival = survival;
+        }
+    }
+
+    // Built-in mix, roughly a request-processing service: many small
+    // short-lived objects, fewer mid-size buffers, a trickle of large
+    // long-lived ones.
+    static final Site[] DEFAULT_MIX = {
+        new Site(32,     700, 0.01),
+        new Site(128,    200, 0.02),
+        new Site(1024,    70, 0.05),
+        new Site(8192,    25, 0.10),
+        new Site(65536,    4, 0.30),
+        new Site(524288,   1, 0.50),
+    };
+
+    static Site[] sites;
+    static int[] cumWeights;
+    static int totalWeight;
+
+    static volatile boolean stop;
+    static final AtomicLong allocatedBytes = new AtomicLong();
+
+    public static void main(String[] args) throws Exception {
+        loadSites();
+
+        int threads = Integer.getInteger("bench.threads",
+                Runtime.getRuntime().availableProcessors());
+        long durationMs = Long.getLong("bench.durationMs", 15000);
+
+        Thread[] workers = new Thread[threads];
+        for (int t = 0; t < threads; t++) {
+            workers[t] = new Thread(new Mutator(t));
+        }
+
+        long start = System.nanoTime();
+        for (Thread w : workers) w.start();
+        Thread.sleep(durationMs);
+        stop = true;
+        for (Thread w : workers) w.join();
+        long elapsedNs = System.nanoTime() - start;
+
+        double mb = allocatedBytes.get() / (1024.0 * 1024.0);
+        double secs = elapsedNs / 1e9;
+        System.out.println("BENCH alloc_replay threads=" + threads +
+                " sites=" + sites.length +
+                " allocated_mb=" + String.format("%.1f", mb) +
+                " mb_per_sec=" + String.format("%.1f", mb / secs));
+    }
+
+    static class Mutator implements Runnable {
+        final Random rng;
+        // Survivors parked here keep a bounded, churning live set.
+        final Object[] retained = new Object[4096];
+
+        Mutator(int id) {
+            rng = new Random(id * 0x9E3779B9L + 42);
+        }
+
+        public void run() {
+            long local = 0;
+            while (!stop) {
+                Site s = pick(rng.nextInt(totalWeight));
+                byte[] obj = new byte[s.size];
+                local += s.size;
+                if (rng.nextDouble() < s.survival) {
+                    retained[rng.nextInt(retained.length)] = obj;
+                }
+            }
+            allocatedBytes.addAndGet(local);
+        }
+    }
+
+    static Site pick(int roll) {
+        for (int i = 0; i < cumWeights.length; i++) {
+            if (roll < cumWeights[i]) {
+                return sites[i];
+            }
+        }
+        return sites[sites.length - 1];
+    }
+
+    static void loadSites() throws Exception {
+        String file = System.getProperty("bench.trace");
+        if (file == null) {
+            sites = DEFAULT_MIX;
+        } else {
+            List<Site> parsed = new ArrayList<Site>();
+            BufferedReader in = new BufferedReader(new FileReader(file));
+            try {
+                String line;
+                while ((line = in.readLine()) != null) {
+                    line = line.trim();
+                    if (line.isEmpty() || line.startsWith("#")) continue;
+                    String[] f = line.split("\\s+");
+                    parsed.add(new Site(Integer.parseInt(f[0]),
+                                        Integer.parseInt(f[1]),
+                                        Double.parseDouble(f[2])));
+                }
+            } finally {
+                in.close();
+            }
+            if (parsed.isEmpty()) {
+                throw new IllegalArgumentException("empty trace: " + file);
+            }
+            sites = parsed.toArray(new Site[0]);
+        }
+
+        cumWeights = new int[sites.length];
+        int sum = 0;
+        for (int i = 0; i < sites.length; i++) {
+            sum += sites[i].weight;
+            cumWeights[i] = sum;
+        }
+        totalWeight = sum;
+    }
+}
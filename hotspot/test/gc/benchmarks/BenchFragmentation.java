@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2018, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test BenchFragmentation
+ * @summary Benchmark: mixed-lifetime allocation with humongous churn
+ * @key gc
+ *
+ * @run main/othervm/timeout=120 -Xmx1g -Xms1g -XX:+PrintGC
+ *      -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions
+ *      -XX:+UseShenandoahGC
+ *      BenchFragmentation
+ */
+
+import java.util.Random;
+
+public class BenchFragmentation {
+
+    // Sliding window of mid-size survivors; random replacement punches
+    // holes across many regions at once.
+    static final int WINDOW = 8192;
+    static final Object[] window = new Object[WINDOW];
+
+    // A few humongous arrays (int[1M] is 4 MB, well above the humongous
+    // threshold at these region sizes), churned to force contiguous
+    // region allocation next to the fragmented window.
+    static final int HUMONGOUS_SLOTS = 16;
+    static final Object[] humongous = new Object[HUMONGOUS_SLOTS];
+
+    public static void main(String[] args) throws Exception {
+        long durationMs = Long.getLong("bench.durationMs", 15000);
+        Random rng = new Random(42);
+
+        long allocated = 0;
+        long humongousCount = 0;
+        long start = System.nanoTime();
+        long deadlineNs = start + durationMs * 1000000L;
+
+        while (System.nanoTime() < deadlineNs) {
+            for (int i = 0; i < 1024; i++) {
+                // Sizes spread over two orders of magnitude so freed slots
+                // rarely fit the next allocation exactly.
+                int size = 64 << rng.nextInt(8);
+                byte[] obj = new byte[size];
+                allocated += size;
+                window[rng.nextInt(WINDOW)] = obj;
+            }
+            if (rng.nextInt(8) == 0) {
+                humongous[rng.nextInt(HUMONGOUS_SLOTS)] = new int[1024 * 1024];
+                allocated += 4L * 1024 * 1024;
+                humongousCount++;
+            }
+        }
+        long elapsedNs = System.nanoTime() - start;
+
+        double mb = allocated / (1024.0 * 1024.0);
+        double secs = elapsedNs / 1e9;
+        System.out.println("BENCH fragmentation" +
+                " allocated_mb=" + String.format("%.1f", mb) +
+                " mb_per_sec=" + String.format("%.1f", mb / secs) +
+                " humongous_allocs=" + humongousCount);
+    }
+}
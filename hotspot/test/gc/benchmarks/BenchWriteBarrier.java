@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2018, Red Hat, Inc. All rights reserved.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test BenchWriteBarrier
+ * @summary Benchmark: reference-store throughput under the SATB and IU barriers
+ * @key gc
+ *
+ * @run main/othervm/timeout=120 -Xmx1g -Xms1g -XX:+PrintGC
+ *      -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions
+ *      -XX:+UseShenandoahGC -XX:ShenandoahGCMode=satb
+ *      BenchWriteBarrier satb
+ *
+ * @run main/othervm/timeout=120 -Xmx1g -Xms1g -XX:+PrintGC
+ *      -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions
+ *      -XX:+UseShenandoahGC -XX:ShenandoahGCMode=iu
+ *      BenchWriteBarrier iu
+ *
+ * @run main/othervm/timeout=120 -Xmx1g -Xms1g -XX:+PrintGC
+ *      -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions
+ *      -XX:+UseShenandoahGC -XX:ShenandoahGCMode=passive
+ *      BenchWriteBarrier passive
+ */
+
+import java.util.Random;
+
+public class BenchWriteBarrier {
+
+    static class Node {
+        Node next;
+        int payload;
+    }
+
+    static final int NODES = 1024 * 1024;
+
+    public static void main(String[] args) throws Exception {
+        String mode = args.length > 0 ? args[0] : "unknown";
+        long durationMs = Long.getLong("bench.durationMs", 15000);
+
+        Node[] nodes = new Node[NODES];
+        for (int i = 0; i < NODES; i++) {
+            nodes[i] = new Node();
+        }
+
+        // Background allocation keeps concurrent cycles coming, so the
+        // stores below run against active barriers, not just the
+        // out-of-cycle fast path.
+        Thread churn = new Thread(new Runnable() {
+            public void run() {
+                Object sink;
+                while (!Thread.currentThread().isInterrupted()) {
+                    sink = new byte[4096];
+                }
+            }
+        });
+        churn.setDaemon(true);
+        churn.start();
+
+        Random rng = new Random(42);
+        long stores = 0;
+        long start = System.nanoTime();
+        long deadlineNs = start + durationMs * 1000000L;
+
+        while (System.nanoTime() < deadlineNs) {
+            // Randomized cross-links: each store overwrites a non-null
+            // reference field, which is the expensive case for SATB
+            // (enqueue previous value) and IU (enqueue new value).
+            for (int i = 0; i < 64 * 1024; i++) {
+                nodes[rng.nextInt(NODES)].next = nodes[rng.nextInt(NODES)];
+            }
+            stores += 64 * 1024;
+        }
+        long elapsedNs = System.nanoTime() - start;
+        churn.interrupt();
+
+        double secs = elapsedNs / 1e9;
+        System.out.println("BENCH write_barrier mode=" + mode +
+                " stores=" + stores +
+                " mstores_per_sec=" + String.format("%.1f", stores / secs / 1e6));
+    }
+}
@@ -110,6 +110,9 @@ public class WhiteBox {
   public native MemoryUsage g1AuxiliaryMemoryUsage();
   public native Object[]    parseCommandLine(String commandline, DiagnosticCommand[] args);
 
+  // Shenandoah
+  public native void shenandoahScheduleGC(boolean start, long deferMillis);
+
   // NMT
   public native long NMTMalloc(long size);
   public native void NMTFree(long mem);